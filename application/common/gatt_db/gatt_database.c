@@ -74,6 +74,16 @@ typedef struct sizeCounterStruct_tag {
 #define localGattDbAttributeCount_d  ((sizeof(sizeCounterStruct_t))/4U)
 uint16_t gGattDbAttributeCount_c;
 
+/*! Declare structure to count the service declarations */
+typedef struct serviceCounterStruct_tag {
+#include "gatt_service_count_x.h"
+    uint32_t end_service;
+} serviceCounterStruct_t;
+
+/*! Size of the service index at compile time, one entry more than the services
+    so that the array is never empty */
+#define localGattDbServiceIndexSize_d  ((sizeof(serviceCounterStruct_t))/4U)
+
 #else /* gGattDbDynamic_d */
 gattDbAttribute_t*  gattDatabase;
 uint16_t            gGattDbAttributeCount_c;
@@ -87,6 +97,65 @@ uint16_t            gGattDbAttributeCount_c;
 extern uint32_t mServerDatabaseHashIndex;
 extern uint32_t mServerClientSupportedFeatureIndex;
 #endif /* gBLE51_d */
+
+/************************************************************************************
+*************************************************************************************
+* Private type definitions
+*************************************************************************************
+************************************************************************************/
+#if defined(gBLE51_d) && (gBLE51_d == 1U) && defined(gGattCaching_d) && (gGattCaching_d == 1U) && defined(gGattDbComputeHash_d) && (gGattDbComputeHash_d == 1U)
+/*! Incremental AES-CMAC (RFC 4493) context used to hash the database */
+typedef struct gattDbCmacContext_tag
+{
+    const uint8_t*  pKey;                               /*!< AES-128 key */
+    uint8_t         aState[gGattDatabaseHashSize_c];    /*!< CBC-MAC of the processed blocks */
+    uint8_t         aBlock[gGattDatabaseHashSize_c];    /*!< Last, not yet processed, block */
+    uint32_t        blockLength;                        /*!< Number of bytes in aBlock */
+} gattDbCmacContext_t;
+#endif /* gBLE51_d && gGattCaching_d && gGattDbComputeHash_d */
+
+/************************************************************************************
+*************************************************************************************
+* Private memory declarations
+*************************************************************************************
+************************************************************************************/
+/*! Database indexes of the service declarations, in ascending order. The index of a
+    static database is sized at compile time, the one of a dynamic database is
+    allocated when the database grows. */
+#if !gGattDbDynamic_d
+static uint16_t maServiceIndex[localGattDbServiceIndexSize_d];
+static uint16_t* mpServiceIndex = maServiceIndex;
+static uint32_t mServiceIndexSize = localGattDbServiceIndexSize_d;
+#else /* gGattDbDynamic_d */
+static uint16_t* mpServiceIndex = NULL;
+static uint32_t mServiceIndexSize = 0U;
+#endif /* gGattDbDynamic_d */
+static uint16_t mServiceIndexCount = 0U;
+
+/*! Database layout for which the service index was built. A change of the database
+    array or of the attribute count triggers a rebuild on the next service query. */
+static const gattDbAttribute_t* mpIndexedDatabase = NULL;
+static uint16_t mIndexedAttributeCount = 0U;
+
+/*! FALSE if the service index could not be allocated */
+static bool_t mServiceIndexValid = FALSE;
+
+/************************************************************************************
+*************************************************************************************
+* Private functions prototypes
+*************************************************************************************
+************************************************************************************/
+static bool_t GattDb_IsServiceDeclaration(uint32_t index);
+static bool_t GattDb_ServiceIndexReady(void);
+static uint32_t GattDb_FindIndexedService(uint16_t index);
+#if defined(gBLE51_d) && (gBLE51_d == 1U) && defined(gGattCaching_d) && (gGattCaching_d == 1U) && defined(gGattDbComputeHash_d) && (gGattDbComputeHash_d == 1U)
+static void GattDb_CmacInit(gattDbCmacContext_t* pContext, const uint8_t* pKey);
+static void GattDb_CmacUpdate(gattDbCmacContext_t* pContext, const uint8_t* pData, uint32_t length);
+static void GattDb_CmacFinish(gattDbCmacContext_t* pContext, uint8_t* pOutput);
+static void GattDb_CmacXorBlock(uint8_t* pState, const uint8_t* pBlock);
+static void GattDb_CmacSubkey(uint8_t* pKey);
+#endif /* gBLE51_d && gGattCaching_d && gGattDbComputeHash_d */
+
 /************************************************************************************
 *************************************************************************************
 * Public functions
@@ -122,9 +191,18 @@ bleResult_t GattDb_Init(void)
     /*! Attribute-specific initialization by X-Macro expansion */
 #include "gatt_init_x.h"
 
+    GattDb_RebuildIndex();
+
     return gBleSuccess_c;
 #else /* gGattDbDynamic_d */
-    return GattDbDynamic_Init();
+    bleResult_t result = GattDbDynamic_Init();
+
+    if (result == gBleSuccess_c)
+    {
+        GattDb_RebuildIndex();
+    }
+
+    return result;
 #endif /* gGattDbDynamic_d */
 }
 
@@ -145,9 +223,65 @@ bleResult_t GattDb_Deinit(void)
     
 #if gGattDbDynamic_d
     result = GattDbDynamic_ReleaseDatabase();
+    GattDb_RebuildIndex();
 #endif /* gGattDbDynamic_d */
     return result;
 }
+
+/*! *********************************************************************************
+*\fn            void GattDb_RebuildIndex(void)
+*\brief         Rebuilds the service index used by GattDb_FindServiceRange.
+*
+*\param  [in]   none.
+*
+*\remarks       Called by GattDb_Init. The index is also rebuilt automatically when
+*               the database array or the attribute count changes.
+********************************************************************************** */
+void GattDb_RebuildIndex(void)
+{
+    uint32_t serviceCount = 0U;
+
+    for (uint32_t j = 0U; j < gGattDbAttributeCount_c; j++)
+    {
+        if (GattDb_IsServiceDeclaration(j))
+        {
+            serviceCount++;
+        }
+    }
+
+#if gGattDbDynamic_d
+    if (serviceCount > mServiceIndexSize)
+    {
+        if (mpServiceIndex != NULL)
+        {
+            (void)MEM_BufferFree(mpServiceIndex);
+        }
+
+        mpServiceIndex = (uint16_t*)MEM_BufferAlloc(serviceCount * sizeof(uint16_t));
+        mServiceIndexSize = (mpServiceIndex != NULL) ? serviceCount : 0U;
+    }
+#endif /* gGattDbDynamic_d */
+
+    mServiceIndexCount = 0U;
+    /* Only an array replacing the static database can exceed the static index */
+    mServiceIndexValid = (serviceCount <= mServiceIndexSize) ? TRUE : FALSE;
+
+    if (mServiceIndexValid)
+    {
+        for (uint32_t j = 0U; j < gGattDbAttributeCount_c; j++)
+        {
+            if (GattDb_IsServiceDeclaration(j))
+            {
+                mpServiceIndex[mServiceIndexCount] = (uint16_t)j;
+                mServiceIndexCount++;
+            }
+        }
+    }
+
+    mpIndexedDatabase = gattDatabase;
+    mIndexedAttributeCount = gGattDbAttributeCount_c;
+}
+
 /*! *********************************************************************************
 *\fn            uint16_t GattDb_GetIndexOfHandle(uint16_t handle)
 *\brief         Database searching function, return the index for a given attribute
@@ -160,16 +294,41 @@ bleResult_t GattDb_Deinit(void)
 ********************************************************************************** */
 uint16_t GattDb_GetIndexOfHandle(uint16_t handle)
 {
-    uint16_t init = (handle >= gGattDbAttributeCount_c) ?
-                    (gGattDbAttributeCount_c - 1U) : handle;
-    for (uint16_t j = init; j != 0xFFFFU && gattDatabase[j].handle >= handle; j--)
+    uint16_t result = gGattDbInvalidHandleIndex_d;
+    uint32_t low = 0U;
+    uint32_t high = gGattDbAttributeCount_c;
+    uint32_t mid;
+
+    if ((handle != gGattDbInvalidHandle_d) &&
+        (handle <= gGattDbAttributeCount_c) &&
+        (gattDatabase[handle - 1U].handle == handle))
+    {
+        /* Handles are usually allocated consecutively starting from 1 */
+        result = handle - 1U;
+    }
+    else
     {
-        if (gattDatabase[j].handle == handle)
+        /* Handles are strictly increasing, so the database is sorted by handle */
+        while (low < high)
+        {
+            mid = (low + high) / 2U;
+            if (gattDatabase[mid].handle < handle)
+            {
+                low = mid + 1U;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+
+        if ((low < gGattDbAttributeCount_c) && (gattDatabase[low].handle == handle))
         {
-            return j;
+            result = (uint16_t)low;
         }
     }
-    return gGattDbInvalidHandleIndex_d;
+
+    return result;
 }
 
 /*! *********************************************************************************
@@ -222,30 +381,34 @@ bleResult_t GattDb_FindServiceRange
 )
 {
     bleResult_t result = gGattDbInvalidHandle_c;
+    uint16_t index = GattDb_GetIndexOfHandle(serviceHandle);
+    uint32_t k;
 
-    for (uint32_t j = 0U; j < gGattDbAttributeCount_c; j++)
+    if ((index != gGattDbInvalidHandleIndex_d) && GattDb_IsServiceDeclaration(index))
     {
-        if (gattDatabase[j].handle == serviceHandle)
+        *pOutStartIndex = index;
+
+        if (GattDb_ServiceIndexReady())
         {
-            if ((gattDatabase[j].uuidType == (uint16_t)gBleUuidType16_c) &&
-                BleSig_IsServiceDeclarationUuid16(gattDatabase[j].uuid))
+            /* The service ends where the next indexed service begins */
+            k = GattDb_FindIndexedService(index) + 1U;
+            k = (k < mServiceIndexCount) ? mpServiceIndex[k] : gGattDbAttributeCount_c;
+        }
+        else
+        {
+            for (k = (uint32_t)index + 1U; k < gGattDbAttributeCount_c; k++)
             {
-                *pOutStartIndex = (uint16_t)j;
-                uint32_t k;
-                for (k = j + 1U; k < gGattDbAttributeCount_c; k++)
+                if (GattDb_IsServiceDeclaration(k))
                 {
-                    if ((gattDatabase[k].uuidType == (uint16_t)gBleUuidType16_c) &&
-                        BleSig_IsServiceDeclarationUuid16(gattDatabase[k].uuid))
-                    {
-                        break;
-                    }
+                    break;
                 }
-                *pOutAttributeCount = (uint16_t)(k - j);
-                result = gBleSuccess_c;
-                break;
             }
         }
+
+        *pOutAttributeCount = (uint16_t)(k - index);
+        result = gBleSuccess_c;
     }
+
     return result;
 }
 
@@ -264,15 +427,14 @@ uint16_t GattDb_ServiceStartHandle(uint16_t handle)
 
     if (index != gGattDbInvalidHandleIndex_d)
     {
+        /* Services hold a few attributes, so the backward scan is shorter than a
+           search of the service index */
         for (int32_t j = (int32_t)index; j >= 0; j--)
         {
-            if (gattDatabase[j].uuidType == (uint16_t)gBleUuidType16_c)
+            if (GattDb_IsServiceDeclaration((uint32_t)j))
             {
-                if (BleSig_IsServiceDeclarationUuid16(gattDatabase[j].uuid))
-                {
-                    result = gattDatabase[j].handle;
-                    break;
-                }
+                result = gattDatabase[j].handle;
+                break;
             }
         }
     }
@@ -287,9 +449,9 @@ uint16_t GattDb_ServiceStartHandle(uint16_t handle)
 *
 * \retval   gBleSuccess_c
 * \retval   gBleInvalidState_c              Database not initialized or empty.
-* \retval   gBleOutOfMemory_c               Could not allocate memory for the database
-*                                           content used to compute the database hash.
-* \retval   gGattDbInvalidHandleIndex_d     Service does not exist in gatt database.
+*
+* \remarks  The hashed attributes are streamed through AES-CMAC one at a time,
+*           so no memory is allocated.
 *
 ********************************************************************************** */
 bleResult_t GattDb_ComputeDatabaseHash(void)
@@ -297,54 +459,56 @@ bleResult_t GattDb_ComputeDatabaseHash(void)
     bleResult_t result = gBleInvalidState_c;
 #if defined(gBLE51_d) && (gBLE51_d == 1U)
 #if defined(gGattCaching_d) && (gGattCaching_d == 1U) && defined(gGattDbComputeHash_d) && (gGattDbComputeHash_d == 1U)
-    uint8_t *pDatabaseContent;
-    uint32_t databaseLength = 0U;
+    gattDbCmacContext_t cmacContext;
+    uint8_t aHandleAndUuid[2U * sizeof(uint16_t)];
     uint8_t aKey[gGattDatabaseHashSize_c] = {0U};
+    bool_t bHashed;
+    bool_t bHashValue;
 
     /* the database is initialized or is not empty */
     if ((gattDatabase != NULL) && (gGattDbAttributeCount_c > 0U))
     {
+        GattDb_CmacInit(&cmacContext, aKey);
+
         for (uint32_t index = 0U; index < gGattDbAttributeCount_c; index ++)
         {
             if (gattDatabase[index].uuidType == (uint16_t)gBleUuidType16_c)
             {
+                bHashed = FALSE;
+                bHashValue = FALSE;
+
                 switch(gattDatabase[index].uuid)
                 {
+                    case gBleSig_PrimaryService_d:
+                    case gBleSig_SecondaryService_d:
+                    case gBleSig_Include_d:
+                    case gBleSig_Characteristic_d:
+                    case gBleSig_CharExtendedProperties_d:
+                        {
+                            bHashed = TRUE;
+                            bHashValue = TRUE;
+                        }
+                        break;
+
                     case gBleSig_CharUserDescription_d:
                     case gBleSig_CCCD_d:
                     case gBleSig_SCCD_d:
                     case gBleSig_CharPresFormatDescriptor_d:
                     case gBleSig_CharAggregateFormat_d:
                         {
-                              /* attribute handle */
-                              databaseLength += sizeof(uint16_t);
-
-                              /* attribute uuid */
-                              databaseLength += sizeof(uint16_t);
-
+                            bHashed = TRUE;
                         }
                         break;
 
-                    case gBleSig_PrimaryService_d:
-                    case gBleSig_SecondaryService_d:
-                    case gBleSig_Include_d:
-                    case gBleSig_Characteristic_d:
-                    case gBleSig_CharExtendedProperties_d:
+                    case gBleSig_GattClientSupportedFeatures_d:
                         {
-                              /* attribute handle */
-                              databaseLength += sizeof(uint16_t);
-
-                              /* attribute uuid */
-                              databaseLength += sizeof(uint16_t);
-
-                              /* attribute value */
-                              databaseLength += gattDatabase[index].valueLength;
+                            mServerClientSupportedFeatureIndex = index;
                         }
                         break;
 
-                    case gBleSig_GattClientSupportedFeatures_d:
+                    case gBleSig_GattDatabaseHash_d:
                         {
-                            mServerClientSupportedFeatureIndex = index;
+                            mServerDatabaseHashIndex = index;
                         }
                         break;
 
@@ -354,86 +518,32 @@ bleResult_t GattDb_ComputeDatabaseHash(void)
                         }
                         break;
                 }
-            }
-        }
 
-        pDatabaseContent = MEM_BufferAlloc(databaseLength);
-        if (pDatabaseContent == NULL)
-        {
-            result = gBleOutOfMemory_c;
-        }
-        else
-        {
-            databaseLength = 0U;
-            for (uint32_t index = 0U; index < gGattDbAttributeCount_c; index ++)
-            {
-                if (gattDatabase[index].uuidType == (uint16_t)gBleUuidType16_c)
+                if (bHashed)
                 {
-                    /* contents are kept in little endian order in the database */
-                    switch(gattDatabase[index].uuid)
+                    /* attribute handle and uuid, contents are kept in little endian order in the database */
+                    Utils_PackTwoByteValue(gattDatabase[index].handle, &aHandleAndUuid[0]);
+                    Utils_PackTwoByteValue(gattDatabase[index].uuid, &aHandleAndUuid[sizeof(uint16_t)]);
+                    GattDb_CmacUpdate(&cmacContext, aHandleAndUuid, sizeof(aHandleAndUuid));
+
+                    if (bHashValue)
                     {
-                        case gBleSig_PrimaryService_d:
-                        case gBleSig_SecondaryService_d:
-                        case gBleSig_Include_d:
-                        case gBleSig_Characteristic_d:
-                        case gBleSig_CharExtendedProperties_d:
-                            {
-                                /* attribute handle */
-                                Utils_PackTwoByteValue(gattDatabase[index].handle, &pDatabaseContent[databaseLength]);
-                                databaseLength += sizeof(uint16_t);
-
-                                /* attribute uuid */
-                                Utils_PackTwoByteValue(gattDatabase[index].uuid, &pDatabaseContent[databaseLength]);
-                                databaseLength += sizeof(uint16_t);
-
-                                /* attribute value */
-                                FLib_MemCpy(&pDatabaseContent[databaseLength], gattDatabase[index].pValue, gattDatabase[index].valueLength);
-                                databaseLength += gattDatabase[index].valueLength;
-                            }
-                            break;
-
-                        case gBleSig_CharUserDescription_d:
-                        case gBleSig_CCCD_d:
-                        case gBleSig_SCCD_d:
-                        case gBleSig_CharPresFormatDescriptor_d:
-                        case gBleSig_CharAggregateFormat_d:
-                            {
-                                /* attribute handle */
-                                Utils_PackTwoByteValue(gattDatabase[index].handle, &pDatabaseContent[databaseLength]);
-                                databaseLength += sizeof(uint16_t);
-
-                                /* attribute uuid */
-                                Utils_PackTwoByteValue(gattDatabase[index].uuid, &pDatabaseContent[databaseLength]);
-                                databaseLength += sizeof(uint16_t);
-                            }
-                            break;
-
-                        case gBleSig_GattDatabaseHash_d:
-                            {
-                                mServerDatabaseHashIndex = index;
-                            }
-                            break;
-
-                        default:
-                            {
-                                ; /* For MISRA rule 16.4 */
-                            }
-                            break;
+                        /* attribute value */
+                        GattDb_CmacUpdate(&cmacContext, gattDatabase[index].pValue, gattDatabase[index].valueLength);
                     }
                 }
             }
+        }
 
-            /* update the the characteristic value */
-            if (mServerDatabaseHashIndex != gGattDbInvalidHandleIndex_d)
-            {
-                /* do AES_CMAC do obtain the database hash and update the value in the database */
-                AES_128_CMAC((uint8_t*)pDatabaseContent, databaseLength, aKey, gattDatabase[mServerDatabaseHashIndex].pValue);
-                Utils_RevertByteArray(gattDatabase[mServerDatabaseHashIndex].pValue, gGattDatabaseHashSize_c);
-            }
-
-            (void)MEM_BufferFree(pDatabaseContent);
-            result = gBleSuccess_c;
+        /* update the the characteristic value */
+        if (mServerDatabaseHashIndex != gGattDbInvalidHandleIndex_d)
+        {
+            /* finish the AES_CMAC to obtain the database hash and update the value in the database */
+            GattDb_CmacFinish(&cmacContext, gattDatabase[mServerDatabaseHashIndex].pValue);
+            Utils_RevertByteArray(gattDatabase[mServerDatabaseHashIndex].pValue, gGattDatabaseHashSize_c);
         }
+
+        result = gBleSuccess_c;
     }
 #endif /* gGattCaching_d && gGattDbComputeHash_d */
 #endif /* gBLE51_d */
@@ -441,6 +551,186 @@ bleResult_t GattDb_ComputeDatabaseHash(void)
 }
 
 
+/************************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+************************************************************************************/
+
+/*! *********************************************************************************
+* \brief    Checks whether the attribute at the given database index is a primary
+*           or secondary service declaration.
+*
+* \param[in] index  The database index.
+*
+* \return   TRUE if the attribute is a service declaration, FALSE otherwise.
+********************************************************************************** */
+static bool_t GattDb_IsServiceDeclaration(uint32_t index)
+{
+    return ((gattDatabase[index].uuidType == (uint16_t)gBleUuidType16_c) &&
+            BleSig_IsServiceDeclarationUuid16(gattDatabase[index].uuid));
+}
+
+/*! *********************************************************************************
+* \brief    Rebuilds the service index if the database changed since it was built.
+*
+* \return   TRUE if the service index covers the whole database, FALSE otherwise.
+********************************************************************************** */
+static bool_t GattDb_ServiceIndexReady(void)
+{
+    if ((mpIndexedDatabase != gattDatabase) ||
+        (mIndexedAttributeCount != gGattDbAttributeCount_c))
+    {
+        GattDb_RebuildIndex();
+    }
+
+    return mServiceIndexValid;
+}
+
+/*! *********************************************************************************
+* \brief    Finds the last indexed service declared at or before a database index.
+*
+* \param[in] index  The database index.
+*
+* \return   Position in mpServiceIndex or mServiceIndexCount if no service is
+*           declared at or before the given index.
+********************************************************************************** */
+static uint32_t GattDb_FindIndexedService(uint16_t index)
+{
+    uint32_t low = 0U;
+    uint32_t high = mServiceIndexCount;
+    uint32_t mid;
+
+    /* Find the first service declared after index */
+    while (low < high)
+    {
+        mid = (low + high) / 2U;
+        if (mpServiceIndex[mid] <= index)
+        {
+            low = mid + 1U;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+
+    return (low == 0U) ? (uint32_t)mServiceIndexCount : (low - 1U);
+}
+
+
+#if defined(gBLE51_d) && (gBLE51_d == 1U) && defined(gGattCaching_d) && (gGattCaching_d == 1U) && defined(gGattDbComputeHash_d) && (gGattDbComputeHash_d == 1U)
+
+/*! *********************************************************************************
+* \brief    Starts an incremental AES-CMAC computation.
+*
+* \param[in] pContext  The CMAC context.
+* \param[in] pKey      The AES-128 key, must be valid until GattDb_CmacFinish.
+********************************************************************************** */
+static void GattDb_CmacInit(gattDbCmacContext_t* pContext, const uint8_t* pKey)
+{
+    FLib_MemSet(pContext->aState, 0U, gGattDatabaseHashSize_c);
+    pContext->pKey = pKey;
+    pContext->blockLength = 0U;
+}
+
+/*! *********************************************************************************
+* \brief    Adds data to an incremental AES-CMAC computation.
+*
+* \param[in] pContext  The CMAC context.
+* \param[in] pData     The data to be authenticated.
+* \param[in] length    The length of the data.
+*
+* \remarks  The last block is kept back, as GattDb_CmacFinish must mask it with
+*           a subkey before it is encrypted.
+********************************************************************************** */
+static void GattDb_CmacUpdate(gattDbCmacContext_t* pContext, const uint8_t* pData, uint32_t length)
+{
+    uint32_t chunk;
+
+    while (length > 0U)
+    {
+        if (pContext->blockLength == gGattDatabaseHashSize_c)
+        {
+            /* More data follows, the buffered block is not the last one */
+            GattDb_CmacXorBlock(pContext->aState, pContext->aBlock);
+            AES_128_Encrypt(pContext->aState, pContext->pKey, pContext->aState);
+            pContext->blockLength = 0U;
+        }
+
+        chunk = gGattDatabaseHashSize_c - pContext->blockLength;
+        if (chunk > length)
+        {
+            chunk = length;
+        }
+
+        FLib_MemCpy(&pContext->aBlock[pContext->blockLength], pData, chunk);
+        pContext->blockLength += chunk;
+        pData = &pData[chunk];
+        length -= chunk;
+    }
+}
+
+/*! *********************************************************************************
+* \brief    Finishes an incremental AES-CMAC computation.
+*
+* \param[in]  pContext  The CMAC context.
+* \param[out] pOutput   The 16 byte MAC, same as AES_128_CMAC over all the data.
+********************************************************************************** */
+static void GattDb_CmacFinish(gattDbCmacContext_t* pContext, uint8_t* pOutput)
+{
+    uint8_t aSubkey[gGattDatabaseHashSize_c] = {0U};
+
+    /* L = AES-128(K, 0), K1 = L << 1, K2 = K1 << 1 */
+    AES_128_Encrypt(aSubkey, pContext->pKey, aSubkey);
+    GattDb_CmacSubkey(aSubkey);
+
+    if (pContext->blockLength < gGattDatabaseHashSize_c)
+    {
+        /* Incomplete last block: pad with 10..0 and use K2 */
+        pContext->aBlock[pContext->blockLength] = 0x80U;
+        FLib_MemSet(&pContext->aBlock[pContext->blockLength + 1U], 0U,
+                    gGattDatabaseHashSize_c - pContext->blockLength - 1U);
+        GattDb_CmacSubkey(aSubkey);
+    }
+
+    GattDb_CmacXorBlock(pContext->aBlock, aSubkey);
+    GattDb_CmacXorBlock(pContext->aState, pContext->aBlock);
+    AES_128_Encrypt(pContext->aState, pContext->pKey, pOutput);
+}
+
+/*! *********************************************************************************
+* \brief    XORs a 16 byte block into the state.
+********************************************************************************** */
+static void GattDb_CmacXorBlock(uint8_t* pState, const uint8_t* pBlock)
+{
+    for (uint32_t i = 0U; i < gGattDatabaseHashSize_c; i++)
+    {
+        pState[i] ^= pBlock[i];
+    }
+}
+
+/*! *********************************************************************************
+* \brief    Derives the next CMAC subkey in place, as in RFC 4493 Generate_Subkey.
+********************************************************************************** */
+static void GattDb_CmacSubkey(uint8_t* pKey)
+{
+    uint8_t msb = pKey[0] & 0x80U;
+
+    for (uint32_t i = 0U; i < (gGattDatabaseHashSize_c - 1U); i++)
+    {
+        pKey[i] = (uint8_t)((uint8_t)(pKey[i] << 1) | (pKey[i + 1U] >> 7));
+    }
+    pKey[gGattDatabaseHashSize_c - 1U] = (uint8_t)(pKey[gGattDatabaseHashSize_c - 1U] << 1);
+
+    if (msb != 0U)
+    {
+        pKey[gGattDatabaseHashSize_c - 1U] ^= 0x87U;
+    }
+}
+#endif /* gBLE51_d && gGattCaching_d && gGattDbComputeHash_d */
+
+
 /*! *********************************************************************************
 * @}
 ********************************************************************************** */
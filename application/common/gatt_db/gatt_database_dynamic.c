@@ -162,6 +162,9 @@ bleResult_t GattDbDynamic_AddServiceInDatabase(serviceInfo_t* pServiceInfo)
         }
     }
 
+    /* Keep the service index in sync with the updated database */
+    GattDb_RebuildIndex();
+
     return result;
 }
 
@@ -467,6 +467,13 @@
 #define INCLUDE_MACRO_SIZE(name)  uint32_t TOKEN_PASTE_LAYER_2(name##_long,__LINE__);
 
 
+/*
+* Macro for counting the service declarations in the database
+*/
+
+#define SERVICE_MACRO_COUNT(name)  uint32_t name##_service;
+
+
 /*
 * Macros for enumeration
 */
@@ -85,6 +85,29 @@
 #define XSIZE_DESCRIPTOR_UUID128(name, uuid, permissions, size, ...)                    UNIVERSAL_MACRO_SIZE(name)
 #define XSIZE_CHARACTERISTIC_AGGREGATE(name, uuid, permissions, size, ...)              UNIVERSAL_MACRO_SIZE(name)
 
+#define XCOUNT_PRIMARY_SERVICE(name, uuid)                                              SERVICE_MACRO_COUNT(name)
+#define XCOUNT_PRIMARY_SERVICE_UUID32(name, uuid32)                                     SERVICE_MACRO_COUNT(name)
+#define XCOUNT_PRIMARY_SERVICE_UUID128(name, uuid128)                                   SERVICE_MACRO_COUNT(name)
+#define XCOUNT_SECONDARY_SERVICE(name, uuid)                                            SERVICE_MACRO_COUNT(name)
+#define XCOUNT_SECONDARY_SERVICE_UUID32(name, uuid32)                                   SERVICE_MACRO_COUNT(name)
+#define XCOUNT_SECONDARY_SERVICE_UUID128(name, uuid128)                                 SERVICE_MACRO_COUNT(name)
+#define XCOUNT_INCLUDE(service_attribute_handle)
+#define XCOUNT_INCLUDE_CUSTOM(service_attribute_handle)
+#define XCOUNT_CHARACTERISTIC(name, uuid, properties)
+#define XCOUNT_CHARACTERISTIC_UUID32(name, uuid32, properties)
+#define XCOUNT_CHARACTERISTIC_UUID128(name, uuid128, properties)
+#define XCOUNT_VALUE(name, uuid, permissions, size, ...)
+#define XCOUNT_VALUE_UUID32(name, uuid32, permissions, size, ...)
+#define XCOUNT_VALUE_UUID128(name, uuid128, permissions, size, ...)
+#define XCOUNT_VALUE_VARLEN(name, uuid, permissions, maxSize, initSize, ...)
+#define XCOUNT_VALUE_UUID32_VARLEN(name, uuid32, permissions, maxSize, initSize, ...)
+#define XCOUNT_VALUE_UUID128_VARLEN(name, uuid128, permissions, maxSize, initSize, ...)
+#define XCOUNT_CCCD(name)
+#define XCOUNT_DESCRIPTOR(name, uuid, permissions, size, ...)
+#define XCOUNT_DESCRIPTOR_UUID32(name, uuid, permissions, size, ...)
+#define XCOUNT_DESCRIPTOR_UUID128(name, uuid, permissions, size, ...)
+#define XCOUNT_CHARACTERISTIC_AGGREGATE(name, uuid, permissions, size, ...)
+
 #define XENUM_PRIMARY_SERVICE(name, uuid)                                               UNIVERSAL_MACRO_ENUM(name)
 #define XENUM_PRIMARY_SERVICE_UUID32(name, uuid32)                                      UNIVERSAL_MACRO_ENUM(name)
 #define XENUM_PRIMARY_SERVICE_UUID128(name, uuid128)                                    UNIVERSAL_MACRO_ENUM(name)
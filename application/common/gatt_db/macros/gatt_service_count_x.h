@@ -0,0 +1,61 @@
+/*! *********************************************************************************
+* Copyright 2026 NXP
+*
+*
+* \file
+*
+* SPDX-License-Identifier: BSD-3-Clause
+********************************************************************************** */
+
+#ifndef GATT_SERVICE_COUNT_X_H
+#define GATT_SERVICE_COUNT_X_H
+
+#define PRIMARY_SERVICE                         XCOUNT_PRIMARY_SERVICE
+#define PRIMARY_SERVICE_UUID32                  XCOUNT_PRIMARY_SERVICE_UUID32
+#define PRIMARY_SERVICE_UUID128                 XCOUNT_PRIMARY_SERVICE_UUID128
+#define SECONDARY_SERVICE                       XCOUNT_SECONDARY_SERVICE
+#define SECONDARY_SERVICE_UUID32                XCOUNT_SECONDARY_SERVICE_UUID32
+#define SECONDARY_SERVICE_UUID128               XCOUNT_SECONDARY_SERVICE_UUID128
+#define INCLUDE                                 XCOUNT_INCLUDE
+#define INCLUDE_CUSTOM                          XCOUNT_INCLUDE_CUSTOM
+#define CHARACTERISTIC                          XCOUNT_CHARACTERISTIC
+#define CHARACTERISTIC_UUID32                   XCOUNT_CHARACTERISTIC_UUID32
+#define CHARACTERISTIC_UUID128                  XCOUNT_CHARACTERISTIC_UUID128
+#define VALUE                                   XCOUNT_VALUE
+#define VALUE_UUID32                            XCOUNT_VALUE_UUID32
+#define VALUE_UUID128                           XCOUNT_VALUE_UUID128
+#define VALUE_VARLEN                            XCOUNT_VALUE_VARLEN
+#define VALUE_UUID32_VARLEN                     XCOUNT_VALUE_UUID32_VARLEN
+#define VALUE_UUID128_VARLEN                    XCOUNT_VALUE_UUID128_VARLEN
+#define CCCD                                    XCOUNT_CCCD
+#define DESCRIPTOR                              XCOUNT_DESCRIPTOR
+#define DESCRIPTOR_UUID32                       XCOUNT_DESCRIPTOR
+#define DESCRIPTOR_UUID128                      XCOUNT_DESCRIPTOR
+#define CHARACTERISTIC_AGGREGATE                XCOUNT_CHARACTERISTIC_AGGREGATE
+
+#include "gatt_db.h"
+
+#undef PRIMARY_SERVICE
+#undef PRIMARY_SERVICE_UUID32
+#undef PRIMARY_SERVICE_UUID128
+#undef SECONDARY_SERVICE
+#undef SECONDARY_SERVICE_UUID32
+#undef SECONDARY_SERVICE_UUID128
+#undef INCLUDE
+#undef INCLUDE_CUSTOM
+#undef CHARACTERISTIC
+#undef CHARACTERISTIC_UUID32
+#undef CHARACTERISTIC_UUID128
+#undef VALUE
+#undef VALUE_UUID32
+#undef VALUE_UUID128
+#undef VALUE_VARLEN
+#undef VALUE_UUID32_VARLEN
+#undef VALUE_UUID128_VARLEN
+#undef CCCD
+#undef DESCRIPTOR
+#undef DESCRIPTOR_UUID32
+#undef DESCRIPTOR_UUID128
+#undef CHARACTERISTIC_AGGREGATE
+
+#endif /* GATT_SERVICE_COUNT_X_H */
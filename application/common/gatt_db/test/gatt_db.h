@@ -0,0 +1,200 @@
+/*! *********************************************************************************
+* Copyright 2026 NXP
+*
+*
+* \file
+*
+* Static database of the GATT database host tests. It covers every attribute kind
+* hashed by GattDb_ComputeDatabaseHash and more services than the previous 32
+* entry service index. Each attribute stays on its own line, its handle is the
+* line number.
+*
+* SPDX-License-Identifier: BSD-3-Clause
+********************************************************************************** */
+
+PRIMARY_SERVICE(service_gatt, gBleSig_GenericAttributeProfile_d)
+    CHARACTERISTIC(char_service_changed, gBleSig_GattServiceChanged_d, (gGattCharPropIndicate_c) )
+        VALUE(value_service_changed, gBleSig_GattServiceChanged_d, (gPermissionNone_c), 4, 0x00, 0x00, 0x00, 0x00)
+        CCCD(cccd_service_changed)
+    CHARACTERISTIC(char_client_supported_features, gBleSig_GattClientSupportedFeatures_d, (gGattCharPropRead_c | gGattCharPropWrite_c) )
+        VALUE(value_client_supported_features, gBleSig_GattClientSupportedFeatures_d, (gPermissionFlagReadable_c | gPermissionFlagWritable_c), 1, 0x00)
+    CHARACTERISTIC(char_database_hash, gBleSig_GattDatabaseHash_d, (gGattCharPropRead_c) )
+        VALUE(value_database_hash, gBleSig_GattDatabaseHash_d, (gPermissionFlagReadable_c), 16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+
+PRIMARY_SERVICE(service_gap, gBleSig_GenericAccessProfile_d)
+    CHARACTERISTIC(char_device_name, gBleSig_GapDeviceName_d, (gGattCharPropRead_c) )
+        VALUE(value_device_name, gBleSig_GapDeviceName_d, (gPermissionFlagReadable_c), 8, "GATT DB")
+
+SECONDARY_SERVICE(service_battery, gBleSig_BatteryService_d)
+    CHARACTERISTIC(char_battery_level, gBleSig_BatteryLevel_d, (gGattCharPropRead_c | gGattCharPropNotify_c | gGattCharPropExtendedProperties_c) )
+        VALUE(value_battery_level, gBleSig_BatteryLevel_d, (gPermissionFlagReadable_c), 1, 0x5A)
+        DESCRIPTOR(desc_battery_ext_properties, gBleSig_CharExtendedProperties_d, (gPermissionFlagReadable_c), 2, 0x00, 0x00)
+        DESCRIPTOR(desc_battery_format, gBleSig_CharPresFormatDescriptor_d, (gPermissionFlagReadable_c), 7, 0x04, 0x00, 0xAD, 0x27, 0x01, 0x00, 0x00)
+        CCCD(cccd_battery_level)
+
+PRIMARY_SERVICE(service_heart_rate, gBleSig_HeartRateService_d)
+    INCLUDE(service_battery)
+    CHARACTERISTIC(char_hr_measurement, gBleSig_HrMeasurement_d, (gGattCharPropNotify_c) )
+        VALUE_VARLEN(value_hr_measurement, gBleSig_HrMeasurement_d, (gPermissionNone_c), 22, 2, 0x00, 0xB4)
+        DESCRIPTOR(desc_hr_user_description, gBleSig_CharUserDescription_d, (gPermissionFlagReadable_c), 5, "Pulse")
+        CCCD(cccd_hr_measurement)
+
+PRIMARY_SERVICE(service_sensor_1, 0x1901)
+    CHARACTERISTIC(char_sensor_1, 0x2C01, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_1, 0x2C01, (gPermissionFlagReadable_c), 2, 0x07, 0x08)
+        CCCD(cccd_sensor_1)
+
+PRIMARY_SERVICE(service_sensor_2, 0x1902)
+    CHARACTERISTIC(char_sensor_2, 0x2C02, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_2, 0x2C02, (gPermissionFlagReadable_c), 3, 0x0E, 0x0F, 0x10)
+        CCCD(cccd_sensor_2)
+
+PRIMARY_SERVICE(service_sensor_3, 0x1903)
+    CHARACTERISTIC(char_sensor_3, 0x2C03, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_3, 0x2C03, (gPermissionFlagReadable_c), 4, 0x15, 0x16, 0x17, 0x18)
+        CCCD(cccd_sensor_3)
+
+PRIMARY_SERVICE(service_sensor_4, 0x1904)
+    CHARACTERISTIC(char_sensor_4, 0x2C04, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_4, 0x2C04, (gPermissionFlagReadable_c), 5, 0x1C, 0x1D, 0x1E, 0x1F, 0x20)
+        CCCD(cccd_sensor_4)
+
+PRIMARY_SERVICE(service_sensor_5, 0x1905)
+    CHARACTERISTIC(char_sensor_5, 0x2C05, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_5, 0x2C05, (gPermissionFlagReadable_c), 1, 0x23)
+        CCCD(cccd_sensor_5)
+
+PRIMARY_SERVICE(service_sensor_6, 0x1906)
+    CHARACTERISTIC(char_sensor_6, 0x2C06, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_6, 0x2C06, (gPermissionFlagReadable_c), 2, 0x2A, 0x2B)
+        CCCD(cccd_sensor_6)
+
+PRIMARY_SERVICE(service_sensor_7, 0x1907)
+    CHARACTERISTIC(char_sensor_7, 0x2C07, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_7, 0x2C07, (gPermissionFlagReadable_c), 3, 0x31, 0x32, 0x33)
+        CCCD(cccd_sensor_7)
+
+PRIMARY_SERVICE(service_sensor_8, 0x1908)
+    CHARACTERISTIC(char_sensor_8, 0x2C08, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_8, 0x2C08, (gPermissionFlagReadable_c), 4, 0x38, 0x39, 0x3A, 0x3B)
+        CCCD(cccd_sensor_8)
+
+PRIMARY_SERVICE(service_sensor_9, 0x1909)
+    CHARACTERISTIC(char_sensor_9, 0x2C09, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_9, 0x2C09, (gPermissionFlagReadable_c), 5, 0x3F, 0x40, 0x41, 0x42, 0x43)
+        CCCD(cccd_sensor_9)
+
+PRIMARY_SERVICE(service_sensor_10, 0x190A)
+    CHARACTERISTIC(char_sensor_10, 0x2C0A, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_10, 0x2C0A, (gPermissionFlagReadable_c), 1, 0x46)
+        CCCD(cccd_sensor_10)
+
+PRIMARY_SERVICE(service_sensor_11, 0x190B)
+    CHARACTERISTIC(char_sensor_11, 0x2C0B, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_11, 0x2C0B, (gPermissionFlagReadable_c), 2, 0x4D, 0x4E)
+        CCCD(cccd_sensor_11)
+
+PRIMARY_SERVICE(service_sensor_12, 0x190C)
+    CHARACTERISTIC(char_sensor_12, 0x2C0C, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_12, 0x2C0C, (gPermissionFlagReadable_c), 3, 0x54, 0x55, 0x56)
+        CCCD(cccd_sensor_12)
+
+PRIMARY_SERVICE(service_sensor_13, 0x190D)
+    CHARACTERISTIC(char_sensor_13, 0x2C0D, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_13, 0x2C0D, (gPermissionFlagReadable_c), 4, 0x5B, 0x5C, 0x5D, 0x5E)
+        CCCD(cccd_sensor_13)
+
+PRIMARY_SERVICE(service_sensor_14, 0x190E)
+    CHARACTERISTIC(char_sensor_14, 0x2C0E, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_14, 0x2C0E, (gPermissionFlagReadable_c), 5, 0x62, 0x63, 0x64, 0x65, 0x66)
+        CCCD(cccd_sensor_14)
+
+PRIMARY_SERVICE(service_sensor_15, 0x190F)
+    CHARACTERISTIC(char_sensor_15, 0x2C0F, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_15, 0x2C0F, (gPermissionFlagReadable_c), 1, 0x69)
+        CCCD(cccd_sensor_15)
+
+PRIMARY_SERVICE(service_sensor_16, 0x1910)
+    CHARACTERISTIC(char_sensor_16, 0x2C10, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_16, 0x2C10, (gPermissionFlagReadable_c), 2, 0x70, 0x71)
+        CCCD(cccd_sensor_16)
+
+PRIMARY_SERVICE(service_sensor_17, 0x1911)
+    CHARACTERISTIC(char_sensor_17, 0x2C11, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_17, 0x2C11, (gPermissionFlagReadable_c), 3, 0x77, 0x78, 0x79)
+        CCCD(cccd_sensor_17)
+
+PRIMARY_SERVICE(service_sensor_18, 0x1912)
+    CHARACTERISTIC(char_sensor_18, 0x2C12, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_18, 0x2C12, (gPermissionFlagReadable_c), 4, 0x7E, 0x7F, 0x80, 0x81)
+        CCCD(cccd_sensor_18)
+
+PRIMARY_SERVICE(service_sensor_19, 0x1913)
+    CHARACTERISTIC(char_sensor_19, 0x2C13, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_19, 0x2C13, (gPermissionFlagReadable_c), 5, 0x85, 0x86, 0x87, 0x88, 0x89)
+        CCCD(cccd_sensor_19)
+
+PRIMARY_SERVICE(service_sensor_20, 0x1914)
+    CHARACTERISTIC(char_sensor_20, 0x2C14, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_20, 0x2C14, (gPermissionFlagReadable_c), 1, 0x8C)
+        CCCD(cccd_sensor_20)
+
+PRIMARY_SERVICE(service_sensor_21, 0x1915)
+    CHARACTERISTIC(char_sensor_21, 0x2C15, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_21, 0x2C15, (gPermissionFlagReadable_c), 2, 0x93, 0x94)
+        CCCD(cccd_sensor_21)
+
+PRIMARY_SERVICE(service_sensor_22, 0x1916)
+    CHARACTERISTIC(char_sensor_22, 0x2C16, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_22, 0x2C16, (gPermissionFlagReadable_c), 3, 0x9A, 0x9B, 0x9C)
+        CCCD(cccd_sensor_22)
+
+PRIMARY_SERVICE(service_sensor_23, 0x1917)
+    CHARACTERISTIC(char_sensor_23, 0x2C17, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_23, 0x2C17, (gPermissionFlagReadable_c), 4, 0xA1, 0xA2, 0xA3, 0xA4)
+        CCCD(cccd_sensor_23)
+
+PRIMARY_SERVICE(service_sensor_24, 0x1918)
+    CHARACTERISTIC(char_sensor_24, 0x2C18, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_24, 0x2C18, (gPermissionFlagReadable_c), 5, 0xA8, 0xA9, 0xAA, 0xAB, 0xAC)
+        CCCD(cccd_sensor_24)
+
+PRIMARY_SERVICE(service_sensor_25, 0x1919)
+    CHARACTERISTIC(char_sensor_25, 0x2C19, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_25, 0x2C19, (gPermissionFlagReadable_c), 1, 0xAF)
+        CCCD(cccd_sensor_25)
+
+PRIMARY_SERVICE(service_sensor_26, 0x191A)
+    CHARACTERISTIC(char_sensor_26, 0x2C1A, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_26, 0x2C1A, (gPermissionFlagReadable_c), 2, 0xB6, 0xB7)
+        CCCD(cccd_sensor_26)
+
+PRIMARY_SERVICE(service_sensor_27, 0x191B)
+    CHARACTERISTIC(char_sensor_27, 0x2C1B, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_27, 0x2C1B, (gPermissionFlagReadable_c), 3, 0xBD, 0xBE, 0xBF)
+        CCCD(cccd_sensor_27)
+
+PRIMARY_SERVICE(service_sensor_28, 0x191C)
+    CHARACTERISTIC(char_sensor_28, 0x2C1C, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_28, 0x2C1C, (gPermissionFlagReadable_c), 4, 0xC4, 0xC5, 0xC6, 0xC7)
+        CCCD(cccd_sensor_28)
+
+PRIMARY_SERVICE(service_sensor_29, 0x191D)
+    CHARACTERISTIC(char_sensor_29, 0x2C1D, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_29, 0x2C1D, (gPermissionFlagReadable_c), 5, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF)
+        CCCD(cccd_sensor_29)
+
+PRIMARY_SERVICE(service_sensor_30, 0x191E)
+    CHARACTERISTIC(char_sensor_30, 0x2C1E, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_30, 0x2C1E, (gPermissionFlagReadable_c), 1, 0xD2)
+        CCCD(cccd_sensor_30)
+
+PRIMARY_SERVICE(service_sensor_31, 0x191F)
+    CHARACTERISTIC(char_sensor_31, 0x2C1F, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_31, 0x2C1F, (gPermissionFlagReadable_c), 2, 0xD9, 0xDA)
+        CCCD(cccd_sensor_31)
+
+PRIMARY_SERVICE(service_sensor_32, 0x1920)
+    CHARACTERISTIC(char_sensor_32, 0x2C20, (gGattCharPropRead_c | gGattCharPropNotify_c) )
+        VALUE(value_sensor_32, 0x2C20, (gPermissionFlagReadable_c), 3, 0xE0, 0xE1, 0xE2)
+        CCCD(cccd_sensor_32)
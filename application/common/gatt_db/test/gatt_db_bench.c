@@ -0,0 +1,267 @@
+/*! *********************************************************************************
+* Copyright 2026 NXP
+*
+*
+* \file
+*
+* Host microbenchmark of the GATT database handle and service lookups. The lookups
+* of gatt_database.c are checked against the linear searches they replaced, then
+* both are timed on a 500 attribute database with 50 services, with consecutive
+* handles and with handle gaps.
+*
+* SPDX-License-Identifier: BSD-3-Clause
+********************************************************************************** */
+
+/************************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "gatt_database.h"
+#include "gatt_db_dynamic.h"
+#include "ble_sig_defines.h"
+
+/************************************************************************************
+*************************************************************************************
+* Private macros
+*************************************************************************************
+************************************************************************************/
+#define mAttributeCount_c       500U
+#define mAttributesPerService_c 10U
+#define mDefaultIterations_c    2000U
+
+/************************************************************************************
+*************************************************************************************
+* Private memory declarations
+*************************************************************************************
+************************************************************************************/
+static gattDbAttribute_t maDatabase[mAttributeCount_c];
+
+/* Keeps the compiler from dropping the timed lookups */
+static volatile uint32_t mSink;
+
+/************************************************************************************
+*************************************************************************************
+* Dynamic database stand-ins, the benchmark fills gattDatabase itself
+*************************************************************************************
+************************************************************************************/
+bleResult_t GattDbDynamic_Init(void)
+{
+    return gBleSuccess_c;
+}
+
+bleResult_t GattDbDynamic_ReleaseDatabase(void)
+{
+    return gBleSuccess_c;
+}
+
+/************************************************************************************
+*************************************************************************************
+* Reference linear searches, as before the service index
+*************************************************************************************
+************************************************************************************/
+static uint16_t Linear_GetIndexOfHandle(uint16_t handle)
+{
+    uint16_t init = (handle >= gGattDbAttributeCount_c) ?
+                    (gGattDbAttributeCount_c - 1U) : handle;
+    for (uint16_t j = init; j != 0xFFFFU && gattDatabase[j].handle >= handle; j--)
+    {
+        if (gattDatabase[j].handle == handle)
+        {
+            return j;
+        }
+    }
+    return gGattDbInvalidHandleIndex_d;
+}
+
+static bool_t Linear_IsServiceDeclaration(uint32_t index)
+{
+    return ((gattDatabase[index].uuidType == (uint16_t)gBleUuidType16_c) &&
+            BleSig_IsServiceDeclarationUuid16(gattDatabase[index].uuid));
+}
+
+static bleResult_t Linear_FindServiceRange
+(
+    uint16_t serviceHandle,
+    uint16_t* pOutStartIndex,
+    uint16_t* pOutAttributeCount
+)
+{
+    bleResult_t result = gGattDbInvalidHandle_c;
+
+    for (uint32_t j = 0U; j < gGattDbAttributeCount_c; j++)
+    {
+        if ((gattDatabase[j].handle == serviceHandle) && Linear_IsServiceDeclaration(j))
+        {
+            uint32_t k;
+
+            *pOutStartIndex = (uint16_t)j;
+            for (k = j + 1U; k < gGattDbAttributeCount_c; k++)
+            {
+                if (Linear_IsServiceDeclaration(k))
+                {
+                    break;
+                }
+            }
+            *pOutAttributeCount = (uint16_t)(k - j);
+            result = gBleSuccess_c;
+            break;
+        }
+    }
+    return result;
+}
+
+static uint16_t Linear_ServiceStartHandle(uint16_t handle)
+{
+    uint16_t result = gGattDbInvalidHandleIndex_d;
+    uint16_t index = Linear_GetIndexOfHandle(handle);
+
+    if (index != gGattDbInvalidHandleIndex_d)
+    {
+        for (int32_t j = (int32_t)index; j >= 0; j--)
+        {
+            if (Linear_IsServiceDeclaration((uint32_t)j))
+            {
+                result = gattDatabase[j].handle;
+                break;
+            }
+        }
+    }
+
+    return result;
+}
+
+/************************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+************************************************************************************/
+static double Now(void)
+{
+    struct timespec t;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double)t.tv_sec + (double)t.tv_nsec * 1e-9;
+}
+
+/* Lays out a service every mAttributesPerService_c attributes, followed by
+   characteristic declarations and values */
+static void FillDatabase(bool_t bHandleGaps)
+{
+    uint16_t handle = 1U;
+
+    for (uint32_t i = 0U; i < mAttributeCount_c; i++)
+    {
+        maDatabase[i].handle = handle;
+        maDatabase[i].uuidType = (uint16_t)gBleUuidType16_c;
+        if ((i % mAttributesPerService_c) == 0U)
+        {
+            maDatabase[i].uuid = gBleSig_PrimaryService_d;
+        }
+        else
+        {
+            maDatabase[i].uuid = ((i % 2U) == 1U) ? gBleSig_Characteristic_d : 0x2A37U;
+        }
+        handle += (bHandleGaps && ((i % 7U) == 0U)) ? 3U : 1U;
+    }
+
+    gattDatabase = maDatabase;
+    gGattDbAttributeCount_c = mAttributeCount_c;
+    GattDb_RebuildIndex();
+}
+
+/* Compares every lookup with the linear search, from below the first handle to
+   past the last one */
+static int CheckDatabase(void)
+{
+    uint16_t lastHandle = maDatabase[mAttributeCount_c - 1U].handle;
+
+    for (uint32_t h = 0U; h <= (uint32_t)lastHandle + 2U; h++)
+    {
+        uint16_t handle = (uint16_t)h;
+        uint16_t start = 0U, count = 0U, refStart = 0U, refCount = 0U;
+        bleResult_t result = GattDb_FindServiceRange(handle, &start, &count);
+        bleResult_t refResult = Linear_FindServiceRange(handle, &refStart, &refCount);
+
+        if (GattDb_GetIndexOfHandle(handle) != Linear_GetIndexOfHandle(handle))
+        {
+            printf("GattDb_GetIndexOfHandle(%u) differs\n", handle);
+            return 1;
+        }
+
+        if (GattDb_ServiceStartHandle(handle) != Linear_ServiceStartHandle(handle))
+        {
+            printf("GattDb_ServiceStartHandle(%u) differs\n", handle);
+            return 1;
+        }
+
+        if ((result != refResult) ||
+            ((result == gBleSuccess_c) && ((start != refStart) || (count != refCount))))
+        {
+            printf("GattDb_FindServiceRange(%u) differs\n", handle);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+#define BENCH(label, expr)                                                          \
+    do {                                                                            \
+        double start = Now();                                                       \
+        for (uint32_t n = 0U; n < iterations; n++)                                  \
+        {                                                                           \
+            for (uint32_t i = 0U; i < mAttributeCount_c; i++)                       \
+            {                                                                       \
+                uint16_t handle = maDatabase[i].handle;                             \
+                uint16_t service = maDatabase[i - (i % mAttributesPerService_c)].handle; \
+                uint16_t a, b;                                                      \
+                (void)handle; (void)service; (void)a; (void)b;                      \
+                expr;                                                               \
+            }                                                                       \
+        }                                                                           \
+        printf("    %-24s %8.1f ns\n", label,                                       \
+               (Now() - start) * 1e9 / ((double)iterations * mAttributeCount_c));   \
+    } while (0)
+
+/************************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+************************************************************************************/
+int main(int argc, char **argv)
+{
+    uint32_t iterations = mDefaultIterations_c;
+
+    if (argc > 1)
+    {
+        iterations = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+
+    for (int layout = 0; layout < 2; layout++)
+    {
+        FillDatabase((layout == 1) ? TRUE : FALSE);
+
+        if (CheckDatabase() != 0)
+        {
+            return 1;
+        }
+
+        printf("%u attributes, %u services, %s handles\n", mAttributeCount_c,
+               mAttributeCount_c / mAttributesPerService_c, (layout == 1) ? "with gaps in the" : "consecutive");
+        printf("  linear search\n");
+        BENCH("GetIndexOfHandle", mSink += Linear_GetIndexOfHandle(handle));
+        BENCH("ServiceStartHandle", mSink += Linear_ServiceStartHandle(handle));
+        BENCH("FindServiceRange", mSink += (uint32_t)Linear_FindServiceRange(service, &a, &b) + b);
+        printf("  gatt_database.c\n");
+        BENCH("GetIndexOfHandle", mSink += GattDb_GetIndexOfHandle(handle));
+        BENCH("ServiceStartHandle", mSink += GattDb_ServiceStartHandle(handle));
+        BENCH("FindServiceRange", mSink += (uint32_t)GattDb_FindServiceRange(service, &a, &b) + b);
+    }
+
+    return 0;
+}
@@ -0,0 +1,361 @@
+/*! *********************************************************************************
+* Copyright 2026 NXP
+*
+*
+* \file
+*
+* Host test of the GATT database hash. The incremental AES-CMAC of gatt_database.c
+* is checked against the RFC 4493 examples, fed whole and in chunks of every size.
+* GattDb_ComputeDatabaseHash is then checked against the one-shot computation it
+* replaced, which serialized the hashed attributes in a buffer for AES_128_CMAC, on
+* the static test database and on random databases.
+*
+* SPDX-License-Identifier: BSD-3-Clause
+********************************************************************************** */
+
+/************************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* The CMAC steps are private to the database, test them in the same translation unit */
+#include "gatt_database.c"
+
+/************************************************************************************
+*************************************************************************************
+* Private macros
+*************************************************************************************
+************************************************************************************/
+#define mRandomDatabases_c      2000U
+#define mMaxRandomAttributes_c  96U
+#define mMaxRandomValueLength_c 40U
+
+/************************************************************************************
+*************************************************************************************
+* Private type definitions
+*************************************************************************************
+************************************************************************************/
+typedef struct cmacVector_tag
+{
+    uint32_t        length;
+    const uint8_t*  pMac;
+} cmacVector_t;
+
+/************************************************************************************
+*************************************************************************************
+* Public memory declarations
+*************************************************************************************
+************************************************************************************/
+/* Kept by the host stack, which the test does not link */
+uint32_t mServerDatabaseHashIndex = gGattDbInvalidHandleIndex_d;
+uint32_t mServerClientSupportedFeatureIndex = gGattDbInvalidHandleIndex_d;
+
+/************************************************************************************
+*************************************************************************************
+* Private memory declarations
+*************************************************************************************
+************************************************************************************/
+/* RFC 4493 section 4 */
+static const uint8_t maRfcKey[16] =
+{
+    0x2B, 0x7E, 0x15, 0x16, 0x28, 0xAE, 0xD2, 0xA6, 0xAB, 0xF7, 0x15, 0x88, 0x09, 0xCF, 0x4F, 0x3C
+};
+
+static const uint8_t maRfcMessage[64] =
+{
+    0x6B, 0xC1, 0xBE, 0xE2, 0x2E, 0x40, 0x9F, 0x96, 0xE9, 0x3D, 0x7E, 0x11, 0x73, 0x93, 0x17, 0x2A,
+    0xAE, 0x2D, 0x8A, 0x57, 0x1E, 0x03, 0xAC, 0x9C, 0x9E, 0xB7, 0x6F, 0xAC, 0x45, 0xAF, 0x8E, 0x51,
+    0x30, 0xC8, 0x1C, 0x46, 0xA3, 0x5C, 0xE4, 0x11, 0xE5, 0xFB, 0xC1, 0x19, 0x1A, 0x0A, 0x52, 0xEF,
+    0xF6, 0x9F, 0x24, 0x45, 0xDF, 0x4F, 0x9B, 0x17, 0xAD, 0x2B, 0x41, 0x7B, 0xE6, 0x6C, 0x37, 0x10
+};
+
+static const uint8_t maRfcSubkeyL[16] =
+{
+    0x7D, 0xF7, 0x6B, 0x0C, 0x1A, 0xB8, 0x99, 0xB3, 0x3E, 0x42, 0xF0, 0x47, 0xB9, 0x1B, 0x54, 0x6F
+};
+
+static const uint8_t maRfcMac0[16] =
+{
+    0xBB, 0x1D, 0x69, 0x29, 0xE9, 0x59, 0x37, 0x28, 0x7F, 0xA3, 0x7D, 0x12, 0x9B, 0x75, 0x67, 0x46
+};
+
+static const uint8_t maRfcMac16[16] =
+{
+    0x07, 0x0A, 0x16, 0xB4, 0x6B, 0x4D, 0x41, 0x44, 0xF7, 0x9B, 0xDD, 0x9D, 0xD0, 0x4A, 0x28, 0x7C
+};
+
+static const uint8_t maRfcMac40[16] =
+{
+    0xDF, 0xA6, 0x67, 0x47, 0xDE, 0x9A, 0xE6, 0x30, 0x30, 0xCA, 0x32, 0x61, 0x14, 0x97, 0xC8, 0x27
+};
+
+static const uint8_t maRfcMac64[16] =
+{
+    0x51, 0xF0, 0xBE, 0xBF, 0x7E, 0x3B, 0x9D, 0x92, 0xFC, 0x49, 0x74, 0x17, 0x79, 0x36, 0x3C, 0xFE
+};
+
+static const cmacVector_t maRfcVectors[] =
+{
+    { 0U,  maRfcMac0  },
+    { 16U, maRfcMac16 },
+    { 40U, maRfcMac40 },
+    { 64U, maRfcMac64 },
+};
+
+/* 16-bit attribute types of the random databases, hashed or not */
+static const uint16_t maRandomUuids[] =
+{
+    gBleSig_PrimaryService_d, gBleSig_SecondaryService_d, gBleSig_Include_d, gBleSig_Characteristic_d,
+    gBleSig_CharExtendedProperties_d, gBleSig_CharUserDescription_d, gBleSig_CCCD_d, gBleSig_SCCD_d,
+    gBleSig_CharPresFormatDescriptor_d, gBleSig_CharAggregateFormat_d, gBleSig_GattClientSupportedFeatures_d,
+    gBleSig_GapDeviceName_d, gBleSig_BatteryLevel_d, gBleSig_HrMeasurement_d
+};
+
+static gattDbAttribute_t maRandomDatabase[mMaxRandomAttributes_c];
+static uint8_t maRandomValues[mMaxRandomAttributes_c][mMaxRandomValueLength_c];
+
+/************************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+************************************************************************************/
+static int CheckBlock(const char* pLabel, const uint8_t* pActual, const uint8_t* pExpected)
+{
+    if (memcmp(pActual, pExpected, gGattDatabaseHashSize_c) != 0)
+    {
+        printf("FAIL %s\n", pLabel);
+        return 1;
+    }
+    return 0;
+}
+
+/* Feeds the message to the incremental CMAC in chunks of the given size */
+static void StreamCmac(const uint8_t* pMessage, uint32_t length, uint32_t chunk, uint8_t* pMac)
+{
+    gattDbCmacContext_t context;
+
+    GattDb_CmacInit(&context, maRfcKey);
+    for (uint32_t offset = 0U; offset < length; offset += chunk)
+    {
+        GattDb_CmacUpdate(&context, &pMessage[offset], ((length - offset) < chunk) ? (length - offset) : chunk);
+    }
+    GattDb_CmacFinish(&context, pMac);
+}
+
+static int TestRfc4493(void)
+{
+    uint8_t aZero[gGattDatabaseHashSize_c] = {0U};
+    uint8_t aMac[gGattDatabaseHashSize_c];
+    char    aLabel[64];
+    int     failures = 0;
+
+    AES_128_Encrypt(aZero, maRfcKey, aMac);
+    failures += CheckBlock("AES-128(K, 0)", aMac, maRfcSubkeyL);
+
+    for (uint32_t v = 0U; v < (sizeof(maRfcVectors) / sizeof(maRfcVectors[0])); v++)
+    {
+        uint32_t length = maRfcVectors[v].length;
+
+        (void)snprintf(aLabel, sizeof(aLabel), "AES_128_CMAC, %u byte example", length);
+        AES_128_CMAC(maRfcMessage, length, maRfcKey, aMac);
+        failures += CheckBlock(aLabel, aMac, maRfcVectors[v].pMac);
+
+        for (uint32_t chunk = 1U; chunk <= ((length == 0U) ? 1U : length); chunk++)
+        {
+            (void)snprintf(aLabel, sizeof(aLabel), "incremental CMAC, %u byte example, %u byte updates", length, chunk);
+            StreamCmac(maRfcMessage, length, chunk, aMac);
+            failures += CheckBlock(aLabel, aMac, maRfcVectors[v].pMac);
+        }
+    }
+
+    return failures;
+}
+
+/* The hash as computed before the incremental CMAC: the hashed attributes are
+   serialized in one buffer, then authenticated at once */
+static void OneShotDatabaseHash(uint8_t* pHash, uint32_t* pHashIndex, uint32_t* pFeaturesIndex)
+{
+    uint8_t* pContent = malloc(((size_t)gGattDbAttributeCount_c * (4U + 0xFFFFU)) + 1U);
+    uint32_t length = 0U;
+    uint8_t  aKey[gGattDatabaseHashSize_c] = {0U};
+
+    *pHashIndex = gGattDbInvalidHandleIndex_d;
+    *pFeaturesIndex = gGattDbInvalidHandleIndex_d;
+
+    for (uint32_t index = 0U; index < gGattDbAttributeCount_c; index++)
+    {
+        if (gattDatabase[index].uuidType == (uint16_t)gBleUuidType16_c)
+        {
+            switch (gattDatabase[index].uuid)
+            {
+                case gBleSig_PrimaryService_d:
+                case gBleSig_SecondaryService_d:
+                case gBleSig_Include_d:
+                case gBleSig_Characteristic_d:
+                case gBleSig_CharExtendedProperties_d:
+                    Utils_PackTwoByteValue(gattDatabase[index].handle, &pContent[length]);
+                    length += sizeof(uint16_t);
+                    Utils_PackTwoByteValue(gattDatabase[index].uuid, &pContent[length]);
+                    length += sizeof(uint16_t);
+                    memcpy(&pContent[length], gattDatabase[index].pValue, gattDatabase[index].valueLength);
+                    length += gattDatabase[index].valueLength;
+                    break;
+
+                case gBleSig_CharUserDescription_d:
+                case gBleSig_CCCD_d:
+                case gBleSig_SCCD_d:
+                case gBleSig_CharPresFormatDescriptor_d:
+                case gBleSig_CharAggregateFormat_d:
+                    Utils_PackTwoByteValue(gattDatabase[index].handle, &pContent[length]);
+                    length += sizeof(uint16_t);
+                    Utils_PackTwoByteValue(gattDatabase[index].uuid, &pContent[length]);
+                    length += sizeof(uint16_t);
+                    break;
+
+                case gBleSig_GattClientSupportedFeatures_d:
+                    *pFeaturesIndex = index;
+                    break;
+
+                case gBleSig_GattDatabaseHash_d:
+                    *pHashIndex = index;
+                    break;
+
+                default:
+                    break;
+            }
+        }
+    }
+
+    AES_128_CMAC(pContent, length, aKey, pHash);
+    Utils_RevertByteArray(pHash, gGattDatabaseHashSize_c);
+    free(pContent);
+}
+
+/* Runs GattDb_ComputeDatabaseHash on the current database and compares it with the
+   one-shot hash */
+static int CheckDatabaseHash(const char* pLabel)
+{
+    uint8_t  aExpected[gGattDatabaseHashSize_c];
+    uint32_t expectedHashIndex;
+    uint32_t expectedFeaturesIndex;
+
+    OneShotDatabaseHash(aExpected, &expectedHashIndex, &expectedFeaturesIndex);
+
+    mServerDatabaseHashIndex = gGattDbInvalidHandleIndex_d;
+    mServerClientSupportedFeatureIndex = gGattDbInvalidHandleIndex_d;
+    if (GattDb_ComputeDatabaseHash() != gBleSuccess_c)
+    {
+        printf("FAIL %s: GattDb_ComputeDatabaseHash\n", pLabel);
+        return 1;
+    }
+
+    if ((mServerDatabaseHashIndex != expectedHashIndex) ||
+        (mServerClientSupportedFeatureIndex != expectedFeaturesIndex))
+    {
+        printf("FAIL %s: Database Hash or Client Supported Features index\n", pLabel);
+        return 1;
+    }
+
+    return CheckBlock(pLabel, gattDatabase[expectedHashIndex].pValue, aExpected);
+}
+
+static int TestStaticDatabase(void)
+{
+    int failures = 0;
+
+    if (GattDb_Init() != gBleSuccess_c)
+    {
+        printf("FAIL GattDb_Init\n");
+        return 1;
+    }
+
+    failures += CheckDatabaseHash("static database hash");
+
+    /* The static service index covers every service of gatt_db.h */
+    if ((GattDb_ServiceIndexReady() == FALSE) ||
+        (mServiceIndexCount != (localGattDbServiceIndexSize_d - 1U)))
+    {
+        printf("FAIL static service index\n");
+        failures++;
+    }
+
+    return failures;
+}
+
+static int TestRandomDatabases(void)
+{
+    gattDbAttribute_t* pStaticDatabase = gattDatabase;
+    uint16_t staticAttributeCount = gGattDbAttributeCount_c;
+    char     aLabel[48];
+    int      failures = 0;
+
+    srand(4493);
+
+    for (uint32_t n = 0U; (n < mRandomDatabases_c) && (failures == 0); n++)
+    {
+        uint32_t count = 1U + ((uint32_t)rand() % mMaxRandomAttributes_c);
+        uint32_t hashIndex = (uint32_t)rand() % count;
+        uint16_t handle = 1U;
+
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            gattDbAttribute_t* pAttribute = &maRandomDatabase[i];
+
+            pAttribute->handle = handle;
+            handle += 1U + (((rand() % 8) == 0) ? (uint16_t)(rand() % 5) : 0U);
+            pAttribute->uuidType = ((rand() % 10) == 0) ? (uint16_t)gBleUuidType128_c : (uint16_t)gBleUuidType16_c;
+            pAttribute->uuid = maRandomUuids[(uint32_t)rand() % (sizeof(maRandomUuids) / sizeof(maRandomUuids[0]))];
+            pAttribute->pValue = maRandomValues[i];
+            pAttribute->valueLength = (uint16_t)((uint32_t)rand() % (mMaxRandomValueLength_c + 1U));
+
+            for (uint32_t j = 0U; j < mMaxRandomValueLength_c; j++)
+            {
+                maRandomValues[i][j] = (uint8_t)rand();
+            }
+
+            if (i == hashIndex)
+            {
+                pAttribute->uuidType = (uint16_t)gBleUuidType16_c;
+                pAttribute->uuid = gBleSig_GattDatabaseHash_d;
+                pAttribute->valueLength = gGattDatabaseHashSize_c;
+            }
+        }
+
+        gattDatabase = maRandomDatabase;
+        gGattDbAttributeCount_c = (uint16_t)count;
+
+        (void)snprintf(aLabel, sizeof(aLabel), "random database %u", n);
+        failures += CheckDatabaseHash(aLabel);
+    }
+
+    gattDatabase = pStaticDatabase;
+    gGattDbAttributeCount_c = staticAttributeCount;
+
+    return failures;
+}
+
+/************************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+************************************************************************************/
+int main(void)
+{
+    int failures = 0;
+
+    failures += TestRfc4493();
+    failures += TestStaticDatabase();
+    failures += TestRandomDatabases();
+
+    if (failures == 0)
+    {
+        printf("gatt_db_hash_test: RFC 4493 examples, static database and %u random databases passed\n",
+               mRandomDatabases_c);
+    }
+
+    return (failures == 0) ? 0 : 1;
+}
@@ -0,0 +1,39 @@
+/*! *********************************************************************************
+* Copyright 2026 NXP
+*
+*
+* \file
+*
+* SPDX-License-Identifier: BSD-3-Clause
+********************************************************************************** */
+/* Host stand-in for the framework types, used by the GATT database host tests */
+#ifndef EMBEDDED_TYPES_H
+#define EMBEDDED_TYPES_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef uint8_t         bool_t;
+typedef unsigned char   uchar_t;
+
+#define TRUE    1
+#define FALSE   0
+
+#define BIT0    0x01U
+#define BIT1    0x02U
+#define BIT2    0x04U
+#define BIT3    0x08U
+#define BIT4    0x10U
+#define BIT5    0x20U
+#define BIT6    0x40U
+#define BIT7    0x80U
+#define BIT8    0x100U
+#define BIT9    0x200U
+#define BIT10   0x400U
+#define BIT11   0x800U
+#define BIT12   0x1000U
+#define BIT13   0x2000U
+#define BIT14   0x4000U
+#define BIT15   0x8000U
+
+#endif /* EMBEDDED_TYPES_H */
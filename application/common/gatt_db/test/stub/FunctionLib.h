@@ -0,0 +1,19 @@
+/*! *********************************************************************************
+* Copyright 2026 NXP
+*
+*
+* \file
+*
+* SPDX-License-Identifier: BSD-3-Clause
+********************************************************************************** */
+/* Host stand-in for the framework memory functions */
+#ifndef FUNCTION_LIB_H
+#define FUNCTION_LIB_H
+
+#include <string.h>
+
+#define FLib_MemCpy(pDst, pSrc, cBytes)     (void)memcpy((pDst), (pSrc), (cBytes))
+#define FLib_MemSet(pDst, value, cBytes)    (void)memset((pDst), (value), (cBytes))
+#define FLib_MemCmp(pData1, pData2, cBytes) (0 == memcmp((pData1), (pData2), (cBytes)))
+
+#endif /* FUNCTION_LIB_H */
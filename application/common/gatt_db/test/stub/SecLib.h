@@ -0,0 +1,23 @@
+/*! *********************************************************************************
+* Copyright 2026 NXP
+*
+*
+* \file
+*
+* SPDX-License-Identifier: BSD-3-Clause
+********************************************************************************** */
+/* Host stand-in for SecLib, the AES functions are in aes.c */
+#ifndef SEC_LIB_H
+#define SEC_LIB_H
+
+#include "EmbeddedTypes.h"
+
+typedef struct
+{
+    uint8_t raw[64];
+} ecdhPublicKey_t;
+
+void AES_128_Encrypt(const uint8_t* pInput, const uint8_t* pKey, uint8_t* pOutput);
+void AES_128_CMAC(const uint8_t* pInput, uint32_t inputLen, const uint8_t* pKey, uint8_t* pOutput);
+
+#endif /* SEC_LIB_H */
@@ -0,0 +1,224 @@
+/*! *********************************************************************************
+* Copyright 2026 NXP
+*
+*
+* \file
+*
+* Host stand-in for the SecLib AES-128 functions used by the GATT database: a
+* byte oriented FIPS-197 block encryption and a one-shot RFC 4493 AES-CMAC.
+*
+* SPDX-License-Identifier: BSD-3-Clause
+********************************************************************************** */
+
+/************************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+************************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "SecLib.h"
+
+/************************************************************************************
+*************************************************************************************
+* Private macros
+*************************************************************************************
+************************************************************************************/
+#define mAesBlockSize_c     16U
+#define mAesRounds_c        10U
+
+/************************************************************************************
+*************************************************************************************
+* Private memory declarations
+*************************************************************************************
+************************************************************************************/
+static const uint8_t maSbox[256] =
+{
+    0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+    0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+    0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+    0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+    0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+    0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+    0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+    0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+    0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+    0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+    0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+    0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+    0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+    0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+    0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+    0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16
+};
+
+/************************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+************************************************************************************/
+static uint8_t Aes_Xtime(uint8_t x)
+{
+    return (uint8_t)((uint8_t)(x << 1) ^ (((x & 0x80U) != 0U) ? 0x1BU : 0x00U));
+}
+
+static void Aes_ExpandKey(const uint8_t* pKey, uint8_t* pRoundKeys)
+{
+    uint8_t rcon = 0x01U;
+
+    memcpy(pRoundKeys, pKey, mAesBlockSize_c);
+
+    for (uint32_t i = mAesBlockSize_c; i < (mAesRounds_c + 1U) * mAesBlockSize_c; i += 4U)
+    {
+        uint8_t t[4];
+
+        memcpy(t, &pRoundKeys[i - 4U], 4U);
+
+        if ((i % mAesBlockSize_c) == 0U)
+        {
+            /* RotWord, SubWord and Rcon */
+            uint8_t first = t[0];
+
+            t[0] = (uint8_t)(maSbox[t[1]] ^ rcon);
+            t[1] = maSbox[t[2]];
+            t[2] = maSbox[t[3]];
+            t[3] = maSbox[first];
+            rcon = Aes_Xtime(rcon);
+        }
+
+        for (uint32_t j = 0U; j < 4U; j++)
+        {
+            pRoundKeys[i + j] = (uint8_t)(pRoundKeys[i + j - mAesBlockSize_c] ^ t[j]);
+        }
+    }
+}
+
+static void Aes_AddRoundKey(uint8_t* pState, const uint8_t* pRoundKey)
+{
+    for (uint32_t i = 0U; i < mAesBlockSize_c; i++)
+    {
+        pState[i] ^= pRoundKey[i];
+    }
+}
+
+/* SubBytes and ShiftRows, the state is stored column by column */
+static void Aes_SubShift(uint8_t* pState)
+{
+    uint8_t t[mAesBlockSize_c];
+
+    for (uint32_t c = 0U; c < 4U; c++)
+    {
+        for (uint32_t r = 0U; r < 4U; r++)
+        {
+            t[(4U * c) + r] = maSbox[pState[(4U * ((c + r) % 4U)) + r]];
+        }
+    }
+
+    memcpy(pState, t, mAesBlockSize_c);
+}
+
+static void Aes_MixColumns(uint8_t* pState)
+{
+    for (uint32_t c = 0U; c < 4U; c++)
+    {
+        uint8_t* pColumn = &pState[4U * c];
+        uint8_t all = (uint8_t)(pColumn[0] ^ pColumn[1] ^ pColumn[2] ^ pColumn[3]);
+        uint8_t first = pColumn[0];
+
+        pColumn[0] ^= (uint8_t)(all ^ Aes_Xtime((uint8_t)(pColumn[0] ^ pColumn[1])));
+        pColumn[1] ^= (uint8_t)(all ^ Aes_Xtime((uint8_t)(pColumn[1] ^ pColumn[2])));
+        pColumn[2] ^= (uint8_t)(all ^ Aes_Xtime((uint8_t)(pColumn[2] ^ pColumn[3])));
+        pColumn[3] ^= (uint8_t)(all ^ Aes_Xtime((uint8_t)(pColumn[3] ^ first)));
+    }
+}
+
+static void Cmac_Subkey(uint8_t* pKey)
+{
+    uint8_t msb = pKey[0] & 0x80U;
+
+    for (uint32_t i = 0U; i < (mAesBlockSize_c - 1U); i++)
+    {
+        pKey[i] = (uint8_t)((uint8_t)(pKey[i] << 1) | (pKey[i + 1U] >> 7));
+    }
+    pKey[mAesBlockSize_c - 1U] = (uint8_t)(pKey[mAesBlockSize_c - 1U] << 1);
+
+    if (msb != 0U)
+    {
+        pKey[mAesBlockSize_c - 1U] ^= 0x87U;
+    }
+}
+
+/************************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+************************************************************************************/
+void AES_128_Encrypt(const uint8_t* pInput, const uint8_t* pKey, uint8_t* pOutput)
+{
+    uint8_t aRoundKeys[(mAesRounds_c + 1U) * mAesBlockSize_c];
+    uint8_t aState[mAesBlockSize_c];
+
+    Aes_ExpandKey(pKey, aRoundKeys);
+    memcpy(aState, pInput, mAesBlockSize_c);
+
+    Aes_AddRoundKey(aState, aRoundKeys);
+    for (uint32_t round = 1U; round <= mAesRounds_c; round++)
+    {
+        Aes_SubShift(aState);
+        if (round != mAesRounds_c)
+        {
+            Aes_MixColumns(aState);
+        }
+        Aes_AddRoundKey(aState, &aRoundKeys[round * mAesBlockSize_c]);
+    }
+
+    memcpy(pOutput, aState, mAesBlockSize_c);
+}
+
+/* RFC 4493 section 2.4, on the whole message at once */
+void AES_128_CMAC(const uint8_t* pInput, uint32_t inputLen, const uint8_t* pKey, uint8_t* pOutput)
+{
+    uint8_t  aSubkey[mAesBlockSize_c] = {0U};
+    uint8_t  aLast[mAesBlockSize_c] = {0U};
+    uint8_t  aState[mAesBlockSize_c] = {0U};
+    uint32_t blocks = (inputLen + mAesBlockSize_c - 1U) / mAesBlockSize_c;
+    uint32_t lastLength;
+
+    AES_128_Encrypt(aSubkey, pKey, aSubkey);
+    Cmac_Subkey(aSubkey);
+
+    if (blocks == 0U)
+    {
+        blocks = 1U;
+    }
+
+    lastLength = inputLen - ((blocks - 1U) * mAesBlockSize_c);
+    memcpy(aLast, &pInput[(blocks - 1U) * mAesBlockSize_c], lastLength);
+
+    if (lastLength < mAesBlockSize_c)
+    {
+        aLast[lastLength] = 0x80U;
+        Cmac_Subkey(aSubkey);
+    }
+
+    for (uint32_t i = 0U; i < mAesBlockSize_c; i++)
+    {
+        aLast[i] ^= aSubkey[i];
+    }
+
+    for (uint32_t block = 0U; block < (blocks - 1U); block++)
+    {
+        for (uint32_t i = 0U; i < mAesBlockSize_c; i++)
+        {
+            aState[i] ^= pInput[(block * mAesBlockSize_c) + i];
+        }
+        AES_128_Encrypt(aState, pKey, aState);
+    }
+
+    for (uint32_t i = 0U; i < mAesBlockSize_c; i++)
+    {
+        aState[i] ^= aLast[i];
+    }
+    AES_128_Encrypt(aState, pKey, pOutput);
+}
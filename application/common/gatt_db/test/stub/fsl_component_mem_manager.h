@@ -0,0 +1,18 @@
+/*! *********************************************************************************
+* Copyright 2026 NXP
+*
+*
+* \file
+*
+* SPDX-License-Identifier: BSD-3-Clause
+********************************************************************************** */
+/* Host stand-in for the memory manager */
+#ifndef FSL_COMPONENT_MEM_MANAGER_H
+#define FSL_COMPONENT_MEM_MANAGER_H
+
+#include <stdlib.h>
+
+#define MEM_BufferAlloc(numBytes)   malloc(numBytes)
+#define MEM_BufferFree(buffMsg)     (free(buffMsg), 0)
+
+#endif /* FSL_COMPONENT_MEM_MANAGER_H */
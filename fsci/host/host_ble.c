@@ -22,6 +22,7 @@
 
 #include "fsci_ble.h"
 #include "ble_general.h"
+#include "host_ble.h"
 
 #if gFsciIncluded_c
 #include "FsciInterface.h"
@@ -42,6 +43,26 @@
 *************************************************************************************
 ************************************************************************************/
 
+/*! State of an asynchronous command in the pipeline */
+typedef enum
+{
+    mAsyncCmdWaiting_c,     /* Completes with its status or out parameters */
+    mAsyncCmdTimedOut_c,    /* Completed with a timeout, still takes its late status and out parameters */
+    mAsyncCmdDone_c         /* Released once the commands sent before are */
+} fsciHostAsyncState_t;
+
+/*! Asynchronous command waiting for its status or its out parameters */
+typedef struct fsciHostAsyncCmd_tag
+{
+    bleAsyncCmdCallback_t   pfCallback;
+    void*                   pParam;
+    uint64_t                tStamp;             /* Time from which the status is awaited, or of the timeout */
+    uint8_t                 opGroup;
+    bool_t                  bHasOutParams;
+    bool_t                  bStatusReceived;    /* Successful status received, out parameters awaited */
+    fsciHostAsyncState_t    state;
+} fsciHostAsyncCmd_t;
+
 /************************************************************************************
 *************************************************************************************
 * Private memory declarations
@@ -51,6 +72,20 @@
 /* Flag which indicates if function has out parameters */
 static volatile bool_t bFunctionHasOutParams = FALSE;
 
+/* Asynchronous commands in the order they were sent, the oldest at mAsyncHead. Timed
+   out commands keep their place for another timeout, so that their late status is not
+   taken for the one of the next command of the same opcode group. */
+static fsciHostAsyncCmd_t maAsyncCmds[gFsciHostAsyncMaxDepth_c];
+static volatile uint8_t   mAsyncHead = 0U;
+static volatile uint8_t   mAsyncCount = 0U;
+static uint8_t            mAsyncDepth = gFsciHostAsyncMaxDepth_c;
+
+/* The out parameters are kept by FSCI for a single command per layer */
+static volatile bool_t    mAsyncOutParamsPending = FALSE;
+
+/* Set while a completion callback runs, the callback must not wait for the pipeline */
+static bool_t             mAsyncInCallback = FALSE;
+
 #if gFsciIncluded_c && gFsciHostSupport_c
 extern clientPacket_t *pFsciHostSyncRsp;
 
@@ -65,6 +100,13 @@ extern osaEventId_t    gFsciHostSyncRspEventId;
 *************************************************************************************
 ************************************************************************************/
 
+static void Ble_AsyncWait(void);
+static fsciHostAsyncCmd_t* Ble_AsyncFind(uint8_t opGroup, bool_t bStatusReceived);
+static fsciHostAsyncCmd_t* Ble_AsyncOldestWaiting(void);
+static void Ble_AsyncSetState(fsciHostAsyncCmd_t* pCmd, fsciHostAsyncState_t state);
+static void Ble_AsyncReleaseDone(void);
+static void Ble_AsyncComplete(fsciHostAsyncCmd_t* pCmd, bleResult_t result, bool_t bTimeout);
+
 /************************************************************************************
 *************************************************************************************
 * Public functions
@@ -143,16 +185,362 @@ bleResult_t Ble_GetCmdStatus(bool_t bHasOutParams)
 
 void Ble_OutParamsReady(void)
 {
+    /* The out parameters of the asynchronous command awaiting them, if any */
+    fsciHostAsyncCmd_t* pCmd = Ble_AsyncFind(0U, TRUE);
+
+    if( NULL != pCmd )
+    {
+        Ble_AsyncComplete(pCmd, gBleSuccess_c, FALSE);
+        return;
+    }
+
     /* Reset flag which indicates if function has out parameters */
     bFunctionHasOutParams = FALSE;
 }
 
+/*! *********************************************************************************
+* \brief  Takes the FSCI host synchronization for a blocking command, once the
+*         asynchronous commands sent before have completed: their status must not
+*         be taken for the one of the blocking command.
+*
+* \param[in] fsciInterfaceId  FSCI interface of the command.
+* \param[in] opGroup          Operation group of the status awaited.
+* \param[in] opCode           Operation code of the status awaited.
+********************************************************************************** */
+void Ble_HostSyncLock(uint32_t fsciInterfaceId, uint8_t opGroup, uint8_t opCode)
+{
+    (void)Ble_AsyncFlush();
+    FSCI_HostSyncLock(fsciInterfaceId, opGroup, opCode);
+}
+
+/*! *********************************************************************************
+* \brief  Sets the number of asynchronous commands which may wait for their status
+*         at once. Commands already sent are not affected.
+*
+* \param[in] depth  From 1 to gFsciHostAsyncMaxDepth_c.
+*
+* \return gBleSuccess_c or gBleInvalidParameter_c.
+********************************************************************************** */
+bleResult_t Ble_AsyncSetDepth(uint8_t depth)
+{
+    if( (depth == 0U) || (depth > gFsciHostAsyncMaxDepth_c) )
+    {
+        return gBleInvalidParameter_c;
+    }
+
+    mAsyncDepth = depth;
+
+    return gBleSuccess_c;
+}
+
+/*! *********************************************************************************
+* \brief  Reserves the place of an asynchronous command in the pipeline. Called by
+*         the asynchronous wrappers right before sending the command.
+*
+*         Waits while the pipeline is full, or while another command with out
+*         parameters is pending if this one has some, except from a completion
+*         callback which gets gBleOverflow_c instead. A timed out command holds its
+*         place for another timeout.
+*
+* \param[in] opGroup        Operation group of the command and of its status.
+* \param[in] bHasOutParams  TRUE if the command has out parameters.
+* \param[in] pfCallback     Called on completion, may be NULL.
+* \param[in] pParam         Passed to pfCallback.
+*
+* \return gBleSuccess_c, gBleOverflow_c or gBleUnexpectedError_c on timeout.
+********************************************************************************** */
+bleResult_t Ble_AsyncCmdBegin
+(
+    uint8_t                 opGroup,
+    bool_t                  bHasOutParams,
+    bleAsyncCmdCallback_t   pfCallback,
+    void*                   pParam
+)
+{
+    fsciHostAsyncCmd_t* pCmd;
+    uint64_t tStamp = TMR_GetTimestamp();
+
+    while( (mAsyncCount >= mAsyncDepth) || (bHasOutParams && mAsyncOutParamsPending) )
+    {
+        if( mAsyncInCallback )
+        {
+            return gBleOverflow_c;
+        }
+
+        if( TMR_GetTimestamp() - tStamp > mFsciHost_WaitForStatusTimeout_us_c * (mAsyncDepth + 1U) )
+        {
+            return gBleUnexpectedError_c;
+        }
+
+        Ble_AsyncWait();
+    }
+
+    OSA_InterruptDisable();
+    pCmd = &maAsyncCmds[(mAsyncHead + mAsyncCount) % gFsciHostAsyncMaxDepth_c];
+    pCmd->pfCallback = pfCallback;
+    pCmd->pParam = pParam;
+    pCmd->tStamp = TMR_GetTimestamp();
+    pCmd->opGroup = opGroup;
+    pCmd->bHasOutParams = bHasOutParams;
+    pCmd->bStatusReceived = FALSE;
+    pCmd->state = mAsyncCmdWaiting_c;
+    mAsyncCount++;
+
+    if( bHasOutParams )
+    {
+        mAsyncOutParamsPending = TRUE;
+    }
+    OSA_InterruptEnable();
+
+    return gBleSuccess_c;
+}
+
+/*! *********************************************************************************
+* \brief  Matches a status event with the oldest asynchronous command of its opcode
+*         group still awaiting one, timed out or not. Called by the status handlers
+*         of the FSCI layers, which only see the statuses not taken by a blocking
+*         command.
+*
+* \param[in] opGroup  Operation group of the status.
+* \param[in] status   The status.
+********************************************************************************** */
+void Ble_AsyncCmdStatus(uint8_t opGroup, bleResult_t status)
+{
+    fsciHostAsyncCmd_t* pCmd = Ble_AsyncFind(opGroup, FALSE);
+
+    if( NULL == pCmd )
+    {
+        /* Not the status of an asynchronous command */
+        return;
+    }
+
+    if( (gBleSuccess_c == status) && pCmd->bHasOutParams )
+    {
+        /* Complete when the out parameters event is handled */
+        pCmd->bStatusReceived = TRUE;
+    }
+    else
+    {
+        Ble_AsyncComplete(pCmd, status, FALSE);
+    }
+}
+
+/*! *********************************************************************************
+* \brief  Receives the pending events and fails the oldest asynchronous command if
+*         its status is late. To be called periodically by the application while
+*         asynchronous commands are pending.
+*
+*         The timed out command keeps its place for another timeout to take its late
+*         status, after which the status is taken as lost.
+********************************************************************************** */
+void Ble_AsyncProcess(void)
+{
+    fsciHostAsyncCmd_t* pCmd;
+    uint64_t now;
+    bool_t bTimeout = FALSE;
+
+#if !gFsciHostSyncUseEvent_c
+    FSCI_receivePacket((void*)fsciBleInterfaceId);
+#endif
+
+    OSA_InterruptDisable();
+    now = TMR_GetTimestamp();
+
+    for( uint8_t i = 0U; i < mAsyncCount; i++ )
+    {
+        pCmd = &maAsyncCmds[(mAsyncHead + i) % gFsciHostAsyncMaxDepth_c];
+
+        if( (mAsyncCmdTimedOut_c == pCmd->state) && (now - pCmd->tStamp > mFsciHost_WaitForStatusTimeout_us_c) )
+        {
+            /* The late status is taken as lost */
+            Ble_AsyncSetState(pCmd, mAsyncCmdDone_c);
+        }
+    }
+    Ble_AsyncReleaseDone();
+
+    pCmd = Ble_AsyncOldestWaiting();
+    if( (NULL != pCmd) && (now - pCmd->tStamp > mFsciHost_WaitForStatusTimeout_us_c) )
+    {
+        bTimeout = TRUE;
+    }
+    OSA_InterruptEnable();
+
+    if( bTimeout )
+    {
+        /* Timeout on the receiving the response */
+        Ble_AsyncComplete(pCmd, gBleUnexpectedError_c, TRUE);
+    }
+}
+
+/*! *********************************************************************************
+* \brief  Waits for all the asynchronous commands to complete.
+*
+* \return gBleSuccess_c, gBleOverflow_c if called from a completion callback.
+********************************************************************************** */
+bleResult_t Ble_AsyncFlush(void)
+{
+    if( mAsyncInCallback && (mAsyncCount > 0U) )
+    {
+        return gBleOverflow_c;
+    }
+
+    while( mAsyncCount > 0U )
+    {
+        Ble_AsyncWait();
+    }
+
+    return gBleSuccess_c;
+}
+
+uint8_t Ble_AsyncPendingCount(void)
+{
+    return mAsyncCount;
+}
+
 /*************************************************************************************
  *************************************************************************************
  * Private functions
  *************************************************************************************
  ************************************************************************************/
 
+static void Ble_AsyncWait(void)
+{
+#if gFsciHostSyncUseEvent_c
+    /* The events are received by the FSCI task */
+    OSA_TimeDelay(1U);
+#endif
+    Ble_AsyncProcess();
+}
+
+/*! *********************************************************************************
+* \brief  Finds the oldest asynchronous command, timed out or not, awaiting its status
+*         in the given opcode group, or awaiting its out parameters.
+*
+* \param[in] opGroup          Operation group of the status, unused for the out
+*                             parameters.
+* \param[in] bStatusReceived  TRUE to find the command awaiting its out parameters.
+*
+* \return The command or NULL.
+********************************************************************************** */
+static fsciHostAsyncCmd_t* Ble_AsyncFind(uint8_t opGroup, bool_t bStatusReceived)
+{
+    fsciHostAsyncCmd_t* pCmd = NULL;
+
+    for( uint8_t i = 0U; i < mAsyncCount; i++ )
+    {
+        fsciHostAsyncCmd_t* pCrt = &maAsyncCmds[(mAsyncHead + i) % gFsciHostAsyncMaxDepth_c];
+
+        if( (mAsyncCmdDone_c != pCrt->state) && (pCrt->bStatusReceived == bStatusReceived) &&
+            (bStatusReceived || (pCrt->opGroup == opGroup)) )
+        {
+            pCmd = pCrt;
+            break;
+        }
+    }
+
+    return pCmd;
+}
+
+/*! *********************************************************************************
+* \brief  Finds the oldest asynchronous command which has not completed yet.
+*
+* \return The command or NULL.
+********************************************************************************** */
+static fsciHostAsyncCmd_t* Ble_AsyncOldestWaiting(void)
+{
+    fsciHostAsyncCmd_t* pCmd = NULL;
+
+    for( uint8_t i = 0U; i < mAsyncCount; i++ )
+    {
+        fsciHostAsyncCmd_t* pCrt = &maAsyncCmds[(mAsyncHead + i) % gFsciHostAsyncMaxDepth_c];
+
+        if( mAsyncCmdWaiting_c == pCrt->state )
+        {
+            pCmd = pCrt;
+            break;
+        }
+    }
+
+    return pCmd;
+}
+
+/*! *********************************************************************************
+* \brief  Moves a command to the given state. Called with the interrupts disabled.
+********************************************************************************** */
+static void Ble_AsyncSetState(fsciHostAsyncCmd_t* pCmd, fsciHostAsyncState_t state)
+{
+    uint64_t now = TMR_GetTimestamp();
+    bool_t bOldest = (pCmd == Ble_AsyncOldestWaiting());
+
+    if( (mAsyncCmdDone_c == state) && pCmd->bHasOutParams )
+    {
+        mAsyncOutParamsPending = FALSE;
+    }
+
+    pCmd->state = state;
+    pCmd->tStamp = now;
+
+    if( bOldest )
+    {
+        /* The next command is only expected to answer from now on */
+        pCmd = Ble_AsyncOldestWaiting();
+
+        if( NULL != pCmd )
+        {
+            pCmd->tStamp = now;
+        }
+    }
+}
+
+/*! *********************************************************************************
+* \brief  Frees the places of the done commands at the head of the pipeline. Called
+*         with the interrupts disabled.
+********************************************************************************** */
+static void Ble_AsyncReleaseDone(void)
+{
+    while( (mAsyncCount > 0U) && (mAsyncCmdDone_c == maAsyncCmds[mAsyncHead].state) )
+    {
+        mAsyncHead = (mAsyncHead + 1U) % gFsciHostAsyncMaxDepth_c;
+        mAsyncCount--;
+    }
+}
+
+/*! *********************************************************************************
+* \brief  Completes a command with its status or out parameters, or with a timeout.
+*         A timed out command is only released by its late status or out parameters,
+*         or by a second timeout, without calling its callback again.
+********************************************************************************** */
+static void Ble_AsyncComplete(fsciHostAsyncCmd_t* pCmd, bleResult_t result, bool_t bTimeout)
+{
+    bleAsyncCmdCallback_t pfCallback = NULL;
+    void* pParam = NULL;
+
+    OSA_InterruptDisable();
+    if( mAsyncCmdWaiting_c == pCmd->state )
+    {
+        pfCallback = pCmd->pfCallback;
+        pParam = pCmd->pParam;
+        Ble_AsyncSetState(pCmd, bTimeout ? mAsyncCmdTimedOut_c : mAsyncCmdDone_c);
+    }
+    else if( (mAsyncCmdTimedOut_c == pCmd->state) && !bTimeout )
+    {
+        Ble_AsyncSetState(pCmd, mAsyncCmdDone_c);
+    }
+    else
+    {
+        ; /* For MISRA compliance */
+    }
+    Ble_AsyncReleaseDone();
+    OSA_InterruptEnable();
+
+    if( NULL != pfCallback )
+    {
+        mAsyncInCallback = TRUE;
+        pfCallback(result, pParam);
+        mAsyncInCallback = FALSE;
+    }
+}
+
 /*! *********************************************************************************
 * @}
 ********************************************************************************** */
@@ -23,12 +23,31 @@
 *************************************************************************************
 ************************************************************************************/
 
+/************************************************************************************
+*************************************************************************************
+* Public macros
+*************************************************************************************
+************************************************************************************/
+
+/*! Maximum number of asynchronous commands waiting for their status at once */
+#ifndef gFsciHostAsyncMaxDepth_c
+#define gFsciHostAsyncMaxDepth_c    8U
+#endif
+
 /************************************************************************************
 *************************************************************************************
 * Public type definitions
 *************************************************************************************
 ************************************************************************************/
 
+/*! Completion of an asynchronous command: called with the status of the command
+    once it is received and, for a command with out parameters, once these are
+    written. The out parameters must stay valid until then, or until Ble_AsyncFlush
+    returns if the command timed out, as they may still arrive late. The callback may send
+    further asynchronous commands, which fail with gBleOverflow_c instead of waiting
+    for room, but no blocking command while asynchronous ones are pending. */
+typedef void (*bleAsyncCmdCallback_t)(bleResult_t result, void* pParam);
+
 /************************************************************************************
 *************************************************************************************
 * Public memory declarations
@@ -45,6 +64,80 @@ bleResult_t Ble_GetCmdStatus(bool_t bHasOutParams);
 
 void Ble_OutParamsReady(void);
 
+void Ble_HostSyncLock(uint32_t fsciInterfaceId, uint8_t opGroup, uint8_t opCode);
+
+bleResult_t Ble_AsyncSetDepth(uint8_t depth);
+
+bleResult_t Ble_AsyncCmdBegin
+(
+    uint8_t                 opGroup,
+    bool_t                  bHasOutParams,
+    bleAsyncCmdCallback_t   pfCallback,
+    void*                   pParam
+);
+
+void Ble_AsyncCmdStatus(uint8_t opGroup, bleResult_t status);
+
+void Ble_AsyncProcess(void);
+
+bleResult_t Ble_AsyncFlush(void);
+
+uint8_t Ble_AsyncPendingCount(void);
+
+bleResult_t Gap_CheckNotificationStatusAsync
+(
+    deviceId_t              deviceId,
+    uint16_t                handle,
+    bool_t*                 pOutIsActive,
+    bleAsyncCmdCallback_t   pfCallback,
+    void*                   pParam
+);
+
+bleResult_t GattServer_SendNotificationAsync
+(
+    deviceId_t              deviceId,
+    uint16_t                handle,
+    bleAsyncCmdCallback_t   pfCallback,
+    void*                   pParam
+);
+
+bleResult_t GattServer_SendIndicationAsync
+(
+    deviceId_t              deviceId,
+    uint16_t                handle,
+    bleAsyncCmdCallback_t   pfCallback,
+    void*                   pParam
+);
+
+bleResult_t GattServer_SendInstantValueNotificationAsync
+(
+    deviceId_t              deviceId,
+    uint16_t                handle,
+    uint16_t                valueLength,
+    uint8_t*                aValue,
+    bleAsyncCmdCallback_t   pfCallback,
+    void*                   pParam
+);
+
+bleResult_t GattServer_SendInstantValueIndicationAsync
+(
+    deviceId_t              deviceId,
+    uint16_t                handle,
+    uint16_t                valueLength,
+    uint8_t*                aValue,
+    bleAsyncCmdCallback_t   pfCallback,
+    void*                   pParam
+);
+
+bleResult_t GattDb_WriteAttributeAsync
+(
+    uint16_t                handle,
+    uint16_t                valueLength,
+    uint8_t*                aValue,
+    bleAsyncCmdCallback_t   pfCallback,
+    void*                   pParam
+);
+
 #ifdef __cplusplus
 extern "C" {
 #endif
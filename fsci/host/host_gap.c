@@ -76,7 +76,7 @@ bleResult_t Gap_RegisterDeviceSecurityRequirements
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(RegisterDeviceSecurityRequirements, pSecurity);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -92,7 +92,7 @@ bleResult_t Gap_SetAdvertisingParameters
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(SetAdvertisingParameters, pAdvertisingParameters);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -109,7 +109,7 @@ bleResult_t Gap_SetExtAdvertisingParameters
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(SetExtAdvertisingParameters, pAdvertisingParameters);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -127,7 +127,7 @@ bleResult_t Gap_SetAdvertisingData
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(SetAdvertisingData, pAdvertisingData, pScanResponseData);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -144,7 +144,7 @@ bleResult_t Gap_StartAdvertising
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(StartAdvertising, advertisingCallback, connectionCallback);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -164,7 +164,7 @@ bleResult_t Gap_StartExtAdvertising
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(StartExtAdvertising, advertisingCallback, connectionCallback, handle, duration, maxExtAdvEvents);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -177,7 +177,7 @@ bleResult_t Gap_StopAdvertising(void)
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(StopAdvertising);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -193,7 +193,7 @@ bleResult_t Gap_StopExtAdvertising
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(StopExtAdvertising, handle);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -211,7 +211,7 @@ bleResult_t Gap_Authorize
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(Authorize, deviceId, handle, access);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -229,7 +229,7 @@ bleResult_t Gap_SaveCccd
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(SaveCccd, deviceId, handle, cccd);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -247,7 +247,7 @@ bleResult_t Gap_CheckNotificationStatus
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(CheckNotificationStatus, deviceId, handle, pOutIsActive);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -256,6 +256,30 @@ bleResult_t Gap_CheckNotificationStatus
 }
 
 
+/*! *********************************************************************************
+* \brief  Non-blocking Gap_CheckNotificationStatus, pfCallback is called once
+*         *pOutIsActive is written. See Ble_AsyncCmdBegin.
+********************************************************************************** */
+bleResult_t Gap_CheckNotificationStatusAsync
+(
+    deviceId_t              deviceId,
+    uint16_t                handle,
+    bool_t*                 pOutIsActive,
+    bleAsyncCmdCallback_t   pfCallback,
+    void*                   pParam
+)
+{
+    bleResult_t result = Ble_AsyncCmdBegin(gFsciBleGapOpcodeGroup_c, TRUE, pfCallback, pParam);
+
+    if( gBleSuccess_c == result )
+    {
+        FsciCmdMonitor(CheckNotificationStatus, deviceId, handle, pOutIsActive);
+    }
+
+    return result;
+}
+
+
 bleResult_t Gap_CheckIndicationStatus
 (
     deviceId_t  deviceId,
@@ -265,7 +289,7 @@ bleResult_t Gap_CheckIndicationStatus
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(CheckIndicationStatus, deviceId, handle, pOutIsActive);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -283,7 +307,7 @@ bleResult_t Gap_GetBondedStaticAddresses
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(GetBondedStaticAddresses, aOutDeviceAddresses, maxDevices, pOutActualCount);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -301,7 +325,7 @@ bleResult_t Gap_GetBondedDevicesIdentityInformation
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(GetBondedDevicesIdentityInformation, aOutIdentityAddresses, maxDevices, pOutActualCount);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -318,7 +342,7 @@ bleResult_t Gap_Pair
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(Pair, deviceId, pPairingParameters);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -336,7 +360,7 @@ bleResult_t Gap_SendPeripheralSecurityRequest
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(SendPeripheralSecurityRequest, deviceId, pPairingParameters);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -352,7 +376,7 @@ bleResult_t Gap_EncryptLink
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(EncryptLink, deviceId);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -369,7 +393,7 @@ bleResult_t Gap_AcceptPairingRequest
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(AcceptPairingRequest, deviceId, pPairingParameters);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -386,7 +410,7 @@ bleResult_t Gap_RejectPairing
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(RejectPairing, deviceId, reason);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -403,7 +427,7 @@ bleResult_t Gap_EnterPasskey
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(EnterPasskey, deviceId, passkey);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -420,7 +444,7 @@ bleResult_t Gap_ProvideOob
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(ProvideOob, deviceId, aOob);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -436,7 +460,7 @@ bleResult_t Gap_RejectPasskeyRequest
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(RejectPasskeyRequest, deviceId);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -453,7 +477,7 @@ bleResult_t Gap_SendSmpKeys
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(SendSmpKeys, deviceId, pKeys);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -469,7 +493,7 @@ bleResult_t Gap_RejectKeyExchangeRequest
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(RejectKeyExchangeRequest, deviceId);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -487,7 +511,7 @@ bleResult_t Gap_ProvideLongTermKey
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(ProvideLongTermKey, deviceId, aLtk, ltkSize);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -503,7 +527,7 @@ bleResult_t Gap_DenyLongTermKey
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(DenyLongTermKey, deviceId);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -521,7 +545,7 @@ bleResult_t Gap_LoadEncryptionInformation
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(LoadEncryptionInformation, deviceId, aOutLtk, pOutLtkSize);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -537,7 +561,7 @@ bleResult_t Gap_SetLocalPasskey
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(SetLocalPasskey, passkey);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -558,7 +582,7 @@ bleResult_t Gap_StartScanning
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(StartScanning, pScanningParameters, scanningCallback, enableFilterDuplicates, duration, period);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -571,7 +595,7 @@ bleResult_t Gap_StopScanning(void)
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(StopScanning);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -588,7 +612,7 @@ bleResult_t Gap_Connect
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(Connect, pParameters, connCallback);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -604,7 +628,7 @@ bleResult_t Gap_Disconnect
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(Disconnect, deviceId);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -623,7 +647,7 @@ bleResult_t Gap_SaveCustomPeerInformation
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(SaveCustomPeerInformation, deviceId, aInfo, offset, infoSize);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -642,7 +666,7 @@ bleResult_t Gap_LoadCustomPeerInformation
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(LoadCustomPeerInformation, deviceId, aOutInfo, offset, infoSize);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -659,7 +683,7 @@ bleResult_t Gap_CheckIfBonded
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(CheckIfBonded, deviceId, pOutIsBonded);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -672,7 +696,7 @@ bleResult_t Gap_ReadFilterAcceptListSize(void)
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(ReadFilterAcceptListSize);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -685,7 +709,7 @@ bleResult_t Gap_ClearFilterAcceptList(void)
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(ClearFilterAcceptList);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -702,7 +726,7 @@ bleResult_t Gap_AddDeviceToFilterAcceptList
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(AddDeviceToFilterAcceptList, addressType, address);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -719,7 +743,7 @@ bleResult_t Gap_RemoveDeviceFromFilterAcceptList
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(RemoveDeviceFromFilterAcceptList, addressType, address);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -732,7 +756,7 @@ bleResult_t Gap_ReadPublicDeviceAddress(void)
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(ReadPublicDeviceAddress);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -749,7 +773,7 @@ bleResult_t Gap_CreateRandomDeviceAddress
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(CreateRandomDeviceAddress, aIrk, aRandomPart);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -767,7 +791,7 @@ bleResult_t Gap_SaveDeviceName
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(SaveDeviceName, deviceId, aName, cNameSize);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -783,7 +807,7 @@ bleResult_t Gap_GetBondedDevicesCount
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(GetBondedDevicesCount, pOutBondedDevicesCount);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -801,7 +825,7 @@ bleResult_t Gap_GetBondedDeviceName
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(GetBondedDeviceName, nvmIndex, aOutName, maxNameSize);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -818,7 +842,7 @@ bleResult_t Gap_VerifyPrivateResolvableAddress
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(VerifyPrivateResolvableAddress, nvmIndex, aAddress);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -834,7 +858,7 @@ bleResult_t Gap_SetRandomAddress
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(SetRandomAddress, aAddress);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -850,7 +874,7 @@ bleResult_t Gap_RemoveBond
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(RemoveBond, nvmIndex);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -863,7 +887,7 @@ bleResult_t Gap_RemoveAllBonds(void)
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(RemoveAllBonds);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -880,7 +904,7 @@ bleResult_t Gap_ReadRadioPowerLevel
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(ReadRadioPowerLevel, txPowerReadType, deviceId);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -896,7 +920,7 @@ bleResult_t Gap_SetDefaultPairingParameters
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(SetDefaultPairingParameters, pPairingParameters);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -918,7 +942,7 @@ bleResult_t Gap_UpdateConnectionParameters
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(UpdateConnectionParameters, deviceId, intervalMin, intervalMax, peripheralLatency, timeoutMultiplier, minCeLength, maxCeLength);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -935,7 +959,7 @@ bleResult_t Gap_EnableUpdateConnectionParameters
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(EnableUpdateConnectionParameters, deviceId, enable);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -953,7 +977,7 @@ bleResult_t Gap_UpdateLeDataLength
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(UpdateLeDataLength, deviceId, txOctets, txTime);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -968,7 +992,7 @@ bleResult_t Gap_LeScRegeneratePublicKey
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(LeScRegeneratePublicKey);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -985,7 +1009,7 @@ bleResult_t Gap_LeScValidateNumericValue
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(LeScValidateNumericValue, deviceId, valid);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -1000,7 +1024,7 @@ bleResult_t Gap_LeScGetLocalOobData
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(LeScGetLocalOobData);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -1017,7 +1041,7 @@ bleResult_t Gap_LeScSetPeerOobData
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(LeScSetPeerOobData, deviceId, pPeerOobData);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -1034,7 +1058,7 @@ bleResult_t Gap_LeScSendKeypressNotification
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(LeScSendKeypressNotification, deviceId, keypressNotification);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -1051,7 +1075,7 @@ bleResult_t Gap_SetScanMode
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(SetScanMode, scanMode, pAutoConnectParams);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -1066,7 +1090,7 @@ bleResult_t Gap_ControllerReset
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(ControllerReset);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -1083,7 +1107,7 @@ bleResult_t Gap_EnableHostPrivacy
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(EnableHostPrivacy, enable, aIrk);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -1102,7 +1126,7 @@ bleResult_t Gap_EnableControllerPrivacy
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(EnableControllerPrivacy, enable, aOwnIrk, peerIdCount, aPeerIdentities);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -1121,7 +1145,7 @@ bleResult_t Gap_UpdatePeriodicAdvList
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(UpdatePeriodicAdvList, operation, addrType, pAddr, SID);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -1136,7 +1160,7 @@ bleResult_t Gap_RemoveAdvSet
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(RemoveAdvSet, handle);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -1151,7 +1175,7 @@ bleResult_t Gap_SetPeriodicAdvParameters
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(SetPeriodicAdvParameters, pAdvertisingParameters);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -1166,7 +1190,7 @@ bleResult_t Gap_StartPeriodicAdvertising
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(StartPeriodicAdvertising, handle);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -1181,7 +1205,7 @@ bleResult_t Gap_StopPeriodicAdvertising
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(StopPeriodicAdvertising, handle);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -1197,7 +1221,7 @@ bleResult_t Gap_PeriodicAdvCreateSync
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGapOpcodeGroup_c, gBleGapStatusOpCode_c);
     FsciCmdMonitor(PeriodicAdvCreateSync, pReq, scanningCallback);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
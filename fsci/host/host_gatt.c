@@ -61,7 +61,7 @@ bleResult_t Gatt_Init(void)
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
     FsciCmdMonitor(Init);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -78,7 +78,7 @@ bleResult_t Gatt_GetMtu
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
     FsciCmdMonitor(GetMtu, deviceId, pOutMtu);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -91,7 +91,7 @@ bleResult_t GattClient_Init(void)
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);  
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);  
     FsciCmdMonitor(ClientInit);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -104,7 +104,7 @@ bleResult_t GattClient_ResetProcedure(void)
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ClientResetProcedure);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -120,7 +120,7 @@ bleResult_t GattClient_RegisterProcedureCallback
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ClientRegisterProcedureCallback, callback);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -136,7 +136,7 @@ bleResult_t GattClient_RegisterNotificationCallback
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ClientRegisterNotificationCallback, callback);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -152,7 +152,7 @@ bleResult_t GattClient_RegisterIndicationCallback
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ClientRegisterIndicationCallback, callback);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -168,7 +168,7 @@ bleResult_t GattClient_ExchangeMtu
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ClientExchangeMtu, deviceId);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -187,7 +187,7 @@ bleResult_t GattClient_DiscoverAllPrimaryServices
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ClientDiscoverAllPrimaryServices, deviceId, aOutPrimaryServices, maxServiceCount, pOutDiscoveredCount);
     result = Ble_GetCmdStatus(FALSE);
     
@@ -216,7 +216,7 @@ bleResult_t GattClient_DiscoverPrimaryServicesByUuid
 {  
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ClientDiscoverPrimaryServicesByUuid, deviceId, uuidType, pUuid, aOutPrimaryServices, maxServiceCount, pOutDiscoveredCount);
     result = Ble_GetCmdStatus(FALSE);
     
@@ -242,7 +242,7 @@ bleResult_t GattClient_FindIncludedServices
 {  
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ClientFindIncludedServices, deviceId, pIoService, maxServiceCount);
     result = Ble_GetCmdStatus(FALSE);
     
@@ -267,7 +267,7 @@ bleResult_t GattClient_DiscoverAllCharacteristicsOfService
 {  
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
     FsciCmdMonitor(ClientDiscoverAllCharacteristicsOfService, deviceId, pIoService, maxCharacteristicCount);
     result = Ble_GetCmdStatus(FALSE);
     
@@ -296,7 +296,7 @@ bleResult_t GattClient_DiscoverCharacteristicOfServiceByUuid
 { 
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
     FsciCmdMonitor(ClientDiscoverCharacteristicOfServiceByUuid, deviceId, uuidType, pUuid, pService, aOutCharacteristics, maxCharacteristicCount, pOutDiscoveredCount);
     result = Ble_GetCmdStatus(FALSE);
     
@@ -323,7 +323,7 @@ bleResult_t GattClient_DiscoverAllCharacteristicDescriptors
 {  
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
     FsciCmdMonitor(ClientDiscoverAllCharacteristicDescriptors, deviceId, pIoCharacteristic, endingHandle, maxDescriptorCount);
     result = Ble_GetCmdStatus(FALSE);
     
@@ -348,7 +348,7 @@ bleResult_t GattClient_ReadCharacteristicValue
 {  
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
     FsciCmdMonitor(ClientReadCharacteristicValue, deviceId, pIoCharacteristic, maxReadBytes);
     result = Ble_GetCmdStatus(FALSE);
     
@@ -377,7 +377,7 @@ bleResult_t GattClient_ReadUsingCharacteristicUuid
 {  
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
     FsciCmdMonitor(ClientReadUsingCharacteristicUuid, deviceId, uuidType, pUuid, pHandleRange, aOutBuffer, maxReadBytes, pOutActualReadBytes);
     result = Ble_GetCmdStatus(FALSE);
     
@@ -403,7 +403,7 @@ bleResult_t GattClient_ReadMultipleCharacteristicValues
 {  
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ClientReadMultipleCharacteristicValues, deviceId, cNumCharacteristics, aIoCharacteristics);
     result = Ble_GetCmdStatus(FALSE);
     
@@ -433,7 +433,7 @@ bleResult_t GattClient_WriteCharacteristicValue
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);      
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);      
     FsciCmdMonitor(ClientWriteCharacteristicValue, deviceId, pCharacteristic, valueLength, aValue, withoutResponse, signedWrite, doReliableLongCharWrites, aCsrk);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -451,7 +451,7 @@ bleResult_t GattClient_ReadCharacteristicDescriptor
 { 
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
     FsciCmdMonitor(ClientReadCharacteristicDescriptor, deviceId, pIoDescriptor, maxReadBytes);
     result = Ble_GetCmdStatus(FALSE);
     
@@ -477,7 +477,7 @@ bleResult_t GattClient_WriteCharacteristicDescriptor
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);  
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);  
     FsciCmdMonitor(ClientWriteCharacteristicDescriptor, deviceId, pDescriptor, valueLength, aValue);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -490,7 +490,7 @@ bleResult_t GattServer_Init(void)
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ServerInit);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -506,7 +506,7 @@ bleResult_t GattServer_RegisterCallback
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ServerRegisterCallback, callback);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -523,7 +523,7 @@ bleResult_t GattServer_RegisterHandlesForWriteNotifications
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ServerRegisterHandlesForWriteNotifications, handleCount, aHandles);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -541,7 +541,7 @@ bleResult_t GattServer_SendAttributeWrittenStatus
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ServerSendAttributeWrittenStatus, deviceId, attributeHandle, status);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -558,7 +558,7 @@ bleResult_t GattServer_RegisterHandlesForReadNotifications
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ServerRegisterHandlesForReadNotifications, handleCount, aHandles);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -576,7 +576,7 @@ bleResult_t GattServer_SendAttributeReadStatus
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ServerSendAttributeReadStatus, deviceId, attributeHandle, status);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -593,7 +593,7 @@ bleResult_t GattServer_SendNotification
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ServerSendNotification, deviceId, handle);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -602,6 +602,28 @@ bleResult_t GattServer_SendNotification
 }
 
 
+/*! *********************************************************************************
+* \brief  Non-blocking GattServer_SendNotification, see Ble_AsyncCmdBegin.
+********************************************************************************** */
+bleResult_t GattServer_SendNotificationAsync
+(
+    deviceId_t              deviceId,
+    uint16_t                handle,
+    bleAsyncCmdCallback_t   pfCallback,
+    void*                   pParam
+)
+{
+    bleResult_t result = Ble_AsyncCmdBegin(gFsciBleGattOpcodeGroup_c, FALSE, pfCallback, pParam);
+
+    if( gBleSuccess_c == result )
+    {
+        FsciCmdMonitor(ServerSendNotification, deviceId, handle);
+    }
+
+    return result;
+}
+
+
 bleResult_t GattServer_SendIndication
 (
     deviceId_t  deviceId,
@@ -610,7 +632,7 @@ bleResult_t GattServer_SendIndication
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ServerSendIndication, deviceId, handle);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -618,6 +640,28 @@ bleResult_t GattServer_SendIndication
     return result;
 }
 
+
+/*! *********************************************************************************
+* \brief  Non-blocking GattServer_SendIndication, see Ble_AsyncCmdBegin.
+********************************************************************************** */
+bleResult_t GattServer_SendIndicationAsync
+(
+    deviceId_t              deviceId,
+    uint16_t                handle,
+    bleAsyncCmdCallback_t   pfCallback,
+    void*                   pParam
+)
+{
+    bleResult_t result = Ble_AsyncCmdBegin(gFsciBleGattOpcodeGroup_c, FALSE, pfCallback, pParam);
+
+    if( gBleSuccess_c == result )
+    {
+        FsciCmdMonitor(ServerSendIndication, deviceId, handle);
+    }
+
+    return result;
+}
+
 bleResult_t GattServer_SendInstantValueNotification
 (
     deviceId_t              deviceId,
@@ -628,7 +672,7 @@ bleResult_t GattServer_SendInstantValueNotification
 {
     bleResult_t result = gBleSuccess_c;
     
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ServerSendInstantValueNotification, deviceId, handle, valueLength, aValue);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -636,6 +680,30 @@ bleResult_t GattServer_SendInstantValueNotification
     return result;    
 }
 
+
+/*! *********************************************************************************
+* \brief  Non-blocking GattServer_SendInstantValueNotification, see Ble_AsyncCmdBegin.
+********************************************************************************** */
+bleResult_t GattServer_SendInstantValueNotificationAsync
+(
+    deviceId_t              deviceId,
+    uint16_t                handle,
+    uint16_t                valueLength,
+    uint8_t*                aValue,
+    bleAsyncCmdCallback_t   pfCallback,
+    void*                   pParam
+)
+{
+    bleResult_t result = Ble_AsyncCmdBegin(gFsciBleGattOpcodeGroup_c, FALSE, pfCallback, pParam);
+
+    if( gBleSuccess_c == result )
+    {
+        FsciCmdMonitor(ServerSendInstantValueNotification, deviceId, handle, valueLength, aValue);
+    }
+
+    return result;
+}
+
 bleResult_t GattServer_SendInstantValueIndication
 (
     deviceId_t              deviceId,
@@ -646,7 +714,7 @@ bleResult_t GattServer_SendInstantValueIndication
 {
     bleResult_t result = gBleSuccess_c;
     
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);    
     FsciCmdMonitor(ServerSendInstantValueIndication, deviceId, handle, valueLength, aValue);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -654,6 +722,30 @@ bleResult_t GattServer_SendInstantValueIndication
     return result;      
 }
 
+
+/*! *********************************************************************************
+* \brief  Non-blocking GattServer_SendInstantValueIndication, see Ble_AsyncCmdBegin.
+********************************************************************************** */
+bleResult_t GattServer_SendInstantValueIndicationAsync
+(
+    deviceId_t              deviceId,
+    uint16_t                handle,
+    uint16_t                valueLength,
+    uint8_t*                aValue,
+    bleAsyncCmdCallback_t   pfCallback,
+    void*                   pParam
+)
+{
+    bleResult_t result = Ble_AsyncCmdBegin(gFsciBleGattOpcodeGroup_c, FALSE, pfCallback, pParam);
+
+    if( gBleSuccess_c == result )
+    {
+        FsciCmdMonitor(ServerSendInstantValueIndication, deviceId, handle, valueLength, aValue);
+    }
+
+    return result;
+}
+
 bleResult_t GattServer_RegisterUniqueHandlesForNotifications
 (
     bool_t bWrite,
@@ -662,7 +754,7 @@ bleResult_t GattServer_RegisterUniqueHandlesForNotifications
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattOpcodeGroup_c, gBleGattStatusOpCode_c);
     FsciCmdMonitor(ServerRegisterUniqueHandlesForNotifications, bWrite, bRead);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -66,7 +66,7 @@ bleResult_t GattDb_WriteAttribute
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);  
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);  
     FsciCmdMonitor(WriteAttribute, handle, valueLength, aValue);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);    
@@ -75,6 +75,30 @@ bleResult_t GattDb_WriteAttribute
 }
 
 
+/*! *********************************************************************************
+* \brief  Non-blocking GattDb_WriteAttribute, see Ble_AsyncCmdBegin. aValue is
+*         copied into the command, it may be reused when the function returns.
+********************************************************************************** */
+bleResult_t GattDb_WriteAttributeAsync
+(
+    uint16_t                handle,
+    uint16_t                valueLength,
+    uint8_t*                aValue,
+    bleAsyncCmdCallback_t   pfCallback,
+    void*                   pParam
+)
+{
+    bleResult_t result = Ble_AsyncCmdBegin(gFsciBleGattDbAppOpcodeGroup_c, FALSE, pfCallback, pParam);
+
+    if( gBleSuccess_c == result )
+    {
+        FsciCmdMonitor(WriteAttribute, handle, valueLength, aValue);
+    }
+
+    return result;
+}
+
+
 bleResult_t GattDb_ReadAttribute
 (
     uint16_t    handle,
@@ -85,7 +109,7 @@ bleResult_t GattDb_ReadAttribute
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
     FsciCmdMonitor(ReadAttribute, handle, maxBytes, aOutValue, pOutValueLength);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);    
@@ -104,7 +128,7 @@ bleResult_t GattDb_FindServiceHandle
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
     FsciCmdMonitor(FindServiceHandle, startHandle, uuidType, pUuid, pOutServiceHandle);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);    
@@ -123,7 +147,7 @@ bleResult_t GattDb_FindCharValueHandleInService
 {
     bleResult_t result = gBleSuccess_c;
     
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
     FsciCmdMonitor(FindCharValueHandleInService, serviceHandle, uuidType, pUuid, pOutCharValueHandle);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId); 
@@ -140,7 +164,7 @@ bleResult_t GattDb_FindCccdHandleForCharValueHandle
 {
     bleResult_t result = gBleSuccess_c;
     
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);    
     FsciCmdMonitor(FindCccdHandleForCharValueHandle, charValueHandle, pOutCccdHandle);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId); 
@@ -159,7 +183,7 @@ bleResult_t GattDb_FindDescriptorHandleForCharValueHandle
 {
     bleResult_t result = gBleSuccess_c;
     
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
     FsciCmdMonitor(FindDescriptorHandleForCharValueHandle, charValueHandle, uuidType, pUuid, pOutDescriptorHandle);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId); 
@@ -172,7 +196,7 @@ bleResult_t GattDbDynamic_Init(void)
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);  
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);  
     FsciCmdMonitor(InitDatabase);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);    
@@ -185,7 +209,7 @@ bleResult_t GattDbDynamic_ReleaseDatabase(void)
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);  
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);  
     FsciCmdMonitor(ReleaseDatabase);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);    
@@ -204,7 +228,7 @@ bleResult_t GattDbDynamic_AddPrimaryServiceDeclaration
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
     FsciCmdMonitor(AddPrimaryServiceDeclaration, desiredHandle, serviceUuidType, pServiceUuid, pOutHandle);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -223,7 +247,7 @@ bleResult_t GattDbDynamic_AddSecondaryServiceDeclaration
 {
     bleResult_t result = gBleSuccess_c;
     
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
     FsciCmdMonitor(AddSecondaryServiceDeclaration, desiredHandle, serviceUuidType, pServiceUuid, pOutHandle);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -243,7 +267,7 @@ bleResult_t GattDbDynamic_AddIncludeDeclaration
 {
     bleResult_t result = gBleSuccess_c;
     
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
     FsciCmdMonitor(AddIncludeDeclaration, includedServiceHandle, endGroupHandle, serviceUuidType, pServiceUuid, pOutHandle);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -266,7 +290,7 @@ bleResult_t GattDbDynamic_AddCharacteristicDeclarationAndValue
 {
     bleResult_t result = gBleSuccess_c;
     
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
     FsciCmdMonitor(AddCharacteristicDeclarationAndValue, characteristicUuidType, pCharacteristicUuid, 
                         characteristicProperties, maxValueLength, initialValueLength, 
                         aInitialValue, valueAccessPermissions, pOutHandle);
@@ -289,7 +313,7 @@ bleResult_t GattDbDynamic_AddCharacteristicDescriptor
 {
     bleResult_t result = gBleSuccess_c;
     
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
     FsciCmdMonitor(AddCharacteristicDescriptor, descriptorUuidType, pDescriptorUuid, descriptorValueLength, 
                          aInitialValue, descriptorAccessPermissions, pOutHandle);
     result = Ble_GetCmdStatus(TRUE);
@@ -303,7 +327,7 @@ bleResult_t GattDbDynamic_AddCccd(uint16_t* pOutHandle)
 {
     bleResult_t result = gBleSuccess_c;
     
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
     FsciCmdMonitor(AddCccd, pOutHandle);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -315,7 +339,7 @@ bleResult_t GattDbDynamic_AddCharAggregateFormat(uint16_t descriptorValueLength,
 {
     bleResult_t result = gBleSuccess_c;
     
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
     FsciCmdMonitor(AddCharAggregateFormat, descriptorValueLength, pInitialValue, pOutHandle);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
@@ -334,7 +358,7 @@ bleResult_t GattDbDynamic_AddCharacteristicDeclarationWithUniqueValue
 {
     bleResult_t result = gBleSuccess_c;
     
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
     FsciCmdMonitor(AddCharacteristicDeclarationWithUniqueValue, characteristicUuidType, pCharacteristicUuid, 
                         characteristicProperties, valueAccessPermissions, pOutHandle);
     result = Ble_GetCmdStatus(TRUE);
@@ -351,7 +375,7 @@ bleResult_t GattDbDynamic_RemoveService
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);  
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);  
     FsciCmdMonitor(RemoveService, serviceHandle);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);    
@@ -367,7 +391,7 @@ bleResult_t GattDbDynamic_RemoveCharacteristic
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);  
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);  
     FsciCmdMonitor(RemoveCharacteristic, characteristicHandle);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);    
@@ -385,7 +409,7 @@ bleResult_t GattDbDynamic_AddCharDescriptorWithUniqueValue
 {
     bleResult_t result = gBleSuccess_c;
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleGattDbAppOpcodeGroup_c, gBleGattDbAppStatusOpCode_c);
     FsciCmdMonitor(AddCharDescriptorWithUniqueValue, descriptorUuidType, pDescriptorUuid, descriptorAccessPermissions, pOutHandle);
     result = Ble_GetCmdStatus(TRUE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);
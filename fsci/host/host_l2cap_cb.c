@@ -64,7 +64,7 @@ bleResult_t L2ca_RegisterLeCbCallbacks(l2caLeCbDataCallback_t pCallback, l2caLeC
     fsciBleSetL2capCbLeCbDataCallback(pCallback);
     fsciBleSetL2capCbLeCbControlCallback(pCtrlCallback);
 
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);    
     FsciCmdMonitor(RegisterLeCbCallbacks, pCallback, pCtrlCallback);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);    
@@ -77,7 +77,7 @@ bleResult_t L2ca_RegisterLePsm(uint16_t lePsm, uint16_t lePsmMtu)
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);    
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);    
     FsciCmdMonitor(RegisterLePsm, lePsm, lePsmMtu);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);    
@@ -90,7 +90,7 @@ bleResult_t L2ca_DeregisterLePsm(uint16_t lePsm)
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);  
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);  
     FsciCmdMonitor(DeregisterLePsm, lePsm);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);    
@@ -103,7 +103,7 @@ bleResult_t L2ca_ConnectLePsm(uint16_t lePsm, deviceId_t deviceId, uint16_t init
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);  
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);  
     FsciCmdMonitor(ConnectLePsm, lePsm, deviceId, initialCredits);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);    
@@ -116,7 +116,7 @@ bleResult_t L2ca_DisconnectLeCbChannel(deviceId_t deviceId, uint16_t channelId)
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);  
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);  
     FsciCmdMonitor(DisconnectLeCbChannel, deviceId, channelId);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);    
@@ -129,7 +129,7 @@ bleResult_t L2ca_CancelConnection(uint16_t lePsm, deviceId_t deviceId, l2caLeCbC
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);  
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);  
     FsciCmdMonitor(CancelConnection, lePsm, deviceId, refuseReason);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);    
@@ -142,7 +142,7 @@ bleResult_t L2ca_SendLeCbData(deviceId_t deviceId, uint16_t channelId, uint8_t*p
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);  
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);  
     FsciCmdMonitor(SendLeCbData, deviceId, channelId, pPacket, packetLength);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);    
@@ -155,7 +155,7 @@ bleResult_t L2ca_SendLeCredit(deviceId_t deviceId, uint16_t channelId, uint16_t
 {
     bleResult_t result = gBleSuccess_c;
   
-    FSCI_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);  
+    Ble_HostSyncLock(fsciBleInterfaceId, gFsciBleL2capCbOpcodeGroup_c, gBleL2capCbStatusOpCode_c);  
     FsciCmdMonitor(SendLeCredit, deviceId, channelId, credits);
     result = Ble_GetCmdStatus(FALSE);
     FSCI_HostSyncUnlock(fsciBleInterfaceId);    
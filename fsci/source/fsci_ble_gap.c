@@ -26,6 +26,7 @@
 #include "fsl_adapter_reset.h"
 #include "controller_api.h"
 #include "fsl_component_timer_manager.h"
+#include "fsl_os_abstraction.h"
 #include "fsci_ble_gap_handlers.h"
 #include "fsci_ble_gap2_handlers.h"
 #if gFsciBleHost_d
@@ -80,6 +81,24 @@
 
 /* Last Generic Event before GAP2 */
 #define gLastGapGenericEventOpCode_c 0x47
+
+/* Size of the opCode and length prefixing every report of a scan report batch */
+#define mFsciBleGapScanBatchRecordHeader_c      3U
+
+/* FNV-1a parameters of the hash identifying duplicate scan reports */
+#define mFsciBleGapScanHashOffset_c             2166136261U
+#define mFsciBleGapScanHashPrime_c              16777619U
+
+/* The batch is taken and transmitted under a mutex, so that a batch taken by the timer
+callback is on the serial interface before the events the Host task sends afterwards.
+Without an RTOS the timer callback runs in interrupt context, so interrupts are masked */
+#if USE_RTOS
+#define fsciBleGapScanBatchLock()   (void)OSA_MutexLock((osa_mutex_handle_t)mScanBatchMutexId, osaWaitForever_c)
+#define fsciBleGapScanBatchUnlock() (void)OSA_MutexUnlock((osa_mutex_handle_t)mScanBatchMutexId)
+#else
+#define fsciBleGapScanBatchLock()   OSA_InterruptDisable()
+#define fsciBleGapScanBatchUnlock() OSA_InterruptEnable()
+#endif /* USE_RTOS */
 /************************************************************************************
 *************************************************************************************
 * Private type definitions
@@ -161,6 +180,23 @@
     }fsciBleGapGetBondedDeviceNameOutParams_t;
 #endif /* gFsciBleHost_d */
 
+#if gFsciBleBBox_d || gFsciBleTest_d
+    /* Structure used for coalescing the scanned device reports, the NoOfReports
+    field of the batch event is not kept in aBuffer */
+    typedef struct fsciBleGapScanBatch_tag
+    {
+        uint16_t    windowMs;
+        uint16_t    maxSize;
+        bool_t      bFilterDuplicates;
+        bool_t      bOpened;
+        uint8_t     noOfReports;
+        uint8_t     noOfHashes;
+        uint16_t    length;
+        uint32_t    aHashes[gFsciBleGapScanDedupEntries_c];
+        uint8_t     aBuffer[gFsciBleGapScanBatchSize_c];
+    }fsciBleGapScanBatch_t;
+#endif /* gFsciBleBBox_d || gFsciBleTest_d */
+
 /************************************************************************************
 *************************************************************************************
 * Private functions prototypes
@@ -171,6 +207,13 @@ static void fsciBleGapGenericCallback(gapGenericEvent_t* pGenericEvent);
 static bleResult_t fsciBleHciHostToControllerInterface(hciPacketType_t packetType, void* pPacket, uint16_t packetSize);
 static bleResult_t fsciWritePublicDeviceAddress(bleDeviceAddress_t bdAddress);
 static void WritePublicDeviceAddress_TmrCb (void *param);
+#if gFsciBleBBox_d || gFsciBleTest_d
+static void fsciBleGapScanBatchSend(void);
+static bool_t fsciBleGapScanBatchAppend(uint8_t opCode, gapScanningEvent_t* pScanningEvent);
+static void fsciBleGapScanBatchFlush(void);
+static uint32_t fsciBleGapScanReportHash(uint8_t opCode, gapScanningEvent_t* pScanningEvent);
+static void fsciBleGapScanBatch_TmrCb(void *param);
+#endif /* gFsciBleBBox_d || gFsciBleTest_d */
 #if defined(gFsciBleTest_d) && (gFsciBleTest_d == 1U) && (defined(CPU_KW45B41Z83AFTA) || defined(CPU_K32W1480VFTA))
 static void fsciPlatformErrorCallback(uint32_t id, int32_t error_status);
 #endif /* defined(gFsciBleTest_d) && (gFsciBleTest_d == 1U) && (defined(CPU_KW45B41Z83AFTA) || defined(CPU_K32W1480VFTA)) */
@@ -440,6 +483,20 @@ fsciBleGapCallbacks_t fsciBleGapCallbacks =
 /* The timer is used for WritePublicDeviceAddress command */
 static TIMER_MANAGER_HANDLE_DEFINE(gAppTimerId);
 
+#if gFsciBleBBox_d || gFsciBleTest_d
+/* Scanned device reports waiting to be sent in one batch event, accessed
+from the Host task and from the batch timer callback */
+static fsciBleGapScanBatch_t mScanBatch;
+
+/* The timer ends the batch window started by the first report of a batch */
+static TIMER_MANAGER_HANDLE_DEFINE(mScanBatchTimerId);
+
+#if USE_RTOS
+/* Guards mScanBatch, held until a taken batch is transmitted */
+static OSA_MUTEX_HANDLE_DEFINE(mScanBatchMutexId);
+#endif /* USE_RTOS */
+#endif /* gFsciBleBBox_d || gFsciBleTest_d */
+
 
 /************************************************************************************
 *************************************************************************************
@@ -3574,6 +3631,52 @@ void fsciBleGapAdvertisingEvtMonitor(gapAdvertisingEvent_t* pAdvertisingEvent)
 }
 
 
+bleResult_t fsciBleGapSetScanReportBatching(uint16_t windowMs, uint16_t maxSize, bool_t bFilterDuplicates)
+{
+    bleResult_t result = gBleSuccess_c;
+
+    if(maxSize > gFsciBleGapScanBatchSize_c)
+    {
+        result = gBleInvalidParameter_c;
+    }
+    else if(FALSE == mScanBatch.bOpened)
+    {
+        if(kStatus_TimerSuccess != TM_Open((timer_handle_t)mScanBatchTimerId))
+        {
+            result = gBleOsError_c;
+        }
+#if USE_RTOS
+        else if(KOSA_StatusSuccess != OSA_MutexCreate((osa_mutex_handle_t)mScanBatchMutexId))
+        {
+            (void)TM_Close((timer_handle_t)mScanBatchTimerId);
+            result = gBleOsError_c;
+        }
+#endif /* USE_RTOS */
+        else
+        {
+            (void)TM_InstallCallback((timer_handle_t)mScanBatchTimerId, fsciBleGapScanBatch_TmrCb, NULL);
+            mScanBatch.bOpened = TRUE;
+        }
+    }
+    else
+    {
+        ; /* For MISRA compliance */
+    }
+
+    if(gBleSuccess_c == result)
+    {
+        fsciBleGapScanBatchLock();
+        /* The reports already coalesced are sent with the previous settings */
+        fsciBleGapScanBatchSend();
+        mScanBatch.windowMs          = windowMs;
+        mScanBatch.maxSize           = (0U == maxSize) ? (uint16_t)gFsciBleGapScanBatchSize_c : maxSize;
+        mScanBatch.bFilterDuplicates = bFilterDuplicates;
+        fsciBleGapScanBatchUnlock();
+    }
+
+    return result;
+}
+
 void fsciBleGapScanningEvtMonitor(gapScanningEvent_t* pScanningEvent)
 {
     clientPacketStructured_t*   pClientPacket = NULL;
@@ -3673,6 +3776,24 @@ void fsciBleGapScanningEvtMonitor(gapScanningEvent_t* pScanningEvent)
             }
     }
 
+    if((!earlyReturn) && (0U != mScanBatch.windowMs))
+    {
+        if((gDeviceScanned_c == pScanningEvent->eventType)
+#if defined(gBLE50_d) && (gBLE50_d == 1U)
+           || (gExtDeviceScanned_c == pScanningEvent->eventType)
+#endif
+          )
+        {
+            /* The report is sent alone only if it does not fit in a batch */
+            earlyReturn = fsciBleGapScanBatchAppend((uint8_t)opCode.gap1Code, pScanningEvent);
+        }
+        else
+        {
+            /* The reports are sent before the other scanning events, e.g. the scan state change */
+            fsciBleGapScanBatchFlush();
+        }
+    }
+
     if (!earlyReturn)
     {
         if (gFsciBleGapOpcodeGroup_c == opGroup)
@@ -3923,6 +4044,198 @@ static void WritePublicDeviceAddress_TmrCb (void *param)
     HAL_ResetMCU();
 }
 
+#if gFsciBleBBox_d || gFsciBleTest_d
+/*! *********************************************************************************
+ * \brief        Sends the coalesced reports in one batch event and starts a new batch.
+ *               Called with the batch lock held, so that the batch is transmitted before
+ *               any other scanning event.
+ *
+ * \return       none. If the packet can not be allocated the reports are lost, as the
+ *               single events.
+ ********************************************************************************** */
+static void fsciBleGapScanBatchSend(void)
+{
+    clientPacketStructured_t*   pClientPacket = NULL;
+
+    if(0U != mScanBatch.noOfReports)
+    {
+        (void)TM_Stop((timer_handle_t)mScanBatchTimerId);
+
+        pClientPacket = fsciBleGapAllocFsciPacket((uint8_t)gBleGapEvtScanningEventDeviceScannedBatchOpCode_c,
+                                                  1U + (uint32_t)mScanBatch.length);
+
+        if(NULL != pClientPacket)
+        {
+            pClientPacket->payload[0] = mScanBatch.noOfReports;
+            FLib_MemCpy(&pClientPacket->payload[1], mScanBatch.aBuffer, mScanBatch.length);
+        }
+
+        mScanBatch.noOfReports = 0U;
+        mScanBatch.noOfHashes  = 0U;
+        mScanBatch.length      = 0U;
+
+        if(NULL != pClientPacket)
+        {
+            /* Transmit the packet over UART */
+            fsciBleTransmitFormatedPacket(pClientPacket, fsciBleInterfaceId);
+        }
+    }
+}
+
+/*! *********************************************************************************
+ * \brief        Adds a scanned device report to the current batch, as the opCode and
+ *               the length of the single event followed by its payload. The batch is
+ *               sent first if the report does not fit in it.
+ *
+ * \param[in]    opCode          Opcode of the single event of the report.
+ * \param[in]    pScanningEvent  The gDeviceScanned_c or gExtDeviceScanned_c event.
+ *
+ * \return       TRUE if the report was batched or dropped as a duplicate, FALSE if it
+ *               must be sent as a single event.
+ ********************************************************************************** */
+static bool_t fsciBleGapScanBatchAppend(uint8_t opCode, gapScanningEvent_t* pScanningEvent)
+{
+    uint32_t                    size = mFsciBleGapScanBatchRecordHeader_c + fsciBleGapGetScanningEventBufferSize(pScanningEvent);
+    uint32_t                    hash = 0U;
+    uint8_t*                    pBuffer = NULL;
+    bool_t                      bConsumed = FALSE;
+    uint32_t                    i;
+
+    if(mScanBatch.bFilterDuplicates)
+    {
+        hash = fsciBleGapScanReportHash(opCode, pScanningEvent);
+    }
+
+    fsciBleGapScanBatchLock();
+
+    if(mScanBatch.bFilterDuplicates)
+    {
+        for(i = 0U; i < mScanBatch.noOfHashes; i++)
+        {
+            if(hash == mScanBatch.aHashes[i])
+            {
+                bConsumed = TRUE;
+                break;
+            }
+        }
+    }
+
+    if(FALSE == bConsumed)
+    {
+        /* The NoOfReports field of the event is part of the batch size */
+        if(((1U + (uint32_t)mScanBatch.length + size) > mScanBatch.maxSize) || (0xFFU == mScanBatch.noOfReports))
+        {
+            fsciBleGapScanBatchSend();
+        }
+
+        /* A report too large for an empty batch is sent alone, after the batch */
+        if((1U + size) <= mScanBatch.maxSize)
+        {
+            pBuffer = &mScanBatch.aBuffer[mScanBatch.length];
+            fsciBleGetBufferFromUint8Value(opCode, pBuffer);
+            fsciBleGetBufferFromUint16Value((uint16_t)(size - mFsciBleGapScanBatchRecordHeader_c), pBuffer);
+            fsciBleGapGetBufferFromScanningEvent(pScanningEvent, &pBuffer);
+            mScanBatch.length += (uint16_t)size;
+
+            if(mScanBatch.bFilterDuplicates && (mScanBatch.noOfHashes < gFsciBleGapScanDedupEntries_c))
+            {
+                mScanBatch.aHashes[mScanBatch.noOfHashes] = hash;
+                mScanBatch.noOfHashes++;
+            }
+
+            mScanBatch.noOfReports++;
+            if(1U == mScanBatch.noOfReports)
+            {
+                /* The first report starts the window */
+                (void)TM_Start((timer_handle_t)mScanBatchTimerId, (uint8_t)kTimerModeSingleShot, mScanBatch.windowMs);
+            }
+
+            bConsumed = TRUE;
+        }
+    }
+
+    fsciBleGapScanBatchUnlock();
+
+    return bConsumed;
+}
+
+/*! *********************************************************************************
+ * \brief        Sends the coalesced reports in one batch event and starts a new batch.
+ *
+ * \return       none
+ ********************************************************************************** */
+static void fsciBleGapScanBatchFlush(void)
+{
+    fsciBleGapScanBatchLock();
+    fsciBleGapScanBatchSend();
+    fsciBleGapScanBatchUnlock();
+}
+
+/*! *********************************************************************************
+ * \brief        Computes the FNV-1a hash of the address, type and data of a report.
+ *
+ * \param[in]    opCode          Opcode of the single event of the report.
+ * \param[in]    pScanningEvent  The gDeviceScanned_c or gExtDeviceScanned_c event.
+ *
+ * \return       The hash of the report.
+ ********************************************************************************** */
+static uint32_t fsciBleGapScanReportHash(uint8_t opCode, gapScanningEvent_t* pScanningEvent)
+{
+    uint32_t        hash = mFsciBleGapScanHashOffset_c;
+    uint8_t         aHeader[2U + gcBleDeviceAddressSize_c];
+    const uint8_t*  pData = NULL;
+    uint32_t        dataLength = 0U;
+    uint32_t        i;
+
+    aHeader[0] = opCode;
+
+#if defined(gBLE50_d) && (gBLE50_d == 1U)
+    if(gExtDeviceScanned_c == pScanningEvent->eventType)
+    {
+        aHeader[1] = (uint8_t)pScanningEvent->eventData.extScannedDevice.addressType;
+        FLib_MemCpy(&aHeader[2], pScanningEvent->eventData.extScannedDevice.aAddress, gcBleDeviceAddressSize_c);
+        /* The advertising properties are hashed with the data */
+        hash = (hash ^ (uint8_t)pScanningEvent->eventData.extScannedDevice.advEventProperties) * mFsciBleGapScanHashPrime_c;
+        pData = pScanningEvent->eventData.extScannedDevice.pData;
+        dataLength = pScanningEvent->eventData.extScannedDevice.dataLength;
+    }
+    else
+#endif
+    {
+        aHeader[1] = (uint8_t)pScanningEvent->eventData.scannedDevice.addressType;
+        FLib_MemCpy(&aHeader[2], pScanningEvent->eventData.scannedDevice.aAddress, gcBleDeviceAddressSize_c);
+        hash = (hash ^ (uint8_t)pScanningEvent->eventData.scannedDevice.advEventType) * mFsciBleGapScanHashPrime_c;
+        pData = pScanningEvent->eventData.scannedDevice.data;
+        dataLength = pScanningEvent->eventData.scannedDevice.dataLength;
+    }
+
+    for(i = 0U; i < sizeof(aHeader); i++)
+    {
+        hash = (hash ^ aHeader[i]) * mFsciBleGapScanHashPrime_c;
+    }
+
+    for(i = 0U; i < dataLength; i++)
+    {
+        hash = (hash ^ pData[i]) * mFsciBleGapScanHashPrime_c;
+    }
+
+    return hash;
+}
+
+/*! *********************************************************************************
+ * \brief        Handles the end of a scan report batch window. Runs in the timer
+ *               manager task and waits for the batch lock when the Host task holds it.
+ *
+ * \param[in]    param   not used
+ *
+ * \return       none
+ ********************************************************************************** */
+static void fsciBleGapScanBatch_TmrCb(void *param)
+{
+    fsciBleGapScanBatchFlush();
+}
+#endif /* gFsciBleBBox_d || gFsciBleTest_d */
+
 #if defined(gFsciBleTest_d) && (gFsciBleTest_d == 1U) && (defined(CPU_KW45B41Z83AFTA) || defined(CPU_K32W1480VFTA))
 /*! *********************************************************************************
  * \brief       Error callback used to handle error at platform level.
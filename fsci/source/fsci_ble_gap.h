@@ -40,6 +40,17 @@
     #define gFsciBleGap2LayerEnabled_d           0
 #endif /* gFsciBleGap2LayerEnabled_d */
 
+/*! Size of the buffer coalescing the scanned device reports sent in one
+    gBleGapEvtScanningEventDeviceScannedBatchOpCode_c event */
+#ifndef gFsciBleGapScanBatchSize_c
+    #define gFsciBleGapScanBatchSize_c          512U
+#endif /* gFsciBleGapScanBatchSize_c */
+
+/*! Number of reports remembered in a batch window when duplicates are filtered */
+#ifndef gFsciBleGapScanDedupEntries_c
+    #define gFsciBleGapScanDedupEntries_c       32U
+#endif /* gFsciBleGapScanDedupEntries_c */
+
 /*! FSCI operation group for GAP */
 #define gFsciBleGapOpcodeGroup_c                0x48
 
@@ -568,6 +579,7 @@ typedef enum
     gBleGapCmdLeSetSchedulerPriority_c                                             = 0x79,                       /*! Set priority for one connection in case of several connections */
     gBleGapCmdLeSetHostFeature_c                                                   = 0x7B,                       /*! Set or clear a bit controlled by the Host in the Link Layer FeatureSet */
     gBleGapCmdPlatformRegisterErrorCallbackOpCode_c                                = 0x7C,                       /*! Register platform error callback */
+    gBleGapCmdSetScanReportBatchingOpCode_c                                        = 0x7D,                       /*! Coalesce the scanned device reports in batch events */
 
     gBleGapStatusOpCode_c                                                          = 0x80,                       /*! GAP status operation code */
 
@@ -716,6 +728,7 @@ typedef enum
     
     gBleGapEvtPlatformError_c                                                      = 0xF8,                       /*! platform error callback event operation code */
     gBleGapEvtConnectionEventSmError_c                                             = 0xF9,                       /*! gapConnectionCallback (type = gConnEvtSmError_c) event operation code */
+    gBleGapEvtScanningEventDeviceScannedBatchOpCode_c                              = 0xFA,                       /*! gapScanningCallback (type = gDeviceScanned_c or gExtDeviceScanned_c) reports coalesced in one event */
 }fsciBleGapOpCode_t;
 
 /************************************************************************************
@@ -766,6 +779,29 @@ void fsciBleGapStatusMonitor
 (
     bleResult_t result
 );
+
+/*! *********************************************************************************
+* \brief  Configures the coalescing of the scanned device reports. While enabled, the
+*         gDeviceScanned_c and gExtDeviceScanned_c events are sent in one
+*         gBleGapEvtScanningEventDeviceScannedBatchOpCode_c event when the window
+*         expires, when the batch is full or before any other scanning event.
+*
+* \param[in]    windowMs            Time the first report of a batch waits for the
+*                                   next ones, in milliseconds. 0 disables batching.
+* \param[in]    maxSize             Batch payload size above which the batch is sent,
+*                                   up to gFsciBleGapScanBatchSize_c. 0 for the largest.
+* \param[in]    bFilterDuplicates   TRUE to drop the reports with the same address,
+*                                   type and data as one already in the batch.
+*
+* \return       gBleSuccess_c, gBleInvalidParameter_c or gBleOsError_c.
+*
+********************************************************************************** */
+bleResult_t fsciBleGapSetScanReportBatching
+(
+    uint16_t    windowMs,
+    uint16_t    maxSize,
+    bool_t      bFilterDuplicates
+);
 #endif /* gFsciBleBBox_d || gFsciBleTest_d */
 
 #if gFsciBleHost_d || gFsciBleTest_d
@@ -25,6 +25,9 @@
 #include "fsci_ble_gap2_handlers.h"
 #include "controller_api.h"
 #include "fwk_seclib.h"
+#if gFsciBleHost_d
+    #include "host_ble.h"
+#endif /* gFsciBleHost_d */
 #if gFsciIncluded_c && gFsciBleGapLayerEnabled_d
 
 /************************************************************************************
@@ -1975,6 +1978,12 @@ void HandleGapCmdLeSetHostFeature
     uint32_t fsciInterfaceId
 );
 
+void HandleGapCmdSetScanReportBatching
+(
+    uint8_t *pBuffer, 
+    uint32_t fsciInterfaceId
+);
+
 /************************************************************************************
 *************************************************************************************
 * Public memory declarations
@@ -2659,7 +2668,7 @@ const pfGapOpCodeHandler_t maGapCmdOpCodeHandlers[]=
 #else
     NULL,                                                                              /* reserved: 0x7C */
 #endif /* defined(gFsciBleTest_d) && (gFsciBleTest_d == 1U) && (defined(CPU_KW45B41Z83AFTA) || defined(CPU_K32W1480VFTA)) */
-    NULL,                                                                             /* reserved: 0x7D */
+    HandleGapCmdSetScanReportBatching,                                                /* = 0x7D, gBleGapCmdSetScanReportBatchingOpCode_c */
     NULL,                                                                             /* reserved: 0x7E */
 };
 #endif /* gFsciBleBBox_d || gFsciBleTest_d */
@@ -9719,6 +9728,9 @@ void HandleGapStatusOpCode(uint8_t *pBuffer, uint32_t fsciInterfaceId)
         /* Clean out parameters pointers kept in FSCI */
         fsciBleGapCleanOutParams();
     }
+
+    /* Status of an asynchronous command, if any is pending */
+    Ble_AsyncCmdStatus(gFsciBleGapOpcodeGroup_c, status);
 }
 /*! *********************************************************************************
 *\private
@@ -11252,6 +11264,35 @@ void HandleGapCmdLeSetHostFeature
     fsciBleGapCallApiFunction(Gap_LeSetHostFeature(bitNumber, enable));
 }
 
+/*! *********************************************************************************
+*\private
+*\fn           void HandleGapCmdSetScanReportBatching(uint8_t *pBuffer,
+*                                                     uint32_t fsciInterfaceId)
+*\brief        Handler for the gBleGapCmdSetScanReportBatchingOpCode_c opCode.
+*
+*\param  [in]  pBuffer              Pointer to the command parameters.
+*\param  [in]  fsciInterfaceId      FSCI interface identifier.
+*
+*\retval       void.
+********************************************************************************** */
+void HandleGapCmdSetScanReportBatching
+(
+    uint8_t *pBuffer, 
+    uint32_t fsciInterfaceId
+)
+{
+    uint16_t windowMs = 0U;
+    uint16_t maxSize = 0U;
+    bool_t   bFilterDuplicates = FALSE;
+
+    /* Get command parameters from buffer */
+    fsciBleGetUint16ValueFromBuffer(windowMs, pBuffer);
+    fsciBleGetUint16ValueFromBuffer(maxSize, pBuffer);
+    fsciBleGetBoolValueFromBuffer(bFilterDuplicates, pBuffer);
+
+    fsciBleGapCallApiFunction(fsciBleGapSetScanReportBatching(windowMs, maxSize, bFilterDuplicates));
+}
+
 /*! *********************************************************************************
 * @}
 ********************************************************************************** */
@@ -4628,6 +4628,9 @@ static void HandleGattStatusOpCode(uint8_t *pBuffer, uint32_t fsciInterfaceId)
         /* Erase the information kept (for asynchronous functions) */
         fsciBleGattClientEraseInfo(FALSE, deviceId, bearerId);
     }
+
+    /* Status of an asynchronous command, if any is pending */
+    Ble_AsyncCmdStatus(gFsciBleGattOpcodeGroup_c, status);
 }
 
 /*! *********************************************************************************
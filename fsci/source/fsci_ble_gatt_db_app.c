@@ -214,6 +214,10 @@ static void HandleGattDbAppCmdRemoveServiceOpCode(uint8_t *pBuffer, uint32_t fsc
 static void HandleGattDbAppCmdRemoveCharacteristicOpCode(uint8_t *pBuffer, uint32_t fsciInterfaceId);
 static void HandleGattDbAppCmdAddCharDescriptorWithUniqueValueOpCode(uint8_t *pBuffer, uint32_t fsciInterfaceId);
 static void HandleGattDbAppCmdEndDatabaseUpdateOpCode(uint8_t *pBuffer, uint32_t fsciInterfaceId);
+#if gFsciBleGattDbAppAddService_d
+static void HandleGattDbAppCmdAddServiceOpCode(uint8_t *pBuffer, uint32_t fsciInterfaceId);
+static bleResult_t fsciBleGattDbAppGetServiceFromTlv(uint8_t* pTlv, uint16_t tlvLength, serviceInfo_t* pServiceInfo, descriptorInfo_t* pDescriptorInfo, uint32_t* pNbOfDescriptors);
+#endif /* gFsciBleGattDbAppAddService_d */
 #endif /* gFsciBleBBox_d || gFsciBleTest_d */
 #if gFsciBleHost_d
 static void HandleGattDbAppStatusOpCode(uint8_t *pBuffer, uint32_t fsciInterfaceId);
@@ -254,6 +258,11 @@ static void HandleGattDbAppEvtAddCharDescriptorWithUniqueValueOpCode(uint8_t *pB
     static fsciBleGattDbAppOutParams_t fsciBleGattDbAppOutParams = {NULL, NULL};
 #endif /* gFsciBleHost_d */
 
+#if gFsciBleGattDbAppAddService_d && (gFsciBleBBox_d || gFsciBleTest_d)
+    /* Payload length of the command being handled, bounds the variable length fields */
+    static uint16_t mFsciBleGattDbAppPayloadLength = 0U;
+#endif /* gFsciBleGattDbAppAddService_d && (gFsciBleBBox_d || gFsciBleTest_d) */
+
 #if gFsciBleBBox_d || gFsciBleTest_d
 static const pfGattDbAppOpCodeHandler_t maGattDbAppCmdOpCodeHandlers[]=
 {
@@ -279,9 +288,14 @@ HandleGattDbAppCmdRemoveCharacteristicOpCode,                                 /*
 HandleGattDbAppCmdAddCharDescriptorWithUniqueValueOpCode,                     /* = 0x13, gBleGattDbAppCmdAddCharDescriptorWithUniqueValueOpCode_c */
 HandleGattDbAppCmdEndDatabaseUpdateOpCode,                                    /* = 0x14, gBleGattDbAppCmdEndDatabaseUpdateOpCode_c */
 #if defined(gBLE52_d) && (gBLE52_d == TRUE)
-HandleGattDbAppCmdAddCharAggregateFormatOpCode                                /* = 0x15, gBleGattDbAppCmdAddCharAggregateFormatOpCode_c */
+HandleGattDbAppCmdAddCharAggregateFormatOpCode,                               /* = 0x15, gBleGattDbAppCmdAddCharAggregateFormatOpCode_c */
+#else
+NULL,                                                                         /* reserved: 0x015 */
+#endif
+#if gFsciBleGattDbAppAddService_d
+HandleGattDbAppCmdAddServiceOpCode                                            /* = 0x16, gBleGattDbAppCmdAddServiceOpCode_c */
 #else
-NULL                                                                          /* reserved: 0x015 */
+NULL                                                                          /* reserved: 0x016 */
 #endif
 };
 #endif /* gFsciBleBBox_d || gFsciBleTest_d */
@@ -346,6 +360,9 @@ void fsciBleGattDbAppHandler(void* pData, void* pParam, uint32_t fsciInterfaceId
             {
                 if (maGattDbAppCmdOpCodeHandlers[pClientPacket->structured.header.opCode] != NULL)
                 {
+#if gFsciBleGattDbAppAddService_d
+                    mFsciBleGattDbAppPayloadLength = pClientPacket->structured.header.len;
+#endif /* gFsciBleGattDbAppAddService_d */
                     /* Select the GATT, GATT Client or GATT Server function to be called (using the FSCI opcode) */
                     maGattDbAppCmdOpCodeHandlers[pClientPacket->structured.header.opCode](pBuffer, fsciInterfaceId);
                     opCodeHandled = TRUE;
@@ -986,6 +1003,64 @@ void fsciBleGattDbAppUint16ParamEvtMonitor(fsciBleGattDbAppOpCode_t opCode, cons
     fsciBleTransmitFormatedPacket(pClientPacket, fsciBleInterfaceId);
 }
 
+#if gFsciBleGattDbAppAddService_d
+void fsciBleGattDbAppAddServiceEvtMonitor(const serviceInfo_t* pServiceInfo)
+{
+    clientPacketStructured_t*   pClientPacket;
+    uint8_t*                    pBuffer;
+    const characteristicInfo_t* pCharacteristicInfo;
+    uint32_t                    dataSize = sizeof(uint16_t) + sizeof(uint8_t);
+    uint32_t                    i;
+    uint32_t                    j;
+
+#if gFsciBleTest_d
+    /* If GATT Database (application) is disabled the event must be not monitored */
+    if(bFsciBleGattDbAppEnabled == FALSE)
+    {
+        return;
+    }
+#endif /* gFsciBleTest_d */
+
+    /* Characteristic handle, CCCD handle, number of descriptors and descriptor handles */
+    for(i = 0U; i < pServiceInfo->nbOfCharacteristics; i++)
+    {
+        dataSize += sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint8_t) +
+                    ((uint32_t)pServiceInfo->pCharacteristicInfo[i].nbOfDescriptors * sizeof(uint16_t));
+    }
+
+    /* Allocate the packet to be sent over UART */
+    pClientPacket = fsciBleGattDbAppAllocFsciPacket((uint8_t)gBleGattDbAppEvtAddServiceOpCode_c, dataSize);
+
+    if(NULL == pClientPacket)
+    {
+        return;
+    }
+
+    pBuffer = &pClientPacket->payload[0];
+
+    /* Set event parameters in the buffer */
+    fsciBleGetBufferFromUint16Value(pServiceInfo->handle, pBuffer);
+    fsciBleGetBufferFromUint8Value(pServiceInfo->nbOfCharacteristics, pBuffer);
+
+    for(i = 0U; i < pServiceInfo->nbOfCharacteristics; i++)
+    {
+        pCharacteristicInfo = &pServiceInfo->pCharacteristicInfo[i];
+
+        fsciBleGetBufferFromUint16Value(pCharacteristicInfo->handle, pBuffer);
+        fsciBleGetBufferFromUint16Value((pCharacteristicInfo->bAddCccd ? pCharacteristicInfo->cccdHandle : gGattDbInvalidHandle_d), pBuffer);
+        fsciBleGetBufferFromUint8Value(pCharacteristicInfo->nbOfDescriptors, pBuffer);
+
+        for(j = 0U; j < pCharacteristicInfo->nbOfDescriptors; j++)
+        {
+            fsciBleGetBufferFromUint16Value(pCharacteristicInfo->pDescriptorInfo[j].handle, pBuffer);
+        }
+    }
+
+    /* Transmit the packet over UART */
+    fsciBleTransmitFormatedPacket(pClientPacket, fsciBleInterfaceId);
+}
+#endif /* gFsciBleGattDbAppAddService_d */
+
 #endif /* gFsciBleBBox_d || gFsciBleTest_d */
 
 /************************************************************************************
@@ -1546,6 +1621,9 @@ static void HandleGattDbAppCmdRemoveServiceOpCode(uint8_t *pBuffer, uint32_t fsc
     fsciBleGetUint16ValueFromBuffer(serviceHandle, pBuffer);
 
     fsciBleGattDbAppCallApiFunction(GattDbDynamic_RemoveService(serviceHandle));
+
+    /* An add of as many attributes would leave the service index stale */
+    GattDb_RebuildIndex();
 }
                     
 /*! *********************************************************************************
@@ -1567,6 +1645,9 @@ static void HandleGattDbAppCmdRemoveCharacteristicOpCode(uint8_t *pBuffer, uint3
     fsciBleGetUint16ValueFromBuffer(characteristicHandle, pBuffer);
 
     fsciBleGattDbAppCallApiFunction(GattDbDynamic_RemoveCharacteristic(characteristicHandle));
+
+    /* An add of as many attributes would leave the service index stale */
+    GattDb_RebuildIndex();
 }
                     
 /*! *********************************************************************************
@@ -1616,6 +1697,259 @@ static void HandleGattDbAppCmdEndDatabaseUpdateOpCode(uint8_t *pBuffer, uint32_t
 {
     fsciBleGattDbAppCallApiFunction(GattDbDynamic_EndDatabaseUpdate());
 }
+
+#if gFsciBleGattDbAppAddService_d
+/*! *********************************************************************************
+*\private
+*\fn           void HandleGattDbAppCmdAddServiceOpCode(uint8_t *pBuffer,
+*                                                      uint32_t fsciInterfaceId)
+*\brief        Handler for the gBleGattDbAppCmdAddServiceOpCode_c opCode. Adds a whole
+*              service from its description; if any attribute cannot be added, the
+*              attributes already added are removed with the service.
+*
+*\param  [in]  pBuffer              Pointer to the command parameters.
+*\param  [in]  fsciInterfaceId      FSCI interface identifier.
+*
+*\retval       void.
+********************************************************************************** */
+static void HandleGattDbAppCmdAddServiceOpCode(uint8_t *pBuffer, uint32_t fsciInterfaceId)
+{
+    uint16_t        tlvLength = 0U;
+    serviceInfo_t   serviceInfo = {0};
+    uint32_t        nbOfDescriptors = 0U;
+    uint8_t*        pInfo = NULL;
+    bleResult_t     result;
+
+    /* Get command parameters from buffer */
+    fsciBleGetUint16ValueFromBuffer(tlvLength, pBuffer);
+
+    /* The description must be in the packet, after its length field */
+    if((mFsciBleGattDbAppPayloadLength < sizeof(uint16_t)) ||
+       ((uint32_t)tlvLength > ((uint32_t)mFsciBleGattDbAppPayloadLength - sizeof(uint16_t))))
+    {
+        result = gBleInvalidParameter_c;
+    }
+    else
+    {
+        /* Validate the description and count its characteristics and descriptors */
+        result = fsciBleGattDbAppGetServiceFromTlv(pBuffer, tlvLength, &serviceInfo, NULL, &nbOfDescriptors);
+    }
+
+    if(gBleSuccess_c == result)
+    {
+        /* Allocate memory buffer for the characteristics and the descriptors,
+           at least one byte for a service without characteristics */
+        pInfo = MEM_BufferAlloc(((uint32_t)serviceInfo.nbOfCharacteristics * sizeof(characteristicInfo_t)) +
+                                (nbOfDescriptors * sizeof(descriptorInfo_t)) + 1U);
+
+        if(NULL != pInfo)
+        {
+            /* The values are not copied, they point in the command buffer */
+            serviceInfo.pCharacteristicInfo = (characteristicInfo_t*)(void*)pInfo;
+            (void)fsciBleGattDbAppGetServiceFromTlv(pBuffer, tlvLength, &serviceInfo,
+                                                   (descriptorInfo_t*)(void*)&serviceInfo.pCharacteristicInfo[serviceInfo.nbOfCharacteristics],
+                                                   &nbOfDescriptors);
+
+            result = GattDbDynamic_AddServiceInDatabase(&serviceInfo);
+
+            if((gBleSuccess_c != result) && (gGattDbInvalidHandle_d != serviceInfo.handle))
+            {
+                /* Keep the database unchanged */
+                (void)GattDbDynamic_RemoveService(serviceInfo.handle);
+                GattDb_RebuildIndex();
+            }
+
+            fsciBleGattDbAppStatusMonitor(result);
+            fsciBleGattDbAppMonitorOutParams(AddService, &serviceInfo);
+
+            (void)MEM_BufferFree(pInfo);
+        }
+        else
+        {
+            /* No memory - the Application GATT Database command can not be executed */
+            fsciBleError(gFsciOutOfMessages_c, fsciInterfaceId);
+        }
+    }
+    else
+    {
+        fsciBleGattDbAppStatusMonitor(result);
+    }
+}
+
+/*! *********************************************************************************
+*\private
+*\fn           bleResult_t fsciBleGattDbAppGetServiceFromTlv(uint8_t* pTlv,
+*                                                  uint16_t tlvLength,
+*                                                  serviceInfo_t* pServiceInfo,
+*                                                  descriptorInfo_t* pDescriptorInfo,
+*                                                  uint32_t* pNbOfDescriptors)
+*\brief        Parses the service description of gBleGattDbAppCmdAddServiceOpCode_c.
+*              If pServiceInfo->pCharacteristicInfo is NULL, only the service UUID and
+*              the number of characteristics and descriptors are set; otherwise the
+*              characteristics and the descriptors are set as well.
+*
+*\param  [in]  pTlv                 The service description.
+*\param  [in]  tlvLength            The length of the service description.
+*\param  [out] pServiceInfo         The service.
+*\param  [out] pDescriptorInfo      The descriptors of all the characteristics.
+*\param  [out] pNbOfDescriptors     The number of descriptors of all the characteristics.
+*
+*\retval       gBleSuccess_c
+*\retval       gBleInvalidParameter_c  The service description is not valid.
+********************************************************************************** */
+static bleResult_t fsciBleGattDbAppGetServiceFromTlv
+(
+    uint8_t*            pTlv,
+    uint16_t            tlvLength,
+    serviceInfo_t*      pServiceInfo,
+    descriptorInfo_t*   pDescriptorInfo,
+    uint32_t*           pNbOfDescriptors
+)
+{
+    bleResult_t             result = gBleSuccess_c;
+    characteristicInfo_t*   pCharacteristicInfo = NULL;
+    descriptorInfo_t*       pDescriptor;
+    bool_t                  bServiceFound = FALSE;
+    uint32_t                nbOfCharacteristics = 0U;
+    uint32_t                nbOfDescriptors = 0U;
+    uint32_t                nbOfCharDescriptors = 0U;
+    uint32_t                idx = 0U;
+    uint8_t                 type;
+    uint16_t                length;
+    uint8_t*                pValue;
+
+    while((idx < tlvLength) && (gBleSuccess_c == result))
+    {
+        if(((uint32_t)tlvLength - idx) < (sizeof(uint8_t) + sizeof(uint16_t)))
+        {
+            result = gBleInvalidParameter_c;
+            break;
+        }
+
+        type = pTlv[idx];
+        length = Utils_ExtractTwoByteValue(&pTlv[idx + 1U]);
+        idx += sizeof(uint8_t) + sizeof(uint16_t);
+        pValue = &pTlv[idx];
+
+        if((uint32_t)length > ((uint32_t)tlvLength - idx))
+        {
+            result = gBleInvalidParameter_c;
+            break;
+        }
+
+        switch(type)
+        {
+            case gFsciBleGattDbAppServiceTlvService_c:
+            {
+                if((TRUE == bServiceFound) || (length != sizeof(uint16_t)))
+                {
+                    result = gBleInvalidParameter_c;
+                }
+                else
+                {
+                    pServiceInfo->uuid16 = Utils_ExtractTwoByteValue(pValue);
+                    bServiceFound = TRUE;
+                }
+            }
+            break;
+
+            case gFsciBleGattDbAppServiceTlvCharacteristic_c:
+            {
+                /* UUID16, properties, permissions and max value length precede the value */
+                if((FALSE == bServiceFound) || (length < 6U) ||
+                   ((length - 6U) > gAttMaxValueLength_c) || (nbOfCharacteristics == 0xFFU))
+                {
+                    result = gBleInvalidParameter_c;
+                }
+                else
+                {
+                    if(NULL != pServiceInfo->pCharacteristicInfo)
+                    {
+                        pCharacteristicInfo = &pServiceInfo->pCharacteristicInfo[nbOfCharacteristics];
+                        pCharacteristicInfo->uuid16 = Utils_ExtractTwoByteValue(pValue);
+                        pCharacteristicInfo->handle = gGattDbInvalidHandle_d;
+                        pCharacteristicInfo->properties = pValue[2];
+                        pCharacteristicInfo->accessPermissions = pValue[3];
+                        pCharacteristicInfo->maxValueLength = Utils_ExtractTwoByteValue(&pValue[4]);
+                        pCharacteristicInfo->valueLength = length - 6U;
+                        pCharacteristicInfo->pValue = &pValue[6];
+                        pCharacteristicInfo->bAddCccd = FALSE;
+                        pCharacteristicInfo->cccdHandle = gGattDbInvalidHandle_d;
+                        pCharacteristicInfo->nbOfDescriptors = 0U;
+                        pCharacteristicInfo->pDescriptorInfo = &pDescriptorInfo[nbOfDescriptors];
+                    }
+
+                    nbOfCharacteristics++;
+                    nbOfCharDescriptors = 0U;
+                }
+            }
+            break;
+
+            case gFsciBleGattDbAppServiceTlvDescriptor_c:
+            {
+                /* UUID16 and permissions precede the value */
+                if((nbOfCharacteristics == 0U) || (length < 3U) ||
+                   ((length - 3U) > gAttMaxValueLength_c) || (nbOfCharDescriptors == 0xFFU))
+                {
+                    result = gBleInvalidParameter_c;
+                }
+                else
+                {
+                    if(NULL != pCharacteristicInfo)
+                    {
+                        pDescriptor = &pDescriptorInfo[nbOfDescriptors];
+                        pDescriptor->uuid16 = Utils_ExtractTwoByteValue(pValue);
+                        pDescriptor->handle = gGattDbInvalidHandle_d;
+                        pDescriptor->accessPermissions = pValue[2];
+                        pDescriptor->valueLength = length - 3U;
+                        pDescriptor->pValue = &pValue[3];
+                        pCharacteristicInfo->nbOfDescriptors++;
+                    }
+
+                    nbOfDescriptors++;
+                    nbOfCharDescriptors++;
+                }
+            }
+            break;
+
+            case gFsciBleGattDbAppServiceTlvCccd_c:
+            {
+                if((nbOfCharacteristics == 0U) || (length != 0U))
+                {
+                    result = gBleInvalidParameter_c;
+                }
+                else if(NULL != pCharacteristicInfo)
+                {
+                    pCharacteristicInfo->bAddCccd = TRUE;
+                }
+                else
+                {
+                    ; /* For MISRA compliance */
+                }
+            }
+            break;
+
+            default:
+            {
+                result = gBleInvalidParameter_c;
+            }
+            break;
+        }
+
+        idx += length;
+    }
+
+    if(FALSE == bServiceFound)
+    {
+        result = gBleInvalidParameter_c;
+    }
+
+    pServiceInfo->nbOfCharacteristics = (uint8_t)nbOfCharacteristics;
+    *pNbOfDescriptors = nbOfDescriptors;
+
+    return result;
+}
+#endif /* gFsciBleGattDbAppAddService_d */
 #endif /* gFsciBleBBox_d || gFsciBleTest_d */
 
 #if gFsciBleHost_d
@@ -1641,6 +1975,9 @@ static void HandleGattDbAppStatusOpCode(uint8_t *pBuffer, uint32_t fsciInterface
         /* Clean out parameters pointers kept in FSCI */
         fsciBleGattDbAppCleanOutParams();
     }
+
+    /* Status of an asynchronous command, if any is pending */
+    Ble_AsyncCmdStatus(gFsciBleGattDbAppOpcodeGroup_c, status);
 }
 
 /*! *********************************************************************************
@@ -25,6 +25,20 @@
 
 #include "fsci_ble_gatt_db_app_types.h"
 
+/*! Macro which indicates if the whole service insertion command is enabled or not. It builds on
+    GattDbDynamic_AddServiceInDatabase, so it follows the dynamic GATT Database by default. */
+#ifndef gFsciBleGattDbAppAddService_d
+    #if defined(gGattDbDynamic_d) && (gGattDbDynamic_d == 1)
+        #define gFsciBleGattDbAppAddService_d       1
+    #else
+        #define gFsciBleGattDbAppAddService_d       0
+    #endif
+#endif /* gFsciBleGattDbAppAddService_d */
+
+#if gFsciBleGattDbAppAddService_d
+    #include "gatt_database_dynamic.h"
+#endif /* gFsciBleGattDbAppAddService_d */
+
 /************************************************************************************
 *************************************************************************************
 * Public constants & macros
@@ -39,6 +53,15 @@
 /*! FSCI operation group for GATT Database (application) */
 #define gFsciBleGattDbAppOpcodeGroup_c              0x46
 
+/*! Record types of the service description carried by gBleGattDbAppCmdAddServiceOpCode_c.
+    A record is the type (1 byte), the value length (2 bytes) and the value. The description
+    starts with the service record; descriptor and CCCD records belong to the characteristic
+    before them. */
+#define gFsciBleGattDbAppServiceTlvService_c        0x01U   /*!< UUID16 */
+#define gFsciBleGattDbAppServiceTlvCharacteristic_c 0x02U   /*!< UUID16, properties, value permissions, max value length, initial value */
+#define gFsciBleGattDbAppServiceTlvDescriptor_c     0x03U   /*!< UUID16, permissions, value */
+#define gFsciBleGattDbAppServiceTlvCccd_c           0x04U   /*!< Empty */
+
 
 #if defined(FsciCmdMonitor)
     //#warning "FsciCmdMonitor macro is already defined"
@@ -423,6 +446,7 @@ typedef enum
 #if defined(gBLE52_d) && (gBLE52_d == TRUE)
     gBleGattDbAppCmdAddCharAggregateFormatOpCode_c                       = 0x15,                             /*! GattDbDynamic_AddCharAggregateFormat command operation code */
 #endif
+    gBleGattDbAppCmdAddServiceOpCode_c                                   = 0x16,                             /*! GattDbDynamic_AddServiceInDatabase command operation code */
 
     gBleGattDbAppStatusOpCode_c                                          = 0x80,                             /*! GATT Database (application) status operation code */
 
@@ -443,6 +467,7 @@ typedef enum
 #if defined(gBLE52_d) && (gBLE52_d == TRUE)
     gBleGattDbAppEvtAddCharAggregateFormatOpCode_c                       = 0x8E,                             /*! GattDbDynamic_AddCharAggregateFormat command out parameters event operation code */
 #endif
+    gBleGattDbAppEvtAddServiceOpCode_c                                   = 0x8F,                             /*! GattDbDynamic_AddServiceInDatabase command out parameters event operation code */
 }fsciBleGattDbAppOpCode_t;
 
 /************************************************************************************
@@ -763,6 +788,21 @@ void fsciBleGattDbAppUint16ParamEvtMonitor
     const uint16_t*             pValue
 );
 
+#if gFsciBleGattDbAppAddService_d
+/*! *********************************************************************************
+* \brief  GattDbDynamic_AddServiceInDatabase command out parameters monitoring function.
+*         Sends the handles of the service, of each characteristic, of its CCCD and of
+*         its descriptors.
+*
+* \param[in]    pServiceInfo    The added service.
+*
+********************************************************************************** */
+void fsciBleGattDbAppAddServiceEvtMonitor
+(
+    const serviceInfo_t* pServiceInfo
+);
+#endif /* gFsciBleGattDbAppAddService_d */
+
 #ifdef __cplusplus
 }
 #endif
@@ -44,6 +44,31 @@
 *************************************************************************************
 ************************************************************************************/
 
+#if gFsciBleBBox_d || gFsciBleTest_d
+/* SDUs of a batch command, sent from the received FSCI packet */
+typedef struct fsciBleL2capCbBatch_tag
+{
+    clientPacket_t* pPacket;        /* Received packet, freed when the batch completes */
+    uint8_t*        pNextSdu;       /* Length field of the next SDU to send */
+    uint8_t         sdusLeft;
+    uint8_t         sdusSent;
+} fsciBleL2capCbBatch_t;
+
+/* Batches queued on a channel, sent in order as L2CAP accepts the SDUs */
+typedef struct fsciBleL2capCbStream_tag
+{
+    bool_t                  bInUse;
+    bool_t                  bStalled;       /* L2CAP queue full, wait for the channel to be idle */
+    bool_t                  bPumping;       /* fsciBleL2capCbStreamPump is running */
+    bool_t                  bRepump;        /* Pump again when the running pump is done */
+    deviceId_t              deviceId;
+    uint16_t                channelId;
+    uint8_t                 head;
+    uint8_t                 count;
+    fsciBleL2capCbBatch_t   aBatches[gFsciBleL2capCbStreamDepth_c];
+} fsciBleL2capCbStream_t;
+#endif /* gFsciBleBBox_d || gFsciBleTest_d */
+
 /************************************************************************************
 *************************************************************************************
 * Private functions prototypes
@@ -52,6 +77,21 @@
 static void fsciBleL2capCbLeCbDataCallback(deviceId_t deviceId, uint16_t lePsm, uint8_t* pPacket, uint16_t packetLength);
 static void fsciBleL2capCbLeCbControlCallback(l2capControlMessage_t *pMessage);
 
+#if gFsciBleBBox_d || gFsciBleTest_d
+static bleResult_t fsciBleL2capCbQueueBatch
+(
+    clientPacket_t*             pClientPacket,
+    uint8_t*                    pBuffer,
+    deviceId_t                  deviceId,
+    uint16_t                    channelId,
+    uint8_t                     noOfSdus,
+    fsciBleL2capCbStream_t**    ppStream
+);
+static void fsciBleL2capCbStreamPump(fsciBleL2capCbStream_t* pStream);
+static void fsciBleL2capCbStreamCompleteBatch(fsciBleL2capCbStream_t* pStream, bleResult_t result);
+static void fsciBleL2capCbStreamControl(l2capControlMessage_t* pMessage);
+#endif /* gFsciBleBBox_d || gFsciBleTest_d */
+
 /************************************************************************************
 *************************************************************************************
 * Private memory declarations
@@ -73,6 +113,11 @@ static l2caLeCbDataCallback_t       l2capCbLeCbDataCallback     = fsciBleL2capCb
 /* L2CAP Credit Based control callback initialized with FSCI empty static function */
 static l2caLeCbControlCallback_t    l2capCbLeCbControlCallback  = fsciBleL2capCbLeCbControlCallback;
 
+#if gFsciBleBBox_d || gFsciBleTest_d
+/* Channels with SDU batches queued, used from the Host task as the L2CAP CB callbacks */
+static fsciBleL2capCbStream_t       maFsciBleL2capCbStreams[gFsciBleL2capCbMaxStreams_c];
+#endif /* gFsciBleBBox_d || gFsciBleTest_d */
+
 
 /************************************************************************************
 *************************************************************************************
@@ -104,6 +149,7 @@ void fsciBleL2capCbHandler(void* pData, void* param, uint32_t fsciInterface)
 {
     clientPacket_t* pClientPacket   = (clientPacket_t*)pData;
     uint8_t*        pBuffer         = &pClientPacket->structured.payload[0];
+    bool_t          bPacketKept     = FALSE;
 
 #if gFsciBleTest_d
     /* Mark this command as initiated by FSCI */
@@ -233,6 +279,35 @@ void fsciBleL2capCbHandler(void* pData, void* param, uint32_t fsciInterface)
                     }
                     break;
 
+                    case (uint8_t)gBleL2capCbCmdSendLeCbDataBatchOpCode_c:
+                    {
+                        deviceId_t              deviceId;
+                        uint16_t                channelId;
+                        uint8_t                 noOfSdus;
+                        bleResult_t             result;
+                        fsciBleL2capCbStream_t* pStream = NULL;
+
+                        /* Get deviceId, channelId and noOfSdus parameters from the received packet */
+                        fsciBleGetDeviceIdFromBuffer(&deviceId, &pBuffer);
+                        fsciBleGetUint16ValueFromBuffer(channelId, pBuffer);
+                        fsciBleGetUint8ValueFromBuffer(noOfSdus, pBuffer);
+
+                        /* The SDUs are not copied, the packet is kept until they are sent */
+                        result = fsciBleL2capCbQueueBatch(pClientPacket, pBuffer, deviceId, channelId, noOfSdus, &pStream);
+                        fsciBleL2capCbStatusMonitor(result);
+
+                        if(gBleSuccess_c == result)
+                        {
+                            bPacketKept = TRUE;
+                            fsciBleL2capCbStreamPump(pStream);
+                        }
+                        else
+                        {
+                            fsciBleL2capCbLeCbDataBatchCompleteEvtMonitor(deviceId, channelId, result, 0U, 0U);
+                        }
+                    }
+                    break;
+
                     case (uint8_t)gBleL2capCbCmdSendLeCreditOpCode_c:
                     {
                         deviceId_t  deviceId;
@@ -616,7 +691,10 @@ void fsciBleL2capCbHandler(void* pData, void* param, uint32_t fsciInterface)
     bFsciBleL2capCbCmdInitiatedByFsci = FALSE;
 #endif /* gFsciBleTest_d */
 
-    (void)MEM_BufferFree(pData);
+    if(FALSE == bPacketKept)
+    {
+        (void)MEM_BufferFree(pData);
+    }
 }
 
 
@@ -1121,6 +1199,44 @@ void fsciBleL2capCbLeCbDataEvtMonitor(deviceId_t deviceId, uint16_t srcCid, uint
 }
 
 
+void fsciBleL2capCbLeCbDataBatchCompleteEvtMonitor(deviceId_t deviceId, uint16_t channelId, bleResult_t result, uint8_t sdusSent, uint16_t sdusQueued)
+{
+    clientPacketStructured_t*   pClientPacket;
+    uint8_t*                    pBuffer;
+
+#if gFsciBleTest_d
+    /* If L2CAP CB is disabled the event must be not monitored */
+    if(FALSE == bFsciBleL2capCbEnabled)
+    {
+        return;
+    }
+#endif /* gFsciBleTest_d */
+
+    /* Allocate the packet to be sent over UART */
+    pClientPacket = fsciBleL2capCbAllocFsciPacket((uint8_t)gBleL2capCbEvtLeCbDataBatchCompleteOpCode_c,
+                                                  fsciBleGetDeviceIdBufferSize(&deviceId) +
+                                                  sizeof(uint16_t) + sizeof(bleResult_t) +
+                                                  sizeof(uint8_t) + sizeof(uint16_t));
+
+    if(NULL == pClientPacket)
+    {
+        return;
+    }
+
+    pBuffer = &pClientPacket->payload[0];
+
+    /* Set event parameters in the buffer */
+    fsciBleGetBufferFromDeviceId(&deviceId, &pBuffer);
+    fsciBleGetBufferFromUint16Value(channelId, pBuffer);
+    fsciBleGetBufferFromEnumValue(result, pBuffer, bleResult_t);
+    fsciBleGetBufferFromUint8Value(sdusSent, pBuffer);
+    fsciBleGetBufferFromUint16Value(sdusQueued, pBuffer);
+
+    /* Transmit the packet over UART */
+    fsciBleTransmitFormatedPacket(pClientPacket, fsciBleInterfaceId);
+}
+
+
 void fsciBleL2capCbLeCbControlEvtMonitor(l2capControlMessage_t* pMessage)
 {
     uint32_t                    dataSize    = sizeof(bool_t);
@@ -1353,9 +1469,304 @@ static void fsciBleL2capCbLeCbDataCallback(deviceId_t deviceId, uint16_t lePsm,
 
 static void fsciBleL2capCbLeCbControlCallback(l2capControlMessage_t *pMessage)
 {
+#if gFsciBleBBox_d || gFsciBleTest_d
+    fsciBleL2capCbStreamControl(pMessage);
+#endif /* gFsciBleBBox_d || gFsciBleTest_d */
     fsciBleL2capCbLeCbControlEvtMonitor(pMessage);
 }
 
+#if gFsciBleBBox_d || gFsciBleTest_d
+
+/*! *********************************************************************************
+* \brief  Checks the SDUs of a batch command and queues the batch on its channel.
+*
+* \param[in]    pClientPacket   The received packet, kept by the batch on success.
+* \param[in]    pBuffer         First SDU in the packet payload.
+* \param[in]    deviceId        The DeviceID of the channel.
+* \param[in]    channelId       The L2CAP CB Channel Id.
+* \param[in]    noOfSdus        Number of SDUs in the packet.
+* \param[out]   ppStream        The channel stream, on success.
+*
+* \return gBleSuccess_c, gBleInvalidParameter_c for a malformed batch or
+*         gBleOverflow_c if no stream or batch slot is free.
+*
+********************************************************************************** */
+static bleResult_t fsciBleL2capCbQueueBatch
+(
+    clientPacket_t*             pClientPacket,
+    uint8_t*                    pBuffer,
+    deviceId_t                  deviceId,
+    uint16_t                    channelId,
+    uint8_t                     noOfSdus,
+    fsciBleL2capCbStream_t**    ppStream
+)
+{
+    bleResult_t             result   = gBleSuccess_c;
+    fsciBleL2capCbStream_t* pStream  = NULL;
+    fsciBleL2capCbStream_t* pFree    = NULL;
+    uint32_t                consumed = (uint32_t)(pBuffer - &pClientPacket->structured.payload[0]);
+    uint32_t                left     = 0U;
+    uint8_t*                pSdu     = pBuffer;
+    uint8_t                 iCount;
+
+    if(pClientPacket->structured.header.len > consumed)
+    {
+        left = pClientPacket->structured.header.len - consumed;
+    }
+
+    /* Every SDU must be in the packet and not empty */
+    if(0U == noOfSdus)
+    {
+        result = gBleInvalidParameter_c;
+    }
+
+    for(iCount = 0U; (iCount < noOfSdus) && (gBleSuccess_c == result); iCount++)
+    {
+        uint16_t sduLength = 0U;
+
+        if(left >= sizeof(uint16_t))
+        {
+            fsciBleGetUint16ValueFromBuffer(sduLength, pSdu);
+            left -= sizeof(uint16_t);
+        }
+
+        if((0U == sduLength) || (sduLength > left))
+        {
+            result = gBleInvalidParameter_c;
+        }
+        else
+        {
+            pSdu += sduLength;
+            left -= sduLength;
+        }
+    }
+
+    if(gBleSuccess_c == result)
+    {
+        for(iCount = 0U; iCount < gFsciBleL2capCbMaxStreams_c; iCount++)
+        {
+            if(TRUE == maFsciBleL2capCbStreams[iCount].bInUse)
+            {
+                if((maFsciBleL2capCbStreams[iCount].deviceId == deviceId) &&
+                   (maFsciBleL2capCbStreams[iCount].channelId == channelId))
+                {
+                    pStream = &maFsciBleL2capCbStreams[iCount];
+                }
+            }
+            else if(NULL == pFree)
+            {
+                pFree = &maFsciBleL2capCbStreams[iCount];
+            }
+            else
+            {
+                ; /* For MISRA compliance */
+            }
+        }
+
+        if(NULL == pStream)
+        {
+            pStream = pFree;
+
+            if(NULL != pStream)
+            {
+                FLib_MemSet(pStream, 0, sizeof(fsciBleL2capCbStream_t));
+                pStream->bInUse    = TRUE;
+                pStream->deviceId  = deviceId;
+                pStream->channelId = channelId;
+            }
+        }
+
+        if((NULL == pStream) || (pStream->count >= gFsciBleL2capCbStreamDepth_c))
+        {
+            result = gBleOverflow_c;
+        }
+    }
+
+    if(gBleSuccess_c == result)
+    {
+        fsciBleL2capCbBatch_t* pBatch = &pStream->aBatches[(pStream->head + pStream->count) % gFsciBleL2capCbStreamDepth_c];
+
+        pBatch->pPacket  = pClientPacket;
+        pBatch->pNextSdu = pBuffer;
+        pBatch->sdusLeft = noOfSdus;
+        pBatch->sdusSent = 0U;
+        pStream->count++;
+
+        /* A new batch is also a new chance for a stalled channel */
+        pStream->bStalled = FALSE;
+        *ppStream = pStream;
+    }
+
+    return result;
+}
+
+/*! *********************************************************************************
+* \brief  Gives the queued SDUs of a channel to L2CAP until it refuses one, and
+*         reports the batches completed on the way. Any error other than a full
+*         L2CAP queue drops all the queued batches, so that the peer gets no data
+*         past a gap.
+*
+* \param[in]    pStream         The channel stream.
+*
+********************************************************************************** */
+static void fsciBleL2capCbStreamPump(fsciBleL2capCbStream_t* pStream)
+{
+    /* L2CAP may call back into the stream while an SDU is sent, pump once at a time */
+    if(TRUE == pStream->bPumping)
+    {
+        pStream->bRepump = TRUE;
+        return;
+    }
+
+    pStream->bPumping = TRUE;
+
+    do
+    {
+        pStream->bRepump = FALSE;
+
+        while((pStream->count > 0U) && (FALSE == pStream->bStalled))
+        {
+            fsciBleL2capCbBatch_t*  pBatch  = &pStream->aBatches[pStream->head];
+            clientPacket_t*         pPacket = pBatch->pPacket;
+            uint8_t*                pSdu    = pBatch->pNextSdu;
+            uint16_t                sduLength;
+            bleResult_t             result;
+
+            fsciBleGetUint16ValueFromBuffer(sduLength, pSdu);
+
+            result = L2ca_SendLeCbData(pStream->deviceId, pStream->channelId, pSdu, sduLength);
+
+            if(pBatch->pPacket != pPacket)
+            {
+                /* The channel was closed while the SDU was sent, the batch is already reported */
+            }
+            else if(gBleSuccess_c == result)
+            {
+                pBatch->pNextSdu = pSdu + sduLength;
+                pBatch->sdusSent++;
+                pBatch->sdusLeft--;
+
+                if(0U == pBatch->sdusLeft)
+                {
+                    fsciBleL2capCbStreamCompleteBatch(pStream, gBleSuccess_c);
+                }
+            }
+            else if((gBleOverflow_c == result) ||
+                    (gBleOutOfMemory_c == result) ||
+                    (gL2caChannelBusy_c == result))
+            {
+                /* Retried when the channel is idle again or the next batch arrives */
+                pStream->bStalled = TRUE;
+            }
+            else
+            {
+                while(pStream->count > 0U)
+                {
+                    fsciBleL2capCbStreamCompleteBatch(pStream, result);
+                }
+            }
+        }
+    } while(TRUE == pStream->bRepump);
+
+    pStream->bPumping = FALSE;
+
+    if(0U == pStream->count)
+    {
+        pStream->bInUse = FALSE;
+    }
+}
+
+/*! *********************************************************************************
+* \brief  Reports the head batch of a channel and frees its packet.
+*
+* \param[in]    pStream         The channel stream.
+* \param[in]    result          gBleSuccess_c or the error which stopped the batch.
+*
+********************************************************************************** */
+static void fsciBleL2capCbStreamCompleteBatch(fsciBleL2capCbStream_t* pStream, bleResult_t result)
+{
+    fsciBleL2capCbBatch_t*  pBatch     = &pStream->aBatches[pStream->head];
+    uint8_t                 sdusSent   = pBatch->sdusSent;
+    uint16_t                sdusQueued = 0U;
+    uint8_t                 iCount;
+
+    (void)MEM_BufferFree(pBatch->pPacket);
+    pBatch->pPacket = NULL;
+
+    pStream->head = (pStream->head + 1U) % gFsciBleL2capCbStreamDepth_c;
+    pStream->count--;
+
+    for(iCount = 0U; iCount < pStream->count; iCount++)
+    {
+        sdusQueued += pStream->aBatches[(pStream->head + iCount) % gFsciBleL2capCbStreamDepth_c].sdusLeft;
+    }
+
+    fsciBleL2capCbLeCbDataBatchCompleteEvtMonitor(pStream->deviceId, pStream->channelId, result, sdusSent, sdusQueued);
+}
+
+/*! *********************************************************************************
+* \brief  Resumes or drops the batches of a channel on its L2CAP CB control events.
+*
+* \param[in]    pMessage        Message data (can be NULL).
+*
+********************************************************************************** */
+static void fsciBleL2capCbStreamControl(l2capControlMessage_t* pMessage)
+{
+    uint8_t iCount;
+
+    if(NULL == pMessage)
+    {
+        return;
+    }
+
+    for(iCount = 0U; iCount < gFsciBleL2capCbMaxStreams_c; iCount++)
+    {
+        fsciBleL2capCbStream_t* pStream = &maFsciBleL2capCbStreams[iCount];
+
+        if(TRUE == pStream->bInUse)
+        {
+            switch(pMessage->messageType)
+            {
+                case gL2ca_ChannelStatusNotification_c:
+                    {
+                        if((pMessage->messageData.channelStatusNotification.deviceId == pStream->deviceId) &&
+                           (pMessage->messageData.channelStatusNotification.cId == pStream->channelId) &&
+                           (gL2ca_ChannelStatusChannelIdle_c == pMessage->messageData.channelStatusNotification.status))
+                        {
+                            pStream->bStalled = FALSE;
+                            fsciBleL2capCbStreamPump(pStream);
+                        }
+                    }
+                    break;
+
+                case gL2ca_LePsmDisconnectNotification_c:
+                    {
+                        if((pMessage->messageData.disconnection.deviceId == pStream->deviceId) &&
+                           (pMessage->messageData.disconnection.cId == pStream->channelId))
+                        {
+                            while(pStream->count > 0U)
+                            {
+                                fsciBleL2capCbStreamCompleteBatch(pStream, gL2caChannelClosed_c);
+                            }
+
+                            if(FALSE == pStream->bPumping)
+                            {
+                                pStream->bInUse = FALSE;
+                            }
+                        }
+                    }
+                    break;
+
+                default:
+                    ; /* For MISRA compliance */
+                    break;
+            }
+        }
+    }
+}
+
+#endif /* gFsciBleBBox_d || gFsciBleTest_d */
+
 #endif /* gFsciIncluded_c && gFsciBleL2capCbLayerEnabled_d */
 
 /*! *********************************************************************************
@@ -39,6 +39,16 @@
 /*! FSCI operation group for L2CAP CB */
 #define gFsciBleL2capCbOpcodeGroup_c            0x42
 
+/*! Number of channels which can stream SDU batches at the same time */
+#ifndef gFsciBleL2capCbMaxStreams_c
+    #define gFsciBleL2capCbMaxStreams_c         2U
+#endif /* gFsciBleL2capCbMaxStreams_c */
+
+/*! Number of SDU batches queued on a channel. Each one holds its FSCI packet until sent. */
+#ifndef gFsciBleL2capCbStreamDepth_c
+    #define gFsciBleL2capCbStreamDepth_c        2U
+#endif /* gFsciBleL2capCbStreamDepth_c */
+
 
 #if defined(FsciCmdMonitor)
     //#warning "FsciCmdMonitor macro is already defined"
@@ -128,6 +138,7 @@ typedef enum
     gBleL2capCbCmdEnhancedChannelReconfigureOpCode_c       = 0x0A,                         /*! L2ca_EnhancedChannelReconfigure command operation code */
     gBleL2capCbCmdEnhancedCancelConnectionOpCode_c         = 0x0B,                         /*! L2ca_EnhancedCancelConnection command operation code */
 #endif /* gBLE52_d */
+    gBleL2capCbCmdSendLeCbDataBatchOpCode_c                = 0x0C,                         /*! L2ca_SendLeCbData for a batch of SDUs operation code */
     
     gBleL2capCbStatusOpCode_c                              = 0x80,                         /*! L2CAP CB status operation code */
     
@@ -148,6 +159,7 @@ typedef enum
     gBleL2capCbEvtEnhancedReconfigureResponseOpCode_c      = 0x8C,                         /*! l2caLeCbControlCallback event (messageType == gL2ca_EnhancedReconfigureResponse_c) operation code */
 #endif /* gBLE52_d */
     gBleL2capCbEvtLowPeerCreditsOpCode_c                   = 0x8D,                         /*! l2caLeCbControlCallback event (messageType == gL2ca_LowPeerCredits_c) operation code */
+    gBleL2capCbEvtLeCbDataBatchCompleteOpCode_c            = 0x8E,                         /*! SDU batch sent or dropped event operation code */
 }fsciBleL2capCbOpCode_t;
 
 /************************************************************************************
@@ -370,6 +382,26 @@ void fsciBleL2capCbLeCbDataEvtMonitor
     uint16_t                packetLength
 );
 
+/*! *********************************************************************************
+* \brief  SDU batch completion event monitoring function.
+*
+* \param[in]    deviceId            The DeviceID of the channel.
+* \param[in]    channelId           The L2CAP CB Channel Id.
+* \param[in]    result              gBleSuccess_c if all the SDUs were given to L2CAP,
+*                                   else the error which stopped the batch.
+* \param[in]    sdusSent            SDUs of the batch given to L2CAP.
+* \param[in]    sdusQueued          SDUs of the next batches still queued on the channel.
+*
+********************************************************************************** */
+void fsciBleL2capCbLeCbDataBatchCompleteEvtMonitor
+(
+    deviceId_t              deviceId,
+    uint16_t                channelId,
+    bleResult_t             result,
+    uint8_t                 sdusSent,
+    uint16_t                sdusQueued
+);
+
 /*! *********************************************************************************
 * \brief  l2caLeCbControlCallback events monitoring function.
 *
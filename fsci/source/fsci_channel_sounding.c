@@ -75,6 +75,22 @@ static void fsciCSCmdCompleteDeviceIdMonitor
     deviceId_t deviceId,
     fsciCSOpCode_t opCode
 );
+#if gFsciBleBBox_d || gFsciBleTest_d
+static bool_t fsciCSStepsFitInPacket
+(
+    clientPacket_t* pClientPacket,
+    const uint8_t*  pSteps,
+    uint8_t         numSteps,
+    uint16_t*       pStepsLength
+);
+#endif /* gFsciBleBBox_d || gFsciBleTest_d */
+static void fsciCSStepIteratorSetup
+(
+    csStepIterator_t*   pIterator,
+    const uint8_t*      pData,
+    uint32_t            length,
+    uint8_t             numSteps
+);
 
 /*  Unpack parameters from the received buffer */
 static void fsciCSTestFromBuffer
@@ -162,6 +178,11 @@ static void fsciCSSetProcedureParametersFromBuffer
     static csMetaEventCallback_t pCsMetaEventCallback = NULL;
 #endif /* gFsciBleTest_d */
 
+/* Steps of the subevent result being passed to the application, bounding the step
+   iterators, and their length in the received packet */
+static const uint8_t* mpCsStepsData = NULL;
+static uint16_t       mCsStepsDataLength = 0U;
+
 
 /************************************************************************************
 *************************************************************************************
@@ -173,6 +194,37 @@ void fsciRegisterCSMetaEventCallback(csMetaEventCallback_t callback)
     pCsMetaEventCallback = callback;
 }
 
+void fsciCSStepIteratorInit(csStepIterator_t* pIterator, const uint8_t* pData, uint8_t numSteps)
+{
+    /* Only the steps of the event being passed to the application can be read */
+    uint32_t length = ((pData != NULL) && (pData == mpCsStepsData)) ? (uint32_t)mCsStepsDataLength : 0U;
+
+    fsciCSStepIteratorSetup(pIterator, pData, length, numSteps);
+}
+
+bool_t fsciCSStepIteratorNext(csStepIterator_t* pIterator, csStep_t* pStep)
+{
+    bool_t   result = FALSE;
+    uint32_t left   = (uint32_t)(pIterator->pEnd - pIterator->pCursor);
+
+    /* Mode, channel and data length fields, then the step data */
+    if( (pIterator->stepsLeft != 0U) &&
+        (left >= 3U * sizeof(uint8_t)) &&
+        (left - 3U * sizeof(uint8_t) >= pIterator->pCursor[2]) )
+    {
+        pStep->mode       = pIterator->pCursor[0];
+        pStep->channel    = pIterator->pCursor[1];
+        pStep->dataLength = pIterator->pCursor[2];
+        pStep->pData      = &pIterator->pCursor[3];
+
+        pIterator->pCursor += 3U * sizeof(uint8_t) + pStep->dataLength;
+        pIterator->stepsLeft--;
+        result = TRUE;
+    }
+
+    return result;
+}
+
 void fsciCSHandler(void* pData, void* param, uint32_t fsciBleInterfaceId)
 {
     clientPacket_t* pClientPacket   = (clientPacket_t*)pData;
@@ -429,32 +481,24 @@ void fsciCSHandler(void* pData, void* param, uint32_t fsciBleInterfaceId)
               case gcsSubeventResultEventOpCode_c:
                   {
                       csMetaEvent_t metaEvent;
-                      uint32_t dataTotalLength = 0U;
 
                       metaEvent.eventType = csSubeventResultEvent_c;
                       fsciCSEventResultFromBuffer(&metaEvent.eventData.csSubeventResultEvent, &pBuffer);
 
-                      /* Compute total data length */
-                      uint8_t *stepDataLenPtr = pBuffer + 2 * sizeof(uint8_t);
-                      for (uint8_t step = 0; step < metaEvent.eventData.csSubeventResultEvent.numStepsReported; step++)
-                      {
-                          /* Account for mode, channel, data_length fields */
-                          dataTotalLength += *(stepDataLenPtr + dataTotalLength) + sizeof(uint8_t) * 3;
-                      }
-
-                      metaEvent.eventData.csSubeventResultEvent.pData = MEM_BufferAlloc(dataTotalLength);
-                      if (metaEvent.eventData.csSubeventResultEvent.pData == NULL)
+                      /* The steps are passed in place, they must not run past the FSCI payload */
+                      if( FALSE == fsciCSStepsFitInPacket(pClientPacket, pBuffer, metaEvent.eventData.csSubeventResultEvent.numStepsReported,
+                                                          &mCsStepsDataLength) )
                       {
-                          fsciBleError(gFsciOutOfMessages_c, fsciBleInterfaceId);
+                          fsciBleError(gFsciError_c, fsciBleInterfaceId);
                       }
                       else
                       {
-                          /* Copy data from buffer */
-                          fsciBleGetArrayFromBuffer(metaEvent.eventData.csSubeventResultEvent.pData, pBuffer, dataTotalLength);
+                          /* pData is valid until the callback returns, the packet is freed below */
+                          metaEvent.eventData.csSubeventResultEvent.pData = pBuffer;
+                          mpCsStepsData = pBuffer;
                           /* Trigger application callback */
                           pCsMetaEventCallback(&metaEvent);
-                          /* Free event data */
-                          MEM_BufferFree(metaEvent.eventData.csSubeventResultEvent.pData);
+                          mpCsStepsData = NULL;
                       }
                   }
                   break;
@@ -462,34 +506,24 @@ void fsciCSHandler(void* pData, void* param, uint32_t fsciBleInterfaceId)
               case gcsSubeventResultContinueEventOpCode_c:
                   {
                       csMetaEvent_t metaEvent;
-                      uint32_t dataTotalLength = 0U;
 
                       metaEvent.eventType = csSubeventResultContinueEvent_c;
                       fsciCSEventResultContinueFromBuffer(&metaEvent.eventData.csSubeventResultContinueEvent, &pBuffer);
 
-                     /* Compute total data length */
-                      uint8_t *stepDataLenPtr = pBuffer + 2 * sizeof(uint8_t);
-                      for (uint8_t step = 0; step < metaEvent.eventData.csSubeventResultContinueEvent.numStepsReported; step++)
+                      /* The steps are passed in place, they must not run past the FSCI payload */
+                      if( FALSE == fsciCSStepsFitInPacket(pClientPacket, pBuffer, metaEvent.eventData.csSubeventResultContinueEvent.numStepsReported,
+                                                          &mCsStepsDataLength) )
                       {
-                          /* Account for mode, channel, data_length fields */
-                          dataTotalLength += *(stepDataLenPtr + dataTotalLength) + sizeof(uint8_t) * 3;
-                      }
-
-                      metaEvent.eventData.csSubeventResultContinueEvent.pData = MEM_BufferAlloc(dataTotalLength);
-                      if (metaEvent.eventData.csSubeventResultContinueEvent.pData == NULL)
-                      {
-                          fsciBleError(gFsciOutOfMessages_c, fsciBleInterfaceId);
+                          fsciBleError(gFsciError_c, fsciBleInterfaceId);
                       }
                       else
                       {
-                          /* Copy data from buffer */
-                          fsciBleGetArrayFromBuffer(metaEvent.eventData.csSubeventResultContinueEvent.pData,
-                                                    pBuffer,
-                                                    dataTotalLength);
+                          /* pData is valid until the callback returns, the packet is freed below */
+                          metaEvent.eventData.csSubeventResultContinueEvent.pData = pBuffer;
+                          mpCsStepsData = pBuffer;
                           /* Trigger application callback */
                           pCsMetaEventCallback(&metaEvent);
-                          /* Free event data */
-                          MEM_BufferFree(metaEvent.eventData.csSubeventResultContinueEvent.pData);
+                          mpCsStepsData = NULL;
                       }
                   }
                   break;
@@ -1591,6 +1625,71 @@ static void fsciCSEventResultContinueFromBuffer
     fsciBleGetUint8ValueFromBuffer(pEvent->numStepsReported, *ppBuffer);
 }
 
+#if gFsciBleBBox_d || gFsciBleTest_d
+/*! *********************************************************************************
+* \brief  Checks that the steps of a CS subevent result end inside the received packet
+*
+* \param[in]    pClientPacket   The received packet.
+* \param[in]    pSteps          First step, inside the packet payload.
+* \param[in]    numSteps        Number of steps reported by the event.
+* \param[out]   pStepsLength    Bytes taken by the steps, valid when TRUE is returned.
+*
+* \return TRUE if all the steps can be read from the payload.
+*
+********************************************************************************** */
+static bool_t fsciCSStepsFitInPacket
+(
+    clientPacket_t* pClientPacket,
+    const uint8_t*  pSteps,
+    uint8_t         numSteps,
+    uint16_t*       pStepsLength
+)
+{
+    csStepIterator_t iterator;
+    csStep_t         step;
+    uint32_t         consumed = (uint32_t)(pSteps - &pClientPacket->structured.payload[0]);
+    uint32_t         length   = 0U;
+
+    if( pClientPacket->structured.header.len > consumed )
+    {
+        length = pClientPacket->structured.header.len - consumed;
+    }
+
+    fsciCSStepIteratorSetup(&iterator, pSteps, length, numSteps);
+
+    while( TRUE == fsciCSStepIteratorNext(&iterator, &step) )
+    {
+    }
+
+    /* The FSCI payload length is 16 bits, so are the steps */
+    *pStepsLength = (uint16_t)(iterator.pCursor - pSteps);
+
+    return (iterator.stepsLeft == 0U) ? TRUE : FALSE;
+}
+#endif /* gFsciBleBBox_d || gFsciBleTest_d */
+
+/*! *********************************************************************************
+* \brief  Starts an iteration over the steps held by length bytes at pData
+*
+* \param[in]    pIterator   The iterator.
+* \param[in]    pData       First step.
+* \param[in]    length      Bytes which may be read from pData.
+* \param[in]    numSteps    Number of steps reported by the event.
+*
+********************************************************************************** */
+static void fsciCSStepIteratorSetup
+(
+    csStepIterator_t*   pIterator,
+    const uint8_t*      pData,
+    uint32_t            length,
+    uint8_t             numSteps
+)
+{
+    pIterator->pCursor   = pData;
+    pIterator->pEnd      = pData + length;
+    pIterator->stepsLeft = numSteps;
+}
+
 /*! *********************************************************************************
 * \brief  Unpack CS Error event from the received buffer
 *
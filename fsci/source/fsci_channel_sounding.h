@@ -154,6 +154,23 @@ typedef enum
     gCSEventCommandStatusOpCode_c                        = 0xA0,                 /*! csCommandStatusEvent_t event operation code */
 }fsciCSOpCode_t;
 
+/*! One step of a CS subevent result, as returned by fsciCSStepIteratorNext */
+typedef struct csStep_tag
+{
+    uint8_t         mode;               /*! Step mode */
+    uint8_t         channel;            /*! Step channel */
+    uint8_t         dataLength;         /*! Length of the step data */
+    const uint8_t*  pData;              /*! Step data, inside the iterated buffer */
+} csStep_t;
+
+/*! Iterator over the steps of a CS subevent result or subevent result continue event */
+typedef struct csStepIterator_tag
+{
+    const uint8_t*  pCursor;            /*! Mode field of the next step */
+    const uint8_t*  pEnd;               /*! End of the iterated buffer */
+    uint8_t         stepsLeft;          /*! Steps not returned yet */
+} csStepIterator_t;
+
 /************************************************************************************
 *************************************************************************************
 * Public memory declarations
@@ -168,6 +185,11 @@ typedef enum
 /*! *********************************************************************************
 * \brief  Registers the LE Meta application event callback.
 *
+*         The pData field of the subevent result events points inside the received
+*         FSCI packet and is valid only until the callback returns. Use
+*         fsciCSStepIteratorInit and fsciCSStepIteratorNext from the callback to read
+*         the steps.
+*
 * \param[in]    callback      The LE Meta event callback.
 *
 ********************************************************************************** */
@@ -194,6 +216,40 @@ void fsciCSHandler
     uint32_t fsciBleInterfaceId
 );
 
+/*! *********************************************************************************
+* \brief  Starts an iteration over the steps of a CS subevent result. The steps are
+*         bounded by the received FSCI packet, so the iteration must be started from
+*         the LE Meta event callback, during which the packet is kept.
+*
+* \param[in]    pIterator   The iterator.
+* \param[in]    pData       The pData field of a csSubeventResultEvent_t or
+*                           csSubeventResultContinueEvent_t.
+* \param[in]    numSteps    The numStepsReported field of the same event.
+*
+********************************************************************************** */
+void fsciCSStepIteratorInit
+(
+    csStepIterator_t*   pIterator,
+    const uint8_t*      pData,
+    uint8_t             numSteps
+);
+
+/*! *********************************************************************************
+* \brief  Reads the next step of a CS subevent result. The step data is not copied.
+*
+* \param[in]    pIterator   The iterator.
+* \param[out]   pStep       The step.
+*
+* \return TRUE if a step was read, FALSE when all the steps were read or the next
+*         one does not fit in the iterated buffer.
+*
+********************************************************************************** */
+bool_t fsciCSStepIteratorNext
+(
+    csStepIterator_t*   pIterator,
+    csStep_t*           pStep
+);
+
 /*! *********************************************************************************
 * \brief  Event Monitor Handler for CS LE Meta events.
 *
@@ -138,6 +138,17 @@ extern "C" {
 ********************************************************************************** */
 uint16_t GattDb_GetIndexOfHandle(uint16_t handle);
 
+/*! *********************************************************************************
+* \brief     Rebuilds the service index used by the service range queries.
+*
+* \remarks   The index is rebuilt automatically when the database array or the
+*            attribute count changes. Call it after dynamic updates that keep both,
+*            such as the removal of a service followed by the addition of another one
+*            of the same size, as the FSCI remove handlers do.
+*
+********************************************************************************** */
+void GattDb_RebuildIndex(void);
+
 /*! *********************************************************************************
 * \brief     Returns the handle of the service to which the given attribute belongs.
 *
@@ -187,9 +198,6 @@ uint16_t GattDb_GetAttributeValueSize(uint16_t handle);
 *
 * \retval   gBleSuccess_c
 * \retval   gBleInvalidState_c              Database not initialized or empty.
-* \retval   gBleOutOfMemory_c               Could not allocate memory for the database
-*                                           content used to compute the database hash.
-* \retval   gGattDbInvalidHandleIndex_d     Service does not exist in gatt database.
 *
 ********************************************************************************** */
 bleResult_t GattDb_ComputeDatabaseHash(void);
@@ -61,12 +61,15 @@ target_sources(${MCUX_SDK_PROJECT_NAME} PRIVATE
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/sys/EventManager.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/sys/MessageQueue.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/sys/RawFrame.c
+  ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/sys/RingQueue.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/sys/hsdkEvent.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/sys/hsdkFile.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/sys/hsdkLock.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/sys/hsdkLogger.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/sys/hsdkSemaphore.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/sys/hsdkThread.c
+  ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/sys/hsdkTrace.c
+  ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/sys/hsdkReactor.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/sys/utils.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/physical/PCAP/PCAPDevice.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/physical/SPI/SPIConfiguration.c
@@ -74,8 +77,13 @@ target_sources(${MCUX_SDK_PROJECT_NAME} PRIVATE
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/physical/UART/UARTConfiguration.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/physical/UART/UARTDevice.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/physical/UART/UARTDiscovery.c
+  ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/physical/Virtual/VirtualBoard.c
+  ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/physical/Virtual/VirtualDevice.c
+  ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/protocol/FSCI/FSCICursorFramer.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/protocol/FSCI/FSCIFrame.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/protocol/FSCI/FSCIFramer.c
+  ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/protocol/HCI/HCIFrame.c
+  ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk/protocol/HCI/HCIFramer.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk-c/demo/HeartRateSensor.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk-c/src/cmd_ble.c
   ${CMAKE_CURRENT_LIST_DIR}/../../../tools/wireless/host_sdk/hsdk-c/src/evt_ble.c
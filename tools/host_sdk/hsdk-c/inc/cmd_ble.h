@@ -139,6 +139,31 @@ typedef struct L2CAPCBEnhancedCancelConnectionRequest_tag {
 	uint8_t *Cids;  // The list of CIDs
 } L2CAPCBEnhancedCancelConnectionRequest_t;
 
+typedef struct L2CAPCBSendLeCbDataBatchRequest_tag {
+	uint8_t DeviceId;  // The DeviceId for which the command is intended
+	uint16_t ChannelId;  // The L2CAP Channel Id assigned on the initiator
+	uint8_t NoOfSdus;  // Number of SDUs in the batch
+	struct {
+		uint16_t Length;  // Length of the SDU, not 0
+		uint8_t *Data;  // The SDU to be transmitted
+	} *Sdus;  // SDUs sent in order on the channel
+} L2CAPCBSendLeCbDataBatchRequest_t;
+
+/* Sends a buffer over a Credit Based channel as batches of SDUs, see L2CAPCBLeCbDataStreamPump */
+typedef struct L2CAPCBLeCbDataStream_tag {
+	uint8_t DeviceId;  // The DeviceId of the channel
+	uint16_t ChannelId;  // The L2CAP Channel Id assigned on the initiator
+	uint8_t *Data;  // Data to send, kept by the caller until the stream is done
+	uint32_t Length;  // Length of Data
+	uint16_t SduSize;  // Bytes per SDU, at most the peer MTU
+	uint8_t SdusPerBatch;  // SDUs per batch command
+	uint8_t MaxBatchesInFlight;  // Batches queued on the board, at most its gFsciBleL2capCbStreamDepth_c
+	uint32_t Offset;  // Data sent to the board
+	uint32_t Acked;  // Data given to L2CAP by the board before the first error
+	uint8_t BatchesInFlight;  // Batches not completed yet
+	uint16_t Status;  // First error reported for the stream, gBleSuccess_c while none
+} L2CAPCBLeCbDataStream_t;
+
 #endif  /* L2CAPCB_ENABLE */
 
 #if GATT_ENABLE
@@ -1355,6 +1380,17 @@ typedef struct GATTDBDynamicAddCharDescriptorWithUniqueValueRequest_tag {
 	GATTDBDynamicAddCharDescriptorWithUniqueValueRequest_DescriptorAccessPermissions_t DescriptorAccessPermissions;  // Access permissions for the descriptor attribute
 } GATTDBDynamicAddCharDescriptorWithUniqueValueRequest_t;
 
+/* Record types of the service description, each record is Type(1) Length(2) Value */
+#define GATTDBDynamicServiceTlvService_c 0x01
+#define GATTDBDynamicServiceTlvCharacteristic_c 0x02
+#define GATTDBDynamicServiceTlvDescriptor_c 0x03
+#define GATTDBDynamicServiceTlvCccd_c 0x04
+
+typedef struct GATTDBDynamicAddServiceRequest_tag {
+	uint16_t TlvLength;  // Length of the service description
+	uint8_t *Tlv;  // Service description, built with GATTDBDynamicServiceTlvService and the following records
+} GATTDBDynamicAddServiceRequest_t;
+
 #endif  /* GATTDB_APP_ENABLE */
 
 #if GATTDB_ATT_ENABLE
@@ -2858,6 +2894,12 @@ typedef PACKED_STRUCT GAPEattSendCreditsRequest_tag {
 	uint16_t Credits;  // Credits
 } GAPEattSendCreditsRequest_t;
 
+typedef PACKED_STRUCT GAPSetScanReportBatchingRequest_tag {
+	uint16_t WindowMs;  // Time the first report of a batch waits for the next ones, in milliseconds; 0 disables batching
+	uint16_t MaxSize;  // Batch payload size above which the batch is sent; 0 for the largest the board supports
+	bool_t FilterDuplicates;  // TRUE to drop the reports with the same address, type and data as one already in the batch
+} GAPSetScanReportBatchingRequest_t;
+
 #endif  /* GAP_ENABLE */
 
 #if FSCI_ENABLE
@@ -3499,6 +3541,14 @@ typedef struct L2CAPCBEnhancedReconfigureResponseIndication_tag {
 	} EnhancedReconfigureResponse;  // Enhanced Reconfigure Response event data
 } L2CAPCBEnhancedReconfigureResponseIndication_t;
 
+typedef PACKED_STRUCT L2CAPCBLeCbDataBatchCompleteIndication_tag {
+	uint8_t DeviceId;  // The DeviceId of the channel
+	uint16_t ChannelId;  // The L2CAP Channel Id assigned on the initiator
+	L2CAPCBConfirm_Status_t Status;  // gBleSuccess_c if all the SDUs were given to L2CAP
+	uint8_t SdusSent;  // SDUs of the batch given to L2CAP
+	uint16_t SdusQueued;  // SDUs of the following batches still queued on the channel
+} L2CAPCBLeCbDataBatchCompleteIndication_t;
+
 #endif  /* L2CAPCB_ENABLE */
 
 #if GATT_ENABLE
@@ -10700,6 +10750,17 @@ typedef PACKED_STRUCT GATTDBDynamicAddCharDescriptorWithUniqueValueIndication_ta
 	uint16_t DescriptorHandle;  // Handle of the Descriptor declaration
 } GATTDBDynamicAddCharDescriptorWithUniqueValueIndication_t;
 
+typedef struct GATTDBDynamicAddServiceIndication_tag {
+	uint16_t ServiceHandle;  // Handle of the Service declaration
+	uint8_t NbOfCharacteristics;  // Number of characteristics of the service
+	struct {
+		uint16_t CharacteristicHandle;  // Handle of the Characteristic declaration
+		uint16_t CccdHandle;  // Handle of the CCCD, 0 if the characteristic has none
+		uint8_t NbOfDescriptors;  // Number of descriptors, the CCCD excluded
+		uint16_t *DescriptorHandles;  // Handles of the descriptors in the order they were described
+	} *Characteristics;  // Characteristics in the order they were described
+} GATTDBDynamicAddServiceIndication_t;
+
 #endif  /* GATTDB_APP_ENABLE */
 
 #if GATTDB_ATT_ENABLE
@@ -14014,6 +14075,17 @@ typedef struct GAPScanningEventExtDeviceScannedIndication_tag {
 	uint8_t *Data;  // Advertising or scan response data
 } GAPScanningEventExtDeviceScannedIndication_t;
 
+typedef struct GAPScanningEventDeviceScannedBatchIndication_tag {
+	uint8_t NoOfReports;  // Number of reports in the batch
+	struct {
+		uint16_t id;  // GAPScanningEventDeviceScannedIndication_FSCI_ID or GAPScanningEventExtDeviceScannedIndication_FSCI_ID
+		union {
+			GAPScanningEventDeviceScannedIndication_t DeviceScanned;
+			GAPScanningEventExtDeviceScannedIndication_t ExtDeviceScanned;
+		} Data;  // The report, as loaded from its single event
+	} *Reports;  // Reports in the order they were scanned
+} GAPScanningEventDeviceScannedBatchIndication_t;
+
 /* Periodic advertising sync status */
 typedef enum GAPScanningEventPeriodicAdvSyncEstablishedIndication_Status_tag {
 	GAPScanningEventPeriodicAdvSyncEstablishedIndication_Status_gBleSuccess_c = 0x0000,
@@ -15890,6 +15962,7 @@ typedef enum bleFsciIds_tag
 	L2CAPCBEnhancedConnectLePsmRequest_FSCI_ID = 0x4209,
 	L2CAPCBEnhancedChannelReconfigureRequest_FSCI_ID = 0x420A,
 	L2CAPCBEnhancedCancelConnectionRequest_FSCI_ID = 0x420B,
+	L2CAPCBSendLeCbDataBatchRequest_FSCI_ID = 0x420C,
 	GATTInitRequest_FSCI_ID = 0x4501,
 	GATTGetMtuRequest_FSCI_ID = 0x4502,
 	GATTClientInitRequest_FSCI_ID = 0x4503,
@@ -15971,6 +16044,7 @@ typedef enum bleFsciIds_tag
 	GATTDBDynamicRemoveCharacteristicRequest_FSCI_ID = 0x4612,
 	GATTDBDynamicAddCharDescriptorWithUniqueValueRequest_FSCI_ID = 0x4613,
 	GATTDBDynamicEndDatabaseUpdateRequest_FSCI_ID = 0x4614,
+	GATTDBDynamicAddServiceRequest_FSCI_ID = 0x4616,
 	GATTDBAttFindInformationRequest_FSCI_ID = 0x4701,
 	GATTDBAttFindByTypeValueRequest_FSCI_ID = 0x4702,
 	GATTDBAttReadByTypeRequest_FSCI_ID = 0x4703,
@@ -16098,6 +16172,7 @@ typedef enum bleFsciIds_tag
 	GAPEattConnectionAccept_FSCI_ID = 0x4873,
 	GAPEattReconfigureRequest_FSCI_ID = 0x4874,
 	GAPEattSendCreditsRequest_FSCI_ID = 0x4875,
+	GAPSetScanReportBatchingRequest_FSCI_ID = 0x487D,
 	FSCICPUResetRequest_FSCI_ID = 0xA308,
 	FSCIGetNumberOfFreeBuffersRequest_FSCI_ID = 0xA309,
 	FSCIAllowDeviceToSleepRequest_FSCI_ID = 0xA370,
@@ -16124,6 +16199,7 @@ typedef enum bleFsciIds_tag
 	L2CAPCBLePsmEnhancedConnectionCompleteIndication_FSCI_ID = 0x428A,
 	L2CAPCBEnhancedReconfigureRequestIndication_FSCI_ID = 0x428B,
 	L2CAPCBEnhancedReconfigureResponseIndication_FSCI_ID = 0x428C,
+	L2CAPCBLeCbDataBatchCompleteIndication_FSCI_ID = 0x428E,
 	GATTConfirm_FSCI_ID = 0x4580,
 	GATTGetMtuIndication_FSCI_ID = 0x4581,
 	GATTClientProcedureExchangeMtuIndication_FSCI_ID = 0x4582,
@@ -16188,6 +16264,7 @@ typedef enum bleFsciIds_tag
 	GATTDBDynamicAddCccdIndication_FSCI_ID = 0x468B,
 	GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueIndication_FSCI_ID = 0x468C,
 	GATTDBDynamicAddCharDescriptorWithUniqueValueIndication_FSCI_ID = 0x468D,
+	GATTDBDynamicAddServiceIndication_FSCI_ID = 0x468F,
 	GATTDBAttConfirm_FSCI_ID = 0x4780,
 	GATTDBAttFindInformationIndication_FSCI_ID = 0x4781,
 	GATTDBAttFindByTypeValueIndication_FSCI_ID = 0x4782,
@@ -16318,8 +16395,21 @@ typedef enum bleFsciIds_tag
 	GAPConnectionEventEattBearerStatusNotificationIndication_FSCI_ID = 0x48F3,
 	GAPGenericEventLeGenerateDhKeyCompleteIndication_FSCI_ID = 0x48F4,
 	GAPGetHostVersionIndication_FSCI_ID = 0x48F5,
+	GAPScanningEventDeviceScannedBatchIndication_FSCI_ID = 0x48FA,
 } bleFsciIds_t;
 
+#if FSCI_EVT_ARENA
+/* Memory the nested arrays of an event are carved from, reset as a whole */
+typedef struct bleEvtArena_tag
+{
+	uint8_t *pBuffer;  // Block the nested arrays are carved from
+	uint32_t size;  // Size of pBuffer
+	uint32_t used;  // Bytes of pBuffer taken by the loaded event
+	uint32_t spilled;  // Bytes the loaded event needed past pBuffer
+	void *pSpill;  // Blocks allocated once pBuffer was full, chained through their first word
+} bleEvtArena_t;
+#endif  /* FSCI_EVT_ARENA */
+
 typedef struct bleEvtContainer_tag
 {
 	uint16_t id;
@@ -16348,6 +16438,7 @@ typedef struct bleEvtContainer_tag
 		L2CAPCBLePsmEnhancedConnectionCompleteIndication_t L2CAPCBLePsmEnhancedConnectionCompleteIndication;
 		L2CAPCBEnhancedReconfigureRequestIndication_t L2CAPCBEnhancedReconfigureRequestIndication;
 		L2CAPCBEnhancedReconfigureResponseIndication_t L2CAPCBEnhancedReconfigureResponseIndication;
+		L2CAPCBLeCbDataBatchCompleteIndication_t L2CAPCBLeCbDataBatchCompleteIndication;
 #endif  /* L2CAPCB_ENABLE */
 
 #if GATT_ENABLE
@@ -16418,6 +16509,7 @@ typedef struct bleEvtContainer_tag
 		GATTDBDynamicAddCccdIndication_t GATTDBDynamicAddCccdIndication;
 		GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueIndication_t GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueIndication;
 		GATTDBDynamicAddCharDescriptorWithUniqueValueIndication_t GATTDBDynamicAddCharDescriptorWithUniqueValueIndication;
+		GATTDBDynamicAddServiceIndication_t GATTDBDynamicAddServiceIndication;
 #endif  /* GATTDB_APP_ENABLE */
 
 #if GATTDB_ATT_ENABLE
@@ -16554,8 +16646,12 @@ typedef struct bleEvtContainer_tag
 		GAPConnectionEventEattBearerStatusNotificationIndication_t GAPConnectionEventEattBearerStatusNotificationIndication;
 		GAPGenericEventLeGenerateDhKeyCompleteIndication_t GAPGenericEventLeGenerateDhKeyCompleteIndication;
 		GAPGetHostVersionIndication_t GAPGetHostVersionIndication;
+		GAPScanningEventDeviceScannedBatchIndication_t GAPScanningEventDeviceScannedBatchIndication;
 #endif  /* GAP_ENABLE */
 	} Data;
+#if FSCI_EVT_ARENA
+	bleEvtArena_t arena;
+#endif  /* FSCI_EVT_ARENA */
 } bleEvtContainer_t;
 
 typedef memStatus_t (*pfnBleEvtHandler)(bleEvtContainer_t *container, uint8_t *pPayload);
@@ -16569,6 +16665,8 @@ typedef struct bleEvtHandler_tag
 
 typedef memStatus_t (*pfnBleUnEvtHandler)(bleEvtContainer_t *container);
 
+typedef void (*pfnBleAppEvtHandler)(fsciPacket_t *frame, uint8_t fsciInterface);
+
 typedef struct bleUnEvtHandler_tag
 {
 	uint16_t id;
@@ -16599,6 +16697,10 @@ memStatus_t L2CAPCBSendLeCreditRequest(L2CAPCBSendLeCreditRequest_t *req, void *
 memStatus_t L2CAPCBEnhancedConnectLePsmRequest(L2CAPCBEnhancedConnectLePsmRequest_t *req, void *arg, uint8_t fsciInterface);
 memStatus_t L2CAPCBEnhancedChannelReconfigureRequest(L2CAPCBEnhancedChannelReconfigureRequest_t *req, void *arg, uint8_t fsciInterface);
 memStatus_t L2CAPCBEnhancedCancelConnectionRequest(L2CAPCBEnhancedCancelConnectionRequest_t *req, void *arg, uint8_t fsciInterface);
+memStatus_t L2CAPCBSendLeCbDataBatchRequest(L2CAPCBSendLeCbDataBatchRequest_t *req, void *arg, uint8_t fsciInterface);
+memStatus_t L2CAPCBLeCbDataStreamPump(L2CAPCBLeCbDataStream_t *stream, void *arg, uint8_t fsciInterface);
+bool_t L2CAPCBLeCbDataStreamHandleEvent(L2CAPCBLeCbDataStream_t *stream, bleEvtContainer_t *container, void *arg, uint8_t fsciInterface);
+bool_t L2CAPCBLeCbDataStreamDone(L2CAPCBLeCbDataStream_t *stream);
 #endif  /* L2CAPCB_ENABLE */
 
 #if GATT_ENABLE
@@ -16686,6 +16788,11 @@ memStatus_t GATTDBDynamicRemoveServiceRequest(GATTDBDynamicRemoveServiceRequest_
 memStatus_t GATTDBDynamicRemoveCharacteristicRequest(GATTDBDynamicRemoveCharacteristicRequest_t *req, void *arg, uint8_t fsciInterface);
 memStatus_t GATTDBDynamicAddCharDescriptorWithUniqueValueRequest(GATTDBDynamicAddCharDescriptorWithUniqueValueRequest_t *req, void *arg, uint8_t fsciInterface);
 memStatus_t GATTDBDynamicEndDatabaseUpdateRequest(void *arg, uint8_t fsciInterface);
+memStatus_t GATTDBDynamicAddServiceRequest(GATTDBDynamicAddServiceRequest_t *req, void *arg, uint8_t fsciInterface);
+uint16_t GATTDBDynamicServiceTlvService(uint8_t *pTlv, uint16_t idx, uint16_t Uuid16);
+uint16_t GATTDBDynamicServiceTlvCharacteristic(uint8_t *pTlv, uint16_t idx, uint16_t Uuid16, uint8_t Properties, uint8_t ValueAccessPermissions, uint16_t MaxValueLength, uint16_t InitialValueLength, const uint8_t *InitialValue);
+uint16_t GATTDBDynamicServiceTlvDescriptor(uint8_t *pTlv, uint16_t idx, uint16_t Uuid16, uint8_t DescriptorAccessPermissions, uint16_t ValueLength, const uint8_t *Value);
+uint16_t GATTDBDynamicServiceTlvCccd(uint8_t *pTlv, uint16_t idx);
 #endif  /* GATTDB_APP_ENABLE */
 
 #if GATTDB_ATT_ENABLE
@@ -16819,6 +16926,7 @@ memStatus_t GAPEattConnectionRequest(GAPEattConnectionRequest_t *req, void *arg,
 memStatus_t GAPEattConnectionAccept(GAPEattConnectionAccept_t *req, void *arg, uint8_t fsciInterface);
 memStatus_t GAPEattReconfigureRequest(GAPEattReconfigureRequest_t *req, void *arg, uint8_t fsciInterface);
 memStatus_t GAPEattSendCreditsRequest(GAPEattSendCreditsRequest_t *req, void *arg, uint8_t fsciInterface);
+memStatus_t GAPSetScanReportBatchingRequest(GAPSetScanReportBatchingRequest_t *req, void *arg, uint8_t fsciInterface);
 #endif  /* GAP_ENABLE */
 
 #if FSCI_ENABLE
@@ -16835,6 +16943,16 @@ memStatus_t FSCINVGetNvVPSizeRequest(void *arg, uint8_t fsciInterface);
 
 void KHC_BLE_RX_MsgHandler(void *pData, void *param, uint8_t fsciInterface);
 
+memStatus_t KHC_BLE_RegisterEvtHandler(uint16_t id, pfnBleAppEvtHandler handler);
+
+void KHC_BLE_UnregisterEvtHandlers(void);
+
 void KHC_BLE_RX_UnMsgHandler(void *pData, void *param, uint8_t fsciInterface);
 
+#if FSCI_EVT_ARENA
+void KHC_BLE_ResetEvtArena(bleEvtContainer_t *container, uint32_t cbHint);
+
+void KHC_BLE_FreeEvtArena(bleEvtContainer_t *container);
+#endif  /* FSCI_EVT_ARENA */
+
 #endif  /* _BLE_CMD_H */
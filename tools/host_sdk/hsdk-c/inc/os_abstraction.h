@@ -28,6 +28,33 @@ Public macros
 
 #define FSCI_LENGTH_FIELD_SIZE      2
 
+/* 1: commands are serialized straight into the frame to be sent, reserved with
+   FSCI_reservePayload and sent with FSCI_transmitReserved.
+   0: commands are serialized into a temporary buffer passed to FSCI_transmitPayload. */
+#ifndef FSCI_TX_IN_PLACE
+#define FSCI_TX_IN_PLACE            0
+#endif
+
+#if FSCI_TX_IN_PLACE
+#define FSCI_TxBufferAlloc(arg, msgLen, fsciInterface) \
+    FSCI_reservePayload(arg, msgLen, fsciInterface)
+#define FSCI_TxBufferSend(arg, og, oc, msg, msgLen, fsciInterface) \
+    FSCI_transmitReserved(arg, og, oc, msg, msgLen, fsciInterface)
+#else
+#define FSCI_TxBufferAlloc(arg, msgLen, fsciInterface) \
+    MEM_BufferAlloc(msgLen)
+#define FSCI_TxBufferSend(arg, og, oc, msg, msgLen, fsciInterface) \
+    do { FSCI_transmitPayload(arg, og, oc, msg, msgLen, fsciInterface); MEM_BufferFree(msg); } while (0)
+#endif
+
+/* 1: the nested arrays of a received event are carved from an arena held by its
+   bleEvtContainer_t, sized from the FSCI length field, and unloading the event
+   resets the arena instead of freeing every array.
+   0: every nested array is allocated with MEM_BufferAlloc and freed on unload. */
+#ifndef FSCI_EVT_ARENA
+#define FSCI_EVT_ARENA              0
+#endif
+
 #define SHELL_NEWLINE()             printf("\n")
 #define shell_refresh()             SHELL_NEWLINE()
 #define shell_write(str)            printf("%s", str)
@@ -102,3 +129,18 @@ void FSCI_transmitPayload(void *arg,            /* Optional argument passed to t
                           uint16_t msgLen,      /* Payload length */
                           uint8_t fsciInterface /* FSCI interface ID */
                          );
+
+#if FSCI_TX_IN_PLACE
+void *FSCI_reservePayload(void *arg,            /* Optional argument passed to the function */
+                          uint16_t msgLen,      /* Payload length */
+                          uint8_t fsciInterface /* FSCI interface ID */
+                         );
+
+void FSCI_transmitReserved(void *arg,            /* Optional argument passed to the function */
+                           uint8_t og,           /* FSCI operation group */
+                           uint8_t oc,           /* FSCI operation code */
+                           void *msg,            /* Payload returned by FSCI_reservePayload */
+                           uint16_t msgLen,      /* Payload length, as reserved */
+                           uint8_t fsciInterface /* FSCI interface ID, as reserved */
+                          );
+#endif
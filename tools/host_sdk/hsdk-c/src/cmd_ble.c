@@ -50,7 +50,7 @@ memStatus_t L2CAPSendAttDataRequest(L2CAPSendAttDataRequest_t *req, void *arg, u
 	msgLen += req->PacketLength;  // Packet
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -62,8 +62,7 @@ memStatus_t L2CAPSendAttDataRequest(L2CAPSendAttDataRequest_t *req, void *arg, u
 	FLib_MemCpy(pMsg + idx, req->Packet, req->PacketLength); idx += req->PacketLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x41, 0x03, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x41, 0x03, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -91,7 +90,7 @@ memStatus_t L2CAPSendSmpDataRequest(L2CAPSendSmpDataRequest_t *req, void *arg, u
 	msgLen += req->PacketLength;  // Packet
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -103,8 +102,7 @@ memStatus_t L2CAPSendSmpDataRequest(L2CAPSendSmpDataRequest_t *req, void *arg, u
 	FLib_MemCpy(pMsg + idx, req->Packet, req->PacketLength); idx += req->PacketLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x41, 0x04, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x41, 0x04, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -267,7 +265,7 @@ memStatus_t L2CAPCBSendLeCbDataRequest(L2CAPCBSendLeCbDataRequest_t *req, void *
 	msgLen += req->PacketLength;  // Packet
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -280,8 +278,7 @@ memStatus_t L2CAPCBSendLeCbDataRequest(L2CAPCBSendLeCbDataRequest_t *req, void *
 	FLib_MemCpy(pMsg + idx, req->Packet, req->PacketLength); idx += req->PacketLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x42, 0x07, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x42, 0x07, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -331,7 +328,7 @@ memStatus_t L2CAPCBEnhancedConnectLePsmRequest(L2CAPCBEnhancedConnectLePsmReques
 	msgLen += req->NoOfChannels;  // Cids
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -346,8 +343,7 @@ memStatus_t L2CAPCBEnhancedConnectLePsmRequest(L2CAPCBEnhancedConnectLePsmReques
 	FLib_MemCpy(pMsg + idx, req->Cids, req->NoOfChannels); idx += req->NoOfChannels;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x42, 0x09, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x42, 0x09, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -377,7 +373,7 @@ memStatus_t L2CAPCBEnhancedChannelReconfigureRequest(L2CAPCBEnhancedChannelRecon
 	msgLen += req->NoOfChannels;  // Cids
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -391,8 +387,7 @@ memStatus_t L2CAPCBEnhancedChannelReconfigureRequest(L2CAPCBEnhancedChannelRecon
 	FLib_MemCpy(pMsg + idx, req->Cids, req->NoOfChannels); idx += req->NoOfChannels;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x42, 0x0A, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x42, 0x0A, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -422,7 +417,7 @@ memStatus_t L2CAPCBEnhancedCancelConnectionRequest(L2CAPCBEnhancedCancelConnecti
 	msgLen += req->NoOfChannels;  // Cids
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -436,11 +431,203 @@ memStatus_t L2CAPCBEnhancedCancelConnectionRequest(L2CAPCBEnhancedCancelConnecti
 	FLib_MemCpy(pMsg + idx, req->Cids, req->NoOfChannels); idx += req->NoOfChannels;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x42, 0x0B, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x42, 0x0B, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
+/*!*************************************************************************************************
+\fn		memStatus_t L2CAPCBSendLeCbDataBatchRequest(L2CAPCBSendLeCbDataBatchRequest_t *req, void *arg, uint8_t fsciInterface)
+\brief	Sends a batch of data packets through a Credit Based Channel. The board answers with
+		L2CAPCBConfirm, then with L2CAPCBLeCbDataBatchCompleteIndication once the SDUs are given
+		to L2CAP or dropped.
+
+\return	memStatus_t			MEM_SUCCESS_c, MEM_ALLOC_ERROR_c, MEM_FREE_ERROR_c
+							MEM_UNKNOWN_ERROR_c if req is NULL or the batch exceeds an FSCI frame
+***************************************************************************************************/
+memStatus_t L2CAPCBSendLeCbDataBatchRequest(L2CAPCBSendLeCbDataBatchRequest_t *req, void *arg, uint8_t fsciInterface)
+{
+	uint8_t *pMsg = NULL;
+	uint32_t msgLen = 0, idx = 0;
+	uint8_t i;
+
+	/* Sanity check */
+	if (!req || (req->NoOfSdus && !req->Sdus))
+	{
+		return MEM_UNKNOWN_ERROR_c;
+	}
+
+	/* Compute the size of the request */
+	msgLen += sizeof(uint8_t);  // DeviceId
+	msgLen += sizeof(uint16_t);  // ChannelId
+	msgLen += sizeof(uint8_t);  // NoOfSdus
+	for (i = 0; i < req->NoOfSdus; i++)
+	{
+		msgLen += sizeof(uint16_t);  // Length
+		msgLen += req->Sdus[i].Length;  // Data
+	}
+
+	if (msgLen > 0xFFFF)
+	{
+		return MEM_UNKNOWN_ERROR_c;
+	}
+
+	/* Allocate memory for the marshalled payload */
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
+	if (!pMsg)
+	{
+		return MEM_ALLOC_ERROR_c;
+	}
+
+	/* Serialize */
+	pMsg[idx] = req->DeviceId; idx++;
+	FLib_MemCpy(pMsg + idx, &(req->ChannelId), sizeof(req->ChannelId)); idx += sizeof(req->ChannelId);
+	pMsg[idx] = req->NoOfSdus; idx++;
+	for (i = 0; i < req->NoOfSdus; i++)
+	{
+		FLib_MemCpy(pMsg + idx, &(req->Sdus[i].Length), sizeof(req->Sdus[i].Length)); idx += sizeof(req->Sdus[i].Length);
+		FLib_MemCpy(pMsg + idx, req->Sdus[i].Data, req->Sdus[i].Length); idx += req->Sdus[i].Length;
+	}
+
+	/* Send the request */
+	FSCI_TxBufferSend(arg, 0x42, 0x0C, pMsg, msgLen, fsciInterface);
+	return MEM_SUCCESS_c;
+}
+
+/*!*************************************************************************************************
+\fn		memStatus_t L2CAPCBLeCbDataStreamPump(L2CAPCBLeCbDataStream_t *stream, void *arg, uint8_t fsciInterface)
+\brief	Cuts the next SDUs of a stream into batch requests, until MaxBatchesInFlight batches are
+		queued on the board. Call it once to start the stream, L2CAPCBLeCbDataStreamHandleEvent
+		calls it again as the batches complete.
+
+\return	memStatus_t			MEM_SUCCESS_c, MEM_ALLOC_ERROR_c
+							MEM_UNKNOWN_ERROR_c if stream is NULL, not configured or a batch exceeds an FSCI frame
+***************************************************************************************************/
+memStatus_t L2CAPCBLeCbDataStreamPump(L2CAPCBLeCbDataStream_t *stream, void *arg, uint8_t fsciInterface)
+{
+	/* Sanity check */
+	if (!stream || (stream->Length && !stream->Data) || !stream->SduSize || !stream->SdusPerBatch || !stream->MaxBatchesInFlight)
+	{
+		return MEM_UNKNOWN_ERROR_c;
+	}
+
+	while (stream->Status == L2CAPCBConfirm_Status_gBleSuccess_c &&
+		   stream->Offset < stream->Length &&
+		   stream->BatchesInFlight < stream->MaxBatchesInFlight)
+	{
+		uint8_t *pMsg = NULL;
+		uint32_t msgLen = 0, idx = 0;
+		uint32_t left = stream->Length - stream->Offset;
+		uint32_t noOfSdus = (left + stream->SduSize - 1) / stream->SduSize;
+		uint32_t i;
+
+		if (noOfSdus > stream->SdusPerBatch)
+		{
+			noOfSdus = stream->SdusPerBatch;
+		}
+
+		/* Compute the size of the request, all the SDUs but the last of the stream are full */
+		msgLen += sizeof(uint8_t);  // DeviceId
+		msgLen += sizeof(uint16_t);  // ChannelId
+		msgLen += sizeof(uint8_t);  // NoOfSdus
+		msgLen += noOfSdus * sizeof(uint16_t);  // Length
+		msgLen += (left < noOfSdus * stream->SduSize) ? left : noOfSdus * stream->SduSize;  // Data
+
+		if (msgLen > 0xFFFF)
+		{
+			return MEM_UNKNOWN_ERROR_c;
+		}
+
+		/* Allocate memory for the marshalled payload */
+		pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
+		if (!pMsg)
+		{
+			return MEM_ALLOC_ERROR_c;
+		}
+
+		/* Serialize, the SDUs are copied from the stream data */
+		pMsg[idx] = stream->DeviceId; idx++;
+		FLib_MemCpy(pMsg + idx, &(stream->ChannelId), sizeof(stream->ChannelId)); idx += sizeof(stream->ChannelId);
+		pMsg[idx] = (uint8_t)noOfSdus; idx++;
+		for (i = 0; i < noOfSdus; i++)
+		{
+			uint16_t length = (stream->Length - stream->Offset < stream->SduSize) ?
+							  (uint16_t)(stream->Length - stream->Offset) : stream->SduSize;
+
+			FLib_MemCpy(pMsg + idx, &length, sizeof(length)); idx += sizeof(length);
+			FLib_MemCpy(pMsg + idx, stream->Data + stream->Offset, length); idx += length;
+			stream->Offset += length;
+		}
+
+		/* Send the request */
+		FSCI_TxBufferSend(arg, 0x42, 0x0C, pMsg, msgLen, fsciInterface);
+		stream->BatchesInFlight++;
+	}
+
+	return MEM_SUCCESS_c;
+}
+
+/*!*************************************************************************************************
+\fn		bool_t L2CAPCBLeCbDataStreamHandleEvent(L2CAPCBLeCbDataStream_t *stream, bleEvtContainer_t *container, void *arg, uint8_t fsciInterface)
+\brief	Accounts a L2CAPCBLeCbDataBatchCompleteIndication of the stream channel and sends the
+		next batch. Once a batch reports an error, no batch is sent anymore and Acked stops
+		growing; the board drops the batches queued behind it, which complete with the
+		same error.
+
+\return	bool_t				TRUE if the event belongs to the stream
+***************************************************************************************************/
+bool_t L2CAPCBLeCbDataStreamHandleEvent(L2CAPCBLeCbDataStream_t *stream, bleEvtContainer_t *container, void *arg, uint8_t fsciInterface)
+{
+	L2CAPCBLeCbDataBatchCompleteIndication_t *evt;
+
+	if (!stream || !container || container->id != L2CAPCBLeCbDataBatchCompleteIndication_FSCI_ID)
+	{
+		return FALSE;
+	}
+
+	evt = &(container->Data.L2CAPCBLeCbDataBatchCompleteIndication);
+
+	if (evt->DeviceId != stream->DeviceId || evt->ChannelId != stream->ChannelId || !stream->BatchesInFlight)
+	{
+		return FALSE;
+	}
+
+	stream->BatchesInFlight--;
+
+	if (stream->Status == L2CAPCBConfirm_Status_gBleSuccess_c)
+	{
+		uint32_t acked = (uint32_t)evt->SdusSent * stream->SduSize;
+
+		/* Only the last SDU of the stream may be short */
+		if (acked > stream->Length - stream->Acked)
+		{
+			acked = stream->Length - stream->Acked;
+		}
+
+		stream->Acked += acked;
+		stream->Status = evt->Status;
+	}
+
+	L2CAPCBLeCbDataStreamPump(stream, arg, fsciInterface);
+	return TRUE;
+}
+
+/*!*************************************************************************************************
+\fn		bool_t L2CAPCBLeCbDataStreamDone(L2CAPCBLeCbDataStream_t *stream)
+\brief	Checks whether a stream has nothing left to send and no batch queued on the board.
+
+\return	bool_t				TRUE if done, Status tells whether all the data was given to L2CAP
+***************************************************************************************************/
+bool_t L2CAPCBLeCbDataStreamDone(L2CAPCBLeCbDataStream_t *stream)
+{
+	if (!stream)
+	{
+		return TRUE;
+	}
+
+	return (stream->BatchesInFlight == 0 &&
+			(stream->Status != L2CAPCBConfirm_Status_gBleSuccess_c || stream->Offset >= stream->Length));
+}
+
 #endif  /* L2CAPCB_ENABLE */
 
 #if GATT_ENABLE
@@ -624,7 +811,7 @@ memStatus_t GATTClientDiscoverPrimaryServicesByUuidRequest(GATTClientDiscoverPri
 	msgLen += sizeof(uint8_t);  // MaxNbOfServices
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -651,8 +838,7 @@ memStatus_t GATTClientDiscoverPrimaryServicesByUuidRequest(GATTClientDiscoverPri
 	pMsg[idx] = req->MaxNbOfServices; idx++;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x0A, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x0A, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -773,7 +959,7 @@ memStatus_t GATTClientFindIncludedServicesRequest(GATTClientFindIncludedServices
 	msgLen += sizeof(uint8_t);  // MaxNbOfIncludedServices
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -878,8 +1064,7 @@ memStatus_t GATTClientFindIncludedServicesRequest(GATTClientFindIncludedServices
 	pMsg[idx] = req->MaxNbOfIncludedServices; idx++;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x0B, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x0B, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -1000,7 +1185,7 @@ memStatus_t GATTClientDiscoverAllCharacteristicsOfServiceRequest(GATTClientDisco
 	msgLen += sizeof(uint8_t);  // MaxNbOfCharacteristics
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -1105,8 +1290,7 @@ memStatus_t GATTClientDiscoverAllCharacteristicsOfServiceRequest(GATTClientDisco
 	pMsg[idx] = req->MaxNbOfCharacteristics; idx++;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x0C, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x0C, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -1243,7 +1427,7 @@ memStatus_t GATTClientDiscoverCharacteristicOfServiceByUuidRequest(GATTClientDis
 	msgLen += sizeof(uint8_t);  // MaxNbOfCharacteristics
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -1364,8 +1548,7 @@ memStatus_t GATTClientDiscoverCharacteristicOfServiceByUuidRequest(GATTClientDis
 	pMsg[idx] = req->MaxNbOfCharacteristics; idx++;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x0D, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x0D, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -1439,7 +1622,7 @@ memStatus_t GATTClientDiscoverAllCharacteristicDescriptorsRequest(GATTClientDisc
 	msgLen += sizeof(uint8_t);  // MaxNbOfDescriptors
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -1497,8 +1680,7 @@ memStatus_t GATTClientDiscoverAllCharacteristicDescriptorsRequest(GATTClientDisc
 	pMsg[idx] = req->MaxNbOfDescriptors; idx++;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x0E, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x0E, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -1571,7 +1753,7 @@ memStatus_t GATTClientReadCharacteristicValueRequest(GATTClientReadCharacteristi
 	msgLen += sizeof(uint16_t);  // MaxReadBytes
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -1628,8 +1810,7 @@ memStatus_t GATTClientReadCharacteristicValueRequest(GATTClientReadCharacteristi
 	FLib_MemCpy(pMsg + idx, &(req->MaxReadBytes), sizeof(req->MaxReadBytes)); idx += sizeof(req->MaxReadBytes);
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x0F, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x0F, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -1680,7 +1861,7 @@ memStatus_t GATTClientReadUsingCharacteristicUuidRequest(GATTClientReadUsingChar
 	msgLen += sizeof(uint16_t);  // MaxReadBytes
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -1714,8 +1895,7 @@ memStatus_t GATTClientReadUsingCharacteristicUuidRequest(GATTClientReadUsingChar
 	FLib_MemCpy(pMsg + idx, &(req->MaxReadBytes), sizeof(req->MaxReadBytes)); idx += sizeof(req->MaxReadBytes);
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x10, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x10, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -1792,7 +1972,7 @@ memStatus_t GATTClientReadMultipleCharacteristicValuesRequest(GATTClientReadMult
 	}	// Characteristics
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -1853,8 +2033,7 @@ memStatus_t GATTClientReadMultipleCharacteristicValuesRequest(GATTClientReadMult
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x11, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x11, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -1932,7 +2111,7 @@ memStatus_t GATTClientWriteCharacteristicValueRequest(GATTClientWriteCharacteris
 	msgLen += 16;  // Csrk
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -1994,8 +2173,7 @@ memStatus_t GATTClientWriteCharacteristicValueRequest(GATTClientWriteCharacteris
 	FLib_MemCpy(pMsg + idx, req->Csrk, 16); idx += 16;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x12, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x12, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -2042,7 +2220,7 @@ memStatus_t GATTClientReadCharacteristicDescriptorRequest(GATTClientReadCharacte
 	msgLen += sizeof(uint16_t);  // MaxReadBytes
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -2073,8 +2251,7 @@ memStatus_t GATTClientReadCharacteristicDescriptorRequest(GATTClientReadCharacte
 	FLib_MemCpy(pMsg + idx, &(req->MaxReadBytes), sizeof(req->MaxReadBytes)); idx += sizeof(req->MaxReadBytes);
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x13, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x13, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -2122,7 +2299,7 @@ memStatus_t GATTClientWriteCharacteristicDescriptorRequest(GATTClientWriteCharac
 	msgLen += req->ValueLength;  // Value
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -2154,8 +2331,7 @@ memStatus_t GATTClientWriteCharacteristicDescriptorRequest(GATTClientWriteCharac
 	FLib_MemCpy(pMsg + idx, req->Value, req->ValueLength); idx += req->ValueLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x14, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x14, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -2206,7 +2382,7 @@ memStatus_t GATTServerRegisterHandlesForWriteNotificationsRequest(GATTServerRegi
 	msgLen += req->HandleCount * sizeof(uint16_t);  // AttributeHandles
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -2217,8 +2393,7 @@ memStatus_t GATTServerRegisterHandlesForWriteNotificationsRequest(GATTServerRegi
 	FLib_MemCpy(pMsg + idx, req->AttributeHandles, req->HandleCount * sizeof(uint16_t)); idx += req->HandleCount * sizeof(uint16_t);
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x17, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x17, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -2304,7 +2479,7 @@ memStatus_t GATTServerSendInstantValueNotificationRequest(GATTServerSendInstantV
 	msgLen += req->ValueLength;  // Value
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -2317,8 +2492,7 @@ memStatus_t GATTServerSendInstantValueNotificationRequest(GATTServerSendInstantV
 	FLib_MemCpy(pMsg + idx, req->Value, req->ValueLength); idx += req->ValueLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x1B, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x1B, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -2347,7 +2521,7 @@ memStatus_t GATTServerSendInstantValueIndicationRequest(GATTServerSendInstantVal
 	msgLen += req->ValueLength;  // Value
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -2360,8 +2534,7 @@ memStatus_t GATTServerSendInstantValueIndicationRequest(GATTServerSendInstantVal
 	FLib_MemCpy(pMsg + idx, req->Value, req->ValueLength); idx += req->ValueLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x1C, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x1C, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -2395,7 +2568,7 @@ memStatus_t GATTServerSendMultipleHandleValueNotificationRequest(GATTServerSendM
 	}	// HandleLengthValueList
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -2413,8 +2586,7 @@ memStatus_t GATTServerSendMultipleHandleValueNotificationRequest(GATTServerSendM
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x22, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x22, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -2441,7 +2613,7 @@ memStatus_t GATTServerRegisterHandlesForReadNotificationsRequest(GATTServerRegis
 	msgLen += req->HandleCount * sizeof(uint16_t);  // AttributeHandles
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -2452,8 +2624,7 @@ memStatus_t GATTServerRegisterHandlesForReadNotificationsRequest(GATTServerRegis
 	FLib_MemCpy(pMsg + idx, req->AttributeHandles, req->HandleCount * sizeof(uint16_t)); idx += req->HandleCount * sizeof(uint16_t);
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x1D, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x1D, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -2518,7 +2689,7 @@ memStatus_t GATTServerUnregisterHandlesForWriteNotificationsRequest(GATTServerUn
 	msgLen += req->HandleCount * sizeof(uint16_t);  // AttributeHandles
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -2529,8 +2700,7 @@ memStatus_t GATTServerUnregisterHandlesForWriteNotificationsRequest(GATTServerUn
 	FLib_MemCpy(pMsg + idx, req->AttributeHandles, req->HandleCount * sizeof(uint16_t)); idx += req->HandleCount * sizeof(uint16_t);
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x20, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x20, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -2557,7 +2727,7 @@ memStatus_t GATTServerUnregisterHandlesForReadNotificationsRequest(GATTServerUnr
 	msgLen += req->HandleCount * sizeof(uint16_t);  // AttributeHandles
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -2568,8 +2738,7 @@ memStatus_t GATTServerUnregisterHandlesForReadNotificationsRequest(GATTServerUnr
 	FLib_MemCpy(pMsg + idx, req->AttributeHandles, req->HandleCount * sizeof(uint16_t)); idx += req->HandleCount * sizeof(uint16_t);
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x21, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x21, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -2646,7 +2815,7 @@ memStatus_t GATTClientReadMultipleVariableCharacteristicValuesRequest(GATTClient
 	}	// Characteristics
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -2707,8 +2876,7 @@ memStatus_t GATTClientReadMultipleVariableCharacteristicValuesRequest(GATTClient
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x24, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x24, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -2819,7 +2987,7 @@ memStatus_t GATTClientEnhancedDiscoverPrimaryServicesByUuidRequest(GATTClientEnh
 	msgLen += sizeof(uint8_t);  // MaxNbOfServices
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -2847,8 +3015,7 @@ memStatus_t GATTClientEnhancedDiscoverPrimaryServicesByUuidRequest(GATTClientEnh
 	pMsg[idx] = req->MaxNbOfServices; idx++;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x2A, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x2A, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -2970,7 +3137,7 @@ memStatus_t GATTClientEnhancedFindIncludedServicesRequest(GATTClientEnhancedFind
 	msgLen += sizeof(uint8_t);  // MaxNbOfIncludedServices
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -3076,8 +3243,7 @@ memStatus_t GATTClientEnhancedFindIncludedServicesRequest(GATTClientEnhancedFind
 	pMsg[idx] = req->MaxNbOfIncludedServices; idx++;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x2B, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x2B, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -3199,7 +3365,7 @@ memStatus_t GATTClientEnhancedDiscoverAllCharacteristicsOfServiceRequest(GATTCli
 	msgLen += sizeof(uint8_t);  // MaxNbOfCharacteristics
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -3305,8 +3471,7 @@ memStatus_t GATTClientEnhancedDiscoverAllCharacteristicsOfServiceRequest(GATTCli
 	pMsg[idx] = req->MaxNbOfCharacteristics; idx++;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x2C, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x2C, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -3444,7 +3609,7 @@ memStatus_t GATTClientEnhancedDiscoverCharacteristicOfServiceByUuidRequest(GATTC
 	msgLen += sizeof(uint8_t);  // MaxNbOfCharacteristics
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -3566,8 +3731,7 @@ memStatus_t GATTClientEnhancedDiscoverCharacteristicOfServiceByUuidRequest(GATTC
 	pMsg[idx] = req->MaxNbOfCharacteristics; idx++;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x2D, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x2D, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -3642,7 +3806,7 @@ memStatus_t GATTClientEnhancedDiscoverAllCharacteristicDescriptorsRequest(GATTCl
 	msgLen += sizeof(uint8_t);  // MaxNbOfDescriptors
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -3701,8 +3865,7 @@ memStatus_t GATTClientEnhancedDiscoverAllCharacteristicDescriptorsRequest(GATTCl
 	pMsg[idx] = req->MaxNbOfDescriptors; idx++;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x2E, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x2E, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -3776,7 +3939,7 @@ memStatus_t GATTClientEnhancedReadCharacteristicValueRequest(GATTClientEnhancedR
 	msgLen += sizeof(uint16_t);  // MaxReadBytes
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -3834,8 +3997,7 @@ memStatus_t GATTClientEnhancedReadCharacteristicValueRequest(GATTClientEnhancedR
 	FLib_MemCpy(pMsg + idx, &(req->MaxReadBytes), sizeof(req->MaxReadBytes)); idx += sizeof(req->MaxReadBytes);
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x2F, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x2F, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -3887,7 +4049,7 @@ memStatus_t GATTClientEnhancedReadUsingCharacteristicUuidRequest(GATTClientEnhan
 	msgLen += sizeof(uint16_t);  // MaxReadBytes
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -3922,8 +4084,7 @@ memStatus_t GATTClientEnhancedReadUsingCharacteristicUuidRequest(GATTClientEnhan
 	FLib_MemCpy(pMsg + idx, &(req->MaxReadBytes), sizeof(req->MaxReadBytes)); idx += sizeof(req->MaxReadBytes);
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x30, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x30, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -4001,7 +4162,7 @@ memStatus_t GATTClientEnhancedReadMultipleCharacteristicValuesRequest(GATTClient
 	}	// Characteristics
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -4063,8 +4224,7 @@ memStatus_t GATTClientEnhancedReadMultipleCharacteristicValuesRequest(GATTClient
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x31, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x31, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -4143,7 +4303,7 @@ memStatus_t GATTClientEnhancedWriteCharacteristicValueRequest(GATTClientEnhanced
 	msgLen += 16;  // Csrk
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -4206,8 +4366,7 @@ memStatus_t GATTClientEnhancedWriteCharacteristicValueRequest(GATTClientEnhanced
 	FLib_MemCpy(pMsg + idx, req->Csrk, 16); idx += 16;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x32, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x32, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -4255,7 +4414,7 @@ memStatus_t GATTClientEnhancedReadCharacteristicDescriptorRequest(GATTClientEnha
 	msgLen += sizeof(uint16_t);  // MaxReadBytes
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -4287,8 +4446,7 @@ memStatus_t GATTClientEnhancedReadCharacteristicDescriptorRequest(GATTClientEnha
 	FLib_MemCpy(pMsg + idx, &(req->MaxReadBytes), sizeof(req->MaxReadBytes)); idx += sizeof(req->MaxReadBytes);
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x33, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x33, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -4337,7 +4495,7 @@ memStatus_t GATTClientEnhancedWriteCharacteristicDescriptorRequest(GATTClientEnh
 	msgLen += req->ValueLength;  // Value
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -4370,8 +4528,7 @@ memStatus_t GATTClientEnhancedWriteCharacteristicDescriptorRequest(GATTClientEnh
 	FLib_MemCpy(pMsg + idx, req->Value, req->ValueLength); idx += req->ValueLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x34, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x34, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -4449,7 +4606,7 @@ memStatus_t GATTClientEnhancedReadMultipleVariableCharacteristicValuesRequest(GA
 	}	// Characteristics
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -4511,8 +4668,7 @@ memStatus_t GATTClientEnhancedReadMultipleVariableCharacteristicValuesRequest(GA
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x35, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x35, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -4611,7 +4767,7 @@ memStatus_t GATTServerEnhancedSendInstantValueNotificationRequest(GATTServerEnha
 	msgLen += req->ValueLength;  // Value
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -4625,8 +4781,7 @@ memStatus_t GATTServerEnhancedSendInstantValueNotificationRequest(GATTServerEnha
 	FLib_MemCpy(pMsg + idx, req->Value, req->ValueLength); idx += req->ValueLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x3A, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x3A, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -4656,7 +4811,7 @@ memStatus_t GATTServerEnhancedSendInstantValueIndicationRequest(GATTServerEnhanc
 	msgLen += req->ValueLength;  // Value
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -4670,8 +4825,7 @@ memStatus_t GATTServerEnhancedSendInstantValueIndicationRequest(GATTServerEnhanc
 	FLib_MemCpy(pMsg + idx, req->Value, req->ValueLength); idx += req->ValueLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x3B, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x3B, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -4720,7 +4874,7 @@ memStatus_t GATTServerEnhancedSendMultipleHandleValueNotificationRequest(GATTSer
 	msgLen += req->TotalLength;  // HandleLengthValueList
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -4733,8 +4887,7 @@ memStatus_t GATTServerEnhancedSendMultipleHandleValueNotificationRequest(GATTSer
 	FLib_MemCpy(pMsg + idx, req->HandleLengthValueList, req->TotalLength); idx += req->TotalLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x45, 0x3D, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x45, 0x3D, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -4784,7 +4937,7 @@ memStatus_t GATTDBWriteAttributeRequest(GATTDBWriteAttributeRequest_t *req, void
 	msgLen += req->ValueLength;  // Value
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -4796,8 +4949,7 @@ memStatus_t GATTDBWriteAttributeRequest(GATTDBWriteAttributeRequest_t *req, void
 	FLib_MemCpy(pMsg + idx, req->Value, req->ValueLength); idx += req->ValueLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x46, 0x02, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x46, 0x02, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -4858,7 +5010,7 @@ memStatus_t GATTDBFindServiceHandleRequest(GATTDBFindServiceHandleRequest_t *req
 	}	// Uuid
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -4884,8 +5036,7 @@ memStatus_t GATTDBFindServiceHandleRequest(GATTDBFindServiceHandleRequest_t *req
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x46, 0x04, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x46, 0x04, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -4927,7 +5078,7 @@ memStatus_t GATTDBFindCharValueHandleInServiceRequest(GATTDBFindCharValueHandleI
 	}	// Uuid
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -4953,8 +5104,7 @@ memStatus_t GATTDBFindCharValueHandleInServiceRequest(GATTDBFindCharValueHandleI
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x46, 0x05, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x46, 0x05, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -5015,7 +5165,7 @@ memStatus_t GATTDBFindDescriptorHandleForCharValueHandleRequest(GATTDBFindDescri
 	}	// Uuid
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -5041,8 +5191,7 @@ memStatus_t GATTDBFindDescriptorHandleForCharValueHandleRequest(GATTDBFindDescri
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x46, 0x07, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x46, 0x07, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -5108,7 +5257,7 @@ memStatus_t GATTDBDynamicAddPrimaryServiceDeclarationRequest(GATTDBDynamicAddPri
 	}	// Uuid
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -5134,8 +5283,7 @@ memStatus_t GATTDBDynamicAddPrimaryServiceDeclarationRequest(GATTDBDynamicAddPri
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x46, 0x0A, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x46, 0x0A, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -5177,7 +5325,7 @@ memStatus_t GATTDBDynamicAddSecondaryServiceDeclarationRequest(GATTDBDynamicAddS
 	}	// Uuid
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -5203,8 +5351,7 @@ memStatus_t GATTDBDynamicAddSecondaryServiceDeclarationRequest(GATTDBDynamicAddS
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x46, 0x0B, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x46, 0x0B, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -5247,7 +5394,7 @@ memStatus_t GATTDBDynamicAddIncludeDeclarationRequest(GATTDBDynamicAddIncludeDec
 	}	// Uuid
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -5274,8 +5421,7 @@ memStatus_t GATTDBDynamicAddIncludeDeclarationRequest(GATTDBDynamicAddIncludeDec
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x46, 0x0C, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x46, 0x0C, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -5321,7 +5467,7 @@ memStatus_t GATTDBDynamicAddCharacteristicDeclarationAndValueRequest(GATTDBDynam
 	msgLen += sizeof(uint8_t);  // ValueAccessPermissions
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -5351,8 +5497,7 @@ memStatus_t GATTDBDynamicAddCharacteristicDeclarationAndValueRequest(GATTDBDynam
 	pMsg[idx] = req->ValueAccessPermissions; idx++;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x46, 0x0D, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x46, 0x0D, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -5396,7 +5541,7 @@ memStatus_t GATTDBDynamicAddCharacteristicDescriptorRequest(GATTDBDynamicAddChar
 	msgLen += sizeof(uint8_t);  // DescriptorAccessPermissions
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -5424,8 +5569,7 @@ memStatus_t GATTDBDynamicAddCharacteristicDescriptorRequest(GATTDBDynamicAddChar
 	pMsg[idx] = req->DescriptorAccessPermissions; idx++;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x46, 0x0E, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x46, 0x0E, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -5480,7 +5624,7 @@ memStatus_t GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueRequest(GATT
 	msgLen += sizeof(uint8_t);  // ValueAccessPermissions
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -5507,8 +5651,7 @@ memStatus_t GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueRequest(GATT
 	pMsg[idx] = req->ValueAccessPermissions; idx++;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x46, 0x10, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x46, 0x10, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -5588,7 +5731,7 @@ memStatus_t GATTDBDynamicAddCharDescriptorWithUniqueValueRequest(GATTDBDynamicAd
 	msgLen += sizeof(uint8_t);  // DescriptorAccessPermissions
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -5614,8 +5757,7 @@ memStatus_t GATTDBDynamicAddCharDescriptorWithUniqueValueRequest(GATTDBDynamicAd
 	pMsg[idx] = req->DescriptorAccessPermissions; idx++;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x46, 0x13, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x46, 0x13, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -5631,6 +5773,147 @@ memStatus_t GATTDBDynamicEndDatabaseUpdateRequest(void *arg, uint8_t fsciInterfa
 	return MEM_SUCCESS_c;
 }
 
+/*!*************************************************************************************************
+\fn		memStatus_t GATTDBDynamicAddServiceRequest(GATTDBDynamicAddServiceRequest_t *req, void *arg, uint8_t fsciInterface)
+\brief	Adds a whole service, with its characteristics and descriptors, in a single command. The
+		board adds all of it or nothing and answers with GATTDBConfirm, then with
+		GATTDBDynamicAddServiceIndication carrying the handles assigned.
+
+\return	memStatus_t			MEM_SUCCESS_c, MEM_ALLOC_ERROR_c, MEM_FREE_ERROR_c
+							MEM_UNKNOWN_ERROR_c if req is NULL or the service exceeds an FSCI frame
+***************************************************************************************************/
+memStatus_t GATTDBDynamicAddServiceRequest(GATTDBDynamicAddServiceRequest_t *req, void *arg, uint8_t fsciInterface)
+{
+	uint8_t *pMsg = NULL;
+	uint32_t msgLen = 0, idx = 0;
+
+	/* Sanity check */
+	if (!req || (req->TlvLength && !req->Tlv))
+	{
+		return MEM_UNKNOWN_ERROR_c;
+	}
+
+	/* Compute the size of the request */
+	msgLen += sizeof(uint16_t);  // TlvLength
+	msgLen += req->TlvLength;  // Tlv
+
+	if (msgLen > 0xFFFF)
+	{
+		return MEM_UNKNOWN_ERROR_c;
+	}
+
+	/* Allocate memory for the marshalled payload */
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
+	if (!pMsg)
+	{
+		return MEM_ALLOC_ERROR_c;
+	}
+
+	/* Serialize */
+	FLib_MemCpy(pMsg + idx, &(req->TlvLength), sizeof(req->TlvLength)); idx += sizeof(req->TlvLength);
+	FLib_MemCpy(pMsg + idx, req->Tlv, req->TlvLength); idx += req->TlvLength;
+
+	/* Send the request */
+	FSCI_TxBufferSend(arg, 0x46, 0x16, pMsg, msgLen, fsciInterface);
+	return MEM_SUCCESS_c;
+}
+
+/*!*************************************************************************************************
+\fn		static uint16_t GATTDBDynamicServiceTlvRecord(uint8_t *pTlv, uint16_t idx, uint8_t type, uint16_t length)
+\brief	Writes the header of a service description record at idx, unless pTlv is NULL.
+
+\return	uint16_t			Index of the record value
+***************************************************************************************************/
+static uint16_t GATTDBDynamicServiceTlvRecord(uint8_t *pTlv, uint16_t idx, uint8_t type, uint16_t length)
+{
+	if (pTlv)
+	{
+		pTlv[idx] = type;
+		FLib_MemCpy(pTlv + idx + 1, &length, sizeof(length));
+	}
+
+	return idx + sizeof(uint8_t) + sizeof(uint16_t);
+}
+
+/*!*************************************************************************************************
+\fn		uint16_t GATTDBDynamicServiceTlvService(uint8_t *pTlv, uint16_t idx, uint16_t Uuid16)
+\brief	Writes the service record of a service description at idx; it must be the first record.
+		With pTlv NULL nothing is written, so that a first pass sizes the description.
+
+\return	uint16_t			Index following the record
+***************************************************************************************************/
+uint16_t GATTDBDynamicServiceTlvService(uint8_t *pTlv, uint16_t idx, uint16_t Uuid16)
+{
+	idx = GATTDBDynamicServiceTlvRecord(pTlv, idx, GATTDBDynamicServiceTlvService_c, sizeof(Uuid16));
+
+	if (pTlv)
+	{
+		FLib_MemCpy(pTlv + idx, &Uuid16, sizeof(Uuid16));
+	}
+
+	return idx + sizeof(Uuid16);
+}
+
+/*!*************************************************************************************************
+\fn		uint16_t GATTDBDynamicServiceTlvCharacteristic(uint8_t *pTlv, uint16_t idx, uint16_t Uuid16, uint8_t Properties, uint8_t ValueAccessPermissions, uint16_t MaxValueLength, uint16_t InitialValueLength, const uint8_t *InitialValue)
+\brief	Writes a characteristic record at idx; the descriptor and CCCD records following it
+		belong to this characteristic. With pTlv NULL nothing is written.
+
+\return	uint16_t			Index following the record
+***************************************************************************************************/
+uint16_t GATTDBDynamicServiceTlvCharacteristic(uint8_t *pTlv, uint16_t idx, uint16_t Uuid16, uint8_t Properties, uint8_t ValueAccessPermissions, uint16_t MaxValueLength, uint16_t InitialValueLength, const uint8_t *InitialValue)
+{
+	uint16_t length = sizeof(Uuid16) + sizeof(Properties) + sizeof(ValueAccessPermissions) + sizeof(MaxValueLength) + InitialValueLength;
+
+	idx = GATTDBDynamicServiceTlvRecord(pTlv, idx, GATTDBDynamicServiceTlvCharacteristic_c, length);
+
+	if (pTlv)
+	{
+		FLib_MemCpy(pTlv + idx, &Uuid16, sizeof(Uuid16));
+		pTlv[idx + 2] = Properties;
+		pTlv[idx + 3] = ValueAccessPermissions;
+		FLib_MemCpy(pTlv + idx + 4, &MaxValueLength, sizeof(MaxValueLength));
+		FLib_MemCpy(pTlv + idx + 6, InitialValue, InitialValueLength);
+	}
+
+	return idx + length;
+}
+
+/*!*************************************************************************************************
+\fn		uint16_t GATTDBDynamicServiceTlvDescriptor(uint8_t *pTlv, uint16_t idx, uint16_t Uuid16, uint8_t DescriptorAccessPermissions, uint16_t ValueLength, const uint8_t *Value)
+\brief	Writes a descriptor record of the last characteristic at idx. With pTlv NULL nothing is
+		written.
+
+\return	uint16_t			Index following the record
+***************************************************************************************************/
+uint16_t GATTDBDynamicServiceTlvDescriptor(uint8_t *pTlv, uint16_t idx, uint16_t Uuid16, uint8_t DescriptorAccessPermissions, uint16_t ValueLength, const uint8_t *Value)
+{
+	uint16_t length = sizeof(Uuid16) + sizeof(DescriptorAccessPermissions) + ValueLength;
+
+	idx = GATTDBDynamicServiceTlvRecord(pTlv, idx, GATTDBDynamicServiceTlvDescriptor_c, length);
+
+	if (pTlv)
+	{
+		FLib_MemCpy(pTlv + idx, &Uuid16, sizeof(Uuid16));
+		pTlv[idx + 2] = DescriptorAccessPermissions;
+		FLib_MemCpy(pTlv + idx + 3, Value, ValueLength);
+	}
+
+	return idx + length;
+}
+
+/*!*************************************************************************************************
+\fn		uint16_t GATTDBDynamicServiceTlvCccd(uint8_t *pTlv, uint16_t idx)
+\brief	Writes the CCCD record of the last characteristic at idx. With pTlv NULL nothing is
+		written.
+
+\return	uint16_t			Index following the record
+***************************************************************************************************/
+uint16_t GATTDBDynamicServiceTlvCccd(uint8_t *pTlv, uint16_t idx)
+{
+	return GATTDBDynamicServiceTlvRecord(pTlv, idx, GATTDBDynamicServiceTlvCccd_c, 0);
+}
+
 #endif  /* GATTDB_APP_ENABLE */
 
 #if GATTDB_ATT_ENABLE
@@ -5680,7 +5963,7 @@ memStatus_t GATTDBAttFindByTypeValueRequest(GATTDBAttFindByTypeValueRequest_t *r
 	msgLen += req->Params.AttributeLength;  // AttributeValue
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -5695,8 +5978,7 @@ memStatus_t GATTDBAttFindByTypeValueRequest(GATTDBAttFindByTypeValueRequest_t *r
 	FLib_MemCpy(pMsg + idx, req->Params.AttributeValue, req->Params.AttributeLength); idx += req->Params.AttributeLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x47, 0x02, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x47, 0x02, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -5736,7 +6018,7 @@ memStatus_t GATTDBAttReadByTypeRequest(GATTDBAttReadByTypeRequest_t *req, void *
 	}	// AttributeType
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -5760,8 +6042,7 @@ memStatus_t GATTDBAttReadByTypeRequest(GATTDBAttReadByTypeRequest_t *req, void *
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x47, 0x03, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x47, 0x03, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -5827,7 +6108,7 @@ memStatus_t GATTDBAttReadMultipleRequest(GATTDBAttReadMultipleRequest_t *req, vo
 	msgLen += req->Params.HandleCount * sizeof(uint16_t);  // ListOfHandles
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -5839,8 +6120,7 @@ memStatus_t GATTDBAttReadMultipleRequest(GATTDBAttReadMultipleRequest_t *req, vo
 	FLib_MemCpy(pMsg + idx, req->Params.ListOfHandles, req->Params.HandleCount * sizeof(uint16_t)); idx += req->Params.HandleCount * sizeof(uint16_t);
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x47, 0x06, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x47, 0x06, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -5880,7 +6160,7 @@ memStatus_t GATTDBAttReadByGroupTypeRequest(GATTDBAttReadByGroupTypeRequest_t *r
 	}	// AttributeType
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -5904,8 +6184,7 @@ memStatus_t GATTDBAttReadByGroupTypeRequest(GATTDBAttReadByGroupTypeRequest_t *r
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x47, 0x07, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x47, 0x07, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -5934,7 +6213,7 @@ memStatus_t GATTDBAttWriteRequest(GATTDBAttWriteRequest_t *req, void *arg, uint8
 	msgLen += req->Params.AttributeLength;  // AttributeValue
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -5947,8 +6226,7 @@ memStatus_t GATTDBAttWriteRequest(GATTDBAttWriteRequest_t *req, void *arg, uint8
 	FLib_MemCpy(pMsg + idx, req->Params.AttributeValue, req->Params.AttributeLength); idx += req->Params.AttributeLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x47, 0x08, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x47, 0x08, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -5977,7 +6255,7 @@ memStatus_t GATTDBAttWriteCommandRequest(GATTDBAttWriteCommandRequest_t *req, vo
 	msgLen += req->Params.AttributeLength;  // AttributeValue
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -5990,8 +6268,7 @@ memStatus_t GATTDBAttWriteCommandRequest(GATTDBAttWriteCommandRequest_t *req, vo
 	FLib_MemCpy(pMsg + idx, req->Params.AttributeValue, req->Params.AttributeLength); idx += req->Params.AttributeLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x47, 0x09, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x47, 0x09, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -6021,7 +6298,7 @@ memStatus_t GATTDBAttSignedWriteCommandRequest(GATTDBAttSignedWriteCommandReques
 	msgLen += 12;  // AuthenticationSignature
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -6035,8 +6312,7 @@ memStatus_t GATTDBAttSignedWriteCommandRequest(GATTDBAttSignedWriteCommandReques
 	FLib_MemCpy(pMsg + idx, req->Params.AuthenticationSignature, 12); idx += 12;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x47, 0x0A, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x47, 0x0A, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -6066,7 +6342,7 @@ memStatus_t GATTDBAttPrepareWriteRequest(GATTDBAttPrepareWriteRequest_t *req, vo
 	msgLen += req->Params.AttributeLength;  // AttributeValue
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -6080,8 +6356,7 @@ memStatus_t GATTDBAttPrepareWriteRequest(GATTDBAttPrepareWriteRequest_t *req, vo
 	FLib_MemCpy(pMsg + idx, req->Params.AttributeValue, req->Params.AttributeLength); idx += req->Params.AttributeLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x47, 0x0B, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x47, 0x0B, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -6130,7 +6405,7 @@ memStatus_t GATTDBAttExecuteWriteFromQueueRequest(GATTDBAttExecuteWriteFromQueue
 	msgLen += req->Params.AttributeLength;  // AttributeValue
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -6144,8 +6419,7 @@ memStatus_t GATTDBAttExecuteWriteFromQueueRequest(GATTDBAttExecuteWriteFromQueue
 	FLib_MemCpy(pMsg + idx, req->Params.AttributeValue, req->Params.AttributeLength); idx += req->Params.AttributeLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x47, 0x0D, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x47, 0x0D, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -6174,7 +6448,7 @@ memStatus_t GATTDBAttPrepareNotificationIndicationRequest(GATTDBAttPrepareNotifi
 	msgLen += req->Params.AttributeLength;  // AttributeValue
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -6187,8 +6461,7 @@ memStatus_t GATTDBAttPrepareNotificationIndicationRequest(GATTDBAttPrepareNotifi
 	FLib_MemCpy(pMsg + idx, req->Params.AttributeValue, req->Params.AttributeLength); idx += req->Params.AttributeLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x47, 0x0E, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x47, 0x0E, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -6246,7 +6519,7 @@ memStatus_t GAPRegisterDeviceSecurityRequirementsRequest(GAPRegisterDeviceSecuri
 
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -6272,8 +6545,7 @@ memStatus_t GAPRegisterDeviceSecurityRequirementsRequest(GAPRegisterDeviceSecuri
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x02, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x02, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -6345,7 +6617,7 @@ memStatus_t GAPSetAdvertisingDataRequest(GAPSetAdvertisingDataRequest_t *req, vo
 
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -6380,8 +6652,7 @@ memStatus_t GAPSetAdvertisingDataRequest(GAPSetAdvertisingDataRequest_t *req, vo
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x04, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x04, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -6698,7 +6969,7 @@ memStatus_t GAPSendSmpKeysRequest(GAPSendSmpKeysRequest_t *req, void *arg, uint8
 
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -6748,8 +7019,7 @@ memStatus_t GAPSendSmpKeysRequest(GAPSendSmpKeysRequest_t *req, void *arg, uint8
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x14, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x14, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -6796,7 +7066,7 @@ memStatus_t GAPProvideLongTermKeyRequest(GAPProvideLongTermKeyRequest_t *req, vo
 	msgLen += req->LtkSize;  // Ltk
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -6808,8 +7078,7 @@ memStatus_t GAPProvideLongTermKeyRequest(GAPProvideLongTermKeyRequest_t *req, vo
 	FLib_MemCpy(pMsg + idx, req->Ltk, req->LtkSize); idx += req->LtkSize;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x16, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x16, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -6906,7 +7175,7 @@ memStatus_t GAPStartScanningRequest(GAPStartScanningRequest_t *req, void *arg, u
 	msgLen += sizeof(uint16_t);  // Period
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -6929,8 +7198,7 @@ memStatus_t GAPStartScanningRequest(GAPStartScanningRequest_t *req, void *arg, u
 	FLib_MemCpy(pMsg + idx, &(req->Period), sizeof(req->Period)); idx += sizeof(req->Period);
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x1A, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x1A, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -7009,7 +7277,7 @@ memStatus_t GAPSaveCustomPeerInformationRequest(GAPSaveCustomPeerInformationRequ
 	msgLen += req->InfoSize;  // Info
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -7022,8 +7290,7 @@ memStatus_t GAPSaveCustomPeerInformationRequest(GAPSaveCustomPeerInformationRequ
 	FLib_MemCpy(pMsg + idx, req->Info, req->InfoSize); idx += req->InfoSize;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x1E, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x1E, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -7175,7 +7442,7 @@ memStatus_t GAPCreateRandomDeviceAddressRequest(GAPCreateRandomDeviceAddressRequ
 
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -7203,8 +7470,7 @@ memStatus_t GAPCreateRandomDeviceAddressRequest(GAPCreateRandomDeviceAddressRequ
 
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x26, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x26, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -7232,7 +7498,7 @@ memStatus_t GAPSaveDeviceNameRequest(GAPSaveDeviceNameRequest_t *req, void *arg,
 	msgLen += req->NameSize;  // Name
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -7244,8 +7510,7 @@ memStatus_t GAPSaveDeviceNameRequest(GAPSaveDeviceNameRequest_t *req, void *arg,
 	FLib_MemCpy(pMsg + idx, req->Name, req->NameSize); idx += req->NameSize;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x27, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x27, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -7410,7 +7675,7 @@ memStatus_t GAPSetScanModeRequest(GAPSetScanModeRequest_t *req, void *arg, uint8
 	}	// AutoConnectData
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -7440,8 +7705,7 @@ memStatus_t GAPSetScanModeRequest(GAPSetScanModeRequest_t *req, void *arg, uint8
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x2F, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x2F, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -7481,7 +7745,7 @@ memStatus_t GAPSetDefaultPairingParametersRequest(GAPSetDefaultPairingParameters
 
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -7504,8 +7768,7 @@ memStatus_t GAPSetDefaultPairingParametersRequest(GAPSetDefaultPairingParameters
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x30, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x30, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -7594,7 +7857,7 @@ memStatus_t GAPEnableHostPrivacyRequest(GAPEnableHostPrivacyRequest_t *req, void
 
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -7610,8 +7873,7 @@ memStatus_t GAPEnableHostPrivacyRequest(GAPEnableHostPrivacyRequest_t *req, void
 
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x35, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x35, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -7657,7 +7919,7 @@ memStatus_t GAPEnableControllerPrivacyRequest(GAPEnableControllerPrivacyRequest_
 	}	// PeerIdentities
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -7687,8 +7949,7 @@ memStatus_t GAPEnableControllerPrivacyRequest(GAPEnableControllerPrivacyRequest_
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x36, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x36, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -7950,7 +8211,7 @@ memStatus_t GAPSaveKeysRequest(GAPSaveKeysRequest_t *req, void *arg, uint8_t fsc
 	msgLen += sizeof(bool_t);  // Authenticated
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -8002,8 +8263,7 @@ memStatus_t GAPSaveKeysRequest(GAPSaveKeysRequest_t *req, void *arg, uint8_t fsc
 	pMsg[idx] = req->Authenticated; idx++;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x42, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x42, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -8304,7 +8564,7 @@ memStatus_t GAPUpdatePeriodicAdvListRequest(GAPUpdatePeriodicAdvListRequest_t *r
 	}  // OperationValue
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -8332,8 +8592,7 @@ memStatus_t GAPUpdatePeriodicAdvListRequest(GAPUpdatePeriodicAdvListRequest_t *r
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x54, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x54, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -8443,7 +8702,7 @@ memStatus_t GAPSetPeriodicAdvertisingDataRequest(GAPSetPeriodicAdvertisingDataRe
 	}	// AdStructures
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -8461,8 +8720,7 @@ memStatus_t GAPSetPeriodicAdvertisingDataRequest(GAPSetPeriodicAdvertisingDataRe
 	}
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x59, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x59, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -8588,7 +8846,7 @@ memStatus_t GAPSetConnectionlessCteTransmitParametersRequest(GAPSetConnectionles
 	msgLen += req->SwitchingPatternLength;  // AntennaIds
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -8603,8 +8861,7 @@ memStatus_t GAPSetConnectionlessCteTransmitParametersRequest(GAPSetConnectionles
 	FLib_MemCpy(pMsg + idx, req->AntennaIds, req->SwitchingPatternLength); idx += req->SwitchingPatternLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x5D, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x5D, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -8654,7 +8911,7 @@ memStatus_t GAPEnableConnectionlessIqSamplingRequest(GAPEnableConnectionlessIqSa
 	msgLen += req->pIqSamplingParams.SwitchingPatternLength;  // AntennaIds
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -8669,8 +8926,7 @@ memStatus_t GAPEnableConnectionlessIqSamplingRequest(GAPEnableConnectionlessIqSa
 	FLib_MemCpy(pMsg + idx, req->pIqSamplingParams.AntennaIds, req->pIqSamplingParams.SwitchingPatternLength); idx += req->pIqSamplingParams.SwitchingPatternLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x5F, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x5F, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -8700,7 +8956,7 @@ memStatus_t GAPSetConnectionCteReceiveParametersRequest(GAPSetConnectionCteRecei
 	msgLen += req->pReceiveParams.SwitchingPatternLength;  // AntennaIds
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -8714,8 +8970,7 @@ memStatus_t GAPSetConnectionCteReceiveParametersRequest(GAPSetConnectionCteRecei
 	FLib_MemCpy(pMsg + idx, req->pReceiveParams.AntennaIds, req->pReceiveParams.SwitchingPatternLength); idx += req->pReceiveParams.SwitchingPatternLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x60, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x60, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -8744,7 +8999,7 @@ memStatus_t GAPSetConnectionCteTransmitParametersRequest(GAPSetConnectionCteTran
 	msgLen += req->pTransmitParams.SwitchingPatternLength;  // AntennaIds
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -8757,8 +9012,7 @@ memStatus_t GAPSetConnectionCteTransmitParametersRequest(GAPSetConnectionCteTran
 	FLib_MemCpy(pMsg + idx, req->pTransmitParams.AntennaIds, req->pTransmitParams.SwitchingPatternLength); idx += req->pTransmitParams.SwitchingPatternLength;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x61, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x61, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -9104,7 +9358,7 @@ memStatus_t GAPEattReconfigureRequest(GAPEattReconfigureRequest_t *req, void *ar
 	msgLen += req->NoOfBearers;  // BearerIds
 
 	/* Allocate memory for the marshalled payload */
-	pMsg = MEM_BufferAlloc(msgLen);
+	pMsg = FSCI_TxBufferAlloc(arg, msgLen, fsciInterface);
 	if (!pMsg)
 	{
 		return MEM_ALLOC_ERROR_c;
@@ -9118,8 +9372,7 @@ memStatus_t GAPEattReconfigureRequest(GAPEattReconfigureRequest_t *req, void *ar
 	FLib_MemCpy(pMsg + idx, req->BearerIds, req->NoOfBearers); idx += req->NoOfBearers;
 
 	/* Send the request */
-	FSCI_transmitPayload(arg, 0x48, 0x74, pMsg, msgLen, fsciInterface);
-	MEM_BufferFree(pMsg);
+	FSCI_TxBufferSend(arg, 0x48, 0x74, pMsg, msgLen, fsciInterface);
 	return MEM_SUCCESS_c;
 }
 
@@ -9142,6 +9395,25 @@ memStatus_t GAPEattSendCreditsRequest(GAPEattSendCreditsRequest_t *req, void *ar
 	return MEM_SUCCESS_c;
 }
 
+/*!*************************************************************************************************
+\fn		memStatus_t GAPSetScanReportBatchingRequest(GAPSetScanReportBatchingRequest_t *req, void *arg, uint8_t fsciInterface)
+\brief	Coalesce the scanned device reports in GAPScanningEventDeviceScannedBatchIndication events.
+
+\return	memStatus_t			MEM_SUCCESS_c, MEM_ALLOC_ERROR_c, MEM_FREE_ERROR_c
+							MEM_UNKNOWN_ERROR_c if req is NULL
+***************************************************************************************************/
+memStatus_t GAPSetScanReportBatchingRequest(GAPSetScanReportBatchingRequest_t *req, void *arg, uint8_t fsciInterface)
+{
+	/* Sanity check */
+	if (!req)
+	{
+		return MEM_UNKNOWN_ERROR_c;
+	}
+
+	FSCI_transmitPayload(arg, 0x48, 0x7D, req, sizeof(GAPSetScanReportBatchingRequest_t), fsciInterface);
+	return MEM_SUCCESS_c;
+}
+
 #endif  /* GAP_ENABLE */
 
 #if FSCI_ENABLE
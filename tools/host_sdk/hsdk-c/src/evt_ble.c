@@ -10,9 +10,29 @@ Include Files
 ==================================================================================================*/
 #include "cmd_ble.h"
 
+/*==================================================================================================
+Private Macros
+==================================================================================================*/
+#if FSCI_EVT_ARENA
+/* A decoded event takes more room than its packed payload, mostly for pointers and padding */
+#define BLE_EVT_ARENA_RATIO			4
+#define BLE_EVT_ARENA_ALIGN			8
+
+#define BLE_EvtBufferAlloc(container, size)	BLE_EvtArenaAlloc(&(container)->arena, size)
+/* Nothing to undo, the arena is reset as a whole */
+#define BLE_EvtBufferFree(container, ptr)
+#else
+#define BLE_EvtBufferAlloc(container, size)	MEM_BufferAlloc(size)
+#define BLE_EvtBufferFree(container, ptr)	MEM_BufferFree(ptr)
+#endif  /* FSCI_EVT_ARENA */
+
 /*==================================================================================================
 Private Prototypes
 ==================================================================================================*/
+#if FSCI_EVT_ARENA
+static void *BLE_EvtArenaAlloc(bleEvtArena_t *arena, uint32_t size);
+#endif  /* FSCI_EVT_ARENA */
+
 #if FSCI_ENABLE
 static memStatus_t Load_FSCIGetNumberOfFreeBuffersResponse(bleEvtContainer_t *container, uint8_t *pPayload);
 static memStatus_t Load_FSCIAckIndication(bleEvtContainer_t *container, uint8_t *pPayload);
@@ -37,6 +57,7 @@ static memStatus_t Load_L2CAPCBLePsmEnhancedConnectRequestIndication(bleEvtConta
 static memStatus_t Load_L2CAPCBLePsmEnhancedConnectionCompleteIndication(bleEvtContainer_t *container, uint8_t *pPayload);
 static memStatus_t Load_L2CAPCBEnhancedReconfigureRequestIndication(bleEvtContainer_t *container, uint8_t *pPayload);
 static memStatus_t Load_L2CAPCBEnhancedReconfigureResponseIndication(bleEvtContainer_t *container, uint8_t *pPayload);
+static memStatus_t Load_L2CAPCBLeCbDataBatchCompleteIndication(bleEvtContainer_t *container, uint8_t *pPayload);
 #endif  /* L2CAPCB_ENABLE */
 
 #if GATT_ENABLE
@@ -107,6 +128,7 @@ static memStatus_t Load_GATTDBDynamicAddCharacteristicDescriptorIndication(bleEv
 static memStatus_t Load_GATTDBDynamicAddCccdIndication(bleEvtContainer_t *container, uint8_t *pPayload);
 static memStatus_t Load_GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueIndication(bleEvtContainer_t *container, uint8_t *pPayload);
 static memStatus_t Load_GATTDBDynamicAddCharDescriptorWithUniqueValueIndication(bleEvtContainer_t *container, uint8_t *pPayload);
+static memStatus_t Load_GATTDBDynamicAddServiceIndication(bleEvtContainer_t *container, uint8_t *pPayload);
 #endif  /* GATTDB_APP_ENABLE */
 
 #if GATTDB_ATT_ENABLE
@@ -243,243 +265,300 @@ static memStatus_t Load_GAPConnectionEventEattReconfigureResponseIndication(bleE
 static memStatus_t Load_GAPConnectionEventEattBearerStatusNotificationIndication(bleEvtContainer_t *container, uint8_t *pPayload);
 static memStatus_t Load_GAPGenericEventLeGenerateDhKeyCompleteIndication(bleEvtContainer_t *container, uint8_t *pPayload);
 static memStatus_t Load_GAPGetHostVersionIndication(bleEvtContainer_t *container, uint8_t *pPayload);
+static memStatus_t Load_GAPScanningEventDeviceScannedBatchIndication(bleEvtContainer_t *container, uint8_t *pPayload);
 #endif  /* GAP_ENABLE */
 
 /*==================================================================================================
 Private global variables declarations
 ==================================================================================================*/
-static const bleEvtHandler_t evtHandlerTbl[] =
+#if FSCI_ENABLE
+/* opGroup 0xA4, indexed by opCode */
+static const pfnBleEvtHandler evtHandlerTbl_A4[256] =
+{
+	[FSCIGetNumberOfFreeBuffersResponse_FSCI_ID & 0xFF] = Load_FSCIGetNumberOfFreeBuffersResponse,
+	[FSCIAckIndication_FSCI_ID & 0xFF] = Load_FSCIAckIndication,
+	[FSCIErrorIndication_FSCI_ID & 0xFF] = Load_FSCIErrorIndication,
+	[FSCIAllowDeviceToSleepConfirm_FSCI_ID & 0xFF] = Load_FSCIAllowDeviceToSleepConfirm,
+	[FSCIWakeUpIndication_FSCI_ID & 0xFF] = Load_FSCIWakeUpIndication,
+	[FSCIGetWakeupReasonResponse_FSCI_ID & 0xFF] = Load_FSCIGetWakeupReasonResponse,
+	[FSCIGetNbuVersionResponse_FSCI_ID & 0xFF] = Load_FSCIGetNbuVersionResponse,
+};
+#endif  /* FSCI_ENABLE */
+
+#if L2CAPCB_ENABLE
+/* opGroup 0x42, indexed by opCode */
+static const pfnBleEvtHandler evtHandlerTbl_42[256] =
+{
+	[L2CAPCBConfirm_FSCI_ID & 0xFF] = Load_L2CAPCBConfirm,
+	[L2CAPCBLePsmConnectionRequestIndication_FSCI_ID & 0xFF] = Load_L2CAPCBLePsmConnectionRequestIndication,
+	[L2CAPCBLePsmConnectionCompleteIndication_FSCI_ID & 0xFF] = Load_L2CAPCBLePsmConnectionCompleteIndication,
+	[L2CAPCBLePsmDisconnectNotificationIndication_FSCI_ID & 0xFF] = Load_L2CAPCBLePsmDisconnectNotificationIndication,
+	[L2CAPCBNoPeerCreditsIndication_FSCI_ID & 0xFF] = Load_L2CAPCBNoPeerCreditsIndication,
+	[L2CAPCBLocalCreditsNotificationIndication_FSCI_ID & 0xFF] = Load_L2CAPCBLocalCreditsNotificationIndication,
+	[L2CAPCBLeCbDataIndication_FSCI_ID & 0xFF] = Load_L2CAPCBLeCbDataIndication,
+	[L2CAPCBErrorIndication_FSCI_ID & 0xFF] = Load_L2CAPCBErrorIndication,
+	[L2CAPCBChannelStatusNotificationIndication_FSCI_ID & 0xFF] = Load_L2CAPCBChannelStatusNotificationIndication,
+	[L2CAPCBLePsmEnhancedConnectRequestIndication_FSCI_ID & 0xFF] = Load_L2CAPCBLePsmEnhancedConnectRequestIndication,
+	[L2CAPCBLePsmEnhancedConnectionCompleteIndication_FSCI_ID & 0xFF] = Load_L2CAPCBLePsmEnhancedConnectionCompleteIndication,
+	[L2CAPCBEnhancedReconfigureRequestIndication_FSCI_ID & 0xFF] = Load_L2CAPCBEnhancedReconfigureRequestIndication,
+	[L2CAPCBEnhancedReconfigureResponseIndication_FSCI_ID & 0xFF] = Load_L2CAPCBEnhancedReconfigureResponseIndication,
+	[L2CAPCBLeCbDataBatchCompleteIndication_FSCI_ID & 0xFF] = Load_L2CAPCBLeCbDataBatchCompleteIndication,
+};
+#endif  /* L2CAPCB_ENABLE */
+
+#if GATT_ENABLE
+/* opGroup 0x45, indexed by opCode */
+static const pfnBleEvtHandler evtHandlerTbl_45[256] =
+{
+	[GATTConfirm_FSCI_ID & 0xFF] = Load_GATTConfirm,
+	[GATTGetMtuIndication_FSCI_ID & 0xFF] = Load_GATTGetMtuIndication,
+	[GATTClientProcedureExchangeMtuIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureExchangeMtuIndication,
+	[GATTClientProcedureDiscoverAllPrimaryServicesIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureDiscoverAllPrimaryServicesIndication,
+	[GATTClientProcedureDiscoverPrimaryServicesByUuidIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureDiscoverPrimaryServicesByUuidIndication,
+	[GATTClientProcedureFindIncludedServicesIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureFindIncludedServicesIndication,
+	[GATTClientProcedureDiscoverAllCharacteristicsIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureDiscoverAllCharacteristicsIndication,
+	[GATTClientProcedureDiscoverCharacteristicByUuidIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureDiscoverCharacteristicByUuidIndication,
+	[GATTClientProcedureDiscoverAllCharacteristicDescriptorsIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureDiscoverAllCharacteristicDescriptorsIndication,
+	[GATTClientProcedureReadCharacteristicValueIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureReadCharacteristicValueIndication,
+	[GATTClientProcedureReadUsingCharacteristicUuidIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureReadUsingCharacteristicUuidIndication,
+	[GATTClientProcedureReadMultipleCharacteristicValuesIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureReadMultipleCharacteristicValuesIndication,
+	[GATTClientProcedureWriteCharacteristicValueIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureWriteCharacteristicValueIndication,
+	[GATTClientProcedureReadCharacteristicDescriptorIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureReadCharacteristicDescriptorIndication,
+	[GATTClientProcedureWriteCharacteristicDescriptorIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureWriteCharacteristicDescriptorIndication,
+	[GATTClientNotificationIndication_FSCI_ID & 0xFF] = Load_GATTClientNotificationIndication,
+	[GATTClientMultipleHandleValueNotificationIndication_FSCI_ID & 0xFF] = Load_GATTClientMultipleHandleValueNotificationIndication,
+	[GATTClientProcedureReadMultipleVariableLenCharValuesIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureReadMultipleVariableLenCharValuesIndication,
+	[GATTClientIndicationIndication_FSCI_ID & 0xFF] = Load_GATTClientIndicationIndication,
+	[GATTServerMtuChangedIndication_FSCI_ID & 0xFF] = Load_GATTServerMtuChangedIndication,
+	[GATTServerHandleValueConfirmationIndication_FSCI_ID & 0xFF] = Load_GATTServerHandleValueConfirmationIndication,
+	[GATTServerAttributeWrittenIndication_FSCI_ID & 0xFF] = Load_GATTServerAttributeWrittenIndication,
+	[GATTServerCharacteristicCccdWrittenIndication_FSCI_ID & 0xFF] = Load_GATTServerCharacteristicCccdWrittenIndication,
+	[GATTServerAttributeWrittenWithoutResponseIndication_FSCI_ID & 0xFF] = Load_GATTServerAttributeWrittenWithoutResponseIndication,
+	[GATTServerErrorIndication_FSCI_ID & 0xFF] = Load_GATTServerErrorIndication,
+	[GATTServerLongCharacteristicWrittenIndication_FSCI_ID & 0xFF] = Load_GATTServerLongCharacteristicWrittenIndication,
+	[GATTServerAttributeReadIndication_FSCI_ID & 0xFF] = Load_GATTServerAttributeReadIndication,
+	[GATTClientProcedureEnhancedDiscoverAllPrimaryServicesIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureEnhancedDiscoverAllPrimaryServicesIndication,
+	[GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuidIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuidIndication,
+	[GATTClientProcedureEnhancedFindIncludedServicesIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureEnhancedFindIncludedServicesIndication,
+	[GATTClientProcedureEnhancedDiscoverAllCharacteristicsIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureEnhancedDiscoverAllCharacteristicsIndication,
+	[GATTClientProcedureEnhancedDiscoverCharacteristicByUuidIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureEnhancedDiscoverCharacteristicByUuidIndication,
+	[GATTClientProcedureEnhancedDiscoverAllCharacteristicDescriptorsIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureEnhancedDiscoverAllCharacteristicDescriptorsIndication,
+	[GATTClientProcedureEnhancedReadCharacteristicValueIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureEnhancedReadCharacteristicValueIndication,
+	[GATTClientProcedureEnhancedReadUsingCharacteristicUuidIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureEnhancedReadUsingCharacteristicUuidIndication,
+	[GATTClientProcedureEnhancedReadMultipleCharacteristicValuesIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureEnhancedReadMultipleCharacteristicValuesIndication,
+	[GATTClientProcedureEnhancedWriteCharacteristicValueIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureEnhancedWriteCharacteristicValueIndication,
+	[GATTClientProcedureEnhancedReadCharacteristicDescriptorIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureEnhancedReadCharacteristicDescriptorIndication,
+	[GATTClientProcedureEnhancedWriteCharacteristicDescriptorIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureEnhancedWriteCharacteristicDescriptorIndication,
+	[GATTClientProcedureEnhancedReadMultipleVariableLenCharValuesIndication_FSCI_ID & 0xFF] = Load_GATTClientProcedureEnhancedReadMultipleVariableLenCharValuesIndication,
+	[GATTClientEnhancedMultipleHandleValueNotificationIndication_FSCI_ID & 0xFF] = Load_GATTClientEnhancedMultipleHandleValueNotificationIndication,
+	[GATTClientEnhancedNotificationIndication_FSCI_ID & 0xFF] = Load_GATTClientEnhancedNotificationIndication,
+	[GATTClientEnhancedIndicationIndication_FSCI_ID & 0xFF] = Load_GATTClientEnhancedIndicationIndication,
+	[GATTServerEnhancedHandleValueConfirmationIndication_FSCI_ID & 0xFF] = Load_GATTServerEnhancedHandleValueConfirmationIndication,
+	[GATTServerEnhancedAttributeWrittenIndication_FSCI_ID & 0xFF] = Load_GATTServerEnhancedAttributeWrittenIndication,
+	[GATTServerEnhancedCharacteristicCccdWrittenIndication_FSCI_ID & 0xFF] = Load_GATTServerEnhancedCharacteristicCccdWrittenIndication,
+	[GATTServerEnhancedAttributeWrittenWithoutResponseIndication_FSCI_ID & 0xFF] = Load_GATTServerEnhancedAttributeWrittenWithoutResponseIndication,
+	[GATTServerEnhancedErrorIndication_FSCI_ID & 0xFF] = Load_GATTServerEnhancedErrorIndication,
+	[GATTServerEnhancedLongCharacteristicWrittenIndication_FSCI_ID & 0xFF] = Load_GATTServerEnhancedLongCharacteristicWrittenIndication,
+	[GATTServerEnhancedAttributeReadIndication_FSCI_ID & 0xFF] = Load_GATTServerEnhancedAttributeReadIndication,
+};
+#endif  /* GATT_ENABLE */
+
+#if GATTDB_APP_ENABLE
+/* opGroup 0x46, indexed by opCode */
+static const pfnBleEvtHandler evtHandlerTbl_46[256] =
+{
+	[GATTDBConfirm_FSCI_ID & 0xFF] = Load_GATTDBConfirm,
+	[GATTDBReadAttributeIndication_FSCI_ID & 0xFF] = Load_GATTDBReadAttributeIndication,
+	[GATTDBFindServiceHandleIndication_FSCI_ID & 0xFF] = Load_GATTDBFindServiceHandleIndication,
+	[GATTDBFindCharValueHandleInServiceIndication_FSCI_ID & 0xFF] = Load_GATTDBFindCharValueHandleInServiceIndication,
+	[GATTDBFindCccdHandleForCharValueHandleIndication_FSCI_ID & 0xFF] = Load_GATTDBFindCccdHandleForCharValueHandleIndication,
+	[GATTDBFindDescriptorHandleForCharValueHandleIndication_FSCI_ID & 0xFF] = Load_GATTDBFindDescriptorHandleForCharValueHandleIndication,
+	[GATTDBDynamicAddPrimaryServiceDeclarationIndication_FSCI_ID & 0xFF] = Load_GATTDBDynamicAddPrimaryServiceDeclarationIndication,
+	[GATTDBDynamicAddSecondaryServiceDeclarationIndication_FSCI_ID & 0xFF] = Load_GATTDBDynamicAddSecondaryServiceDeclarationIndication,
+	[GATTDBDynamicAddIncludeDeclarationIndication_FSCI_ID & 0xFF] = Load_GATTDBDynamicAddIncludeDeclarationIndication,
+	[GATTDBDynamicAddCharacteristicDeclarationAndValueIndication_FSCI_ID & 0xFF] = Load_GATTDBDynamicAddCharacteristicDeclarationAndValueIndication,
+	[GATTDBDynamicAddCharacteristicDescriptorIndication_FSCI_ID & 0xFF] = Load_GATTDBDynamicAddCharacteristicDescriptorIndication,
+	[GATTDBDynamicAddCccdIndication_FSCI_ID & 0xFF] = Load_GATTDBDynamicAddCccdIndication,
+	[GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueIndication_FSCI_ID & 0xFF] = Load_GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueIndication,
+	[GATTDBDynamicAddCharDescriptorWithUniqueValueIndication_FSCI_ID & 0xFF] = Load_GATTDBDynamicAddCharDescriptorWithUniqueValueIndication,
+	[GATTDBDynamicAddServiceIndication_FSCI_ID & 0xFF] = Load_GATTDBDynamicAddServiceIndication,
+};
+#endif  /* GATTDB_APP_ENABLE */
+
+#if GATTDB_ATT_ENABLE
+/* opGroup 0x47, indexed by opCode */
+static const pfnBleEvtHandler evtHandlerTbl_47[256] =
+{
+	[GATTDBAttConfirm_FSCI_ID & 0xFF] = Load_GATTDBAttConfirm,
+	[GATTDBAttFindInformationIndication_FSCI_ID & 0xFF] = Load_GATTDBAttFindInformationIndication,
+	[GATTDBAttFindByTypeValueIndication_FSCI_ID & 0xFF] = Load_GATTDBAttFindByTypeValueIndication,
+	[GATTDBAttReadByTypeIndication_FSCI_ID & 0xFF] = Load_GATTDBAttReadByTypeIndication,
+	[GATTDBAttReadIndication_FSCI_ID & 0xFF] = Load_GATTDBAttReadIndication,
+	[GATTDBAttReadBlobIndication_FSCI_ID & 0xFF] = Load_GATTDBAttReadBlobIndication,
+	[GATTDBAttReadMultipleIndication_FSCI_ID & 0xFF] = Load_GATTDBAttReadMultipleIndication,
+	[GATTDBAttReadByGroupTypeIndication_FSCI_ID & 0xFF] = Load_GATTDBAttReadByGroupTypeIndication,
+	[GATTDBAttWriteIndication_FSCI_ID & 0xFF] = Load_GATTDBAttWriteIndication,
+	[GATTDBAttPrepareWriteIndication_FSCI_ID & 0xFF] = Load_GATTDBAttPrepareWriteIndication,
+	[GATTDBAttExecuteWriteIndication_FSCI_ID & 0xFF] = Load_GATTDBAttExecuteWriteIndication,
+	[GATTDBAttExecuteWriteFromQueueIndication_FSCI_ID & 0xFF] = Load_GATTDBAttExecuteWriteFromQueueIndication,
+	[GATTDBAttPrepareNotificationIndicationIndication_FSCI_ID & 0xFF] = Load_GATTDBAttPrepareNotificationIndicationIndication,
+};
+#endif  /* GATTDB_ATT_ENABLE */
+
+#if GAP_ENABLE
+/* opGroup 0x48, indexed by opCode */
+static const pfnBleEvtHandler evtHandlerTbl_48[256] =
+{
+	[GAPConfirm_FSCI_ID & 0xFF] = Load_GAPConfirm,
+	[GAPCheckNotificationStatusIndication_FSCI_ID & 0xFF] = Load_GAPCheckNotificationStatusIndication,
+	[GAPCheckIndicationStatusIndication_FSCI_ID & 0xFF] = Load_GAPCheckIndicationStatusIndication,
+	[GAPLoadKeysIndication_FSCI_ID & 0xFF] = Load_GAPLoadKeysIndication,
+	[GAPLoadEncryptionInformationIndication_FSCI_ID & 0xFF] = Load_GAPLoadEncryptionInformationIndication,
+	[GAPLoadCustomPeerInformationIndication_FSCI_ID & 0xFF] = Load_GAPLoadCustomPeerInformationIndication,
+	[GAPCheckIfBondedIndication_FSCI_ID & 0xFF] = Load_GAPCheckIfBondedIndication,
+	[GAPGetBondedDevicesCountIndication_FSCI_ID & 0xFF] = Load_GAPGetBondedDevicesCountIndication,
+	[GAPGetBondedDeviceNameIndication_FSCI_ID & 0xFF] = Load_GAPGetBondedDeviceNameIndication,
+	[GAPGenericEventInitializationCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventInitializationCompleteIndication,
+	[GAPGenericEventInternalErrorIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventInternalErrorIndication,
+	[GAPGenericEventAdvertisingSetupFailedIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventAdvertisingSetupFailedIndication,
+	[GAPGenericEventAdvertisingParametersSetupCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventAdvertisingParametersSetupCompleteIndication,
+	[GAPGenericEventAdvertisingDataSetupCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventAdvertisingDataSetupCompleteIndication,
+	[GAPGenericEventFilterAcceptListSizeReadIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventFilterAcceptListSizeReadIndication,
+	[GAPGenericEventDeviceAddedToFilterAcceptListIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventDeviceAddedToFilterAcceptListIndication,
+	[GAPGenericEventDeviceRemovedFromFilterAcceptListIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventDeviceRemovedFromFilterAcceptListIndication,
+	[GAPGenericEventFilterAcceptListClearedIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventFilterAcceptListClearedIndication,
+	[GAPGenericEventRandomAddressReadyIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventRandomAddressReadyIndication,
+	[GAPGenericEventCreateConnectionCanceledIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventCreateConnectionCanceledIndication,
+	[GAPGenericEventPublicAddressReadIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventPublicAddressReadIndication,
+	[GAPGenericEventAdvTxPowerLevelReadIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventAdvTxPowerLevelReadIndication,
+	[GAPGenericEventPrivateResolvableAddressVerifiedIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventPrivateResolvableAddressVerifiedIndication,
+	[GAPGenericEventRandomAddressSetIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventRandomAddressSetIndication,
+	[GAPAdvertisingEventStateChangedIndication_FSCI_ID & 0xFF] = Load_GAPAdvertisingEventStateChangedIndication,
+	[GAPAdvertisingEventCommandFailedIndication_FSCI_ID & 0xFF] = Load_GAPAdvertisingEventCommandFailedIndication,
+	[GAPScanningEventStateChangedIndication_FSCI_ID & 0xFF] = Load_GAPScanningEventStateChangedIndication,
+	[GAPScanningEventCommandFailedIndication_FSCI_ID & 0xFF] = Load_GAPScanningEventCommandFailedIndication,
+	[GAPScanningEventDeviceScannedIndication_FSCI_ID & 0xFF] = Load_GAPScanningEventDeviceScannedIndication,
+	[GAPConnectionEventConnectedIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventConnectedIndication,
+	[GAPConnectionEventPairingRequestIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventPairingRequestIndication,
+	[GAPConnectionEventPeripheralSecurityRequestIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventPeripheralSecurityRequestIndication,
+	[GAPConnectionEventPairingResponseIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventPairingResponseIndication,
+	[GAPConnectionEventAuthenticationRejectedIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventAuthenticationRejectedIndication,
+	[GAPConnectionEventPasskeyRequestIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventPasskeyRequestIndication,
+	[GAPConnectionEventOobRequestIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventOobRequestIndication,
+	[GAPConnectionEventPasskeyDisplayIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventPasskeyDisplayIndication,
+	[GAPConnectionEventKeyExchangeRequestIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventKeyExchangeRequestIndication,
+	[GAPConnectionEventKeysReceivedIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventKeysReceivedIndication,
+	[GAPConnectionEventLongTermKeyRequestIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventLongTermKeyRequestIndication,
+	[GAPConnectionEventEncryptionChangedIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventEncryptionChangedIndication,
+	[GAPConnectionEventPairingCompleteIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventPairingCompleteIndication,
+	[GAPConnectionEventDisconnectedIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventDisconnectedIndication,
+	[GAPConnectionEventRssiReadIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventRssiReadIndication,
+	[GAPConnectionEventTxPowerLevelReadIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventTxPowerLevelReadIndication,
+	[GAPConnectionEventPowerReadFailureIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventPowerReadFailureIndication,
+	[GAPConnectionEventParameterUpdateRequestIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventParameterUpdateRequestIndication,
+	[GAPConnectionEventParameterUpdateCompleteIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventParameterUpdateCompleteIndication,
+	[GAPConnectionEventLeDataLengthChangedIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventLeDataLengthChangedIndication,
+	[GAPConnectionEventLeScOobDataRequestIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventLeScOobDataRequestIndication,
+	[GAPConnectionEventLeScDisplayNumericValueIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventLeScDisplayNumericValueIndication,
+	[GAPConnectionEventLeScKeypressNotificationIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventLeScKeypressNotificationIndication,
+	[GAPLeScPublicKeyRegeneratedIndication_FSCI_ID & 0xFF] = Load_GAPLeScPublicKeyRegeneratedIndication,
+	[GAPGenericEventLeScLocalOobDataIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventLeScLocalOobDataIndication,
+	[GAPGenericEventHostPrivacyStateChangedIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventHostPrivacyStateChangedIndication,
+	[GAPGenericEventControllerPrivacyStateChangedIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventControllerPrivacyStateChangedIndication,
+	[GAPGenericEventTxPowerLevelSetCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventTxPowerLevelSetCompleteIndication,
+	[GAPGenericEventLePhyEventIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventLePhyEventIndication,
+	[GAPGetBondedDevicesIdentityInformationIndication_FSCI_ID & 0xFF] = Load_GAPGetBondedDevicesIdentityInformationIndication,
+	[GAPControllerNotificationIndication_FSCI_ID & 0xFF] = Load_GAPControllerNotificationIndication,
+	[GAPBondCreatedIndication_FSCI_ID & 0xFF] = Load_GAPBondCreatedIndication,
+	[GAPGenericEventChannelMapSetIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventChannelMapSetIndication,
+	[GAPConnectionEventChannelMapReadIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventChannelMapReadIndication,
+	[GAPConnectionEventChannelMapReadFailureIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventChannelMapReadFailureIndication,
+	[GAPGenericEventExtAdvertisingParamSetupCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventExtAdvertisingParamSetupCompleteIndication,
+	[GAPGenericEventExtAdvertisingDataSetupCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventExtAdvertisingDataSetupCompleteIndication,
+	[GAPGenericEventPeriodicAdvParamSetupCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventPeriodicAdvParamSetupCompleteIndication,
+	[GAPGenericEventPeriodicAdvDataSetupCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventPeriodicAdvDataSetupCompleteIndication,
+	[GAPGenericEventPeriodicAdvListUpdateCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventPeriodicAdvListUpdateCompleteIndication,
+	[GAPAdvertisingEventExtAdvertisingStateChangedIndication_FSCI_ID & 0xFF] = Load_GAPAdvertisingEventExtAdvertisingStateChangedIndication,
+	[GAPAdvertisingEventAdvertisingSetTerminatedIndication_FSCI_ID & 0xFF] = Load_GAPAdvertisingEventAdvertisingSetTerminatedIndication,
+	[GAPAdvertisingEventExtAdvertisingSetRemoveCompletedIndication_FSCI_ID & 0xFF] = Load_GAPAdvertisingEventExtAdvertisingSetRemoveCompletedIndication,
+	[GAPAdvertisingEventExtScanReqReceivedIndication_FSCI_ID & 0xFF] = Load_GAPAdvertisingEventExtScanReqReceivedIndication,
+	[GAPGenericEventPeriodicAdvertisingStateChangedIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventPeriodicAdvertisingStateChangedIndication,
+	[GAPScanningEventExtDeviceScannedIndication_FSCI_ID & 0xFF] = Load_GAPScanningEventExtDeviceScannedIndication,
+	[GAPScanningEventPeriodicAdvSyncEstablishedIndication_FSCI_ID & 0xFF] = Load_GAPScanningEventPeriodicAdvSyncEstablishedIndication,
+	[GAPScanningEventPeriodicAdvSyncTerminatedIndication_FSCI_ID & 0xFF] = Load_GAPScanningEventPeriodicAdvSyncTerminatedIndication,
+	[GAPScanningEventPeriodicAdvSyncLostIndication_FSCI_ID & 0xFF] = Load_GAPScanningEventPeriodicAdvSyncLostIndication,
+	[GAPScanningEventPeriodicDeviceScannedIndication_FSCI_ID & 0xFF] = Load_GAPScanningEventPeriodicDeviceScannedIndication,
+	[GAPGenericEventPeriodicAdvCreateSyncCancelledIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventPeriodicAdvCreateSyncCancelledIndication,
+	[GAPConnectionEventChannelSelectionAlgorithm2Indication_FSCI_ID & 0xFF] = Load_GAPConnectionEventChannelSelectionAlgorithm2Indication,
+	[GAPGenericEventTxEntryAvailableIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventTxEntryAvailableIndication,
+	[GAPGenericEventControllerLocalRPAReadIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventControllerLocalRPAReadIndication,
+	[GAPCheckNvmIndexIndication_FSCI_ID & 0xFF] = Load_GAPCheckNvmIndexIndication,
+	[GAPGetDeviceIdFromConnHandleIndication_FSCI_ID & 0xFF] = Load_GAPGetDeviceIdFromConnHandleIndication,
+	[GAPGetConnectionHandleFromDeviceIdIndication_FSCI_ID & 0xFF] = Load_GAPGetConnectionHandleFromDeviceIdIndication,
+	[GAPPairingEventNoLTKIndication_FSCI_ID & 0xFF] = Load_GAPPairingEventNoLTKIndication,
+	[GAPPairingAlreadyStartedIndication_FSCI_ID & 0xFF] = Load_GAPPairingAlreadyStartedIndication,
+	[GAPGenericEventConnectionlessCteTransmitParamsSetupCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventConnectionlessCteTransmitParamsSetupCompleteIndication,
+	[GAPGenericEventConnectionlessCteTransmitStateChangedIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventConnectionlessCteTransmitStateChangedIndication,
+	[GAPGenericEventConnectionlessIqSamplingStateChangedIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventConnectionlessIqSamplingStateChangedIndication,
+	[GAPGenericEventAntennaInformationReadIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventAntennaInformationReadIndication,
+	[GAPScanningEventConnectionlessIqReportReceivedIndication_FSCI_ID & 0xFF] = Load_GAPScanningEventConnectionlessIqReportReceivedIndication,
+	[GAPConnectionEventIqReportReceivedIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventIqReportReceivedIndication,
+	[GAPConnectionEventCteRequestFailedIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventCteRequestFailedIndication,
+	[GAPConnectionEventCteReceiveParamsSetupCompleteIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventCteReceiveParamsSetupCompleteIndication,
+	[GAPConnectionEventCteTransmitParamsSetupCompleteIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventCteTransmitParamsSetupCompleteIndication,
+	[GAPConnectionEventCteReqStateChangedIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventCteReqStateChangedIndication,
+	[GAPConnectionEventCteRspStateChangedIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventCteRspStateChangedIndication,
+	[GAPGenericEventPeriodicAdvRecvEnableCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventPeriodicAdvRecvEnableCompleteIndication,
+	[GAPGenericEventPeriodicAdvSyncTransferCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventPeriodicAdvSyncTransferCompleteIndication,
+	[GAPGenericEventPeriodicAdvSetInfoTransferCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventPeriodicAdvSetInfoTransferCompleteIndication,
+	[GAPGenericEventSetPeriodicAdvSyncTransferParamsCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventSetPeriodicAdvSyncTransferParamsCompleteIndication,
+	[GAPGenericEventSetDefaultPeriodicAdvSyncTransferParamsCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventSetDefaultPeriodicAdvSyncTransferParamsCompleteIndication,
+	[GAPScanningEventPeriodicAdvSyncTransferReceivedIndication_FSCI_ID & 0xFF] = Load_GAPScanningEventPeriodicAdvSyncTransferReceivedIndication,
+	[GAPConnectionEventPathLossThresholdIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventPathLossThresholdIndication,
+	[GAPConnectionEventTransmitPowerReportingIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventTransmitPowerReportingIndication,
+	[GAPConnectionEventEnhancedReadTransmitPowerLevelIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventEnhancedReadTransmitPowerLevelIndication,
+	[GAPConnectionEventPathLossReportingParamsSetupCompleteIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventPathLossReportingParamsSetupCompleteIndication,
+	[GAPConnectionEventPathLossReportingStateChangedIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventPathLossReportingStateChangedIndication,
+	[GAPConnectionEventTransmitPowerReportingStateChangedIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventTransmitPowerReportingStateChangedIndication,
+	[GAPConnectionEventEattConnectionRequestIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventEattConnectionRequestIndication,
+	[GAPConnectionEventEattConnectionCompleteIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventEattConnectionCompleteIndication,
+	[GAPConnectionEventEattReconfigureResponseIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventEattReconfigureResponseIndication,
+	[GAPConnectionEventEattBearerStatusNotificationIndication_FSCI_ID & 0xFF] = Load_GAPConnectionEventEattBearerStatusNotificationIndication,
+	[GAPGenericEventLeGenerateDhKeyCompleteIndication_FSCI_ID & 0xFF] = Load_GAPGenericEventLeGenerateDhKeyCompleteIndication,
+	[GAPGetHostVersionIndication_FSCI_ID & 0xFF] = Load_GAPGetHostVersionIndication,
+	[GAPScanningEventDeviceScannedBatchIndication_FSCI_ID & 0xFF] = Load_GAPScanningEventDeviceScannedBatchIndication,
+};
+#endif  /* GAP_ENABLE */
+
+/* Handlers registered by the application, indexed by opGroup; each opCode table
+   is allocated on the first registration in its opGroup */
+static pfnBleAppEvtHandler *appEvtHandlerTbl[256];
+
+/* Event handlers, indexed by opGroup */
+static const pfnBleEvtHandler *const evtHandlerTbl[256] =
 {
 #if FSCI_ENABLE
-	{FSCIGetNumberOfFreeBuffersResponse_FSCI_ID, Load_FSCIGetNumberOfFreeBuffersResponse},
-	{FSCIAckIndication_FSCI_ID, Load_FSCIAckIndication},
-	{FSCIErrorIndication_FSCI_ID, Load_FSCIErrorIndication},
-	{FSCIAllowDeviceToSleepConfirm_FSCI_ID, Load_FSCIAllowDeviceToSleepConfirm},
-	{FSCIWakeUpIndication_FSCI_ID, Load_FSCIWakeUpIndication},
-	{FSCIGetWakeupReasonResponse_FSCI_ID, Load_FSCIGetWakeupReasonResponse},
-	{FSCIGetNbuVersionResponse_FSCI_ID, Load_FSCIGetNbuVersionResponse},
+	[0xA4] = evtHandlerTbl_A4,
 #endif  /* FSCI_ENABLE */
 
 #if L2CAPCB_ENABLE
-	{L2CAPCBConfirm_FSCI_ID, Load_L2CAPCBConfirm},
-	{L2CAPCBLePsmConnectionRequestIndication_FSCI_ID, Load_L2CAPCBLePsmConnectionRequestIndication},
-	{L2CAPCBLePsmConnectionCompleteIndication_FSCI_ID, Load_L2CAPCBLePsmConnectionCompleteIndication},
-	{L2CAPCBLePsmDisconnectNotificationIndication_FSCI_ID, Load_L2CAPCBLePsmDisconnectNotificationIndication},
-	{L2CAPCBNoPeerCreditsIndication_FSCI_ID, Load_L2CAPCBNoPeerCreditsIndication},
-	{L2CAPCBLocalCreditsNotificationIndication_FSCI_ID, Load_L2CAPCBLocalCreditsNotificationIndication},
-	{L2CAPCBLeCbDataIndication_FSCI_ID, Load_L2CAPCBLeCbDataIndication},
-	{L2CAPCBErrorIndication_FSCI_ID, Load_L2CAPCBErrorIndication},
-	{L2CAPCBChannelStatusNotificationIndication_FSCI_ID, Load_L2CAPCBChannelStatusNotificationIndication},
-	{L2CAPCBLePsmEnhancedConnectRequestIndication_FSCI_ID, Load_L2CAPCBLePsmEnhancedConnectRequestIndication},
-	{L2CAPCBLePsmEnhancedConnectionCompleteIndication_FSCI_ID, Load_L2CAPCBLePsmEnhancedConnectionCompleteIndication},
-	{L2CAPCBEnhancedReconfigureRequestIndication_FSCI_ID, Load_L2CAPCBEnhancedReconfigureRequestIndication},
-	{L2CAPCBEnhancedReconfigureResponseIndication_FSCI_ID, Load_L2CAPCBEnhancedReconfigureResponseIndication},
+	[0x42] = evtHandlerTbl_42,
 #endif  /* L2CAPCB_ENABLE */
 
 #if GATT_ENABLE
-	{GATTConfirm_FSCI_ID, Load_GATTConfirm},
-	{GATTGetMtuIndication_FSCI_ID, Load_GATTGetMtuIndication},
-	{GATTClientProcedureExchangeMtuIndication_FSCI_ID, Load_GATTClientProcedureExchangeMtuIndication},
-	{GATTClientProcedureDiscoverAllPrimaryServicesIndication_FSCI_ID, Load_GATTClientProcedureDiscoverAllPrimaryServicesIndication},
-	{GATTClientProcedureDiscoverPrimaryServicesByUuidIndication_FSCI_ID, Load_GATTClientProcedureDiscoverPrimaryServicesByUuidIndication},
-	{GATTClientProcedureFindIncludedServicesIndication_FSCI_ID, Load_GATTClientProcedureFindIncludedServicesIndication},
-	{GATTClientProcedureDiscoverAllCharacteristicsIndication_FSCI_ID, Load_GATTClientProcedureDiscoverAllCharacteristicsIndication},
-	{GATTClientProcedureDiscoverCharacteristicByUuidIndication_FSCI_ID, Load_GATTClientProcedureDiscoverCharacteristicByUuidIndication},
-	{GATTClientProcedureDiscoverAllCharacteristicDescriptorsIndication_FSCI_ID, Load_GATTClientProcedureDiscoverAllCharacteristicDescriptorsIndication},
-	{GATTClientProcedureReadCharacteristicValueIndication_FSCI_ID, Load_GATTClientProcedureReadCharacteristicValueIndication},
-	{GATTClientProcedureReadUsingCharacteristicUuidIndication_FSCI_ID, Load_GATTClientProcedureReadUsingCharacteristicUuidIndication},
-	{GATTClientProcedureReadMultipleCharacteristicValuesIndication_FSCI_ID, Load_GATTClientProcedureReadMultipleCharacteristicValuesIndication},
-	{GATTClientProcedureWriteCharacteristicValueIndication_FSCI_ID, Load_GATTClientProcedureWriteCharacteristicValueIndication},
-	{GATTClientProcedureReadCharacteristicDescriptorIndication_FSCI_ID, Load_GATTClientProcedureReadCharacteristicDescriptorIndication},
-	{GATTClientProcedureWriteCharacteristicDescriptorIndication_FSCI_ID, Load_GATTClientProcedureWriteCharacteristicDescriptorIndication},
-	{GATTClientNotificationIndication_FSCI_ID, Load_GATTClientNotificationIndication},
-	{GATTClientMultipleHandleValueNotificationIndication_FSCI_ID, Load_GATTClientMultipleHandleValueNotificationIndication},
-	{GATTClientProcedureReadMultipleVariableLenCharValuesIndication_FSCI_ID, Load_GATTClientProcedureReadMultipleVariableLenCharValuesIndication},
-	{GATTClientIndicationIndication_FSCI_ID, Load_GATTClientIndicationIndication},
-	{GATTServerMtuChangedIndication_FSCI_ID, Load_GATTServerMtuChangedIndication},
-	{GATTServerHandleValueConfirmationIndication_FSCI_ID, Load_GATTServerHandleValueConfirmationIndication},
-	{GATTServerAttributeWrittenIndication_FSCI_ID, Load_GATTServerAttributeWrittenIndication},
-	{GATTServerCharacteristicCccdWrittenIndication_FSCI_ID, Load_GATTServerCharacteristicCccdWrittenIndication},
-	{GATTServerAttributeWrittenWithoutResponseIndication_FSCI_ID, Load_GATTServerAttributeWrittenWithoutResponseIndication},
-	{GATTServerErrorIndication_FSCI_ID, Load_GATTServerErrorIndication},
-	{GATTServerLongCharacteristicWrittenIndication_FSCI_ID, Load_GATTServerLongCharacteristicWrittenIndication},
-	{GATTServerAttributeReadIndication_FSCI_ID, Load_GATTServerAttributeReadIndication},
-	{GATTClientProcedureEnhancedDiscoverAllPrimaryServicesIndication_FSCI_ID, Load_GATTClientProcedureEnhancedDiscoverAllPrimaryServicesIndication},
-	{GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuidIndication_FSCI_ID, Load_GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuidIndication},
-	{GATTClientProcedureEnhancedFindIncludedServicesIndication_FSCI_ID, Load_GATTClientProcedureEnhancedFindIncludedServicesIndication},
-	{GATTClientProcedureEnhancedDiscoverAllCharacteristicsIndication_FSCI_ID, Load_GATTClientProcedureEnhancedDiscoverAllCharacteristicsIndication},
-	{GATTClientProcedureEnhancedDiscoverCharacteristicByUuidIndication_FSCI_ID, Load_GATTClientProcedureEnhancedDiscoverCharacteristicByUuidIndication},
-	{GATTClientProcedureEnhancedDiscoverAllCharacteristicDescriptorsIndication_FSCI_ID, Load_GATTClientProcedureEnhancedDiscoverAllCharacteristicDescriptorsIndication},
-	{GATTClientProcedureEnhancedReadCharacteristicValueIndication_FSCI_ID, Load_GATTClientProcedureEnhancedReadCharacteristicValueIndication},
-	{GATTClientProcedureEnhancedReadUsingCharacteristicUuidIndication_FSCI_ID, Load_GATTClientProcedureEnhancedReadUsingCharacteristicUuidIndication},
-	{GATTClientProcedureEnhancedReadMultipleCharacteristicValuesIndication_FSCI_ID, Load_GATTClientProcedureEnhancedReadMultipleCharacteristicValuesIndication},
-	{GATTClientProcedureEnhancedWriteCharacteristicValueIndication_FSCI_ID, Load_GATTClientProcedureEnhancedWriteCharacteristicValueIndication},
-	{GATTClientProcedureEnhancedReadCharacteristicDescriptorIndication_FSCI_ID, Load_GATTClientProcedureEnhancedReadCharacteristicDescriptorIndication},
-	{GATTClientProcedureEnhancedWriteCharacteristicDescriptorIndication_FSCI_ID, Load_GATTClientProcedureEnhancedWriteCharacteristicDescriptorIndication},
-	{GATTClientProcedureEnhancedReadMultipleVariableLenCharValuesIndication_FSCI_ID, Load_GATTClientProcedureEnhancedReadMultipleVariableLenCharValuesIndication},
-	{GATTClientEnhancedMultipleHandleValueNotificationIndication_FSCI_ID, Load_GATTClientEnhancedMultipleHandleValueNotificationIndication},
-	{GATTClientEnhancedNotificationIndication_FSCI_ID, Load_GATTClientEnhancedNotificationIndication},
-	{GATTClientEnhancedIndicationIndication_FSCI_ID, Load_GATTClientEnhancedIndicationIndication},
-	{GATTServerEnhancedHandleValueConfirmationIndication_FSCI_ID, Load_GATTServerEnhancedHandleValueConfirmationIndication},
-	{GATTServerEnhancedAttributeWrittenIndication_FSCI_ID, Load_GATTServerEnhancedAttributeWrittenIndication},
-	{GATTServerEnhancedCharacteristicCccdWrittenIndication_FSCI_ID, Load_GATTServerEnhancedCharacteristicCccdWrittenIndication},
-	{GATTServerEnhancedAttributeWrittenWithoutResponseIndication_FSCI_ID, Load_GATTServerEnhancedAttributeWrittenWithoutResponseIndication},
-	{GATTServerEnhancedErrorIndication_FSCI_ID, Load_GATTServerEnhancedErrorIndication},
-	{GATTServerEnhancedLongCharacteristicWrittenIndication_FSCI_ID, Load_GATTServerEnhancedLongCharacteristicWrittenIndication},
-	{GATTServerEnhancedAttributeReadIndication_FSCI_ID, Load_GATTServerEnhancedAttributeReadIndication},
+	[0x45] = evtHandlerTbl_45,
 #endif  /* GATT_ENABLE */
 
 #if GATTDB_APP_ENABLE
-	{GATTDBConfirm_FSCI_ID, Load_GATTDBConfirm},
-	{GATTDBReadAttributeIndication_FSCI_ID, Load_GATTDBReadAttributeIndication},
-	{GATTDBFindServiceHandleIndication_FSCI_ID, Load_GATTDBFindServiceHandleIndication},
-	{GATTDBFindCharValueHandleInServiceIndication_FSCI_ID, Load_GATTDBFindCharValueHandleInServiceIndication},
-	{GATTDBFindCccdHandleForCharValueHandleIndication_FSCI_ID, Load_GATTDBFindCccdHandleForCharValueHandleIndication},
-	{GATTDBFindDescriptorHandleForCharValueHandleIndication_FSCI_ID, Load_GATTDBFindDescriptorHandleForCharValueHandleIndication},
-	{GATTDBDynamicAddPrimaryServiceDeclarationIndication_FSCI_ID, Load_GATTDBDynamicAddPrimaryServiceDeclarationIndication},
-	{GATTDBDynamicAddSecondaryServiceDeclarationIndication_FSCI_ID, Load_GATTDBDynamicAddSecondaryServiceDeclarationIndication},
-	{GATTDBDynamicAddIncludeDeclarationIndication_FSCI_ID, Load_GATTDBDynamicAddIncludeDeclarationIndication},
-	{GATTDBDynamicAddCharacteristicDeclarationAndValueIndication_FSCI_ID, Load_GATTDBDynamicAddCharacteristicDeclarationAndValueIndication},
-	{GATTDBDynamicAddCharacteristicDescriptorIndication_FSCI_ID, Load_GATTDBDynamicAddCharacteristicDescriptorIndication},
-	{GATTDBDynamicAddCccdIndication_FSCI_ID, Load_GATTDBDynamicAddCccdIndication},
-	{GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueIndication_FSCI_ID, Load_GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueIndication},
-	{GATTDBDynamicAddCharDescriptorWithUniqueValueIndication_FSCI_ID, Load_GATTDBDynamicAddCharDescriptorWithUniqueValueIndication},
+	[0x46] = evtHandlerTbl_46,
 #endif  /* GATTDB_APP_ENABLE */
 
 #if GATTDB_ATT_ENABLE
-	{GATTDBAttConfirm_FSCI_ID, Load_GATTDBAttConfirm},
-	{GATTDBAttFindInformationIndication_FSCI_ID, Load_GATTDBAttFindInformationIndication},
-	{GATTDBAttFindByTypeValueIndication_FSCI_ID, Load_GATTDBAttFindByTypeValueIndication},
-	{GATTDBAttReadByTypeIndication_FSCI_ID, Load_GATTDBAttReadByTypeIndication},
-	{GATTDBAttReadIndication_FSCI_ID, Load_GATTDBAttReadIndication},
-	{GATTDBAttReadBlobIndication_FSCI_ID, Load_GATTDBAttReadBlobIndication},
-	{GATTDBAttReadMultipleIndication_FSCI_ID, Load_GATTDBAttReadMultipleIndication},
-	{GATTDBAttReadByGroupTypeIndication_FSCI_ID, Load_GATTDBAttReadByGroupTypeIndication},
-	{GATTDBAttWriteIndication_FSCI_ID, Load_GATTDBAttWriteIndication},
-	{GATTDBAttPrepareWriteIndication_FSCI_ID, Load_GATTDBAttPrepareWriteIndication},
-	{GATTDBAttExecuteWriteIndication_FSCI_ID, Load_GATTDBAttExecuteWriteIndication},
-	{GATTDBAttExecuteWriteFromQueueIndication_FSCI_ID, Load_GATTDBAttExecuteWriteFromQueueIndication},
-	{GATTDBAttPrepareNotificationIndicationIndication_FSCI_ID, Load_GATTDBAttPrepareNotificationIndicationIndication},
+	[0x47] = evtHandlerTbl_47,
 #endif  /* GATTDB_ATT_ENABLE */
 
 #if GAP_ENABLE
-	{GAPConfirm_FSCI_ID, Load_GAPConfirm},
-	{GAPCheckNotificationStatusIndication_FSCI_ID, Load_GAPCheckNotificationStatusIndication},
-	{GAPCheckIndicationStatusIndication_FSCI_ID, Load_GAPCheckIndicationStatusIndication},
-	{GAPLoadKeysIndication_FSCI_ID, Load_GAPLoadKeysIndication},
-	{GAPLoadEncryptionInformationIndication_FSCI_ID, Load_GAPLoadEncryptionInformationIndication},
-	{GAPLoadCustomPeerInformationIndication_FSCI_ID, Load_GAPLoadCustomPeerInformationIndication},
-	{GAPCheckIfBondedIndication_FSCI_ID, Load_GAPCheckIfBondedIndication},
-	{GAPGetBondedDevicesCountIndication_FSCI_ID, Load_GAPGetBondedDevicesCountIndication},
-	{GAPGetBondedDeviceNameIndication_FSCI_ID, Load_GAPGetBondedDeviceNameIndication},
-	{GAPGenericEventInitializationCompleteIndication_FSCI_ID, Load_GAPGenericEventInitializationCompleteIndication},
-	{GAPGenericEventInternalErrorIndication_FSCI_ID, Load_GAPGenericEventInternalErrorIndication},
-	{GAPGenericEventAdvertisingSetupFailedIndication_FSCI_ID, Load_GAPGenericEventAdvertisingSetupFailedIndication},
-	{GAPGenericEventAdvertisingParametersSetupCompleteIndication_FSCI_ID, Load_GAPGenericEventAdvertisingParametersSetupCompleteIndication},
-	{GAPGenericEventAdvertisingDataSetupCompleteIndication_FSCI_ID, Load_GAPGenericEventAdvertisingDataSetupCompleteIndication},
-	{GAPGenericEventFilterAcceptListSizeReadIndication_FSCI_ID, Load_GAPGenericEventFilterAcceptListSizeReadIndication},
-	{GAPGenericEventDeviceAddedToFilterAcceptListIndication_FSCI_ID, Load_GAPGenericEventDeviceAddedToFilterAcceptListIndication},
-	{GAPGenericEventDeviceRemovedFromFilterAcceptListIndication_FSCI_ID, Load_GAPGenericEventDeviceRemovedFromFilterAcceptListIndication},
-	{GAPGenericEventFilterAcceptListClearedIndication_FSCI_ID, Load_GAPGenericEventFilterAcceptListClearedIndication},
-	{GAPGenericEventRandomAddressReadyIndication_FSCI_ID, Load_GAPGenericEventRandomAddressReadyIndication},
-	{GAPGenericEventCreateConnectionCanceledIndication_FSCI_ID, Load_GAPGenericEventCreateConnectionCanceledIndication},
-	{GAPGenericEventPublicAddressReadIndication_FSCI_ID, Load_GAPGenericEventPublicAddressReadIndication},
-	{GAPGenericEventAdvTxPowerLevelReadIndication_FSCI_ID, Load_GAPGenericEventAdvTxPowerLevelReadIndication},
-	{GAPGenericEventPrivateResolvableAddressVerifiedIndication_FSCI_ID, Load_GAPGenericEventPrivateResolvableAddressVerifiedIndication},
-	{GAPGenericEventRandomAddressSetIndication_FSCI_ID, Load_GAPGenericEventRandomAddressSetIndication},
-	{GAPAdvertisingEventStateChangedIndication_FSCI_ID, Load_GAPAdvertisingEventStateChangedIndication},
-	{GAPAdvertisingEventCommandFailedIndication_FSCI_ID, Load_GAPAdvertisingEventCommandFailedIndication},
-	{GAPScanningEventStateChangedIndication_FSCI_ID, Load_GAPScanningEventStateChangedIndication},
-	{GAPScanningEventCommandFailedIndication_FSCI_ID, Load_GAPScanningEventCommandFailedIndication},
-	{GAPScanningEventDeviceScannedIndication_FSCI_ID, Load_GAPScanningEventDeviceScannedIndication},
-	{GAPConnectionEventConnectedIndication_FSCI_ID, Load_GAPConnectionEventConnectedIndication},
-	{GAPConnectionEventPairingRequestIndication_FSCI_ID, Load_GAPConnectionEventPairingRequestIndication},
-	{GAPConnectionEventPeripheralSecurityRequestIndication_FSCI_ID, Load_GAPConnectionEventPeripheralSecurityRequestIndication},
-	{GAPConnectionEventPairingResponseIndication_FSCI_ID, Load_GAPConnectionEventPairingResponseIndication},
-	{GAPConnectionEventAuthenticationRejectedIndication_FSCI_ID, Load_GAPConnectionEventAuthenticationRejectedIndication},
-	{GAPConnectionEventPasskeyRequestIndication_FSCI_ID, Load_GAPConnectionEventPasskeyRequestIndication},
-	{GAPConnectionEventOobRequestIndication_FSCI_ID, Load_GAPConnectionEventOobRequestIndication},
-	{GAPConnectionEventPasskeyDisplayIndication_FSCI_ID, Load_GAPConnectionEventPasskeyDisplayIndication},
-	{GAPConnectionEventKeyExchangeRequestIndication_FSCI_ID, Load_GAPConnectionEventKeyExchangeRequestIndication},
-	{GAPConnectionEventKeysReceivedIndication_FSCI_ID, Load_GAPConnectionEventKeysReceivedIndication},
-	{GAPConnectionEventLongTermKeyRequestIndication_FSCI_ID, Load_GAPConnectionEventLongTermKeyRequestIndication},
-	{GAPConnectionEventEncryptionChangedIndication_FSCI_ID, Load_GAPConnectionEventEncryptionChangedIndication},
-	{GAPConnectionEventPairingCompleteIndication_FSCI_ID, Load_GAPConnectionEventPairingCompleteIndication},
-	{GAPConnectionEventDisconnectedIndication_FSCI_ID, Load_GAPConnectionEventDisconnectedIndication},
-	{GAPConnectionEventRssiReadIndication_FSCI_ID, Load_GAPConnectionEventRssiReadIndication},
-	{GAPConnectionEventTxPowerLevelReadIndication_FSCI_ID, Load_GAPConnectionEventTxPowerLevelReadIndication},
-	{GAPConnectionEventPowerReadFailureIndication_FSCI_ID, Load_GAPConnectionEventPowerReadFailureIndication},
-	{GAPConnectionEventParameterUpdateRequestIndication_FSCI_ID, Load_GAPConnectionEventParameterUpdateRequestIndication},
-	{GAPConnectionEventParameterUpdateCompleteIndication_FSCI_ID, Load_GAPConnectionEventParameterUpdateCompleteIndication},
-	{GAPConnectionEventLeDataLengthChangedIndication_FSCI_ID, Load_GAPConnectionEventLeDataLengthChangedIndication},
-	{GAPConnectionEventLeScOobDataRequestIndication_FSCI_ID, Load_GAPConnectionEventLeScOobDataRequestIndication},
-	{GAPConnectionEventLeScDisplayNumericValueIndication_FSCI_ID, Load_GAPConnectionEventLeScDisplayNumericValueIndication},
-	{GAPConnectionEventLeScKeypressNotificationIndication_FSCI_ID, Load_GAPConnectionEventLeScKeypressNotificationIndication},
-	{GAPLeScPublicKeyRegeneratedIndication_FSCI_ID, Load_GAPLeScPublicKeyRegeneratedIndication},
-	{GAPGenericEventLeScLocalOobDataIndication_FSCI_ID, Load_GAPGenericEventLeScLocalOobDataIndication},
-	{GAPGenericEventHostPrivacyStateChangedIndication_FSCI_ID, Load_GAPGenericEventHostPrivacyStateChangedIndication},
-	{GAPGenericEventControllerPrivacyStateChangedIndication_FSCI_ID, Load_GAPGenericEventControllerPrivacyStateChangedIndication},
-	{GAPGenericEventTxPowerLevelSetCompleteIndication_FSCI_ID, Load_GAPGenericEventTxPowerLevelSetCompleteIndication},
-	{GAPGenericEventLePhyEventIndication_FSCI_ID, Load_GAPGenericEventLePhyEventIndication},
-	{GAPGetBondedDevicesIdentityInformationIndication_FSCI_ID, Load_GAPGetBondedDevicesIdentityInformationIndication},
-	{GAPControllerNotificationIndication_FSCI_ID, Load_GAPControllerNotificationIndication},
-	{GAPBondCreatedIndication_FSCI_ID, Load_GAPBondCreatedIndication},
-	{GAPGenericEventChannelMapSetIndication_FSCI_ID, Load_GAPGenericEventChannelMapSetIndication},
-	{GAPConnectionEventChannelMapReadIndication_FSCI_ID, Load_GAPConnectionEventChannelMapReadIndication},
-	{GAPConnectionEventChannelMapReadFailureIndication_FSCI_ID, Load_GAPConnectionEventChannelMapReadFailureIndication},
-	{GAPGenericEventExtAdvertisingParamSetupCompleteIndication_FSCI_ID, Load_GAPGenericEventExtAdvertisingParamSetupCompleteIndication},
-	{GAPGenericEventExtAdvertisingDataSetupCompleteIndication_FSCI_ID, Load_GAPGenericEventExtAdvertisingDataSetupCompleteIndication},
-	{GAPGenericEventPeriodicAdvParamSetupCompleteIndication_FSCI_ID, Load_GAPGenericEventPeriodicAdvParamSetupCompleteIndication},
-	{GAPGenericEventPeriodicAdvDataSetupCompleteIndication_FSCI_ID, Load_GAPGenericEventPeriodicAdvDataSetupCompleteIndication},
-	{GAPGenericEventPeriodicAdvListUpdateCompleteIndication_FSCI_ID, Load_GAPGenericEventPeriodicAdvListUpdateCompleteIndication},
-	{GAPAdvertisingEventExtAdvertisingStateChangedIndication_FSCI_ID, Load_GAPAdvertisingEventExtAdvertisingStateChangedIndication},
-	{GAPAdvertisingEventAdvertisingSetTerminatedIndication_FSCI_ID, Load_GAPAdvertisingEventAdvertisingSetTerminatedIndication},
-	{GAPAdvertisingEventExtAdvertisingSetRemoveCompletedIndication_FSCI_ID, Load_GAPAdvertisingEventExtAdvertisingSetRemoveCompletedIndication},
-	{GAPAdvertisingEventExtScanReqReceivedIndication_FSCI_ID, Load_GAPAdvertisingEventExtScanReqReceivedIndication},
-	{GAPGenericEventPeriodicAdvertisingStateChangedIndication_FSCI_ID, Load_GAPGenericEventPeriodicAdvertisingStateChangedIndication},
-	{GAPScanningEventExtDeviceScannedIndication_FSCI_ID, Load_GAPScanningEventExtDeviceScannedIndication},
-	{GAPScanningEventPeriodicAdvSyncEstablishedIndication_FSCI_ID, Load_GAPScanningEventPeriodicAdvSyncEstablishedIndication},
-	{GAPScanningEventPeriodicAdvSyncTerminatedIndication_FSCI_ID, Load_GAPScanningEventPeriodicAdvSyncTerminatedIndication},
-	{GAPScanningEventPeriodicAdvSyncLostIndication_FSCI_ID, Load_GAPScanningEventPeriodicAdvSyncLostIndication},
-	{GAPScanningEventPeriodicDeviceScannedIndication_FSCI_ID, Load_GAPScanningEventPeriodicDeviceScannedIndication},
-	{GAPGenericEventPeriodicAdvCreateSyncCancelledIndication_FSCI_ID, Load_GAPGenericEventPeriodicAdvCreateSyncCancelledIndication},
-	{GAPConnectionEventChannelSelectionAlgorithm2Indication_FSCI_ID, Load_GAPConnectionEventChannelSelectionAlgorithm2Indication},
-	{GAPGenericEventTxEntryAvailableIndication_FSCI_ID, Load_GAPGenericEventTxEntryAvailableIndication},
-	{GAPGenericEventControllerLocalRPAReadIndication_FSCI_ID, Load_GAPGenericEventControllerLocalRPAReadIndication},
-	{GAPCheckNvmIndexIndication_FSCI_ID, Load_GAPCheckNvmIndexIndication},
-	{GAPGetDeviceIdFromConnHandleIndication_FSCI_ID, Load_GAPGetDeviceIdFromConnHandleIndication},
-	{GAPGetConnectionHandleFromDeviceIdIndication_FSCI_ID, Load_GAPGetConnectionHandleFromDeviceIdIndication},
-	{GAPPairingEventNoLTKIndication_FSCI_ID, Load_GAPPairingEventNoLTKIndication},
-	{GAPPairingAlreadyStartedIndication_FSCI_ID, Load_GAPPairingAlreadyStartedIndication},
-	{GAPGenericEventConnectionlessCteTransmitParamsSetupCompleteIndication_FSCI_ID, Load_GAPGenericEventConnectionlessCteTransmitParamsSetupCompleteIndication},
-	{GAPGenericEventConnectionlessCteTransmitStateChangedIndication_FSCI_ID, Load_GAPGenericEventConnectionlessCteTransmitStateChangedIndication},
-	{GAPGenericEventConnectionlessIqSamplingStateChangedIndication_FSCI_ID, Load_GAPGenericEventConnectionlessIqSamplingStateChangedIndication},
-	{GAPGenericEventAntennaInformationReadIndication_FSCI_ID, Load_GAPGenericEventAntennaInformationReadIndication},
-	{GAPScanningEventConnectionlessIqReportReceivedIndication_FSCI_ID, Load_GAPScanningEventConnectionlessIqReportReceivedIndication},
-	{GAPConnectionEventIqReportReceivedIndication_FSCI_ID, Load_GAPConnectionEventIqReportReceivedIndication},
-	{GAPConnectionEventCteRequestFailedIndication_FSCI_ID, Load_GAPConnectionEventCteRequestFailedIndication},
-	{GAPConnectionEventCteReceiveParamsSetupCompleteIndication_FSCI_ID, Load_GAPConnectionEventCteReceiveParamsSetupCompleteIndication},
-	{GAPConnectionEventCteTransmitParamsSetupCompleteIndication_FSCI_ID, Load_GAPConnectionEventCteTransmitParamsSetupCompleteIndication},
-	{GAPConnectionEventCteReqStateChangedIndication_FSCI_ID, Load_GAPConnectionEventCteReqStateChangedIndication},
-	{GAPConnectionEventCteRspStateChangedIndication_FSCI_ID, Load_GAPConnectionEventCteRspStateChangedIndication},
-	{GAPGenericEventPeriodicAdvRecvEnableCompleteIndication_FSCI_ID, Load_GAPGenericEventPeriodicAdvRecvEnableCompleteIndication},
-	{GAPGenericEventPeriodicAdvSyncTransferCompleteIndication_FSCI_ID, Load_GAPGenericEventPeriodicAdvSyncTransferCompleteIndication},
-	{GAPGenericEventPeriodicAdvSetInfoTransferCompleteIndication_FSCI_ID, Load_GAPGenericEventPeriodicAdvSetInfoTransferCompleteIndication},
-	{GAPGenericEventSetPeriodicAdvSyncTransferParamsCompleteIndication_FSCI_ID, Load_GAPGenericEventSetPeriodicAdvSyncTransferParamsCompleteIndication},
-	{GAPGenericEventSetDefaultPeriodicAdvSyncTransferParamsCompleteIndication_FSCI_ID, Load_GAPGenericEventSetDefaultPeriodicAdvSyncTransferParamsCompleteIndication},
-	{GAPScanningEventPeriodicAdvSyncTransferReceivedIndication_FSCI_ID, Load_GAPScanningEventPeriodicAdvSyncTransferReceivedIndication},
-	{GAPConnectionEventPathLossThresholdIndication_FSCI_ID, Load_GAPConnectionEventPathLossThresholdIndication},
-	{GAPConnectionEventTransmitPowerReportingIndication_FSCI_ID, Load_GAPConnectionEventTransmitPowerReportingIndication},
-	{GAPConnectionEventEnhancedReadTransmitPowerLevelIndication_FSCI_ID, Load_GAPConnectionEventEnhancedReadTransmitPowerLevelIndication},
-	{GAPConnectionEventPathLossReportingParamsSetupCompleteIndication_FSCI_ID, Load_GAPConnectionEventPathLossReportingParamsSetupCompleteIndication},
-	{GAPConnectionEventPathLossReportingStateChangedIndication_FSCI_ID, Load_GAPConnectionEventPathLossReportingStateChangedIndication},
-	{GAPConnectionEventTransmitPowerReportingStateChangedIndication_FSCI_ID, Load_GAPConnectionEventTransmitPowerReportingStateChangedIndication},
-	{GAPConnectionEventEattConnectionRequestIndication_FSCI_ID, Load_GAPConnectionEventEattConnectionRequestIndication},
-	{GAPConnectionEventEattConnectionCompleteIndication_FSCI_ID, Load_GAPConnectionEventEattConnectionCompleteIndication},
-	{GAPConnectionEventEattReconfigureResponseIndication_FSCI_ID, Load_GAPConnectionEventEattReconfigureResponseIndication},
-	{GAPConnectionEventEattBearerStatusNotificationIndication_FSCI_ID, Load_GAPConnectionEventEattBearerStatusNotificationIndication},
-	{GAPGenericEventLeGenerateDhKeyCompleteIndication_FSCI_ID, Load_GAPGenericEventLeGenerateDhKeyCompleteIndication},
-	{GAPGetHostVersionIndication_FSCI_ID, Load_GAPGetHostVersionIndication},
+	[0x48] = evtHandlerTbl_48,
 #endif  /* GAP_ENABLE */
 };
 
@@ -770,7 +849,7 @@ static memStatus_t Load_L2CAPCBLeCbDataIndication(bleEvtContainer_t *container,
 
 	if (evt->PacketLength > 0)
 	{
-		evt->Packet = MEM_BufferAlloc(evt->PacketLength);
+		evt->Packet = BLE_EvtBufferAlloc(container, evt->PacketLength);
 
 		if (!evt->Packet)
 		{
@@ -856,7 +935,7 @@ static memStatus_t Load_L2CAPCBLePsmEnhancedConnectRequestIndication(bleEvtConta
 
 		if (evt->EnhancedConnRequest.NoOfChannels > 0)
 		{
-			evt->EnhancedConnRequest.aCids = MEM_BufferAlloc(evt->EnhancedConnRequest.NoOfChannels * 2);
+			evt->EnhancedConnRequest.aCids = BLE_EvtBufferAlloc(container, evt->EnhancedConnRequest.NoOfChannels * 2);
 
 			if (!evt->EnhancedConnRequest.aCids)
 			{
@@ -902,7 +981,7 @@ static memStatus_t Load_L2CAPCBLePsmEnhancedConnectionCompleteIndication(bleEvtC
 
 		if (evt->EnhancedConnComplete.NoOfChannels > 0)
 		{
-			evt->EnhancedConnComplete.aCids = MEM_BufferAlloc(evt->EnhancedConnComplete.NoOfChannels * 2);
+			evt->EnhancedConnComplete.aCids = BLE_EvtBufferAlloc(container, evt->EnhancedConnComplete.NoOfChannels * 2);
 
 			if (!evt->EnhancedConnComplete.aCids)
 			{
@@ -947,7 +1026,7 @@ static memStatus_t Load_L2CAPCBEnhancedReconfigureRequestIndication(bleEvtContai
 
 		if (evt->EnhancedReconfigureRequest.NoOfChannels > 0)
 		{
-			evt->EnhancedReconfigureRequest.aCids = MEM_BufferAlloc(evt->EnhancedReconfigureRequest.NoOfChannels * 2);
+			evt->EnhancedReconfigureRequest.aCids = BLE_EvtBufferAlloc(container, evt->EnhancedReconfigureRequest.NoOfChannels * 2);
 
 			if (!evt->EnhancedReconfigureRequest.aCids)
 			{
@@ -992,6 +1071,29 @@ static memStatus_t Load_L2CAPCBEnhancedReconfigureResponseIndication(bleEvtConta
 	return MEM_SUCCESS_c;
 }
 
+/*!*************************************************************************************************
+\fn		static memStatus_t Load_L2CAPCBLeCbDataBatchCompleteIndication(bleEvtContainer_t *container, uint8_t *pPayload)
+\brief	Credit Based - SDU batch sent or dropped event
+***************************************************************************************************/
+static memStatus_t Load_L2CAPCBLeCbDataBatchCompleteIndication(bleEvtContainer_t *container, uint8_t *pPayload)
+{
+	L2CAPCBLeCbDataBatchCompleteIndication_t *evt = &(container->Data.L2CAPCBLeCbDataBatchCompleteIndication);
+
+	uint32_t idx = 0;
+
+	/* Store (OG, OC) in ID */
+	container->id = L2CAPCBLeCbDataBatchCompleteIndication_FSCI_ID;
+
+	evt->DeviceId = pPayload[idx]; idx++;
+	FLib_MemCpy(&(evt->ChannelId), pPayload + idx, sizeof(evt->ChannelId)); idx += sizeof(evt->ChannelId);
+	evt->Status = (L2CAPCBConfirm_Status_t)0;
+	FLib_MemCpy(&(evt->Status), pPayload + idx, 2); idx += 2;
+	evt->SdusSent = pPayload[idx]; idx++;
+	FLib_MemCpy(&(evt->SdusQueued), pPayload + idx, sizeof(evt->SdusQueued)); idx += sizeof(evt->SdusQueued);
+
+	return MEM_SUCCESS_c;
+}
+
 #endif  /* L2CAPCB_ENABLE */
 
 #if GATT_ENABLE
@@ -1063,7 +1165,7 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllPrimaryServicesIndication(
 
 	if (evt->NbOfDiscoveredServices > 0)
 	{
-		evt->DiscoveredServices = MEM_BufferAlloc(evt->NbOfDiscoveredServices * sizeof(evt->DiscoveredServices[0]));
+		evt->DiscoveredServices = BLE_EvtBufferAlloc(container, evt->NbOfDiscoveredServices * sizeof(evt->DiscoveredServices[0]));
 
 		if (!evt->DiscoveredServices)
 		{
@@ -1101,11 +1203,11 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllPrimaryServicesIndication(
 
 		if (evt->DiscoveredServices[i].NbOfCharacteristics > 0)
 		{
-			evt->DiscoveredServices[i].Characteristics = MEM_BufferAlloc(evt->DiscoveredServices[i].NbOfCharacteristics * sizeof(evt->DiscoveredServices[i].Characteristics[0]));
+			evt->DiscoveredServices[i].Characteristics = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].NbOfCharacteristics * sizeof(evt->DiscoveredServices[i].Characteristics[0]));
 
 			if (!evt->DiscoveredServices[i].Characteristics)
 			{
-				MEM_BufferFree(evt->DiscoveredServices);
+				BLE_EvtBufferFree(container, evt->DiscoveredServices);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -1141,15 +1243,15 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllPrimaryServicesIndication(
 
 			if (evt->DiscoveredServices[i].Characteristics[j].Value.ValueLength > 0)
 			{
-				evt->DiscoveredServices[i].Characteristics[j].Value.Value = MEM_BufferAlloc(evt->DiscoveredServices[i].Characteristics[j].Value.ValueLength);
+				evt->DiscoveredServices[i].Characteristics[j].Value.Value = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].Characteristics[j].Value.ValueLength);
 
 				if (!evt->DiscoveredServices[i].Characteristics[j].Value.Value)
 				{
 					for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 					}
-					MEM_BufferFree(evt->DiscoveredServices);
+					BLE_EvtBufferFree(container, evt->DiscoveredServices);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -1164,7 +1266,7 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllPrimaryServicesIndication(
 
 			if (evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors > 0)
 			{
-				evt->DiscoveredServices[i].Characteristics[j].Descriptors = MEM_BufferAlloc(evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors * sizeof(evt->DiscoveredServices[i].Characteristics[j].Descriptors[0]));
+				evt->DiscoveredServices[i].Characteristics[j].Descriptors = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors * sizeof(evt->DiscoveredServices[i].Characteristics[j].Descriptors[0]));
 
 				if (!evt->DiscoveredServices[i].Characteristics[j].Descriptors)
 				{
@@ -1172,14 +1274,14 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllPrimaryServicesIndication(
 					{
 						for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 						{
-							MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Value.Value);
+							BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Value.Value);
 						}
 					}
 					for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 					}
-					MEM_BufferFree(evt->DiscoveredServices);
+					BLE_EvtBufferFree(container, evt->DiscoveredServices);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -1214,7 +1316,7 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllPrimaryServicesIndication(
 
 				if (evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].ValueLength > 0)
 				{
-					evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value = MEM_BufferAlloc(evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].ValueLength);
+					evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].ValueLength);
 
 					if (!evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value)
 					{
@@ -1222,21 +1324,21 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllPrimaryServicesIndication(
 						{
 							for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 							{
-								MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Descriptors);
+								BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors);
 							}
 						}
 						for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 						{
 							for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 							{
-								MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Value.Value);
+								BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Value.Value);
 							}
 						}
 						for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 						{
-							MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+							BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 						}
-						MEM_BufferFree(evt->DiscoveredServices);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices);
 						return MEM_ALLOC_ERROR_c;
 					}
 
@@ -1253,7 +1355,7 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllPrimaryServicesIndication(
 
 		if (evt->DiscoveredServices[i].NbOfIncludedServices > 0)
 		{
-			evt->DiscoveredServices[i].IncludedServices = MEM_BufferAlloc(evt->DiscoveredServices[i].NbOfIncludedServices * sizeof(evt->DiscoveredServices[i].IncludedServices[0]));
+			evt->DiscoveredServices[i].IncludedServices = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].NbOfIncludedServices * sizeof(evt->DiscoveredServices[i].IncludedServices[0]));
 
 			if (!evt->DiscoveredServices[i].IncludedServices)
 			{
@@ -1263,7 +1365,7 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllPrimaryServicesIndication(
 					{
 						for (uint32_t k = 0; k < evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors; k++)
 						{
-							MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value);
+							BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value);
 						}
 					}
 				}
@@ -1271,21 +1373,21 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllPrimaryServicesIndication(
 				{
 					for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Descriptors);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors);
 					}
 				}
 				for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 				{
 					for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Value.Value);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Value.Value);
 					}
 				}
 				for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 				{
-					MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+					BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 				}
-				MEM_BufferFree(evt->DiscoveredServices);
+				BLE_EvtBufferFree(container, evt->DiscoveredServices);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -1344,7 +1446,7 @@ static memStatus_t Load_GATTClientProcedureDiscoverPrimaryServicesByUuidIndicati
 
 	if (evt->NbOfDiscoveredServices > 0)
 	{
-		evt->DiscoveredServices = MEM_BufferAlloc(evt->NbOfDiscoveredServices * sizeof(evt->DiscoveredServices[0]));
+		evt->DiscoveredServices = BLE_EvtBufferAlloc(container, evt->NbOfDiscoveredServices * sizeof(evt->DiscoveredServices[0]));
 
 		if (!evt->DiscoveredServices)
 		{
@@ -1382,11 +1484,11 @@ static memStatus_t Load_GATTClientProcedureDiscoverPrimaryServicesByUuidIndicati
 
 		if (evt->DiscoveredServices[i].NbOfCharacteristics > 0)
 		{
-			evt->DiscoveredServices[i].Characteristics = MEM_BufferAlloc(evt->DiscoveredServices[i].NbOfCharacteristics * sizeof(evt->DiscoveredServices[i].Characteristics[0]));
+			evt->DiscoveredServices[i].Characteristics = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].NbOfCharacteristics * sizeof(evt->DiscoveredServices[i].Characteristics[0]));
 
 			if (!evt->DiscoveredServices[i].Characteristics)
 			{
-				MEM_BufferFree(evt->DiscoveredServices);
+				BLE_EvtBufferFree(container, evt->DiscoveredServices);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -1422,15 +1524,15 @@ static memStatus_t Load_GATTClientProcedureDiscoverPrimaryServicesByUuidIndicati
 
 			if (evt->DiscoveredServices[i].Characteristics[j].Value.ValueLength > 0)
 			{
-				evt->DiscoveredServices[i].Characteristics[j].Value.Value = MEM_BufferAlloc(evt->DiscoveredServices[i].Characteristics[j].Value.ValueLength);
+				evt->DiscoveredServices[i].Characteristics[j].Value.Value = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].Characteristics[j].Value.ValueLength);
 
 				if (!evt->DiscoveredServices[i].Characteristics[j].Value.Value)
 				{
 					for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 					}
-					MEM_BufferFree(evt->DiscoveredServices);
+					BLE_EvtBufferFree(container, evt->DiscoveredServices);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -1445,7 +1547,7 @@ static memStatus_t Load_GATTClientProcedureDiscoverPrimaryServicesByUuidIndicati
 
 			if (evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors > 0)
 			{
-				evt->DiscoveredServices[i].Characteristics[j].Descriptors = MEM_BufferAlloc(evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors * sizeof(evt->DiscoveredServices[i].Characteristics[j].Descriptors[0]));
+				evt->DiscoveredServices[i].Characteristics[j].Descriptors = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors * sizeof(evt->DiscoveredServices[i].Characteristics[j].Descriptors[0]));
 
 				if (!evt->DiscoveredServices[i].Characteristics[j].Descriptors)
 				{
@@ -1453,14 +1555,14 @@ static memStatus_t Load_GATTClientProcedureDiscoverPrimaryServicesByUuidIndicati
 					{
 						for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 						{
-							MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Value.Value);
+							BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Value.Value);
 						}
 					}
 					for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 					}
-					MEM_BufferFree(evt->DiscoveredServices);
+					BLE_EvtBufferFree(container, evt->DiscoveredServices);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -1495,7 +1597,7 @@ static memStatus_t Load_GATTClientProcedureDiscoverPrimaryServicesByUuidIndicati
 
 				if (evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].ValueLength > 0)
 				{
-					evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value = MEM_BufferAlloc(evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].ValueLength);
+					evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].ValueLength);
 
 					if (!evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value)
 					{
@@ -1503,21 +1605,21 @@ static memStatus_t Load_GATTClientProcedureDiscoverPrimaryServicesByUuidIndicati
 						{
 							for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 							{
-								MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Descriptors);
+								BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors);
 							}
 						}
 						for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 						{
 							for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 							{
-								MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Value.Value);
+								BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Value.Value);
 							}
 						}
 						for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 						{
-							MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+							BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 						}
-						MEM_BufferFree(evt->DiscoveredServices);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices);
 						return MEM_ALLOC_ERROR_c;
 					}
 
@@ -1534,7 +1636,7 @@ static memStatus_t Load_GATTClientProcedureDiscoverPrimaryServicesByUuidIndicati
 
 		if (evt->DiscoveredServices[i].NbOfIncludedServices > 0)
 		{
-			evt->DiscoveredServices[i].IncludedServices = MEM_BufferAlloc(evt->DiscoveredServices[i].NbOfIncludedServices * sizeof(evt->DiscoveredServices[i].IncludedServices[0]));
+			evt->DiscoveredServices[i].IncludedServices = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].NbOfIncludedServices * sizeof(evt->DiscoveredServices[i].IncludedServices[0]));
 
 			if (!evt->DiscoveredServices[i].IncludedServices)
 			{
@@ -1544,7 +1646,7 @@ static memStatus_t Load_GATTClientProcedureDiscoverPrimaryServicesByUuidIndicati
 					{
 						for (uint32_t k = 0; k < evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors; k++)
 						{
-							MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value);
+							BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value);
 						}
 					}
 				}
@@ -1552,21 +1654,21 @@ static memStatus_t Load_GATTClientProcedureDiscoverPrimaryServicesByUuidIndicati
 				{
 					for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Descriptors);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors);
 					}
 				}
 				for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 				{
 					for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Value.Value);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Value.Value);
 					}
 				}
 				for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 				{
-					MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+					BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 				}
-				MEM_BufferFree(evt->DiscoveredServices);
+				BLE_EvtBufferFree(container, evt->DiscoveredServices);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -1643,7 +1745,7 @@ static memStatus_t Load_GATTClientProcedureFindIncludedServicesIndication(bleEvt
 
 	if (evt->Service.NbOfCharacteristics > 0)
 	{
-		evt->Service.Characteristics = MEM_BufferAlloc(evt->Service.NbOfCharacteristics * sizeof(evt->Service.Characteristics[0]));
+		evt->Service.Characteristics = BLE_EvtBufferAlloc(container, evt->Service.NbOfCharacteristics * sizeof(evt->Service.Characteristics[0]));
 
 		if (!evt->Service.Characteristics)
 		{
@@ -1682,11 +1784,11 @@ static memStatus_t Load_GATTClientProcedureFindIncludedServicesIndication(bleEvt
 
 		if (evt->Service.Characteristics[i].Value.ValueLength > 0)
 		{
-			evt->Service.Characteristics[i].Value.Value = MEM_BufferAlloc(evt->Service.Characteristics[i].Value.ValueLength);
+			evt->Service.Characteristics[i].Value.Value = BLE_EvtBufferAlloc(container, evt->Service.Characteristics[i].Value.ValueLength);
 
 			if (!evt->Service.Characteristics[i].Value.Value)
 			{
-				MEM_BufferFree(evt->Service.Characteristics);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -1701,15 +1803,15 @@ static memStatus_t Load_GATTClientProcedureFindIncludedServicesIndication(bleEvt
 
 		if (evt->Service.Characteristics[i].NbOfDescriptors > 0)
 		{
-			evt->Service.Characteristics[i].Descriptors = MEM_BufferAlloc(evt->Service.Characteristics[i].NbOfDescriptors * sizeof(evt->Service.Characteristics[i].Descriptors[0]));
+			evt->Service.Characteristics[i].Descriptors = BLE_EvtBufferAlloc(container, evt->Service.Characteristics[i].NbOfDescriptors * sizeof(evt->Service.Characteristics[i].Descriptors[0]));
 
 			if (!evt->Service.Characteristics[i].Descriptors)
 			{
 				for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 				{
-					MEM_BufferFree(evt->Service.Characteristics[i].Value.Value);
+					BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Value.Value);
 				}
-				MEM_BufferFree(evt->Service.Characteristics);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -1744,19 +1846,19 @@ static memStatus_t Load_GATTClientProcedureFindIncludedServicesIndication(bleEvt
 
 			if (evt->Service.Characteristics[i].Descriptors[j].ValueLength > 0)
 			{
-				evt->Service.Characteristics[i].Descriptors[j].Value = MEM_BufferAlloc(evt->Service.Characteristics[i].Descriptors[j].ValueLength);
+				evt->Service.Characteristics[i].Descriptors[j].Value = BLE_EvtBufferAlloc(container, evt->Service.Characteristics[i].Descriptors[j].ValueLength);
 
 				if (!evt->Service.Characteristics[i].Descriptors[j].Value)
 				{
 					for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Service.Characteristics[i].Descriptors);
+						BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Descriptors);
 					}
 					for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Service.Characteristics[i].Value.Value);
+						BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Value.Value);
 					}
-					MEM_BufferFree(evt->Service.Characteristics);
+					BLE_EvtBufferFree(container, evt->Service.Characteristics);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -1773,7 +1875,7 @@ static memStatus_t Load_GATTClientProcedureFindIncludedServicesIndication(bleEvt
 
 	if (evt->Service.NbOfIncludedServices > 0)
 	{
-		evt->Service.IncludedServices = MEM_BufferAlloc(evt->Service.NbOfIncludedServices * sizeof(evt->Service.IncludedServices[0]));
+		evt->Service.IncludedServices = BLE_EvtBufferAlloc(container, evt->Service.NbOfIncludedServices * sizeof(evt->Service.IncludedServices[0]));
 
 		if (!evt->Service.IncludedServices)
 		{
@@ -1781,18 +1883,18 @@ static memStatus_t Load_GATTClientProcedureFindIncludedServicesIndication(bleEvt
 			{
 				for (uint32_t j = 0; j < evt->Service.Characteristics[i].NbOfDescriptors; j++)
 				{
-					MEM_BufferFree(evt->Service.Characteristics[i].Descriptors[j].Value);
+					BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Descriptors[j].Value);
 				}
 			}
 			for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 			{
-				MEM_BufferFree(evt->Service.Characteristics[i].Descriptors);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Descriptors);
 			}
 			for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 			{
-				MEM_BufferFree(evt->Service.Characteristics[i].Value.Value);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Value.Value);
 			}
-			MEM_BufferFree(evt->Service.Characteristics);
+			BLE_EvtBufferFree(container, evt->Service.Characteristics);
 			return MEM_ALLOC_ERROR_c;
 		}
 
@@ -1868,7 +1970,7 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllCharacteristicsIndication(
 
 	if (evt->Service.NbOfCharacteristics > 0)
 	{
-		evt->Service.Characteristics = MEM_BufferAlloc(evt->Service.NbOfCharacteristics * sizeof(evt->Service.Characteristics[0]));
+		evt->Service.Characteristics = BLE_EvtBufferAlloc(container, evt->Service.NbOfCharacteristics * sizeof(evt->Service.Characteristics[0]));
 
 		if (!evt->Service.Characteristics)
 		{
@@ -1907,11 +2009,11 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllCharacteristicsIndication(
 
 		if (evt->Service.Characteristics[i].Value.ValueLength > 0)
 		{
-			evt->Service.Characteristics[i].Value.Value = MEM_BufferAlloc(evt->Service.Characteristics[i].Value.ValueLength);
+			evt->Service.Characteristics[i].Value.Value = BLE_EvtBufferAlloc(container, evt->Service.Characteristics[i].Value.ValueLength);
 
 			if (!evt->Service.Characteristics[i].Value.Value)
 			{
-				MEM_BufferFree(evt->Service.Characteristics);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -1926,15 +2028,15 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllCharacteristicsIndication(
 
 		if (evt->Service.Characteristics[i].NbOfDescriptors > 0)
 		{
-			evt->Service.Characteristics[i].Descriptors = MEM_BufferAlloc(evt->Service.Characteristics[i].NbOfDescriptors * sizeof(evt->Service.Characteristics[i].Descriptors[0]));
+			evt->Service.Characteristics[i].Descriptors = BLE_EvtBufferAlloc(container, evt->Service.Characteristics[i].NbOfDescriptors * sizeof(evt->Service.Characteristics[i].Descriptors[0]));
 
 			if (!evt->Service.Characteristics[i].Descriptors)
 			{
 				for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 				{
-					MEM_BufferFree(evt->Service.Characteristics[i].Value.Value);
+					BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Value.Value);
 				}
-				MEM_BufferFree(evt->Service.Characteristics);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -1969,19 +2071,19 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllCharacteristicsIndication(
 
 			if (evt->Service.Characteristics[i].Descriptors[j].ValueLength > 0)
 			{
-				evt->Service.Characteristics[i].Descriptors[j].Value = MEM_BufferAlloc(evt->Service.Characteristics[i].Descriptors[j].ValueLength);
+				evt->Service.Characteristics[i].Descriptors[j].Value = BLE_EvtBufferAlloc(container, evt->Service.Characteristics[i].Descriptors[j].ValueLength);
 
 				if (!evt->Service.Characteristics[i].Descriptors[j].Value)
 				{
 					for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Service.Characteristics[i].Descriptors);
+						BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Descriptors);
 					}
 					for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Service.Characteristics[i].Value.Value);
+						BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Value.Value);
 					}
-					MEM_BufferFree(evt->Service.Characteristics);
+					BLE_EvtBufferFree(container, evt->Service.Characteristics);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -1998,7 +2100,7 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllCharacteristicsIndication(
 
 	if (evt->Service.NbOfIncludedServices > 0)
 	{
-		evt->Service.IncludedServices = MEM_BufferAlloc(evt->Service.NbOfIncludedServices * sizeof(evt->Service.IncludedServices[0]));
+		evt->Service.IncludedServices = BLE_EvtBufferAlloc(container, evt->Service.NbOfIncludedServices * sizeof(evt->Service.IncludedServices[0]));
 
 		if (!evt->Service.IncludedServices)
 		{
@@ -2006,18 +2108,18 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllCharacteristicsIndication(
 			{
 				for (uint32_t j = 0; j < evt->Service.Characteristics[i].NbOfDescriptors; j++)
 				{
-					MEM_BufferFree(evt->Service.Characteristics[i].Descriptors[j].Value);
+					BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Descriptors[j].Value);
 				}
 			}
 			for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 			{
-				MEM_BufferFree(evt->Service.Characteristics[i].Descriptors);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Descriptors);
 			}
 			for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 			{
-				MEM_BufferFree(evt->Service.Characteristics[i].Value.Value);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Value.Value);
 			}
-			MEM_BufferFree(evt->Service.Characteristics);
+			BLE_EvtBufferFree(container, evt->Service.Characteristics);
 			return MEM_ALLOC_ERROR_c;
 		}
 
@@ -2075,7 +2177,7 @@ static memStatus_t Load_GATTClientProcedureDiscoverCharacteristicByUuidIndicatio
 
 	if (evt->NbOfCharacteristics > 0)
 	{
-		evt->Characteristics = MEM_BufferAlloc(evt->NbOfCharacteristics * sizeof(evt->Characteristics[0]));
+		evt->Characteristics = BLE_EvtBufferAlloc(container, evt->NbOfCharacteristics * sizeof(evt->Characteristics[0]));
 
 		if (!evt->Characteristics)
 		{
@@ -2114,11 +2216,11 @@ static memStatus_t Load_GATTClientProcedureDiscoverCharacteristicByUuidIndicatio
 
 		if (evt->Characteristics[i].Value.ValueLength > 0)
 		{
-			evt->Characteristics[i].Value.Value = MEM_BufferAlloc(evt->Characteristics[i].Value.ValueLength);
+			evt->Characteristics[i].Value.Value = BLE_EvtBufferAlloc(container, evt->Characteristics[i].Value.ValueLength);
 
 			if (!evt->Characteristics[i].Value.Value)
 			{
-				MEM_BufferFree(evt->Characteristics);
+				BLE_EvtBufferFree(container, evt->Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -2133,15 +2235,15 @@ static memStatus_t Load_GATTClientProcedureDiscoverCharacteristicByUuidIndicatio
 
 		if (evt->Characteristics[i].NbOfDescriptors > 0)
 		{
-			evt->Characteristics[i].Descriptors = MEM_BufferAlloc(evt->Characteristics[i].NbOfDescriptors * sizeof(evt->Characteristics[i].Descriptors[0]));
+			evt->Characteristics[i].Descriptors = BLE_EvtBufferAlloc(container, evt->Characteristics[i].NbOfDescriptors * sizeof(evt->Characteristics[i].Descriptors[0]));
 
 			if (!evt->Characteristics[i].Descriptors)
 			{
 				for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 				{
-					MEM_BufferFree(evt->Characteristics[i].Value.Value);
+					BLE_EvtBufferFree(container, evt->Characteristics[i].Value.Value);
 				}
-				MEM_BufferFree(evt->Characteristics);
+				BLE_EvtBufferFree(container, evt->Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -2176,19 +2278,19 @@ static memStatus_t Load_GATTClientProcedureDiscoverCharacteristicByUuidIndicatio
 
 			if (evt->Characteristics[i].Descriptors[j].ValueLength > 0)
 			{
-				evt->Characteristics[i].Descriptors[j].Value = MEM_BufferAlloc(evt->Characteristics[i].Descriptors[j].ValueLength);
+				evt->Characteristics[i].Descriptors[j].Value = BLE_EvtBufferAlloc(container, evt->Characteristics[i].Descriptors[j].ValueLength);
 
 				if (!evt->Characteristics[i].Descriptors[j].Value)
 				{
 					for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Characteristics[i].Descriptors);
+						BLE_EvtBufferFree(container, evt->Characteristics[i].Descriptors);
 					}
 					for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Characteristics[i].Value.Value);
+						BLE_EvtBufferFree(container, evt->Characteristics[i].Value.Value);
 					}
-					MEM_BufferFree(evt->Characteristics);
+					BLE_EvtBufferFree(container, evt->Characteristics);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -2244,7 +2346,7 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllCharacteristicDescriptorsI
 
 	if (evt->Characteristic.Value.ValueLength > 0)
 	{
-		evt->Characteristic.Value.Value = MEM_BufferAlloc(evt->Characteristic.Value.ValueLength);
+		evt->Characteristic.Value.Value = BLE_EvtBufferAlloc(container, evt->Characteristic.Value.ValueLength);
 
 		if (!evt->Characteristic.Value.Value)
 		{
@@ -2262,11 +2364,11 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllCharacteristicDescriptorsI
 
 	if (evt->Characteristic.NbOfDescriptors > 0)
 	{
-		evt->Characteristic.Descriptors = MEM_BufferAlloc(evt->Characteristic.NbOfDescriptors * sizeof(evt->Characteristic.Descriptors[0]));
+		evt->Characteristic.Descriptors = BLE_EvtBufferAlloc(container, evt->Characteristic.NbOfDescriptors * sizeof(evt->Characteristic.Descriptors[0]));
 
 		if (!evt->Characteristic.Descriptors)
 		{
-			MEM_BufferFree(evt->Characteristic.Value.Value);
+			BLE_EvtBufferFree(container, evt->Characteristic.Value.Value);
 			return MEM_ALLOC_ERROR_c;
 		}
 
@@ -2301,12 +2403,12 @@ static memStatus_t Load_GATTClientProcedureDiscoverAllCharacteristicDescriptorsI
 
 		if (evt->Characteristic.Descriptors[i].ValueLength > 0)
 		{
-			evt->Characteristic.Descriptors[i].Value = MEM_BufferAlloc(evt->Characteristic.Descriptors[i].ValueLength);
+			evt->Characteristic.Descriptors[i].Value = BLE_EvtBufferAlloc(container, evt->Characteristic.Descriptors[i].ValueLength);
 
 			if (!evt->Characteristic.Descriptors[i].Value)
 			{
-				MEM_BufferFree(evt->Characteristic.Descriptors);
-				MEM_BufferFree(evt->Characteristic.Value.Value);
+				BLE_EvtBufferFree(container, evt->Characteristic.Descriptors);
+				BLE_EvtBufferFree(container, evt->Characteristic.Value.Value);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -2361,7 +2463,7 @@ static memStatus_t Load_GATTClientProcedureReadCharacteristicValueIndication(ble
 
 	if (evt->Characteristic.Value.ValueLength > 0)
 	{
-		evt->Characteristic.Value.Value = MEM_BufferAlloc(evt->Characteristic.Value.ValueLength);
+		evt->Characteristic.Value.Value = BLE_EvtBufferAlloc(container, evt->Characteristic.Value.ValueLength);
 
 		if (!evt->Characteristic.Value.Value)
 		{
@@ -2379,11 +2481,11 @@ static memStatus_t Load_GATTClientProcedureReadCharacteristicValueIndication(ble
 
 	if (evt->Characteristic.NbOfDescriptors > 0)
 	{
-		evt->Characteristic.Descriptors = MEM_BufferAlloc(evt->Characteristic.NbOfDescriptors * sizeof(evt->Characteristic.Descriptors[0]));
+		evt->Characteristic.Descriptors = BLE_EvtBufferAlloc(container, evt->Characteristic.NbOfDescriptors * sizeof(evt->Characteristic.Descriptors[0]));
 
 		if (!evt->Characteristic.Descriptors)
 		{
-			MEM_BufferFree(evt->Characteristic.Value.Value);
+			BLE_EvtBufferFree(container, evt->Characteristic.Value.Value);
 			return MEM_ALLOC_ERROR_c;
 		}
 
@@ -2418,12 +2520,12 @@ static memStatus_t Load_GATTClientProcedureReadCharacteristicValueIndication(ble
 
 		if (evt->Characteristic.Descriptors[i].ValueLength > 0)
 		{
-			evt->Characteristic.Descriptors[i].Value = MEM_BufferAlloc(evt->Characteristic.Descriptors[i].ValueLength);
+			evt->Characteristic.Descriptors[i].Value = BLE_EvtBufferAlloc(container, evt->Characteristic.Descriptors[i].ValueLength);
 
 			if (!evt->Characteristic.Descriptors[i].Value)
 			{
-				MEM_BufferFree(evt->Characteristic.Descriptors);
-				MEM_BufferFree(evt->Characteristic.Value.Value);
+				BLE_EvtBufferFree(container, evt->Characteristic.Descriptors);
+				BLE_EvtBufferFree(container, evt->Characteristic.Value.Value);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -2459,7 +2561,7 @@ static memStatus_t Load_GATTClientProcedureReadUsingCharacteristicUuidIndication
 
 	if (evt->NbOfReadBytes > 0)
 	{
-		evt->ReadBytes = MEM_BufferAlloc(evt->NbOfReadBytes);
+		evt->ReadBytes = BLE_EvtBufferAlloc(container, evt->NbOfReadBytes);
 
 		if (!evt->ReadBytes)
 		{
@@ -2497,7 +2599,7 @@ static memStatus_t Load_GATTClientProcedureReadMultipleCharacteristicValuesIndic
 
 	if (evt->NbOfCharacteristics > 0)
 	{
-		evt->Characteristics = MEM_BufferAlloc(evt->NbOfCharacteristics * sizeof(evt->Characteristics[0]));
+		evt->Characteristics = BLE_EvtBufferAlloc(container, evt->NbOfCharacteristics * sizeof(evt->Characteristics[0]));
 
 		if (!evt->Characteristics)
 		{
@@ -2536,11 +2638,11 @@ static memStatus_t Load_GATTClientProcedureReadMultipleCharacteristicValuesIndic
 
 		if (evt->Characteristics[i].Value.ValueLength > 0)
 		{
-			evt->Characteristics[i].Value.Value = MEM_BufferAlloc(evt->Characteristics[i].Value.ValueLength);
+			evt->Characteristics[i].Value.Value = BLE_EvtBufferAlloc(container, evt->Characteristics[i].Value.ValueLength);
 
 			if (!evt->Characteristics[i].Value.Value)
 			{
-				MEM_BufferFree(evt->Characteristics);
+				BLE_EvtBufferFree(container, evt->Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -2555,15 +2657,15 @@ static memStatus_t Load_GATTClientProcedureReadMultipleCharacteristicValuesIndic
 
 		if (evt->Characteristics[i].NbOfDescriptors > 0)
 		{
-			evt->Characteristics[i].Descriptors = MEM_BufferAlloc(evt->Characteristics[i].NbOfDescriptors * sizeof(evt->Characteristics[i].Descriptors[0]));
+			evt->Characteristics[i].Descriptors = BLE_EvtBufferAlloc(container, evt->Characteristics[i].NbOfDescriptors * sizeof(evt->Characteristics[i].Descriptors[0]));
 
 			if (!evt->Characteristics[i].Descriptors)
 			{
 				for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 				{
-					MEM_BufferFree(evt->Characteristics[i].Value.Value);
+					BLE_EvtBufferFree(container, evt->Characteristics[i].Value.Value);
 				}
-				MEM_BufferFree(evt->Characteristics);
+				BLE_EvtBufferFree(container, evt->Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -2598,19 +2700,19 @@ static memStatus_t Load_GATTClientProcedureReadMultipleCharacteristicValuesIndic
 
 			if (evt->Characteristics[i].Descriptors[j].ValueLength > 0)
 			{
-				evt->Characteristics[i].Descriptors[j].Value = MEM_BufferAlloc(evt->Characteristics[i].Descriptors[j].ValueLength);
+				evt->Characteristics[i].Descriptors[j].Value = BLE_EvtBufferAlloc(container, evt->Characteristics[i].Descriptors[j].ValueLength);
 
 				if (!evt->Characteristics[i].Descriptors[j].Value)
 				{
 					for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Characteristics[i].Descriptors);
+						BLE_EvtBufferFree(container, evt->Characteristics[i].Descriptors);
 					}
 					for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Characteristics[i].Value.Value);
+						BLE_EvtBufferFree(container, evt->Characteristics[i].Value.Value);
 					}
-					MEM_BufferFree(evt->Characteristics);
+					BLE_EvtBufferFree(container, evt->Characteristics);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -2681,7 +2783,7 @@ static memStatus_t Load_GATTClientProcedureReadCharacteristicDescriptorIndicatio
 
 	if (evt->Descriptor.ValueLength > 0)
 	{
-		evt->Descriptor.Value = MEM_BufferAlloc(evt->Descriptor.ValueLength);
+		evt->Descriptor.Value = BLE_EvtBufferAlloc(container, evt->Descriptor.ValueLength);
 
 		if (!evt->Descriptor.Value)
 		{
@@ -2734,7 +2836,7 @@ static memStatus_t Load_GATTClientNotificationIndication(bleEvtContainer_t *cont
 
 	if (evt->ValueLength > 0)
 	{
-		evt->Value = MEM_BufferAlloc(evt->ValueLength);
+		evt->Value = BLE_EvtBufferAlloc(container, evt->ValueLength);
 
 		if (!evt->Value)
 		{
@@ -2770,7 +2872,7 @@ static memStatus_t Load_GATTClientMultipleHandleValueNotificationIndication(bleE
 
 	if (evt->HandleCount > 0)
 	{
-		evt->HandleLengthValueList = MEM_BufferAlloc(evt->HandleCount * sizeof(evt->HandleLengthValueList[0]));
+		evt->HandleLengthValueList = BLE_EvtBufferAlloc(container, evt->HandleCount * sizeof(evt->HandleLengthValueList[0]));
 
 		if (!evt->HandleLengthValueList)
 		{
@@ -2791,11 +2893,11 @@ static memStatus_t Load_GATTClientMultipleHandleValueNotificationIndication(bleE
 
 		if (evt->HandleLengthValueList[i].ValueLength > 0)
 		{
-			evt->HandleLengthValueList[i].Value = MEM_BufferAlloc(evt->HandleLengthValueList[i].ValueLength);
+			evt->HandleLengthValueList[i].Value = BLE_EvtBufferAlloc(container, evt->HandleLengthValueList[i].ValueLength);
 
 			if (!evt->HandleLengthValueList[i].Value)
 			{
-				MEM_BufferFree(evt->HandleLengthValueList);
+				BLE_EvtBufferFree(container, evt->HandleLengthValueList);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -2831,7 +2933,7 @@ static memStatus_t Load_GATTClientProcedureReadMultipleVariableLenCharValuesIndi
 
 	if (evt->NbOfCharacteristics > 0)
 	{
-		evt->Characteristics = MEM_BufferAlloc(evt->NbOfCharacteristics * sizeof(evt->Characteristics[0]));
+		evt->Characteristics = BLE_EvtBufferAlloc(container, evt->NbOfCharacteristics * sizeof(evt->Characteristics[0]));
 
 		if (!evt->Characteristics)
 		{
@@ -2870,11 +2972,11 @@ static memStatus_t Load_GATTClientProcedureReadMultipleVariableLenCharValuesIndi
 
 		if (evt->Characteristics[i].Value.ValueLength > 0)
 		{
-			evt->Characteristics[i].Value.Value = MEM_BufferAlloc(evt->Characteristics[i].Value.ValueLength);
+			evt->Characteristics[i].Value.Value = BLE_EvtBufferAlloc(container, evt->Characteristics[i].Value.ValueLength);
 
 			if (!evt->Characteristics[i].Value.Value)
 			{
-				MEM_BufferFree(evt->Characteristics);
+				BLE_EvtBufferFree(container, evt->Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -2889,15 +2991,15 @@ static memStatus_t Load_GATTClientProcedureReadMultipleVariableLenCharValuesIndi
 
 		if (evt->Characteristics[i].NbOfDescriptors > 0)
 		{
-			evt->Characteristics[i].Descriptors = MEM_BufferAlloc(evt->Characteristics[i].NbOfDescriptors * sizeof(evt->Characteristics[i].Descriptors[0]));
+			evt->Characteristics[i].Descriptors = BLE_EvtBufferAlloc(container, evt->Characteristics[i].NbOfDescriptors * sizeof(evt->Characteristics[i].Descriptors[0]));
 
 			if (!evt->Characteristics[i].Descriptors)
 			{
 				for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 				{
-					MEM_BufferFree(evt->Characteristics[i].Value.Value);
+					BLE_EvtBufferFree(container, evt->Characteristics[i].Value.Value);
 				}
-				MEM_BufferFree(evt->Characteristics);
+				BLE_EvtBufferFree(container, evt->Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -2932,19 +3034,19 @@ static memStatus_t Load_GATTClientProcedureReadMultipleVariableLenCharValuesIndi
 
 			if (evt->Characteristics[i].Descriptors[j].ValueLength > 0)
 			{
-				evt->Characteristics[i].Descriptors[j].Value = MEM_BufferAlloc(evt->Characteristics[i].Descriptors[j].ValueLength);
+				evt->Characteristics[i].Descriptors[j].Value = BLE_EvtBufferAlloc(container, evt->Characteristics[i].Descriptors[j].ValueLength);
 
 				if (!evt->Characteristics[i].Descriptors[j].Value)
 				{
 					for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Characteristics[i].Descriptors);
+						BLE_EvtBufferFree(container, evt->Characteristics[i].Descriptors);
 					}
 					for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Characteristics[i].Value.Value);
+						BLE_EvtBufferFree(container, evt->Characteristics[i].Value.Value);
 					}
-					MEM_BufferFree(evt->Characteristics);
+					BLE_EvtBufferFree(container, evt->Characteristics);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -2980,7 +3082,7 @@ static memStatus_t Load_GATTClientIndicationIndication(bleEvtContainer_t *contai
 
 	if (evt->ValueLength > 0)
 	{
-		evt->Value = MEM_BufferAlloc(evt->ValueLength);
+		evt->Value = BLE_EvtBufferAlloc(container, evt->ValueLength);
 
 		if (!evt->Value)
 		{
@@ -3049,7 +3151,7 @@ static memStatus_t Load_GATTServerAttributeWrittenIndication(bleEvtContainer_t *
 
 	if (evt->AttributeWrittenEvent.ValueLength > 0)
 	{
-		evt->AttributeWrittenEvent.Value = MEM_BufferAlloc(evt->AttributeWrittenEvent.ValueLength);
+		evt->AttributeWrittenEvent.Value = BLE_EvtBufferAlloc(container, evt->AttributeWrittenEvent.ValueLength);
 
 		if (!evt->AttributeWrittenEvent.Value)
 		{
@@ -3102,7 +3204,7 @@ static memStatus_t Load_GATTServerAttributeWrittenWithoutResponseIndication(bleE
 
 	if (evt->AttributeWrittenEvent.ValueLength > 0)
 	{
-		evt->AttributeWrittenEvent.Value = MEM_BufferAlloc(evt->AttributeWrittenEvent.ValueLength);
+		evt->AttributeWrittenEvent.Value = BLE_EvtBufferAlloc(container, evt->AttributeWrittenEvent.ValueLength);
 
 		if (!evt->AttributeWrittenEvent.Value)
 		{
@@ -3155,7 +3257,7 @@ static memStatus_t Load_GATTServerLongCharacteristicWrittenIndication(bleEvtCont
 
 	if (evt->LongCharacteristicWrittenEvent.ValueLength > 0)
 	{
-		evt->LongCharacteristicWrittenEvent.Value = MEM_BufferAlloc(evt->LongCharacteristicWrittenEvent.ValueLength);
+		evt->LongCharacteristicWrittenEvent.Value = BLE_EvtBufferAlloc(container, evt->LongCharacteristicWrittenEvent.ValueLength);
 
 		if (!evt->LongCharacteristicWrittenEvent.Value)
 		{
@@ -3210,7 +3312,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllPrimaryServicesInd
 
 	if (evt->NbOfDiscoveredServices > 0)
 	{
-		evt->DiscoveredServices = MEM_BufferAlloc(evt->NbOfDiscoveredServices * sizeof(evt->DiscoveredServices[0]));
+		evt->DiscoveredServices = BLE_EvtBufferAlloc(container, evt->NbOfDiscoveredServices * sizeof(evt->DiscoveredServices[0]));
 
 		if (!evt->DiscoveredServices)
 		{
@@ -3248,11 +3350,11 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllPrimaryServicesInd
 
 		if (evt->DiscoveredServices[i].NbOfCharacteristics > 0)
 		{
-			evt->DiscoveredServices[i].Characteristics = MEM_BufferAlloc(evt->DiscoveredServices[i].NbOfCharacteristics * sizeof(evt->DiscoveredServices[i].Characteristics[0]));
+			evt->DiscoveredServices[i].Characteristics = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].NbOfCharacteristics * sizeof(evt->DiscoveredServices[i].Characteristics[0]));
 
 			if (!evt->DiscoveredServices[i].Characteristics)
 			{
-				MEM_BufferFree(evt->DiscoveredServices);
+				BLE_EvtBufferFree(container, evt->DiscoveredServices);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -3288,15 +3390,15 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllPrimaryServicesInd
 
 			if (evt->DiscoveredServices[i].Characteristics[j].Value.ValueLength > 0)
 			{
-				evt->DiscoveredServices[i].Characteristics[j].Value.Value = MEM_BufferAlloc(evt->DiscoveredServices[i].Characteristics[j].Value.ValueLength);
+				evt->DiscoveredServices[i].Characteristics[j].Value.Value = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].Characteristics[j].Value.ValueLength);
 
 				if (!evt->DiscoveredServices[i].Characteristics[j].Value.Value)
 				{
 					for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 					}
-					MEM_BufferFree(evt->DiscoveredServices);
+					BLE_EvtBufferFree(container, evt->DiscoveredServices);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -3311,7 +3413,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllPrimaryServicesInd
 
 			if (evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors > 0)
 			{
-				evt->DiscoveredServices[i].Characteristics[j].Descriptors = MEM_BufferAlloc(evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors * sizeof(evt->DiscoveredServices[i].Characteristics[j].Descriptors[0]));
+				evt->DiscoveredServices[i].Characteristics[j].Descriptors = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors * sizeof(evt->DiscoveredServices[i].Characteristics[j].Descriptors[0]));
 
 				if (!evt->DiscoveredServices[i].Characteristics[j].Descriptors)
 				{
@@ -3319,14 +3421,14 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllPrimaryServicesInd
 					{
 						for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 						{
-							MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Value.Value);
+							BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Value.Value);
 						}
 					}
 					for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 					}
-					MEM_BufferFree(evt->DiscoveredServices);
+					BLE_EvtBufferFree(container, evt->DiscoveredServices);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -3361,7 +3463,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllPrimaryServicesInd
 
 				if (evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].ValueLength > 0)
 				{
-					evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value = MEM_BufferAlloc(evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].ValueLength);
+					evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].ValueLength);
 
 					if (!evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value)
 					{
@@ -3369,21 +3471,21 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllPrimaryServicesInd
 						{
 							for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 							{
-								MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Descriptors);
+								BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors);
 							}
 						}
 						for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 						{
 							for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 							{
-								MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Value.Value);
+								BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Value.Value);
 							}
 						}
 						for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 						{
-							MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+							BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 						}
-						MEM_BufferFree(evt->DiscoveredServices);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices);
 						return MEM_ALLOC_ERROR_c;
 					}
 
@@ -3400,7 +3502,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllPrimaryServicesInd
 
 		if (evt->DiscoveredServices[i].NbOfIncludedServices > 0)
 		{
-			evt->DiscoveredServices[i].IncludedServices = MEM_BufferAlloc(evt->DiscoveredServices[i].NbOfIncludedServices * sizeof(evt->DiscoveredServices[i].IncludedServices[0]));
+			evt->DiscoveredServices[i].IncludedServices = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].NbOfIncludedServices * sizeof(evt->DiscoveredServices[i].IncludedServices[0]));
 
 			if (!evt->DiscoveredServices[i].IncludedServices)
 			{
@@ -3410,7 +3512,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllPrimaryServicesInd
 					{
 						for (uint32_t k = 0; k < evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors; k++)
 						{
-							MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value);
+							BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value);
 						}
 					}
 				}
@@ -3418,21 +3520,21 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllPrimaryServicesInd
 				{
 					for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Descriptors);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors);
 					}
 				}
 				for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 				{
 					for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Value.Value);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Value.Value);
 					}
 				}
 				for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 				{
-					MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+					BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 				}
-				MEM_BufferFree(evt->DiscoveredServices);
+				BLE_EvtBufferFree(container, evt->DiscoveredServices);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -3492,7 +3594,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuid
 
 	if (evt->NbOfDiscoveredServices > 0)
 	{
-		evt->DiscoveredServices = MEM_BufferAlloc(evt->NbOfDiscoveredServices * sizeof(evt->DiscoveredServices[0]));
+		evt->DiscoveredServices = BLE_EvtBufferAlloc(container, evt->NbOfDiscoveredServices * sizeof(evt->DiscoveredServices[0]));
 
 		if (!evt->DiscoveredServices)
 		{
@@ -3530,11 +3632,11 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuid
 
 		if (evt->DiscoveredServices[i].NbOfCharacteristics > 0)
 		{
-			evt->DiscoveredServices[i].Characteristics = MEM_BufferAlloc(evt->DiscoveredServices[i].NbOfCharacteristics * sizeof(evt->DiscoveredServices[i].Characteristics[0]));
+			evt->DiscoveredServices[i].Characteristics = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].NbOfCharacteristics * sizeof(evt->DiscoveredServices[i].Characteristics[0]));
 
 			if (!evt->DiscoveredServices[i].Characteristics)
 			{
-				MEM_BufferFree(evt->DiscoveredServices);
+				BLE_EvtBufferFree(container, evt->DiscoveredServices);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -3570,15 +3672,15 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuid
 
 			if (evt->DiscoveredServices[i].Characteristics[j].Value.ValueLength > 0)
 			{
-				evt->DiscoveredServices[i].Characteristics[j].Value.Value = MEM_BufferAlloc(evt->DiscoveredServices[i].Characteristics[j].Value.ValueLength);
+				evt->DiscoveredServices[i].Characteristics[j].Value.Value = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].Characteristics[j].Value.ValueLength);
 
 				if (!evt->DiscoveredServices[i].Characteristics[j].Value.Value)
 				{
 					for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 					}
-					MEM_BufferFree(evt->DiscoveredServices);
+					BLE_EvtBufferFree(container, evt->DiscoveredServices);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -3593,7 +3695,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuid
 
 			if (evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors > 0)
 			{
-				evt->DiscoveredServices[i].Characteristics[j].Descriptors = MEM_BufferAlloc(evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors * sizeof(evt->DiscoveredServices[i].Characteristics[j].Descriptors[0]));
+				evt->DiscoveredServices[i].Characteristics[j].Descriptors = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors * sizeof(evt->DiscoveredServices[i].Characteristics[j].Descriptors[0]));
 
 				if (!evt->DiscoveredServices[i].Characteristics[j].Descriptors)
 				{
@@ -3601,14 +3703,14 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuid
 					{
 						for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 						{
-							MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Value.Value);
+							BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Value.Value);
 						}
 					}
 					for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 					}
-					MEM_BufferFree(evt->DiscoveredServices);
+					BLE_EvtBufferFree(container, evt->DiscoveredServices);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -3643,7 +3745,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuid
 
 				if (evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].ValueLength > 0)
 				{
-					evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value = MEM_BufferAlloc(evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].ValueLength);
+					evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].ValueLength);
 
 					if (!evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value)
 					{
@@ -3651,21 +3753,21 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuid
 						{
 							for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 							{
-								MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Descriptors);
+								BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors);
 							}
 						}
 						for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 						{
 							for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 							{
-								MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Value.Value);
+								BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Value.Value);
 							}
 						}
 						for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 						{
-							MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+							BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 						}
-						MEM_BufferFree(evt->DiscoveredServices);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices);
 						return MEM_ALLOC_ERROR_c;
 					}
 
@@ -3682,7 +3784,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuid
 
 		if (evt->DiscoveredServices[i].NbOfIncludedServices > 0)
 		{
-			evt->DiscoveredServices[i].IncludedServices = MEM_BufferAlloc(evt->DiscoveredServices[i].NbOfIncludedServices * sizeof(evt->DiscoveredServices[i].IncludedServices[0]));
+			evt->DiscoveredServices[i].IncludedServices = BLE_EvtBufferAlloc(container, evt->DiscoveredServices[i].NbOfIncludedServices * sizeof(evt->DiscoveredServices[i].IncludedServices[0]));
 
 			if (!evt->DiscoveredServices[i].IncludedServices)
 			{
@@ -3692,7 +3794,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuid
 					{
 						for (uint32_t k = 0; k < evt->DiscoveredServices[i].Characteristics[j].NbOfDescriptors; k++)
 						{
-							MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value);
+							BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors[k].Value);
 						}
 					}
 				}
@@ -3700,21 +3802,21 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuid
 				{
 					for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Descriptors);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Descriptors);
 					}
 				}
 				for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 				{
 					for (uint32_t j = 0; j < evt->DiscoveredServices[i].NbOfCharacteristics; j++)
 					{
-						MEM_BufferFree(evt->DiscoveredServices[i].Characteristics[j].Value.Value);
+						BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics[j].Value.Value);
 					}
 				}
 				for (uint32_t i = 0; i < evt->NbOfDiscoveredServices; i++)
 				{
-					MEM_BufferFree(evt->DiscoveredServices[i].Characteristics);
+					BLE_EvtBufferFree(container, evt->DiscoveredServices[i].Characteristics);
 				}
-				MEM_BufferFree(evt->DiscoveredServices);
+				BLE_EvtBufferFree(container, evt->DiscoveredServices);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -3792,7 +3894,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedFindIncludedServicesIndicatio
 
 	if (evt->Service.NbOfCharacteristics > 0)
 	{
-		evt->Service.Characteristics = MEM_BufferAlloc(evt->Service.NbOfCharacteristics * sizeof(evt->Service.Characteristics[0]));
+		evt->Service.Characteristics = BLE_EvtBufferAlloc(container, evt->Service.NbOfCharacteristics * sizeof(evt->Service.Characteristics[0]));
 
 		if (!evt->Service.Characteristics)
 		{
@@ -3831,11 +3933,11 @@ static memStatus_t Load_GATTClientProcedureEnhancedFindIncludedServicesIndicatio
 
 		if (evt->Service.Characteristics[i].Value.ValueLength > 0)
 		{
-			evt->Service.Characteristics[i].Value.Value = MEM_BufferAlloc(evt->Service.Characteristics[i].Value.ValueLength);
+			evt->Service.Characteristics[i].Value.Value = BLE_EvtBufferAlloc(container, evt->Service.Characteristics[i].Value.ValueLength);
 
 			if (!evt->Service.Characteristics[i].Value.Value)
 			{
-				MEM_BufferFree(evt->Service.Characteristics);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -3850,15 +3952,15 @@ static memStatus_t Load_GATTClientProcedureEnhancedFindIncludedServicesIndicatio
 
 		if (evt->Service.Characteristics[i].NbOfDescriptors > 0)
 		{
-			evt->Service.Characteristics[i].Descriptors = MEM_BufferAlloc(evt->Service.Characteristics[i].NbOfDescriptors * sizeof(evt->Service.Characteristics[i].Descriptors[0]));
+			evt->Service.Characteristics[i].Descriptors = BLE_EvtBufferAlloc(container, evt->Service.Characteristics[i].NbOfDescriptors * sizeof(evt->Service.Characteristics[i].Descriptors[0]));
 
 			if (!evt->Service.Characteristics[i].Descriptors)
 			{
 				for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 				{
-					MEM_BufferFree(evt->Service.Characteristics[i].Value.Value);
+					BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Value.Value);
 				}
-				MEM_BufferFree(evt->Service.Characteristics);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -3893,19 +3995,19 @@ static memStatus_t Load_GATTClientProcedureEnhancedFindIncludedServicesIndicatio
 
 			if (evt->Service.Characteristics[i].Descriptors[j].ValueLength > 0)
 			{
-				evt->Service.Characteristics[i].Descriptors[j].Value = MEM_BufferAlloc(evt->Service.Characteristics[i].Descriptors[j].ValueLength);
+				evt->Service.Characteristics[i].Descriptors[j].Value = BLE_EvtBufferAlloc(container, evt->Service.Characteristics[i].Descriptors[j].ValueLength);
 
 				if (!evt->Service.Characteristics[i].Descriptors[j].Value)
 				{
 					for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Service.Characteristics[i].Descriptors);
+						BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Descriptors);
 					}
 					for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Service.Characteristics[i].Value.Value);
+						BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Value.Value);
 					}
-					MEM_BufferFree(evt->Service.Characteristics);
+					BLE_EvtBufferFree(container, evt->Service.Characteristics);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -3922,7 +4024,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedFindIncludedServicesIndicatio
 
 	if (evt->Service.NbOfIncludedServices > 0)
 	{
-		evt->Service.IncludedServices = MEM_BufferAlloc(evt->Service.NbOfIncludedServices * sizeof(evt->Service.IncludedServices[0]));
+		evt->Service.IncludedServices = BLE_EvtBufferAlloc(container, evt->Service.NbOfIncludedServices * sizeof(evt->Service.IncludedServices[0]));
 
 		if (!evt->Service.IncludedServices)
 		{
@@ -3930,18 +4032,18 @@ static memStatus_t Load_GATTClientProcedureEnhancedFindIncludedServicesIndicatio
 			{
 				for (uint32_t j = 0; j < evt->Service.Characteristics[i].NbOfDescriptors; j++)
 				{
-					MEM_BufferFree(evt->Service.Characteristics[i].Descriptors[j].Value);
+					BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Descriptors[j].Value);
 				}
 			}
 			for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 			{
-				MEM_BufferFree(evt->Service.Characteristics[i].Descriptors);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Descriptors);
 			}
 			for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 			{
-				MEM_BufferFree(evt->Service.Characteristics[i].Value.Value);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Value.Value);
 			}
-			MEM_BufferFree(evt->Service.Characteristics);
+			BLE_EvtBufferFree(container, evt->Service.Characteristics);
 			return MEM_ALLOC_ERROR_c;
 		}
 
@@ -4018,7 +4120,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllCharacteristicsInd
 
 	if (evt->Service.NbOfCharacteristics > 0)
 	{
-		evt->Service.Characteristics = MEM_BufferAlloc(evt->Service.NbOfCharacteristics * sizeof(evt->Service.Characteristics[0]));
+		evt->Service.Characteristics = BLE_EvtBufferAlloc(container, evt->Service.NbOfCharacteristics * sizeof(evt->Service.Characteristics[0]));
 
 		if (!evt->Service.Characteristics)
 		{
@@ -4057,11 +4159,11 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllCharacteristicsInd
 
 		if (evt->Service.Characteristics[i].Value.ValueLength > 0)
 		{
-			evt->Service.Characteristics[i].Value.Value = MEM_BufferAlloc(evt->Service.Characteristics[i].Value.ValueLength);
+			evt->Service.Characteristics[i].Value.Value = BLE_EvtBufferAlloc(container, evt->Service.Characteristics[i].Value.ValueLength);
 
 			if (!evt->Service.Characteristics[i].Value.Value)
 			{
-				MEM_BufferFree(evt->Service.Characteristics);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -4076,15 +4178,15 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllCharacteristicsInd
 
 		if (evt->Service.Characteristics[i].NbOfDescriptors > 0)
 		{
-			evt->Service.Characteristics[i].Descriptors = MEM_BufferAlloc(evt->Service.Characteristics[i].NbOfDescriptors * sizeof(evt->Service.Characteristics[i].Descriptors[0]));
+			evt->Service.Characteristics[i].Descriptors = BLE_EvtBufferAlloc(container, evt->Service.Characteristics[i].NbOfDescriptors * sizeof(evt->Service.Characteristics[i].Descriptors[0]));
 
 			if (!evt->Service.Characteristics[i].Descriptors)
 			{
 				for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 				{
-					MEM_BufferFree(evt->Service.Characteristics[i].Value.Value);
+					BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Value.Value);
 				}
-				MEM_BufferFree(evt->Service.Characteristics);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -4119,19 +4221,19 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllCharacteristicsInd
 
 			if (evt->Service.Characteristics[i].Descriptors[j].ValueLength > 0)
 			{
-				evt->Service.Characteristics[i].Descriptors[j].Value = MEM_BufferAlloc(evt->Service.Characteristics[i].Descriptors[j].ValueLength);
+				evt->Service.Characteristics[i].Descriptors[j].Value = BLE_EvtBufferAlloc(container, evt->Service.Characteristics[i].Descriptors[j].ValueLength);
 
 				if (!evt->Service.Characteristics[i].Descriptors[j].Value)
 				{
 					for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Service.Characteristics[i].Descriptors);
+						BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Descriptors);
 					}
 					for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Service.Characteristics[i].Value.Value);
+						BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Value.Value);
 					}
-					MEM_BufferFree(evt->Service.Characteristics);
+					BLE_EvtBufferFree(container, evt->Service.Characteristics);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -4148,7 +4250,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllCharacteristicsInd
 
 	if (evt->Service.NbOfIncludedServices > 0)
 	{
-		evt->Service.IncludedServices = MEM_BufferAlloc(evt->Service.NbOfIncludedServices * sizeof(evt->Service.IncludedServices[0]));
+		evt->Service.IncludedServices = BLE_EvtBufferAlloc(container, evt->Service.NbOfIncludedServices * sizeof(evt->Service.IncludedServices[0]));
 
 		if (!evt->Service.IncludedServices)
 		{
@@ -4156,18 +4258,18 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllCharacteristicsInd
 			{
 				for (uint32_t j = 0; j < evt->Service.Characteristics[i].NbOfDescriptors; j++)
 				{
-					MEM_BufferFree(evt->Service.Characteristics[i].Descriptors[j].Value);
+					BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Descriptors[j].Value);
 				}
 			}
 			for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 			{
-				MEM_BufferFree(evt->Service.Characteristics[i].Descriptors);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Descriptors);
 			}
 			for (uint32_t i = 0; i < evt->Service.NbOfCharacteristics; i++)
 			{
-				MEM_BufferFree(evt->Service.Characteristics[i].Value.Value);
+				BLE_EvtBufferFree(container, evt->Service.Characteristics[i].Value.Value);
 			}
-			MEM_BufferFree(evt->Service.Characteristics);
+			BLE_EvtBufferFree(container, evt->Service.Characteristics);
 			return MEM_ALLOC_ERROR_c;
 		}
 
@@ -4226,7 +4328,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverCharacteristicByUuidI
 
 	if (evt->NbOfCharacteristics > 0)
 	{
-		evt->Characteristics = MEM_BufferAlloc(evt->NbOfCharacteristics * sizeof(evt->Characteristics[0]));
+		evt->Characteristics = BLE_EvtBufferAlloc(container, evt->NbOfCharacteristics * sizeof(evt->Characteristics[0]));
 
 		if (!evt->Characteristics)
 		{
@@ -4265,11 +4367,11 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverCharacteristicByUuidI
 
 		if (evt->Characteristics[i].Value.ValueLength > 0)
 		{
-			evt->Characteristics[i].Value.Value = MEM_BufferAlloc(evt->Characteristics[i].Value.ValueLength);
+			evt->Characteristics[i].Value.Value = BLE_EvtBufferAlloc(container, evt->Characteristics[i].Value.ValueLength);
 
 			if (!evt->Characteristics[i].Value.Value)
 			{
-				MEM_BufferFree(evt->Characteristics);
+				BLE_EvtBufferFree(container, evt->Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -4284,15 +4386,15 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverCharacteristicByUuidI
 
 		if (evt->Characteristics[i].NbOfDescriptors > 0)
 		{
-			evt->Characteristics[i].Descriptors = MEM_BufferAlloc(evt->Characteristics[i].NbOfDescriptors * sizeof(evt->Characteristics[i].Descriptors[0]));
+			evt->Characteristics[i].Descriptors = BLE_EvtBufferAlloc(container, evt->Characteristics[i].NbOfDescriptors * sizeof(evt->Characteristics[i].Descriptors[0]));
 
 			if (!evt->Characteristics[i].Descriptors)
 			{
 				for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 				{
-					MEM_BufferFree(evt->Characteristics[i].Value.Value);
+					BLE_EvtBufferFree(container, evt->Characteristics[i].Value.Value);
 				}
-				MEM_BufferFree(evt->Characteristics);
+				BLE_EvtBufferFree(container, evt->Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -4327,19 +4429,19 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverCharacteristicByUuidI
 
 			if (evt->Characteristics[i].Descriptors[j].ValueLength > 0)
 			{
-				evt->Characteristics[i].Descriptors[j].Value = MEM_BufferAlloc(evt->Characteristics[i].Descriptors[j].ValueLength);
+				evt->Characteristics[i].Descriptors[j].Value = BLE_EvtBufferAlloc(container, evt->Characteristics[i].Descriptors[j].ValueLength);
 
 				if (!evt->Characteristics[i].Descriptors[j].Value)
 				{
 					for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Characteristics[i].Descriptors);
+						BLE_EvtBufferFree(container, evt->Characteristics[i].Descriptors);
 					}
 					for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Characteristics[i].Value.Value);
+						BLE_EvtBufferFree(container, evt->Characteristics[i].Value.Value);
 					}
-					MEM_BufferFree(evt->Characteristics);
+					BLE_EvtBufferFree(container, evt->Characteristics);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -4396,7 +4498,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllCharacteristicDesc
 
 	if (evt->Characteristic.Value.ValueLength > 0)
 	{
-		evt->Characteristic.Value.Value = MEM_BufferAlloc(evt->Characteristic.Value.ValueLength);
+		evt->Characteristic.Value.Value = BLE_EvtBufferAlloc(container, evt->Characteristic.Value.ValueLength);
 
 		if (!evt->Characteristic.Value.Value)
 		{
@@ -4414,11 +4516,11 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllCharacteristicDesc
 
 	if (evt->Characteristic.NbOfDescriptors > 0)
 	{
-		evt->Characteristic.Descriptors = MEM_BufferAlloc(evt->Characteristic.NbOfDescriptors * sizeof(evt->Characteristic.Descriptors[0]));
+		evt->Characteristic.Descriptors = BLE_EvtBufferAlloc(container, evt->Characteristic.NbOfDescriptors * sizeof(evt->Characteristic.Descriptors[0]));
 
 		if (!evt->Characteristic.Descriptors)
 		{
-			MEM_BufferFree(evt->Characteristic.Value.Value);
+			BLE_EvtBufferFree(container, evt->Characteristic.Value.Value);
 			return MEM_ALLOC_ERROR_c;
 		}
 
@@ -4453,12 +4555,12 @@ static memStatus_t Load_GATTClientProcedureEnhancedDiscoverAllCharacteristicDesc
 
 		if (evt->Characteristic.Descriptors[i].ValueLength > 0)
 		{
-			evt->Characteristic.Descriptors[i].Value = MEM_BufferAlloc(evt->Characteristic.Descriptors[i].ValueLength);
+			evt->Characteristic.Descriptors[i].Value = BLE_EvtBufferAlloc(container, evt->Characteristic.Descriptors[i].ValueLength);
 
 			if (!evt->Characteristic.Descriptors[i].Value)
 			{
-				MEM_BufferFree(evt->Characteristic.Descriptors);
-				MEM_BufferFree(evt->Characteristic.Value.Value);
+				BLE_EvtBufferFree(container, evt->Characteristic.Descriptors);
+				BLE_EvtBufferFree(container, evt->Characteristic.Value.Value);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -4514,7 +4616,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedReadCharacteristicValueIndica
 
 	if (evt->Characteristic.Value.ValueLength > 0)
 	{
-		evt->Characteristic.Value.Value = MEM_BufferAlloc(evt->Characteristic.Value.ValueLength);
+		evt->Characteristic.Value.Value = BLE_EvtBufferAlloc(container, evt->Characteristic.Value.ValueLength);
 
 		if (!evt->Characteristic.Value.Value)
 		{
@@ -4532,11 +4634,11 @@ static memStatus_t Load_GATTClientProcedureEnhancedReadCharacteristicValueIndica
 
 	if (evt->Characteristic.NbOfDescriptors > 0)
 	{
-		evt->Characteristic.Descriptors = MEM_BufferAlloc(evt->Characteristic.NbOfDescriptors * sizeof(evt->Characteristic.Descriptors[0]));
+		evt->Characteristic.Descriptors = BLE_EvtBufferAlloc(container, evt->Characteristic.NbOfDescriptors * sizeof(evt->Characteristic.Descriptors[0]));
 
 		if (!evt->Characteristic.Descriptors)
 		{
-			MEM_BufferFree(evt->Characteristic.Value.Value);
+			BLE_EvtBufferFree(container, evt->Characteristic.Value.Value);
 			return MEM_ALLOC_ERROR_c;
 		}
 
@@ -4571,12 +4673,12 @@ static memStatus_t Load_GATTClientProcedureEnhancedReadCharacteristicValueIndica
 
 		if (evt->Characteristic.Descriptors[i].ValueLength > 0)
 		{
-			evt->Characteristic.Descriptors[i].Value = MEM_BufferAlloc(evt->Characteristic.Descriptors[i].ValueLength);
+			evt->Characteristic.Descriptors[i].Value = BLE_EvtBufferAlloc(container, evt->Characteristic.Descriptors[i].ValueLength);
 
 			if (!evt->Characteristic.Descriptors[i].Value)
 			{
-				MEM_BufferFree(evt->Characteristic.Descriptors);
-				MEM_BufferFree(evt->Characteristic.Value.Value);
+				BLE_EvtBufferFree(container, evt->Characteristic.Descriptors);
+				BLE_EvtBufferFree(container, evt->Characteristic.Value.Value);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -4613,7 +4715,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedReadUsingCharacteristicUuidIn
 
 	if (evt->NbOfReadBytes > 0)
 	{
-		evt->ReadBytes = MEM_BufferAlloc(evt->NbOfReadBytes);
+		evt->ReadBytes = BLE_EvtBufferAlloc(container, evt->NbOfReadBytes);
 
 		if (!evt->ReadBytes)
 		{
@@ -4652,7 +4754,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedReadMultipleCharacteristicVal
 
 	if (evt->NbOfCharacteristics > 0)
 	{
-		evt->Characteristics = MEM_BufferAlloc(evt->NbOfCharacteristics * sizeof(evt->Characteristics[0]));
+		evt->Characteristics = BLE_EvtBufferAlloc(container, evt->NbOfCharacteristics * sizeof(evt->Characteristics[0]));
 
 		if (!evt->Characteristics)
 		{
@@ -4691,11 +4793,11 @@ static memStatus_t Load_GATTClientProcedureEnhancedReadMultipleCharacteristicVal
 
 		if (evt->Characteristics[i].Value.ValueLength > 0)
 		{
-			evt->Characteristics[i].Value.Value = MEM_BufferAlloc(evt->Characteristics[i].Value.ValueLength);
+			evt->Characteristics[i].Value.Value = BLE_EvtBufferAlloc(container, evt->Characteristics[i].Value.ValueLength);
 
 			if (!evt->Characteristics[i].Value.Value)
 			{
-				MEM_BufferFree(evt->Characteristics);
+				BLE_EvtBufferFree(container, evt->Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -4710,15 +4812,15 @@ static memStatus_t Load_GATTClientProcedureEnhancedReadMultipleCharacteristicVal
 
 		if (evt->Characteristics[i].NbOfDescriptors > 0)
 		{
-			evt->Characteristics[i].Descriptors = MEM_BufferAlloc(evt->Characteristics[i].NbOfDescriptors * sizeof(evt->Characteristics[i].Descriptors[0]));
+			evt->Characteristics[i].Descriptors = BLE_EvtBufferAlloc(container, evt->Characteristics[i].NbOfDescriptors * sizeof(evt->Characteristics[i].Descriptors[0]));
 
 			if (!evt->Characteristics[i].Descriptors)
 			{
 				for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 				{
-					MEM_BufferFree(evt->Characteristics[i].Value.Value);
+					BLE_EvtBufferFree(container, evt->Characteristics[i].Value.Value);
 				}
-				MEM_BufferFree(evt->Characteristics);
+				BLE_EvtBufferFree(container, evt->Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -4753,19 +4855,19 @@ static memStatus_t Load_GATTClientProcedureEnhancedReadMultipleCharacteristicVal
 
 			if (evt->Characteristics[i].Descriptors[j].ValueLength > 0)
 			{
-				evt->Characteristics[i].Descriptors[j].Value = MEM_BufferAlloc(evt->Characteristics[i].Descriptors[j].ValueLength);
+				evt->Characteristics[i].Descriptors[j].Value = BLE_EvtBufferAlloc(container, evt->Characteristics[i].Descriptors[j].ValueLength);
 
 				if (!evt->Characteristics[i].Descriptors[j].Value)
 				{
 					for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Characteristics[i].Descriptors);
+						BLE_EvtBufferFree(container, evt->Characteristics[i].Descriptors);
 					}
 					for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Characteristics[i].Value.Value);
+						BLE_EvtBufferFree(container, evt->Characteristics[i].Value.Value);
 					}
-					MEM_BufferFree(evt->Characteristics);
+					BLE_EvtBufferFree(container, evt->Characteristics);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -4837,7 +4939,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedReadCharacteristicDescriptorI
 
 	if (evt->Descriptor.ValueLength > 0)
 	{
-		evt->Descriptor.Value = MEM_BufferAlloc(evt->Descriptor.ValueLength);
+		evt->Descriptor.Value = BLE_EvtBufferAlloc(container, evt->Descriptor.ValueLength);
 
 		if (!evt->Descriptor.Value)
 		{
@@ -4892,7 +4994,7 @@ static memStatus_t Load_GATTClientProcedureEnhancedReadMultipleVariableLenCharVa
 
 	if (evt->NbOfCharacteristics > 0)
 	{
-		evt->Characteristics = MEM_BufferAlloc(evt->NbOfCharacteristics * sizeof(evt->Characteristics[0]));
+		evt->Characteristics = BLE_EvtBufferAlloc(container, evt->NbOfCharacteristics * sizeof(evt->Characteristics[0]));
 
 		if (!evt->Characteristics)
 		{
@@ -4931,11 +5033,11 @@ static memStatus_t Load_GATTClientProcedureEnhancedReadMultipleVariableLenCharVa
 
 		if (evt->Characteristics[i].Value.ValueLength > 0)
 		{
-			evt->Characteristics[i].Value.Value = MEM_BufferAlloc(evt->Characteristics[i].Value.ValueLength);
+			evt->Characteristics[i].Value.Value = BLE_EvtBufferAlloc(container, evt->Characteristics[i].Value.ValueLength);
 
 			if (!evt->Characteristics[i].Value.Value)
 			{
-				MEM_BufferFree(evt->Characteristics);
+				BLE_EvtBufferFree(container, evt->Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -4950,15 +5052,15 @@ static memStatus_t Load_GATTClientProcedureEnhancedReadMultipleVariableLenCharVa
 
 		if (evt->Characteristics[i].NbOfDescriptors > 0)
 		{
-			evt->Characteristics[i].Descriptors = MEM_BufferAlloc(evt->Characteristics[i].NbOfDescriptors * sizeof(evt->Characteristics[i].Descriptors[0]));
+			evt->Characteristics[i].Descriptors = BLE_EvtBufferAlloc(container, evt->Characteristics[i].NbOfDescriptors * sizeof(evt->Characteristics[i].Descriptors[0]));
 
 			if (!evt->Characteristics[i].Descriptors)
 			{
 				for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 				{
-					MEM_BufferFree(evt->Characteristics[i].Value.Value);
+					BLE_EvtBufferFree(container, evt->Characteristics[i].Value.Value);
 				}
-				MEM_BufferFree(evt->Characteristics);
+				BLE_EvtBufferFree(container, evt->Characteristics);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -4993,19 +5095,19 @@ static memStatus_t Load_GATTClientProcedureEnhancedReadMultipleVariableLenCharVa
 
 			if (evt->Characteristics[i].Descriptors[j].ValueLength > 0)
 			{
-				evt->Characteristics[i].Descriptors[j].Value = MEM_BufferAlloc(evt->Characteristics[i].Descriptors[j].ValueLength);
+				evt->Characteristics[i].Descriptors[j].Value = BLE_EvtBufferAlloc(container, evt->Characteristics[i].Descriptors[j].ValueLength);
 
 				if (!evt->Characteristics[i].Descriptors[j].Value)
 				{
 					for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Characteristics[i].Descriptors);
+						BLE_EvtBufferFree(container, evt->Characteristics[i].Descriptors);
 					}
 					for (uint32_t i = 0; i < evt->NbOfCharacteristics; i++)
 					{
-						MEM_BufferFree(evt->Characteristics[i].Value.Value);
+						BLE_EvtBufferFree(container, evt->Characteristics[i].Value.Value);
 					}
-					MEM_BufferFree(evt->Characteristics);
+					BLE_EvtBufferFree(container, evt->Characteristics);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -5041,7 +5143,7 @@ static memStatus_t Load_GATTClientEnhancedMultipleHandleValueNotificationIndicat
 
 	if (evt->HandleCount > 0)
 	{
-		evt->HandleLengthValueList = MEM_BufferAlloc(evt->HandleCount * sizeof(evt->HandleLengthValueList[0]));
+		evt->HandleLengthValueList = BLE_EvtBufferAlloc(container, evt->HandleCount * sizeof(evt->HandleLengthValueList[0]));
 
 		if (!evt->HandleLengthValueList)
 		{
@@ -5062,11 +5164,11 @@ static memStatus_t Load_GATTClientEnhancedMultipleHandleValueNotificationIndicat
 
 		if (evt->HandleLengthValueList[i].ValueLength > 0)
 		{
-			evt->HandleLengthValueList[i].Value = MEM_BufferAlloc(evt->HandleLengthValueList[i].ValueLength);
+			evt->HandleLengthValueList[i].Value = BLE_EvtBufferAlloc(container, evt->HandleLengthValueList[i].ValueLength);
 
 			if (!evt->HandleLengthValueList[i].Value)
 			{
-				MEM_BufferFree(evt->HandleLengthValueList);
+				BLE_EvtBufferFree(container, evt->HandleLengthValueList);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -5102,7 +5204,7 @@ static memStatus_t Load_GATTClientEnhancedNotificationIndication(bleEvtContainer
 
 	if (evt->ValueLength > 0)
 	{
-		evt->Value = MEM_BufferAlloc(evt->ValueLength);
+		evt->Value = BLE_EvtBufferAlloc(container, evt->ValueLength);
 
 		if (!evt->Value)
 		{
@@ -5140,7 +5242,7 @@ static memStatus_t Load_GATTClientEnhancedIndicationIndication(bleEvtContainer_t
 
 	if (evt->ValueLength > 0)
 	{
-		evt->Value = MEM_BufferAlloc(evt->ValueLength);
+		evt->Value = BLE_EvtBufferAlloc(container, evt->ValueLength);
 
 		if (!evt->Value)
 		{
@@ -5194,7 +5296,7 @@ static memStatus_t Load_GATTServerEnhancedAttributeWrittenIndication(bleEvtConta
 
 	if (evt->AttributeWrittenEvent.ValueLength > 0)
 	{
-		evt->AttributeWrittenEvent.Value = MEM_BufferAlloc(evt->AttributeWrittenEvent.ValueLength);
+		evt->AttributeWrittenEvent.Value = BLE_EvtBufferAlloc(container, evt->AttributeWrittenEvent.ValueLength);
 
 		if (!evt->AttributeWrittenEvent.Value)
 		{
@@ -5248,7 +5350,7 @@ static memStatus_t Load_GATTServerEnhancedAttributeWrittenWithoutResponseIndicat
 
 	if (evt->AttributeWrittenEvent.ValueLength > 0)
 	{
-		evt->AttributeWrittenEvent.Value = MEM_BufferAlloc(evt->AttributeWrittenEvent.ValueLength);
+		evt->AttributeWrittenEvent.Value = BLE_EvtBufferAlloc(container, evt->AttributeWrittenEvent.ValueLength);
 
 		if (!evt->AttributeWrittenEvent.Value)
 		{
@@ -5302,7 +5404,7 @@ static memStatus_t Load_GATTServerEnhancedLongCharacteristicWrittenIndication(bl
 
 	if (evt->LongCharacteristicWrittenEvent.ValueLength > 0)
 	{
-		evt->LongCharacteristicWrittenEvent.Value = MEM_BufferAlloc(evt->LongCharacteristicWrittenEvent.ValueLength);
+		evt->LongCharacteristicWrittenEvent.Value = BLE_EvtBufferAlloc(container, evt->LongCharacteristicWrittenEvent.ValueLength);
 
 		if (!evt->LongCharacteristicWrittenEvent.Value)
 		{
@@ -5372,7 +5474,7 @@ static memStatus_t Load_GATTDBReadAttributeIndication(bleEvtContainer_t *contain
 
 	if (evt->ValueLength > 0)
 	{
-		evt->Value = MEM_BufferAlloc(evt->ValueLength);
+		evt->Value = BLE_EvtBufferAlloc(container, evt->ValueLength);
 
 		if (!evt->Value)
 		{
@@ -5582,6 +5684,63 @@ static memStatus_t Load_GATTDBDynamicAddCharDescriptorWithUniqueValueIndication(
 	return MEM_SUCCESS_c;
 }
 
+/*!*************************************************************************************************
+\fn		static memStatus_t Load_GATTDBDynamicAddServiceIndication(bleEvtContainer_t *container, uint8_t *pPayload)
+\brief	Handles assigned to a service added in a single command
+***************************************************************************************************/
+static memStatus_t Load_GATTDBDynamicAddServiceIndication(bleEvtContainer_t *container, uint8_t *pPayload)
+{
+	GATTDBDynamicAddServiceIndication_t *evt = &(container->Data.GATTDBDynamicAddServiceIndication);
+
+	uint32_t idx = 0;
+	uint32_t i;
+
+	/* Store (OG, OC) in ID */
+	container->id = GATTDBDynamicAddServiceIndication_FSCI_ID;
+
+	FLib_MemCpy(&(evt->ServiceHandle), pPayload + idx, sizeof(evt->ServiceHandle)); idx += sizeof(evt->ServiceHandle);
+	evt->NbOfCharacteristics = pPayload[idx]; idx++;
+
+	if (evt->NbOfCharacteristics > 0)
+	{
+		evt->Characteristics = BLE_EvtBufferAlloc(container, evt->NbOfCharacteristics * sizeof(evt->Characteristics[0]));
+
+		if (!evt->Characteristics)
+		{
+			return MEM_ALLOC_ERROR_c;
+		}
+
+		/* The unloader relies on the descriptor handles of the characteristics not reached yet */
+		FLib_MemSet(evt->Characteristics, 0, evt->NbOfCharacteristics * sizeof(evt->Characteristics[0]));
+	}
+	else
+	{
+		evt->Characteristics = NULL;
+	}
+
+	for (i = 0; i < evt->NbOfCharacteristics; i++)
+	{
+		FLib_MemCpy(&(evt->Characteristics[i].CharacteristicHandle), pPayload + idx, sizeof(evt->Characteristics[i].CharacteristicHandle)); idx += sizeof(evt->Characteristics[i].CharacteristicHandle);
+		FLib_MemCpy(&(evt->Characteristics[i].CccdHandle), pPayload + idx, sizeof(evt->Characteristics[i].CccdHandle)); idx += sizeof(evt->Characteristics[i].CccdHandle);
+		evt->Characteristics[i].NbOfDescriptors = pPayload[idx]; idx++;
+
+		if (evt->Characteristics[i].NbOfDescriptors > 0)
+		{
+			evt->Characteristics[i].DescriptorHandles = BLE_EvtBufferAlloc(container, evt->Characteristics[i].NbOfDescriptors * sizeof(uint16_t));
+
+			if (!evt->Characteristics[i].DescriptorHandles)
+			{
+				evt->Characteristics[i].NbOfDescriptors = 0;
+				return MEM_ALLOC_ERROR_c;
+			}
+
+			FLib_MemCpy(evt->Characteristics[i].DescriptorHandles, pPayload + idx, evt->Characteristics[i].NbOfDescriptors * sizeof(uint16_t)); idx += evt->Characteristics[i].NbOfDescriptors * sizeof(uint16_t);
+		}
+	}
+
+	return MEM_SUCCESS_c;
+}
+
 #endif  /* GATTDB_APP_ENABLE */
 
 #if GATTDB_ATT_ENABLE
@@ -5623,7 +5782,7 @@ static memStatus_t Load_GATTDBAttFindInformationIndication(bleEvtContainer_t *co
 
 			if (evt->Params.InformationData.Uuid16BitFormat.HandleUuid16PairCount > 0)
 			{
-				evt->Params.InformationData.Uuid16BitFormat.HandleUuid16 = MEM_BufferAlloc(evt->Params.InformationData.Uuid16BitFormat.HandleUuid16PairCount * sizeof(evt->Params.InformationData.Uuid16BitFormat.HandleUuid16[0]));
+				evt->Params.InformationData.Uuid16BitFormat.HandleUuid16 = BLE_EvtBufferAlloc(container, evt->Params.InformationData.Uuid16BitFormat.HandleUuid16PairCount * sizeof(evt->Params.InformationData.Uuid16BitFormat.HandleUuid16[0]));
 
 				if (!evt->Params.InformationData.Uuid16BitFormat.HandleUuid16)
 				{
@@ -5649,11 +5808,11 @@ static memStatus_t Load_GATTDBAttFindInformationIndication(bleEvtContainer_t *co
 
 			if (evt->Params.InformationData.Uuid128BitFormat.HandleUuid128PairCount > 0)
 			{
-				evt->Params.InformationData.Uuid128BitFormat.HandleUuid128 = MEM_BufferAlloc(evt->Params.InformationData.Uuid128BitFormat.HandleUuid128PairCount * sizeof(evt->Params.InformationData.Uuid128BitFormat.HandleUuid128[0]));
+				evt->Params.InformationData.Uuid128BitFormat.HandleUuid128 = BLE_EvtBufferAlloc(container, evt->Params.InformationData.Uuid128BitFormat.HandleUuid128PairCount * sizeof(evt->Params.InformationData.Uuid128BitFormat.HandleUuid128[0]));
 
 				if (!evt->Params.InformationData.Uuid128BitFormat.HandleUuid128)
 				{
-					MEM_BufferFree(evt->Params.InformationData.Uuid16BitFormat.HandleUuid16);
+					BLE_EvtBufferFree(container, evt->Params.InformationData.Uuid16BitFormat.HandleUuid16);
 					return MEM_ALLOC_ERROR_c;
 				}
 
@@ -5693,7 +5852,7 @@ static memStatus_t Load_GATTDBAttFindByTypeValueIndication(bleEvtContainer_t *co
 
 	if (evt->Params.GroupCount > 0)
 	{
-		evt->Params.HandleGroup = MEM_BufferAlloc(evt->Params.GroupCount * sizeof(evt->Params.HandleGroup[0]));
+		evt->Params.HandleGroup = BLE_EvtBufferAlloc(container, evt->Params.GroupCount * sizeof(evt->Params.HandleGroup[0]));
 
 		if (!evt->Params.HandleGroup)
 		{
@@ -5735,7 +5894,7 @@ static memStatus_t Load_GATTDBAttReadByTypeIndication(bleEvtContainer_t *contain
 
 	if (evt->Params.AttributeDataListLength > 0)
 	{
-		evt->Params.AttributeDataList = MEM_BufferAlloc(evt->Params.AttributeDataListLength);
+		evt->Params.AttributeDataList = BLE_EvtBufferAlloc(container, evt->Params.AttributeDataListLength);
 
 		if (!evt->Params.AttributeDataList)
 		{
@@ -5771,7 +5930,7 @@ static memStatus_t Load_GATTDBAttReadIndication(bleEvtContainer_t *container, ui
 
 	if (evt->Params.AttributeLength > 0)
 	{
-		evt->Params.AttributeValue = MEM_BufferAlloc(evt->Params.AttributeLength);
+		evt->Params.AttributeValue = BLE_EvtBufferAlloc(container, evt->Params.AttributeLength);
 
 		if (!evt->Params.AttributeValue)
 		{
@@ -5823,7 +5982,7 @@ static memStatus_t Load_GATTDBAttReadMultipleIndication(bleEvtContainer_t *conta
 
 	if (evt->Params.ListLength > 0)
 	{
-		evt->Params.ListOfValues = MEM_BufferAlloc(evt->Params.ListLength);
+		evt->Params.ListOfValues = BLE_EvtBufferAlloc(container, evt->Params.ListLength);
 
 		if (!evt->Params.ListOfValues)
 		{
@@ -5860,7 +6019,7 @@ static memStatus_t Load_GATTDBAttReadByGroupTypeIndication(bleEvtContainer_t *co
 
 	if (evt->Params.AttributeDataListLength > 0)
 	{
-		evt->Params.AttributeDataList = MEM_BufferAlloc(evt->Params.AttributeDataListLength);
+		evt->Params.AttributeDataList = BLE_EvtBufferAlloc(container, evt->Params.AttributeDataListLength);
 
 		if (!evt->Params.AttributeDataList)
 		{
@@ -5914,7 +6073,7 @@ static memStatus_t Load_GATTDBAttPrepareWriteIndication(bleEvtContainer_t *conta
 
 	if (evt->Params.AttributeLength > 0)
 	{
-		evt->Params.AttributeValue = MEM_BufferAlloc(evt->Params.AttributeLength);
+		evt->Params.AttributeValue = BLE_EvtBufferAlloc(container, evt->Params.AttributeLength);
 
 		if (!evt->Params.AttributeValue)
 		{
@@ -6053,7 +6212,7 @@ static memStatus_t Load_GAPLoadKeysIndication(bleEvtContainer_t *container, uint
 
 		if (evt->Keys.LtkInfo.LtkSize > 0)
 		{
-			evt->Keys.LtkInfo.Ltk = MEM_BufferAlloc(evt->Keys.LtkInfo.LtkSize);
+			evt->Keys.LtkInfo.Ltk = BLE_EvtBufferAlloc(container, evt->Keys.LtkInfo.LtkSize);
 
 			if (!evt->Keys.LtkInfo.Ltk)
 			{
@@ -6082,11 +6241,11 @@ static memStatus_t Load_GAPLoadKeysIndication(bleEvtContainer_t *container, uint
 
 		if (evt->Keys.RandEdivInfo.RandSize > 0)
 		{
-			evt->Keys.RandEdivInfo.Rand = MEM_BufferAlloc(evt->Keys.RandEdivInfo.RandSize);
+			evt->Keys.RandEdivInfo.Rand = BLE_EvtBufferAlloc(container, evt->Keys.RandEdivInfo.RandSize);
 
 			if (!evt->Keys.RandEdivInfo.Rand)
 			{
-				MEM_BufferFree(evt->Keys.LtkInfo.Ltk);
+				BLE_EvtBufferFree(container, evt->Keys.LtkInfo.Ltk);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -6138,7 +6297,7 @@ static memStatus_t Load_GAPLoadEncryptionInformationIndication(bleEvtContainer_t
 
 	if (evt->LtkSize > 0)
 	{
-		evt->Ltk = MEM_BufferAlloc(evt->LtkSize);
+		evt->Ltk = BLE_EvtBufferAlloc(container, evt->LtkSize);
 
 		if (!evt->Ltk)
 		{
@@ -6173,7 +6332,7 @@ static memStatus_t Load_GAPLoadCustomPeerInformationIndication(bleEvtContainer_t
 
 	if (evt->InfoSize > 0)
 	{
-		evt->Info = MEM_BufferAlloc(evt->InfoSize);
+		evt->Info = BLE_EvtBufferAlloc(container, evt->InfoSize);
 
 		if (!evt->Info)
 		{
@@ -6240,7 +6399,7 @@ static memStatus_t Load_GAPGetBondedDeviceNameIndication(bleEvtContainer_t *cont
 
 	if (evt->NameSize > 0)
 	{
-		evt->Name = MEM_BufferAlloc(evt->NameSize);
+		evt->Name = BLE_EvtBufferAlloc(container, evt->NameSize);
 
 		if (!evt->Name)
 		{
@@ -6582,7 +6741,7 @@ static memStatus_t Load_GAPScanningEventDeviceScannedIndication(bleEvtContainer_
 
 	if (evt->DataLength > 0)
 	{
-		evt->Data = MEM_BufferAlloc(evt->DataLength);
+		evt->Data = BLE_EvtBufferAlloc(container, evt->DataLength);
 
 		if (!evt->Data)
 		{
@@ -6786,7 +6945,7 @@ static memStatus_t Load_GAPConnectionEventKeysReceivedIndication(bleEvtContainer
 
 		if (evt->Keys.LtkInfo.LtkSize > 0)
 		{
-			evt->Keys.LtkInfo.Ltk = MEM_BufferAlloc(evt->Keys.LtkInfo.LtkSize);
+			evt->Keys.LtkInfo.Ltk = BLE_EvtBufferAlloc(container, evt->Keys.LtkInfo.LtkSize);
 
 			if (!evt->Keys.LtkInfo.Ltk)
 			{
@@ -6815,11 +6974,11 @@ static memStatus_t Load_GAPConnectionEventKeysReceivedIndication(bleEvtContainer
 
 		if (evt->Keys.RandEdivInfo.RandSize > 0)
 		{
-			evt->Keys.RandEdivInfo.Rand = MEM_BufferAlloc(evt->Keys.RandEdivInfo.RandSize);
+			evt->Keys.RandEdivInfo.Rand = BLE_EvtBufferAlloc(container, evt->Keys.RandEdivInfo.RandSize);
 
 			if (!evt->Keys.RandEdivInfo.Rand)
 			{
-				MEM_BufferFree(evt->Keys.LtkInfo.Ltk);
+				BLE_EvtBufferFree(container, evt->Keys.LtkInfo.Ltk);
 				return MEM_ALLOC_ERROR_c;
 			}
 
@@ -6870,7 +7029,7 @@ static memStatus_t Load_GAPConnectionEventLongTermKeyRequestIndication(bleEvtCon
 
 	if (evt->RandSize > 0)
 	{
-		evt->Rand = MEM_BufferAlloc(evt->RandSize);
+		evt->Rand = BLE_EvtBufferAlloc(container, evt->RandSize);
 
 		if (!evt->Rand)
 		{
@@ -7207,7 +7366,7 @@ static memStatus_t Load_GAPGetBondedDevicesIdentityInformationIndication(bleEvtC
 
 	if (evt->NbOfDeviceIdentityAddresses > 0)
 	{
-		evt->IdentityAddresses = MEM_BufferAlloc(evt->NbOfDeviceIdentityAddresses * sizeof(evt->IdentityAddresses[0]));
+		evt->IdentityAddresses = BLE_EvtBufferAlloc(container, evt->NbOfDeviceIdentityAddresses * sizeof(evt->IdentityAddresses[0]));
 
 		if (!evt->IdentityAddresses)
 		{
@@ -7502,7 +7661,7 @@ static memStatus_t Load_GAPScanningEventExtDeviceScannedIndication(bleEvtContain
 
 	if (evt->DataLength > 0)
 	{
-		evt->Data = MEM_BufferAlloc(evt->DataLength);
+		evt->Data = BLE_EvtBufferAlloc(container, evt->DataLength);
 
 		if (!evt->Data)
 		{
@@ -7588,7 +7747,7 @@ static memStatus_t Load_GAPScanningEventPeriodicDeviceScannedIndication(bleEvtCo
 
 	if (evt->DataLength > 0)
 	{
-		evt->Data = MEM_BufferAlloc(evt->DataLength);
+		evt->Data = BLE_EvtBufferAlloc(container, evt->DataLength);
 
 		if (!evt->Data)
 		{
@@ -7839,7 +7998,7 @@ static memStatus_t Load_GAPScanningEventConnectionlessIqReportReceivedIndication
 
 	if (evt->sampleCount > 0)
 	{
-		evt->I_samples = MEM_BufferAlloc(evt->sampleCount);
+		evt->I_samples = BLE_EvtBufferAlloc(container, evt->sampleCount);
 
 		if (!evt->I_samples)
 		{
@@ -7856,11 +8015,11 @@ static memStatus_t Load_GAPScanningEventConnectionlessIqReportReceivedIndication
 
 	if (evt->sampleCount > 0)
 	{
-		evt->Q_samples = MEM_BufferAlloc(evt->sampleCount);
+		evt->Q_samples = BLE_EvtBufferAlloc(container, evt->sampleCount);
 
 		if (!evt->Q_samples)
 		{
-			MEM_BufferFree(evt->I_samples);
+			BLE_EvtBufferFree(container, evt->I_samples);
 			return MEM_ALLOC_ERROR_c;
 		}
 
@@ -7900,7 +8059,7 @@ static memStatus_t Load_GAPConnectionEventIqReportReceivedIndication(bleEvtConta
 
 	if (evt->sampleCount > 0)
 	{
-		evt->I_samples = MEM_BufferAlloc(evt->sampleCount);
+		evt->I_samples = BLE_EvtBufferAlloc(container, evt->sampleCount);
 
 		if (!evt->I_samples)
 		{
@@ -7917,11 +8076,11 @@ static memStatus_t Load_GAPConnectionEventIqReportReceivedIndication(bleEvtConta
 
 	if (evt->sampleCount > 0)
 	{
-		evt->Q_samples = MEM_BufferAlloc(evt->sampleCount);
+		evt->Q_samples = BLE_EvtBufferAlloc(container, evt->sampleCount);
 
 		if (!evt->Q_samples)
 		{
-			MEM_BufferFree(evt->I_samples);
+			BLE_EvtBufferFree(container, evt->I_samples);
 			return MEM_ALLOC_ERROR_c;
 		}
 
@@ -8246,7 +8405,7 @@ static memStatus_t Load_GAPConnectionEventEattConnectionCompleteIndication(bleEv
 
 	if (evt->NoOfBearers > 0)
 	{
-		evt->BearerIDs = MEM_BufferAlloc(evt->NoOfBearers);
+		evt->BearerIDs = BLE_EvtBufferAlloc(container, evt->NoOfBearers);
 
 		if (!evt->BearerIDs)
 		{
@@ -8284,7 +8443,7 @@ static memStatus_t Load_GAPConnectionEventEattReconfigureResponseIndication(bleE
 
 	if (evt->NoOfBearers > 0)
 	{
-		evt->BearerIDs = MEM_BufferAlloc(evt->NoOfBearers);
+		evt->BearerIDs = BLE_EvtBufferAlloc(container, evt->NoOfBearers);
 
 		if (!evt->BearerIDs)
 		{
@@ -8350,9 +8509,132 @@ static memStatus_t Load_GAPGetHostVersionIndication(bleEvtContainer_t *container
 	return MEM_SUCCESS_c;
 }
 
+/*!*************************************************************************************************
+\fn		static memStatus_t Load_GAPScanningEventDeviceScannedBatchIndication(bleEvtContainer_t *container, uint8_t *pPayload)
+\brief	Scanned device reports coalesced by the board. Each record is the opcode and the length of
+		a single scanned device event followed by its payload; the records of unknown events are
+		skipped.
+***************************************************************************************************/
+static memStatus_t Load_GAPScanningEventDeviceScannedBatchIndication(bleEvtContainer_t *container, uint8_t *pPayload)
+{
+	GAPScanningEventDeviceScannedBatchIndication_t batch;
+	memStatus_t status = MEM_SUCCESS_c;
+	uint8_t noOfRecords;
+	uint8_t opCode;
+	uint16_t length;
+	uint32_t idx = 0;
+	uint32_t i;
+
+	noOfRecords = pPayload[idx]; idx++;
+	batch.NoOfReports = 0;
+
+	if (noOfRecords > 0)
+	{
+		batch.Reports = BLE_EvtBufferAlloc(container, noOfRecords * sizeof(batch.Reports[0]));
+
+		if (!batch.Reports)
+		{
+			return MEM_ALLOC_ERROR_c;
+		}
+	}
+	else
+	{
+		batch.Reports = NULL;
+	}
+
+	/* Each report is loaded in the container as its single event, then moved to the batch */
+	for (i = 0; i < noOfRecords && status == MEM_SUCCESS_c; i++)
+	{
+		opCode = pPayload[idx]; idx++;
+		FLib_MemCpy(&length, pPayload + idx, sizeof(length)); idx += sizeof(length);
+
+		if (opCode == (GAPScanningEventDeviceScannedIndication_FSCI_ID & 0xFF))
+		{
+			status = Load_GAPScanningEventDeviceScannedIndication(container, pPayload + idx);
+			batch.Reports[batch.NoOfReports].Data.DeviceScanned = container->Data.GAPScanningEventDeviceScannedIndication;
+		}
+		else if (opCode == (GAPScanningEventExtDeviceScannedIndication_FSCI_ID & 0xFF))
+		{
+			status = Load_GAPScanningEventExtDeviceScannedIndication(container, pPayload + idx);
+			batch.Reports[batch.NoOfReports].Data.ExtDeviceScanned = container->Data.GAPScanningEventExtDeviceScannedIndication;
+		}
+		else
+		{
+			idx += length;
+			continue;
+		}
+
+		if (status == MEM_SUCCESS_c)
+		{
+			batch.Reports[batch.NoOfReports].id = container->id;
+			batch.NoOfReports++;
+		}
+
+		idx += length;
+	}
+
+	/* Store (OG, OC) in ID, the reports loaded so far are released with the batch on failure */
+	container->id = GAPScanningEventDeviceScannedBatchIndication_FSCI_ID;
+	container->Data.GAPScanningEventDeviceScannedBatchIndication = batch;
+
+	return status;
+}
+
 #endif  /* GAP_ENABLE */
 
 
+/*!*************************************************************************************************
+\fn		memStatus_t KHC_BLE_RegisterEvtHandler(uint16_t id, pfnBleAppEvtHandler handler)
+\brief	Registers a handler receiving the packets with the given (OG, OC) as they are, instead
+		of KHC_BLE_RX_MsgHandler loading them into the container. NULL removes the handler.
+		The handler tables are not locked: register the handlers before the framer delivers
+		packets to KHC_BLE_RX_MsgHandler, from a single thread.
+
+\return	memStatus_t			MEM_SUCCESS_c, MEM_ALLOC_ERROR_c
+***************************************************************************************************/
+memStatus_t KHC_BLE_RegisterEvtHandler(uint16_t id, pfnBleAppEvtHandler handler)
+{
+	uint8_t og = id >> 8;
+
+	if (!appEvtHandlerTbl[og])
+	{
+		if (!handler)
+		{
+			return MEM_SUCCESS_c;
+		}
+
+		appEvtHandlerTbl[og] = MEM_BufferAlloc(256 * sizeof(pfnBleAppEvtHandler));
+		if (!appEvtHandlerTbl[og])
+		{
+			return MEM_ALLOC_ERROR_c;
+		}
+
+		FLib_MemSet(appEvtHandlerTbl[og], 0, 256 * sizeof(pfnBleAppEvtHandler));
+	}
+
+	appEvtHandlerTbl[og][id & 0xFF] = handler;
+	return MEM_SUCCESS_c;
+}
+
+/*!*************************************************************************************************
+\fn		void KHC_BLE_UnregisterEvtHandlers(void)
+\brief	Removes all the handlers registered with KHC_BLE_RegisterEvtHandler and frees their
+		tables. Call it once the framer no longer delivers packets to KHC_BLE_RX_MsgHandler.
+***************************************************************************************************/
+void KHC_BLE_UnregisterEvtHandlers(void)
+{
+	uint32_t og;
+
+	for (og = 0; og < 256; og++)
+	{
+		if (appEvtHandlerTbl[og])
+		{
+			MEM_BufferFree(appEvtHandlerTbl[og]);
+			appEvtHandlerTbl[og] = NULL;
+		}
+	}
+}
+
 void KHC_BLE_RX_MsgHandler(void *pData, void *param, uint8_t fsciInterface)
 {
 	if (!pData || !param)
@@ -8365,14 +8647,103 @@ void KHC_BLE_RX_MsgHandler(void *pData, void *param, uint8_t fsciInterface)
 	uint8_t og = frame->opGroup;
 	uint8_t oc = frame->opCode;
 	uint8_t *pPayload = frame->data;
-	uint16_t id = (og << 8) + oc, i;
 
-	for (i = 0; i < sizeof(evtHandlerTbl) / sizeof(evtHandlerTbl[0]); i++)
+	if (appEvtHandlerTbl[og] && appEvtHandlerTbl[og][oc])
 	{
-		if (evtHandlerTbl[i].id == id)
-		{
-			evtHandlerTbl[i].handlerFunc(container, pPayload);
-			break;
-		}
+		/* Nothing is loaded in the container for this packet */
+		container->id = 0;
+		appEvtHandlerTbl[og][oc](frame, fsciInterface);
+		return;
+	}
+
+	if (evtHandlerTbl[og] && evtHandlerTbl[og][oc])
+	{
+#if FSCI_EVT_ARENA
+		/* Drops the nested arrays of the event previously loaded in the container */
+		KHC_BLE_ResetEvtArena(container, BLE_EVT_ARENA_RATIO * frame->length);
+#endif  /* FSCI_EVT_ARENA */
+		evtHandlerTbl[og][oc](container, pPayload);
+	}
+}
+
+#if FSCI_EVT_ARENA
+/*!*************************************************************************************************
+\fn		void KHC_BLE_ResetEvtArena(bleEvtContainer_t *container, uint32_t cbHint)
+\brief	Releases at once the nested arrays of the event loaded in the container. The arena is
+		grown to the largest of cbHint and what the last event needed, so that events of a size
+		already seen are decoded without allocating. The container must start zeroed.
+***************************************************************************************************/
+void KHC_BLE_ResetEvtArena(bleEvtContainer_t *container, uint32_t cbHint)
+{
+	bleEvtArena_t *arena = &container->arena;
+	uint32_t cbWanted = arena->used + arena->spilled;
+	void *pNext;
+
+	while (arena->pSpill)
+	{
+		pNext = *(void **)arena->pSpill;
+		MEM_BufferFree(arena->pSpill);
+		arena->pSpill = pNext;
+	}
+
+	if (cbHint > cbWanted)
+	{
+		cbWanted = cbHint;
+	}
+
+	if (cbWanted > arena->size)
+	{
+		MEM_BufferFree(arena->pBuffer);
+		arena->pBuffer = MEM_BufferAlloc(cbWanted);
+		arena->size = arena->pBuffer ? cbWanted : 0;
 	}
+
+	arena->used = 0;
+	arena->spilled = 0;
+}
+
+/*!*************************************************************************************************
+\fn		void KHC_BLE_FreeEvtArena(bleEvtContainer_t *container)
+\brief	Releases the event loaded in the container and the memory held by its arena.
+***************************************************************************************************/
+void KHC_BLE_FreeEvtArena(bleEvtContainer_t *container)
+{
+	KHC_BLE_ResetEvtArena(container, 0);
+	MEM_BufferFree(container->arena.pBuffer);
+	FLib_MemSet(&container->arena, 0, sizeof(container->arena));
+}
+
+/*==================================================================================================
+Private Functions
+==================================================================================================*/
+/*!*************************************************************************************************
+\fn		static void *BLE_EvtArenaAlloc(bleEvtArena_t *arena, uint32_t size)
+\brief	Carves size bytes from the arena. Once it is full, the block is allocated separately and
+		chained, to be released by the next reset.
+***************************************************************************************************/
+static void *BLE_EvtArenaAlloc(bleEvtArena_t *arena, uint32_t size)
+{
+	uint8_t *pBlock;
+
+	size = (size + BLE_EVT_ARENA_ALIGN - 1) & ~(uint32_t)(BLE_EVT_ARENA_ALIGN - 1);
+
+	if (arena->size - arena->used >= size)
+	{
+		pBlock = arena->pBuffer + arena->used;
+		arena->used += size;
+		return pBlock;
+	}
+
+	pBlock = MEM_BufferAlloc(BLE_EVT_ARENA_ALIGN + size);
+	if (!pBlock)
+	{
+		return NULL;
+	}
+
+	*(void **)pBlock = arena->pSpill;
+	arena->pSpill = pBlock;
+	arena->spilled += size;
+
+	return pBlock + BLE_EVT_ARENA_ALIGN;
 }
+#endif  /* FSCI_EVT_ARENA */
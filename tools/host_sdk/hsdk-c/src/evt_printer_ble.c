@@ -1081,6 +1081,10 @@ void SHELL_BleEventNotify(void *param)
 			shell_write("L2CAPCBEnhancedReconfigureResponseIndication");
 			break;
 
+		case L2CAPCBLeCbDataBatchCompleteIndication_FSCI_ID:
+			shell_write("L2CAPCBLeCbDataBatchCompleteIndication");
+			break;
+
 #endif  /* L2CAPCB_ENABLE */
 
 #if GATT_ENABLE
@@ -17992,6 +17996,11 @@ void SHELL_BleEventNotify(void *param)
 			shell_write("GATTDBDynamicAddCharDescriptorWithUniqueValueIndication");
 			break;
 
+		case GATTDBDynamicAddServiceIndication_FSCI_ID:
+			shell_write("GATTDBDynamicAddServiceIndication");
+			shell_printf(" -> service 0x%04X, %d characteristics", container->Data.GATTDBDynamicAddServiceIndication.ServiceHandle, container->Data.GATTDBDynamicAddServiceIndication.NbOfCharacteristics);
+			break;
+
 #endif  /* GATTDB_APP_ENABLE */
 
 #if GATTDB_ATT_ENABLE
@@ -29933,6 +29942,11 @@ void SHELL_BleEventNotify(void *param)
 			shell_write("GAPGetHostVersionIndication");
 			break;
 
+		case GAPScanningEventDeviceScannedBatchIndication_FSCI_ID:
+			shell_write("GAPScanningEventDeviceScannedBatchIndication");
+			shell_printf(" -> %d reports", container->Data.GAPScanningEventDeviceScannedBatchIndication.NoOfReports);
+			break;
+
 #endif  /* GAP_ENABLE */
 
 	}
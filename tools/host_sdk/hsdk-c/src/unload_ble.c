@@ -37,6 +37,7 @@ static memStatus_t UnLoad_L2CAPCBLePsmEnhancedConnectRequestIndication(bleEvtCon
 static memStatus_t UnLoad_L2CAPCBLePsmEnhancedConnectionCompleteIndication(bleEvtContainer_t *container);
 static memStatus_t UnLoad_L2CAPCBEnhancedReconfigureRequestIndication(bleEvtContainer_t *container);
 static memStatus_t UnLoad_L2CAPCBEnhancedReconfigureResponseIndication(bleEvtContainer_t *container);
+static memStatus_t UnLoad_L2CAPCBLeCbDataBatchCompleteIndication(bleEvtContainer_t *container);
 #endif  /* L2CAPCB_ENABLE */
 
 #if GATT_ENABLE
@@ -107,6 +108,7 @@ static memStatus_t UnLoad_GATTDBDynamicAddCharacteristicDescriptorIndication(ble
 static memStatus_t UnLoad_GATTDBDynamicAddCccdIndication(bleEvtContainer_t *container);
 static memStatus_t UnLoad_GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueIndication(bleEvtContainer_t *container);
 static memStatus_t UnLoad_GATTDBDynamicAddCharDescriptorWithUniqueValueIndication(bleEvtContainer_t *container);
+static memStatus_t UnLoad_GATTDBDynamicAddServiceIndication(bleEvtContainer_t *container);
 #endif  /* GATTDB_APP_ENABLE */
 
 #if GATTDB_ATT_ENABLE
@@ -243,243 +245,296 @@ static memStatus_t UnLoad_GAPConnectionEventEattReconfigureResponseIndication(bl
 static memStatus_t UnLoad_GAPConnectionEventEattBearerStatusNotificationIndication(bleEvtContainer_t *container);
 static memStatus_t UnLoad_GAPGenericEventLeGenerateDhKeyCompleteIndication(bleEvtContainer_t *container);
 static memStatus_t UnLoad_GAPGetHostVersionIndication(bleEvtContainer_t *container);
+static memStatus_t UnLoad_GAPScanningEventDeviceScannedBatchIndication(bleEvtContainer_t *container);
 #endif  /* GAP_ENABLE */
 
 /*==================================================================================================
 Private global variables declarations
 ==================================================================================================*/
-static const bleUnEvtHandler_t unEvtHandlerTbl[] =
+#if FSCI_ENABLE
+/* opGroup 0xA4, indexed by opCode */
+static const pfnBleUnEvtHandler unEvtHandlerTbl_A4[256] =
+{
+	[FSCIGetNumberOfFreeBuffersResponse_FSCI_ID & 0xFF] = UnLoad_FSCIGetNumberOfFreeBuffersResponse,
+	[FSCIAckIndication_FSCI_ID & 0xFF] = UnLoad_FSCIAckIndication,
+	[FSCIErrorIndication_FSCI_ID & 0xFF] = UnLoad_FSCIErrorIndication,
+	[FSCIAllowDeviceToSleepConfirm_FSCI_ID & 0xFF] = UnLoad_FSCIAllowDeviceToSleepConfirm,
+	[FSCIWakeUpIndication_FSCI_ID & 0xFF] = UnLoad_FSCIWakeUpIndication,
+	[FSCIGetWakeupReasonResponse_FSCI_ID & 0xFF] = UnLoad_FSCIGetWakeupReasonResponse,
+	[FSCIGetNbuVersionResponse_FSCI_ID & 0xFF] = UnLoad_FSCIGetNbuVersionResponse,
+};
+#endif  /* FSCI_ENABLE */
+
+#if L2CAPCB_ENABLE
+/* opGroup 0x42, indexed by opCode */
+static const pfnBleUnEvtHandler unEvtHandlerTbl_42[256] =
+{
+	[L2CAPCBConfirm_FSCI_ID & 0xFF] = UnLoad_L2CAPCBConfirm,
+	[L2CAPCBLePsmConnectionRequestIndication_FSCI_ID & 0xFF] = UnLoad_L2CAPCBLePsmConnectionRequestIndication,
+	[L2CAPCBLePsmConnectionCompleteIndication_FSCI_ID & 0xFF] = UnLoad_L2CAPCBLePsmConnectionCompleteIndication,
+	[L2CAPCBLePsmDisconnectNotificationIndication_FSCI_ID & 0xFF] = UnLoad_L2CAPCBLePsmDisconnectNotificationIndication,
+	[L2CAPCBNoPeerCreditsIndication_FSCI_ID & 0xFF] = UnLoad_L2CAPCBNoPeerCreditsIndication,
+	[L2CAPCBLocalCreditsNotificationIndication_FSCI_ID & 0xFF] = UnLoad_L2CAPCBLocalCreditsNotificationIndication,
+	[L2CAPCBLeCbDataIndication_FSCI_ID & 0xFF] = UnLoad_L2CAPCBLeCbDataIndication,
+	[L2CAPCBErrorIndication_FSCI_ID & 0xFF] = UnLoad_L2CAPCBErrorIndication,
+	[L2CAPCBChannelStatusNotificationIndication_FSCI_ID & 0xFF] = UnLoad_L2CAPCBChannelStatusNotificationIndication,
+	[L2CAPCBLePsmEnhancedConnectRequestIndication_FSCI_ID & 0xFF] = UnLoad_L2CAPCBLePsmEnhancedConnectRequestIndication,
+	[L2CAPCBLePsmEnhancedConnectionCompleteIndication_FSCI_ID & 0xFF] = UnLoad_L2CAPCBLePsmEnhancedConnectionCompleteIndication,
+	[L2CAPCBEnhancedReconfigureRequestIndication_FSCI_ID & 0xFF] = UnLoad_L2CAPCBEnhancedReconfigureRequestIndication,
+	[L2CAPCBEnhancedReconfigureResponseIndication_FSCI_ID & 0xFF] = UnLoad_L2CAPCBEnhancedReconfigureResponseIndication,
+	[L2CAPCBLeCbDataBatchCompleteIndication_FSCI_ID & 0xFF] = UnLoad_L2CAPCBLeCbDataBatchCompleteIndication,
+};
+#endif  /* L2CAPCB_ENABLE */
+
+#if GATT_ENABLE
+/* opGroup 0x45, indexed by opCode */
+static const pfnBleUnEvtHandler unEvtHandlerTbl_45[256] =
+{
+	[GATTConfirm_FSCI_ID & 0xFF] = UnLoad_GATTConfirm,
+	[GATTGetMtuIndication_FSCI_ID & 0xFF] = UnLoad_GATTGetMtuIndication,
+	[GATTClientProcedureExchangeMtuIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureExchangeMtuIndication,
+	[GATTClientProcedureDiscoverAllPrimaryServicesIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureDiscoverAllPrimaryServicesIndication,
+	[GATTClientProcedureDiscoverPrimaryServicesByUuidIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureDiscoverPrimaryServicesByUuidIndication,
+	[GATTClientProcedureFindIncludedServicesIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureFindIncludedServicesIndication,
+	[GATTClientProcedureDiscoverAllCharacteristicsIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureDiscoverAllCharacteristicsIndication,
+	[GATTClientProcedureDiscoverCharacteristicByUuidIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureDiscoverCharacteristicByUuidIndication,
+	[GATTClientProcedureDiscoverAllCharacteristicDescriptorsIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureDiscoverAllCharacteristicDescriptorsIndication,
+	[GATTClientProcedureReadCharacteristicValueIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureReadCharacteristicValueIndication,
+	[GATTClientProcedureReadUsingCharacteristicUuidIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureReadUsingCharacteristicUuidIndication,
+	[GATTClientProcedureReadMultipleCharacteristicValuesIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureReadMultipleCharacteristicValuesIndication,
+	[GATTClientProcedureWriteCharacteristicValueIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureWriteCharacteristicValueIndication,
+	[GATTClientProcedureReadCharacteristicDescriptorIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureReadCharacteristicDescriptorIndication,
+	[GATTClientProcedureWriteCharacteristicDescriptorIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureWriteCharacteristicDescriptorIndication,
+	[GATTClientNotificationIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientNotificationIndication,
+	[GATTClientMultipleHandleValueNotificationIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientMultipleHandleValueNotificationIndication,
+	[GATTClientProcedureReadMultipleVariableLenCharValuesIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureReadMultipleVariableLenCharValuesIndication,
+	[GATTClientIndicationIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientIndicationIndication,
+	[GATTServerMtuChangedIndication_FSCI_ID & 0xFF] = UnLoad_GATTServerMtuChangedIndication,
+	[GATTServerHandleValueConfirmationIndication_FSCI_ID & 0xFF] = UnLoad_GATTServerHandleValueConfirmationIndication,
+	[GATTServerAttributeWrittenIndication_FSCI_ID & 0xFF] = UnLoad_GATTServerAttributeWrittenIndication,
+	[GATTServerCharacteristicCccdWrittenIndication_FSCI_ID & 0xFF] = UnLoad_GATTServerCharacteristicCccdWrittenIndication,
+	[GATTServerAttributeWrittenWithoutResponseIndication_FSCI_ID & 0xFF] = UnLoad_GATTServerAttributeWrittenWithoutResponseIndication,
+	[GATTServerErrorIndication_FSCI_ID & 0xFF] = UnLoad_GATTServerErrorIndication,
+	[GATTServerLongCharacteristicWrittenIndication_FSCI_ID & 0xFF] = UnLoad_GATTServerLongCharacteristicWrittenIndication,
+	[GATTServerAttributeReadIndication_FSCI_ID & 0xFF] = UnLoad_GATTServerAttributeReadIndication,
+	[GATTClientProcedureEnhancedDiscoverAllPrimaryServicesIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureEnhancedDiscoverAllPrimaryServicesIndication,
+	[GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuidIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuidIndication,
+	[GATTClientProcedureEnhancedFindIncludedServicesIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureEnhancedFindIncludedServicesIndication,
+	[GATTClientProcedureEnhancedDiscoverAllCharacteristicsIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureEnhancedDiscoverAllCharacteristicsIndication,
+	[GATTClientProcedureEnhancedDiscoverCharacteristicByUuidIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureEnhancedDiscoverCharacteristicByUuidIndication,
+	[GATTClientProcedureEnhancedDiscoverAllCharacteristicDescriptorsIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureEnhancedDiscoverAllCharacteristicDescriptorsIndication,
+	[GATTClientProcedureEnhancedReadCharacteristicValueIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureEnhancedReadCharacteristicValueIndication,
+	[GATTClientProcedureEnhancedReadUsingCharacteristicUuidIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureEnhancedReadUsingCharacteristicUuidIndication,
+	[GATTClientProcedureEnhancedReadMultipleCharacteristicValuesIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureEnhancedReadMultipleCharacteristicValuesIndication,
+	[GATTClientProcedureEnhancedWriteCharacteristicValueIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureEnhancedWriteCharacteristicValueIndication,
+	[GATTClientProcedureEnhancedReadCharacteristicDescriptorIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureEnhancedReadCharacteristicDescriptorIndication,
+	[GATTClientProcedureEnhancedWriteCharacteristicDescriptorIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureEnhancedWriteCharacteristicDescriptorIndication,
+	[GATTClientProcedureEnhancedReadMultipleVariableLenCharValuesIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientProcedureEnhancedReadMultipleVariableLenCharValuesIndication,
+	[GATTClientEnhancedMultipleHandleValueNotificationIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientEnhancedMultipleHandleValueNotificationIndication,
+	[GATTClientEnhancedNotificationIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientEnhancedNotificationIndication,
+	[GATTClientEnhancedIndicationIndication_FSCI_ID & 0xFF] = UnLoad_GATTClientEnhancedIndicationIndication,
+	[GATTServerEnhancedHandleValueConfirmationIndication_FSCI_ID & 0xFF] = UnLoad_GATTServerEnhancedHandleValueConfirmationIndication,
+	[GATTServerEnhancedAttributeWrittenIndication_FSCI_ID & 0xFF] = UnLoad_GATTServerEnhancedAttributeWrittenIndication,
+	[GATTServerEnhancedCharacteristicCccdWrittenIndication_FSCI_ID & 0xFF] = UnLoad_GATTServerEnhancedCharacteristicCccdWrittenIndication,
+	[GATTServerEnhancedAttributeWrittenWithoutResponseIndication_FSCI_ID & 0xFF] = UnLoad_GATTServerEnhancedAttributeWrittenWithoutResponseIndication,
+	[GATTServerEnhancedErrorIndication_FSCI_ID & 0xFF] = UnLoad_GATTServerEnhancedErrorIndication,
+	[GATTServerEnhancedLongCharacteristicWrittenIndication_FSCI_ID & 0xFF] = UnLoad_GATTServerEnhancedLongCharacteristicWrittenIndication,
+	[GATTServerEnhancedAttributeReadIndication_FSCI_ID & 0xFF] = UnLoad_GATTServerEnhancedAttributeReadIndication,
+};
+#endif  /* GATT_ENABLE */
+
+#if GATTDB_APP_ENABLE
+/* opGroup 0x46, indexed by opCode */
+static const pfnBleUnEvtHandler unEvtHandlerTbl_46[256] =
+{
+	[GATTDBConfirm_FSCI_ID & 0xFF] = UnLoad_GATTDBConfirm,
+	[GATTDBReadAttributeIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBReadAttributeIndication,
+	[GATTDBFindServiceHandleIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBFindServiceHandleIndication,
+	[GATTDBFindCharValueHandleInServiceIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBFindCharValueHandleInServiceIndication,
+	[GATTDBFindCccdHandleForCharValueHandleIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBFindCccdHandleForCharValueHandleIndication,
+	[GATTDBFindDescriptorHandleForCharValueHandleIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBFindDescriptorHandleForCharValueHandleIndication,
+	[GATTDBDynamicAddPrimaryServiceDeclarationIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBDynamicAddPrimaryServiceDeclarationIndication,
+	[GATTDBDynamicAddSecondaryServiceDeclarationIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBDynamicAddSecondaryServiceDeclarationIndication,
+	[GATTDBDynamicAddIncludeDeclarationIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBDynamicAddIncludeDeclarationIndication,
+	[GATTDBDynamicAddCharacteristicDeclarationAndValueIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBDynamicAddCharacteristicDeclarationAndValueIndication,
+	[GATTDBDynamicAddCharacteristicDescriptorIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBDynamicAddCharacteristicDescriptorIndication,
+	[GATTDBDynamicAddCccdIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBDynamicAddCccdIndication,
+	[GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueIndication,
+	[GATTDBDynamicAddCharDescriptorWithUniqueValueIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBDynamicAddCharDescriptorWithUniqueValueIndication,
+	[GATTDBDynamicAddServiceIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBDynamicAddServiceIndication,
+};
+#endif  /* GATTDB_APP_ENABLE */
+
+#if GATTDB_ATT_ENABLE
+/* opGroup 0x47, indexed by opCode */
+static const pfnBleUnEvtHandler unEvtHandlerTbl_47[256] =
+{
+	[GATTDBAttConfirm_FSCI_ID & 0xFF] = UnLoad_GATTDBAttConfirm,
+	[GATTDBAttFindInformationIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBAttFindInformationIndication,
+	[GATTDBAttFindByTypeValueIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBAttFindByTypeValueIndication,
+	[GATTDBAttReadByTypeIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBAttReadByTypeIndication,
+	[GATTDBAttReadIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBAttReadIndication,
+	[GATTDBAttReadBlobIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBAttReadBlobIndication,
+	[GATTDBAttReadMultipleIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBAttReadMultipleIndication,
+	[GATTDBAttReadByGroupTypeIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBAttReadByGroupTypeIndication,
+	[GATTDBAttWriteIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBAttWriteIndication,
+	[GATTDBAttPrepareWriteIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBAttPrepareWriteIndication,
+	[GATTDBAttExecuteWriteIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBAttExecuteWriteIndication,
+	[GATTDBAttExecuteWriteFromQueueIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBAttExecuteWriteFromQueueIndication,
+	[GATTDBAttPrepareNotificationIndicationIndication_FSCI_ID & 0xFF] = UnLoad_GATTDBAttPrepareNotificationIndicationIndication,
+};
+#endif  /* GATTDB_ATT_ENABLE */
+
+#if GAP_ENABLE
+/* opGroup 0x48, indexed by opCode */
+static const pfnBleUnEvtHandler unEvtHandlerTbl_48[256] =
+{
+	[GAPConfirm_FSCI_ID & 0xFF] = UnLoad_GAPConfirm,
+	[GAPCheckNotificationStatusIndication_FSCI_ID & 0xFF] = UnLoad_GAPCheckNotificationStatusIndication,
+	[GAPCheckIndicationStatusIndication_FSCI_ID & 0xFF] = UnLoad_GAPCheckIndicationStatusIndication,
+	[GAPLoadKeysIndication_FSCI_ID & 0xFF] = UnLoad_GAPLoadKeysIndication,
+	[GAPLoadEncryptionInformationIndication_FSCI_ID & 0xFF] = UnLoad_GAPLoadEncryptionInformationIndication,
+	[GAPLoadCustomPeerInformationIndication_FSCI_ID & 0xFF] = UnLoad_GAPLoadCustomPeerInformationIndication,
+	[GAPCheckIfBondedIndication_FSCI_ID & 0xFF] = UnLoad_GAPCheckIfBondedIndication,
+	[GAPGetBondedDevicesCountIndication_FSCI_ID & 0xFF] = UnLoad_GAPGetBondedDevicesCountIndication,
+	[GAPGetBondedDeviceNameIndication_FSCI_ID & 0xFF] = UnLoad_GAPGetBondedDeviceNameIndication,
+	[GAPGenericEventInitializationCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventInitializationCompleteIndication,
+	[GAPGenericEventInternalErrorIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventInternalErrorIndication,
+	[GAPGenericEventAdvertisingSetupFailedIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventAdvertisingSetupFailedIndication,
+	[GAPGenericEventAdvertisingParametersSetupCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventAdvertisingParametersSetupCompleteIndication,
+	[GAPGenericEventAdvertisingDataSetupCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventAdvertisingDataSetupCompleteIndication,
+	[GAPGenericEventFilterAcceptListSizeReadIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventFilterAcceptListSizeReadIndication,
+	[GAPGenericEventDeviceAddedToFilterAcceptListIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventDeviceAddedToFilterAcceptListIndication,
+	[GAPGenericEventDeviceRemovedFromFilterAcceptListIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventDeviceRemovedFromFilterAcceptListIndication,
+	[GAPGenericEventFilterAcceptListClearedIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventFilterAcceptListClearedIndication,
+	[GAPGenericEventRandomAddressReadyIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventRandomAddressReadyIndication,
+	[GAPGenericEventCreateConnectionCanceledIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventCreateConnectionCanceledIndication,
+	[GAPGenericEventPublicAddressReadIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventPublicAddressReadIndication,
+	[GAPGenericEventAdvTxPowerLevelReadIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventAdvTxPowerLevelReadIndication,
+	[GAPGenericEventPrivateResolvableAddressVerifiedIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventPrivateResolvableAddressVerifiedIndication,
+	[GAPGenericEventRandomAddressSetIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventRandomAddressSetIndication,
+	[GAPAdvertisingEventStateChangedIndication_FSCI_ID & 0xFF] = UnLoad_GAPAdvertisingEventStateChangedIndication,
+	[GAPAdvertisingEventCommandFailedIndication_FSCI_ID & 0xFF] = UnLoad_GAPAdvertisingEventCommandFailedIndication,
+	[GAPScanningEventStateChangedIndication_FSCI_ID & 0xFF] = UnLoad_GAPScanningEventStateChangedIndication,
+	[GAPScanningEventCommandFailedIndication_FSCI_ID & 0xFF] = UnLoad_GAPScanningEventCommandFailedIndication,
+	[GAPScanningEventDeviceScannedIndication_FSCI_ID & 0xFF] = UnLoad_GAPScanningEventDeviceScannedIndication,
+	[GAPConnectionEventConnectedIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventConnectedIndication,
+	[GAPConnectionEventPairingRequestIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventPairingRequestIndication,
+	[GAPConnectionEventPeripheralSecurityRequestIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventPeripheralSecurityRequestIndication,
+	[GAPConnectionEventPairingResponseIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventPairingResponseIndication,
+	[GAPConnectionEventAuthenticationRejectedIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventAuthenticationRejectedIndication,
+	[GAPConnectionEventPasskeyRequestIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventPasskeyRequestIndication,
+	[GAPConnectionEventOobRequestIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventOobRequestIndication,
+	[GAPConnectionEventPasskeyDisplayIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventPasskeyDisplayIndication,
+	[GAPConnectionEventKeyExchangeRequestIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventKeyExchangeRequestIndication,
+	[GAPConnectionEventKeysReceivedIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventKeysReceivedIndication,
+	[GAPConnectionEventLongTermKeyRequestIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventLongTermKeyRequestIndication,
+	[GAPConnectionEventEncryptionChangedIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventEncryptionChangedIndication,
+	[GAPConnectionEventPairingCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventPairingCompleteIndication,
+	[GAPConnectionEventDisconnectedIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventDisconnectedIndication,
+	[GAPConnectionEventRssiReadIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventRssiReadIndication,
+	[GAPConnectionEventTxPowerLevelReadIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventTxPowerLevelReadIndication,
+	[GAPConnectionEventPowerReadFailureIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventPowerReadFailureIndication,
+	[GAPConnectionEventParameterUpdateRequestIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventParameterUpdateRequestIndication,
+	[GAPConnectionEventParameterUpdateCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventParameterUpdateCompleteIndication,
+	[GAPConnectionEventLeDataLengthChangedIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventLeDataLengthChangedIndication,
+	[GAPConnectionEventLeScOobDataRequestIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventLeScOobDataRequestIndication,
+	[GAPConnectionEventLeScDisplayNumericValueIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventLeScDisplayNumericValueIndication,
+	[GAPConnectionEventLeScKeypressNotificationIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventLeScKeypressNotificationIndication,
+	[GAPLeScPublicKeyRegeneratedIndication_FSCI_ID & 0xFF] = UnLoad_GAPLeScPublicKeyRegeneratedIndication,
+	[GAPGenericEventLeScLocalOobDataIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventLeScLocalOobDataIndication,
+	[GAPGenericEventHostPrivacyStateChangedIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventHostPrivacyStateChangedIndication,
+	[GAPGenericEventControllerPrivacyStateChangedIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventControllerPrivacyStateChangedIndication,
+	[GAPGenericEventTxPowerLevelSetCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventTxPowerLevelSetCompleteIndication,
+	[GAPGenericEventLePhyEventIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventLePhyEventIndication,
+	[GAPGetBondedDevicesIdentityInformationIndication_FSCI_ID & 0xFF] = UnLoad_GAPGetBondedDevicesIdentityInformationIndication,
+	[GAPControllerNotificationIndication_FSCI_ID & 0xFF] = UnLoad_GAPControllerNotificationIndication,
+	[GAPBondCreatedIndication_FSCI_ID & 0xFF] = UnLoad_GAPBondCreatedIndication,
+	[GAPGenericEventChannelMapSetIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventChannelMapSetIndication,
+	[GAPConnectionEventChannelMapReadIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventChannelMapReadIndication,
+	[GAPConnectionEventChannelMapReadFailureIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventChannelMapReadFailureIndication,
+	[GAPGenericEventExtAdvertisingParamSetupCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventExtAdvertisingParamSetupCompleteIndication,
+	[GAPGenericEventExtAdvertisingDataSetupCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventExtAdvertisingDataSetupCompleteIndication,
+	[GAPGenericEventPeriodicAdvParamSetupCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventPeriodicAdvParamSetupCompleteIndication,
+	[GAPGenericEventPeriodicAdvDataSetupCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventPeriodicAdvDataSetupCompleteIndication,
+	[GAPGenericEventPeriodicAdvListUpdateCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventPeriodicAdvListUpdateCompleteIndication,
+	[GAPAdvertisingEventExtAdvertisingStateChangedIndication_FSCI_ID & 0xFF] = UnLoad_GAPAdvertisingEventExtAdvertisingStateChangedIndication,
+	[GAPAdvertisingEventAdvertisingSetTerminatedIndication_FSCI_ID & 0xFF] = UnLoad_GAPAdvertisingEventAdvertisingSetTerminatedIndication,
+	[GAPAdvertisingEventExtAdvertisingSetRemoveCompletedIndication_FSCI_ID & 0xFF] = UnLoad_GAPAdvertisingEventExtAdvertisingSetRemoveCompletedIndication,
+	[GAPAdvertisingEventExtScanReqReceivedIndication_FSCI_ID & 0xFF] = UnLoad_GAPAdvertisingEventExtScanReqReceivedIndication,
+	[GAPGenericEventPeriodicAdvertisingStateChangedIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventPeriodicAdvertisingStateChangedIndication,
+	[GAPScanningEventExtDeviceScannedIndication_FSCI_ID & 0xFF] = UnLoad_GAPScanningEventExtDeviceScannedIndication,
+	[GAPScanningEventPeriodicAdvSyncEstablishedIndication_FSCI_ID & 0xFF] = UnLoad_GAPScanningEventPeriodicAdvSyncEstablishedIndication,
+	[GAPScanningEventPeriodicAdvSyncTerminatedIndication_FSCI_ID & 0xFF] = UnLoad_GAPScanningEventPeriodicAdvSyncTerminatedIndication,
+	[GAPScanningEventPeriodicAdvSyncLostIndication_FSCI_ID & 0xFF] = UnLoad_GAPScanningEventPeriodicAdvSyncLostIndication,
+	[GAPScanningEventPeriodicDeviceScannedIndication_FSCI_ID & 0xFF] = UnLoad_GAPScanningEventPeriodicDeviceScannedIndication,
+	[GAPGenericEventPeriodicAdvCreateSyncCancelledIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventPeriodicAdvCreateSyncCancelledIndication,
+	[GAPConnectionEventChannelSelectionAlgorithm2Indication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventChannelSelectionAlgorithm2Indication,
+	[GAPGenericEventTxEntryAvailableIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventTxEntryAvailableIndication,
+	[GAPGenericEventControllerLocalRPAReadIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventControllerLocalRPAReadIndication,
+	[GAPCheckNvmIndexIndication_FSCI_ID & 0xFF] = UnLoad_GAPCheckNvmIndexIndication,
+	[GAPGetDeviceIdFromConnHandleIndication_FSCI_ID & 0xFF] = UnLoad_GAPGetDeviceIdFromConnHandleIndication,
+	[GAPGetConnectionHandleFromDeviceIdIndication_FSCI_ID & 0xFF] = UnLoad_GAPGetConnectionHandleFromDeviceIdIndication,
+	[GAPPairingEventNoLTKIndication_FSCI_ID & 0xFF] = UnLoad_GAPPairingEventNoLTKIndication,
+	[GAPPairingAlreadyStartedIndication_FSCI_ID & 0xFF] = UnLoad_GAPPairingAlreadyStartedIndication,
+	[GAPGenericEventConnectionlessCteTransmitParamsSetupCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventConnectionlessCteTransmitParamsSetupCompleteIndication,
+	[GAPGenericEventConnectionlessCteTransmitStateChangedIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventConnectionlessCteTransmitStateChangedIndication,
+	[GAPGenericEventConnectionlessIqSamplingStateChangedIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventConnectionlessIqSamplingStateChangedIndication,
+	[GAPGenericEventAntennaInformationReadIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventAntennaInformationReadIndication,
+	[GAPScanningEventConnectionlessIqReportReceivedIndication_FSCI_ID & 0xFF] = UnLoad_GAPScanningEventConnectionlessIqReportReceivedIndication,
+	[GAPConnectionEventIqReportReceivedIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventIqReportReceivedIndication,
+	[GAPConnectionEventCteRequestFailedIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventCteRequestFailedIndication,
+	[GAPConnectionEventCteReceiveParamsSetupCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventCteReceiveParamsSetupCompleteIndication,
+	[GAPConnectionEventCteTransmitParamsSetupCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventCteTransmitParamsSetupCompleteIndication,
+	[GAPConnectionEventCteReqStateChangedIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventCteReqStateChangedIndication,
+	[GAPConnectionEventCteRspStateChangedIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventCteRspStateChangedIndication,
+	[GAPGenericEventPeriodicAdvRecvEnableCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventPeriodicAdvRecvEnableCompleteIndication,
+	[GAPGenericEventPeriodicAdvSyncTransferCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventPeriodicAdvSyncTransferCompleteIndication,
+	[GAPGenericEventPeriodicAdvSetInfoTransferCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventPeriodicAdvSetInfoTransferCompleteIndication,
+	[GAPGenericEventSetPeriodicAdvSyncTransferParamsCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventSetPeriodicAdvSyncTransferParamsCompleteIndication,
+	[GAPGenericEventSetDefaultPeriodicAdvSyncTransferParamsCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventSetDefaultPeriodicAdvSyncTransferParamsCompleteIndication,
+	[GAPScanningEventPeriodicAdvSyncTransferReceivedIndication_FSCI_ID & 0xFF] = UnLoad_GAPScanningEventPeriodicAdvSyncTransferReceivedIndication,
+	[GAPConnectionEventPathLossThresholdIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventPathLossThresholdIndication,
+	[GAPConnectionEventTransmitPowerReportingIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventTransmitPowerReportingIndication,
+	[GAPConnectionEventEnhancedReadTransmitPowerLevelIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventEnhancedReadTransmitPowerLevelIndication,
+	[GAPConnectionEventPathLossReportingParamsSetupCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventPathLossReportingParamsSetupCompleteIndication,
+	[GAPConnectionEventPathLossReportingStateChangedIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventPathLossReportingStateChangedIndication,
+	[GAPConnectionEventTransmitPowerReportingStateChangedIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventTransmitPowerReportingStateChangedIndication,
+	[GAPConnectionEventEattConnectionRequestIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventEattConnectionRequestIndication,
+	[GAPConnectionEventEattConnectionCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventEattConnectionCompleteIndication,
+	[GAPConnectionEventEattReconfigureResponseIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventEattReconfigureResponseIndication,
+	[GAPConnectionEventEattBearerStatusNotificationIndication_FSCI_ID & 0xFF] = UnLoad_GAPConnectionEventEattBearerStatusNotificationIndication,
+	[GAPGenericEventLeGenerateDhKeyCompleteIndication_FSCI_ID & 0xFF] = UnLoad_GAPGenericEventLeGenerateDhKeyCompleteIndication,
+	[GAPGetHostVersionIndication_FSCI_ID & 0xFF] = UnLoad_GAPGetHostVersionIndication,
+	[GAPScanningEventDeviceScannedBatchIndication_FSCI_ID & 0xFF] = UnLoad_GAPScanningEventDeviceScannedBatchIndication,
+};
+#endif  /* GAP_ENABLE */
+
+/* Unload handlers, indexed by opGroup */
+static const pfnBleUnEvtHandler *const unEvtHandlerTbl[256] =
 {
 #if FSCI_ENABLE
-	{FSCIGetNumberOfFreeBuffersResponse_FSCI_ID, UnLoad_FSCIGetNumberOfFreeBuffersResponse},
-	{FSCIAckIndication_FSCI_ID, UnLoad_FSCIAckIndication},
-	{FSCIErrorIndication_FSCI_ID, UnLoad_FSCIErrorIndication},
-	{FSCIAllowDeviceToSleepConfirm_FSCI_ID, UnLoad_FSCIAllowDeviceToSleepConfirm},
-	{FSCIWakeUpIndication_FSCI_ID, UnLoad_FSCIWakeUpIndication},
-	{FSCIGetWakeupReasonResponse_FSCI_ID, UnLoad_FSCIGetWakeupReasonResponse},
-	{FSCIGetNbuVersionResponse_FSCI_ID, UnLoad_FSCIGetNbuVersionResponse},
+	[0xA4] = unEvtHandlerTbl_A4,
 #endif  /* FSCI_ENABLE */
 
 #if L2CAPCB_ENABLE
-	{L2CAPCBConfirm_FSCI_ID, UnLoad_L2CAPCBConfirm},
-	{L2CAPCBLePsmConnectionRequestIndication_FSCI_ID, UnLoad_L2CAPCBLePsmConnectionRequestIndication},
-	{L2CAPCBLePsmConnectionCompleteIndication_FSCI_ID, UnLoad_L2CAPCBLePsmConnectionCompleteIndication},
-	{L2CAPCBLePsmDisconnectNotificationIndication_FSCI_ID, UnLoad_L2CAPCBLePsmDisconnectNotificationIndication},
-	{L2CAPCBNoPeerCreditsIndication_FSCI_ID, UnLoad_L2CAPCBNoPeerCreditsIndication},
-	{L2CAPCBLocalCreditsNotificationIndication_FSCI_ID, UnLoad_L2CAPCBLocalCreditsNotificationIndication},
-	{L2CAPCBLeCbDataIndication_FSCI_ID, UnLoad_L2CAPCBLeCbDataIndication},
-	{L2CAPCBErrorIndication_FSCI_ID, UnLoad_L2CAPCBErrorIndication},
-	{L2CAPCBChannelStatusNotificationIndication_FSCI_ID, UnLoad_L2CAPCBChannelStatusNotificationIndication},
-	{L2CAPCBLePsmEnhancedConnectRequestIndication_FSCI_ID, UnLoad_L2CAPCBLePsmEnhancedConnectRequestIndication},
-	{L2CAPCBLePsmEnhancedConnectionCompleteIndication_FSCI_ID, UnLoad_L2CAPCBLePsmEnhancedConnectionCompleteIndication},
-	{L2CAPCBEnhancedReconfigureRequestIndication_FSCI_ID, UnLoad_L2CAPCBEnhancedReconfigureRequestIndication},
-	{L2CAPCBEnhancedReconfigureResponseIndication_FSCI_ID, UnLoad_L2CAPCBEnhancedReconfigureResponseIndication},
+	[0x42] = unEvtHandlerTbl_42,
 #endif  /* L2CAPCB_ENABLE */
 
 #if GATT_ENABLE
-	{GATTConfirm_FSCI_ID, UnLoad_GATTConfirm},
-	{GATTGetMtuIndication_FSCI_ID, UnLoad_GATTGetMtuIndication},
-	{GATTClientProcedureExchangeMtuIndication_FSCI_ID, UnLoad_GATTClientProcedureExchangeMtuIndication},
-	{GATTClientProcedureDiscoverAllPrimaryServicesIndication_FSCI_ID, UnLoad_GATTClientProcedureDiscoverAllPrimaryServicesIndication},
-	{GATTClientProcedureDiscoverPrimaryServicesByUuidIndication_FSCI_ID, UnLoad_GATTClientProcedureDiscoverPrimaryServicesByUuidIndication},
-	{GATTClientProcedureFindIncludedServicesIndication_FSCI_ID, UnLoad_GATTClientProcedureFindIncludedServicesIndication},
-	{GATTClientProcedureDiscoverAllCharacteristicsIndication_FSCI_ID, UnLoad_GATTClientProcedureDiscoverAllCharacteristicsIndication},
-	{GATTClientProcedureDiscoverCharacteristicByUuidIndication_FSCI_ID, UnLoad_GATTClientProcedureDiscoverCharacteristicByUuidIndication},
-	{GATTClientProcedureDiscoverAllCharacteristicDescriptorsIndication_FSCI_ID, UnLoad_GATTClientProcedureDiscoverAllCharacteristicDescriptorsIndication},
-	{GATTClientProcedureReadCharacteristicValueIndication_FSCI_ID, UnLoad_GATTClientProcedureReadCharacteristicValueIndication},
-	{GATTClientProcedureReadUsingCharacteristicUuidIndication_FSCI_ID, UnLoad_GATTClientProcedureReadUsingCharacteristicUuidIndication},
-	{GATTClientProcedureReadMultipleCharacteristicValuesIndication_FSCI_ID, UnLoad_GATTClientProcedureReadMultipleCharacteristicValuesIndication},
-	{GATTClientProcedureWriteCharacteristicValueIndication_FSCI_ID, UnLoad_GATTClientProcedureWriteCharacteristicValueIndication},
-	{GATTClientProcedureReadCharacteristicDescriptorIndication_FSCI_ID, UnLoad_GATTClientProcedureReadCharacteristicDescriptorIndication},
-	{GATTClientProcedureWriteCharacteristicDescriptorIndication_FSCI_ID, UnLoad_GATTClientProcedureWriteCharacteristicDescriptorIndication},
-	{GATTClientNotificationIndication_FSCI_ID, UnLoad_GATTClientNotificationIndication},
-	{GATTClientMultipleHandleValueNotificationIndication_FSCI_ID, UnLoad_GATTClientMultipleHandleValueNotificationIndication},
-	{GATTClientProcedureReadMultipleVariableLenCharValuesIndication_FSCI_ID, UnLoad_GATTClientProcedureReadMultipleVariableLenCharValuesIndication},
-	{GATTClientIndicationIndication_FSCI_ID, UnLoad_GATTClientIndicationIndication},
-	{GATTServerMtuChangedIndication_FSCI_ID, UnLoad_GATTServerMtuChangedIndication},
-	{GATTServerHandleValueConfirmationIndication_FSCI_ID, UnLoad_GATTServerHandleValueConfirmationIndication},
-	{GATTServerAttributeWrittenIndication_FSCI_ID, UnLoad_GATTServerAttributeWrittenIndication},
-	{GATTServerCharacteristicCccdWrittenIndication_FSCI_ID, UnLoad_GATTServerCharacteristicCccdWrittenIndication},
-	{GATTServerAttributeWrittenWithoutResponseIndication_FSCI_ID, UnLoad_GATTServerAttributeWrittenWithoutResponseIndication},
-	{GATTServerErrorIndication_FSCI_ID, UnLoad_GATTServerErrorIndication},
-	{GATTServerLongCharacteristicWrittenIndication_FSCI_ID, UnLoad_GATTServerLongCharacteristicWrittenIndication},
-	{GATTServerAttributeReadIndication_FSCI_ID, UnLoad_GATTServerAttributeReadIndication},
-	{GATTClientProcedureEnhancedDiscoverAllPrimaryServicesIndication_FSCI_ID, UnLoad_GATTClientProcedureEnhancedDiscoverAllPrimaryServicesIndication},
-	{GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuidIndication_FSCI_ID, UnLoad_GATTClientProcedureEnhancedDiscoverPrimaryServicesByUuidIndication},
-	{GATTClientProcedureEnhancedFindIncludedServicesIndication_FSCI_ID, UnLoad_GATTClientProcedureEnhancedFindIncludedServicesIndication},
-	{GATTClientProcedureEnhancedDiscoverAllCharacteristicsIndication_FSCI_ID, UnLoad_GATTClientProcedureEnhancedDiscoverAllCharacteristicsIndication},
-	{GATTClientProcedureEnhancedDiscoverCharacteristicByUuidIndication_FSCI_ID, UnLoad_GATTClientProcedureEnhancedDiscoverCharacteristicByUuidIndication},
-	{GATTClientProcedureEnhancedDiscoverAllCharacteristicDescriptorsIndication_FSCI_ID, UnLoad_GATTClientProcedureEnhancedDiscoverAllCharacteristicDescriptorsIndication},
-	{GATTClientProcedureEnhancedReadCharacteristicValueIndication_FSCI_ID, UnLoad_GATTClientProcedureEnhancedReadCharacteristicValueIndication},
-	{GATTClientProcedureEnhancedReadUsingCharacteristicUuidIndication_FSCI_ID, UnLoad_GATTClientProcedureEnhancedReadUsingCharacteristicUuidIndication},
-	{GATTClientProcedureEnhancedReadMultipleCharacteristicValuesIndication_FSCI_ID, UnLoad_GATTClientProcedureEnhancedReadMultipleCharacteristicValuesIndication},
-	{GATTClientProcedureEnhancedWriteCharacteristicValueIndication_FSCI_ID, UnLoad_GATTClientProcedureEnhancedWriteCharacteristicValueIndication},
-	{GATTClientProcedureEnhancedReadCharacteristicDescriptorIndication_FSCI_ID, UnLoad_GATTClientProcedureEnhancedReadCharacteristicDescriptorIndication},
-	{GATTClientProcedureEnhancedWriteCharacteristicDescriptorIndication_FSCI_ID, UnLoad_GATTClientProcedureEnhancedWriteCharacteristicDescriptorIndication},
-	{GATTClientProcedureEnhancedReadMultipleVariableLenCharValuesIndication_FSCI_ID, UnLoad_GATTClientProcedureEnhancedReadMultipleVariableLenCharValuesIndication},
-	{GATTClientEnhancedMultipleHandleValueNotificationIndication_FSCI_ID, UnLoad_GATTClientEnhancedMultipleHandleValueNotificationIndication},
-	{GATTClientEnhancedNotificationIndication_FSCI_ID, UnLoad_GATTClientEnhancedNotificationIndication},
-	{GATTClientEnhancedIndicationIndication_FSCI_ID, UnLoad_GATTClientEnhancedIndicationIndication},
-	{GATTServerEnhancedHandleValueConfirmationIndication_FSCI_ID, UnLoad_GATTServerEnhancedHandleValueConfirmationIndication},
-	{GATTServerEnhancedAttributeWrittenIndication_FSCI_ID, UnLoad_GATTServerEnhancedAttributeWrittenIndication},
-	{GATTServerEnhancedCharacteristicCccdWrittenIndication_FSCI_ID, UnLoad_GATTServerEnhancedCharacteristicCccdWrittenIndication},
-	{GATTServerEnhancedAttributeWrittenWithoutResponseIndication_FSCI_ID, UnLoad_GATTServerEnhancedAttributeWrittenWithoutResponseIndication},
-	{GATTServerEnhancedErrorIndication_FSCI_ID, UnLoad_GATTServerEnhancedErrorIndication},
-	{GATTServerEnhancedLongCharacteristicWrittenIndication_FSCI_ID, UnLoad_GATTServerEnhancedLongCharacteristicWrittenIndication},
-	{GATTServerEnhancedAttributeReadIndication_FSCI_ID, UnLoad_GATTServerEnhancedAttributeReadIndication},
+	[0x45] = unEvtHandlerTbl_45,
 #endif  /* GATT_ENABLE */
 
 #if GATTDB_APP_ENABLE
-	{GATTDBConfirm_FSCI_ID, UnLoad_GATTDBConfirm},
-	{GATTDBReadAttributeIndication_FSCI_ID, UnLoad_GATTDBReadAttributeIndication},
-	{GATTDBFindServiceHandleIndication_FSCI_ID, UnLoad_GATTDBFindServiceHandleIndication},
-	{GATTDBFindCharValueHandleInServiceIndication_FSCI_ID, UnLoad_GATTDBFindCharValueHandleInServiceIndication},
-	{GATTDBFindCccdHandleForCharValueHandleIndication_FSCI_ID, UnLoad_GATTDBFindCccdHandleForCharValueHandleIndication},
-	{GATTDBFindDescriptorHandleForCharValueHandleIndication_FSCI_ID, UnLoad_GATTDBFindDescriptorHandleForCharValueHandleIndication},
-	{GATTDBDynamicAddPrimaryServiceDeclarationIndication_FSCI_ID, UnLoad_GATTDBDynamicAddPrimaryServiceDeclarationIndication},
-	{GATTDBDynamicAddSecondaryServiceDeclarationIndication_FSCI_ID, UnLoad_GATTDBDynamicAddSecondaryServiceDeclarationIndication},
-	{GATTDBDynamicAddIncludeDeclarationIndication_FSCI_ID, UnLoad_GATTDBDynamicAddIncludeDeclarationIndication},
-	{GATTDBDynamicAddCharacteristicDeclarationAndValueIndication_FSCI_ID, UnLoad_GATTDBDynamicAddCharacteristicDeclarationAndValueIndication},
-	{GATTDBDynamicAddCharacteristicDescriptorIndication_FSCI_ID, UnLoad_GATTDBDynamicAddCharacteristicDescriptorIndication},
-	{GATTDBDynamicAddCccdIndication_FSCI_ID, UnLoad_GATTDBDynamicAddCccdIndication},
-	{GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueIndication_FSCI_ID, UnLoad_GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueIndication},
-	{GATTDBDynamicAddCharDescriptorWithUniqueValueIndication_FSCI_ID, UnLoad_GATTDBDynamicAddCharDescriptorWithUniqueValueIndication},
+	[0x46] = unEvtHandlerTbl_46,
 #endif  /* GATTDB_APP_ENABLE */
 
 #if GATTDB_ATT_ENABLE
-	{GATTDBAttConfirm_FSCI_ID, UnLoad_GATTDBAttConfirm},
-	{GATTDBAttFindInformationIndication_FSCI_ID, UnLoad_GATTDBAttFindInformationIndication},
-	{GATTDBAttFindByTypeValueIndication_FSCI_ID, UnLoad_GATTDBAttFindByTypeValueIndication},
-	{GATTDBAttReadByTypeIndication_FSCI_ID, UnLoad_GATTDBAttReadByTypeIndication},
-	{GATTDBAttReadIndication_FSCI_ID, UnLoad_GATTDBAttReadIndication},
-	{GATTDBAttReadBlobIndication_FSCI_ID, UnLoad_GATTDBAttReadBlobIndication},
-	{GATTDBAttReadMultipleIndication_FSCI_ID, UnLoad_GATTDBAttReadMultipleIndication},
-	{GATTDBAttReadByGroupTypeIndication_FSCI_ID, UnLoad_GATTDBAttReadByGroupTypeIndication},
-	{GATTDBAttWriteIndication_FSCI_ID, UnLoad_GATTDBAttWriteIndication},
-	{GATTDBAttPrepareWriteIndication_FSCI_ID, UnLoad_GATTDBAttPrepareWriteIndication},
-	{GATTDBAttExecuteWriteIndication_FSCI_ID, UnLoad_GATTDBAttExecuteWriteIndication},
-	{GATTDBAttExecuteWriteFromQueueIndication_FSCI_ID, UnLoad_GATTDBAttExecuteWriteFromQueueIndication},
-	{GATTDBAttPrepareNotificationIndicationIndication_FSCI_ID, UnLoad_GATTDBAttPrepareNotificationIndicationIndication},
+	[0x47] = unEvtHandlerTbl_47,
 #endif  /* GATTDB_ATT_ENABLE */
 
 #if GAP_ENABLE
-	{GAPConfirm_FSCI_ID, UnLoad_GAPConfirm},
-	{GAPCheckNotificationStatusIndication_FSCI_ID, UnLoad_GAPCheckNotificationStatusIndication},
-	{GAPCheckIndicationStatusIndication_FSCI_ID, UnLoad_GAPCheckIndicationStatusIndication},
-	{GAPLoadKeysIndication_FSCI_ID, UnLoad_GAPLoadKeysIndication},
-	{GAPLoadEncryptionInformationIndication_FSCI_ID, UnLoad_GAPLoadEncryptionInformationIndication},
-	{GAPLoadCustomPeerInformationIndication_FSCI_ID, UnLoad_GAPLoadCustomPeerInformationIndication},
-	{GAPCheckIfBondedIndication_FSCI_ID, UnLoad_GAPCheckIfBondedIndication},
-	{GAPGetBondedDevicesCountIndication_FSCI_ID, UnLoad_GAPGetBondedDevicesCountIndication},
-	{GAPGetBondedDeviceNameIndication_FSCI_ID, UnLoad_GAPGetBondedDeviceNameIndication},
-	{GAPGenericEventInitializationCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventInitializationCompleteIndication},
-	{GAPGenericEventInternalErrorIndication_FSCI_ID, UnLoad_GAPGenericEventInternalErrorIndication},
-	{GAPGenericEventAdvertisingSetupFailedIndication_FSCI_ID, UnLoad_GAPGenericEventAdvertisingSetupFailedIndication},
-	{GAPGenericEventAdvertisingParametersSetupCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventAdvertisingParametersSetupCompleteIndication},
-	{GAPGenericEventAdvertisingDataSetupCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventAdvertisingDataSetupCompleteIndication},
-	{GAPGenericEventFilterAcceptListSizeReadIndication_FSCI_ID, UnLoad_GAPGenericEventFilterAcceptListSizeReadIndication},
-	{GAPGenericEventDeviceAddedToFilterAcceptListIndication_FSCI_ID, UnLoad_GAPGenericEventDeviceAddedToFilterAcceptListIndication},
-	{GAPGenericEventDeviceRemovedFromFilterAcceptListIndication_FSCI_ID, UnLoad_GAPGenericEventDeviceRemovedFromFilterAcceptListIndication},
-	{GAPGenericEventFilterAcceptListClearedIndication_FSCI_ID, UnLoad_GAPGenericEventFilterAcceptListClearedIndication},
-	{GAPGenericEventRandomAddressReadyIndication_FSCI_ID, UnLoad_GAPGenericEventRandomAddressReadyIndication},
-	{GAPGenericEventCreateConnectionCanceledIndication_FSCI_ID, UnLoad_GAPGenericEventCreateConnectionCanceledIndication},
-	{GAPGenericEventPublicAddressReadIndication_FSCI_ID, UnLoad_GAPGenericEventPublicAddressReadIndication},
-	{GAPGenericEventAdvTxPowerLevelReadIndication_FSCI_ID, UnLoad_GAPGenericEventAdvTxPowerLevelReadIndication},
-	{GAPGenericEventPrivateResolvableAddressVerifiedIndication_FSCI_ID, UnLoad_GAPGenericEventPrivateResolvableAddressVerifiedIndication},
-	{GAPGenericEventRandomAddressSetIndication_FSCI_ID, UnLoad_GAPGenericEventRandomAddressSetIndication},
-	{GAPAdvertisingEventStateChangedIndication_FSCI_ID, UnLoad_GAPAdvertisingEventStateChangedIndication},
-	{GAPAdvertisingEventCommandFailedIndication_FSCI_ID, UnLoad_GAPAdvertisingEventCommandFailedIndication},
-	{GAPScanningEventStateChangedIndication_FSCI_ID, UnLoad_GAPScanningEventStateChangedIndication},
-	{GAPScanningEventCommandFailedIndication_FSCI_ID, UnLoad_GAPScanningEventCommandFailedIndication},
-	{GAPScanningEventDeviceScannedIndication_FSCI_ID, UnLoad_GAPScanningEventDeviceScannedIndication},
-	{GAPConnectionEventConnectedIndication_FSCI_ID, UnLoad_GAPConnectionEventConnectedIndication},
-	{GAPConnectionEventPairingRequestIndication_FSCI_ID, UnLoad_GAPConnectionEventPairingRequestIndication},
-	{GAPConnectionEventPeripheralSecurityRequestIndication_FSCI_ID, UnLoad_GAPConnectionEventPeripheralSecurityRequestIndication},
-	{GAPConnectionEventPairingResponseIndication_FSCI_ID, UnLoad_GAPConnectionEventPairingResponseIndication},
-	{GAPConnectionEventAuthenticationRejectedIndication_FSCI_ID, UnLoad_GAPConnectionEventAuthenticationRejectedIndication},
-	{GAPConnectionEventPasskeyRequestIndication_FSCI_ID, UnLoad_GAPConnectionEventPasskeyRequestIndication},
-	{GAPConnectionEventOobRequestIndication_FSCI_ID, UnLoad_GAPConnectionEventOobRequestIndication},
-	{GAPConnectionEventPasskeyDisplayIndication_FSCI_ID, UnLoad_GAPConnectionEventPasskeyDisplayIndication},
-	{GAPConnectionEventKeyExchangeRequestIndication_FSCI_ID, UnLoad_GAPConnectionEventKeyExchangeRequestIndication},
-	{GAPConnectionEventKeysReceivedIndication_FSCI_ID, UnLoad_GAPConnectionEventKeysReceivedIndication},
-	{GAPConnectionEventLongTermKeyRequestIndication_FSCI_ID, UnLoad_GAPConnectionEventLongTermKeyRequestIndication},
-	{GAPConnectionEventEncryptionChangedIndication_FSCI_ID, UnLoad_GAPConnectionEventEncryptionChangedIndication},
-	{GAPConnectionEventPairingCompleteIndication_FSCI_ID, UnLoad_GAPConnectionEventPairingCompleteIndication},
-	{GAPConnectionEventDisconnectedIndication_FSCI_ID, UnLoad_GAPConnectionEventDisconnectedIndication},
-	{GAPConnectionEventRssiReadIndication_FSCI_ID, UnLoad_GAPConnectionEventRssiReadIndication},
-	{GAPConnectionEventTxPowerLevelReadIndication_FSCI_ID, UnLoad_GAPConnectionEventTxPowerLevelReadIndication},
-	{GAPConnectionEventPowerReadFailureIndication_FSCI_ID, UnLoad_GAPConnectionEventPowerReadFailureIndication},
-	{GAPConnectionEventParameterUpdateRequestIndication_FSCI_ID, UnLoad_GAPConnectionEventParameterUpdateRequestIndication},
-	{GAPConnectionEventParameterUpdateCompleteIndication_FSCI_ID, UnLoad_GAPConnectionEventParameterUpdateCompleteIndication},
-	{GAPConnectionEventLeDataLengthChangedIndication_FSCI_ID, UnLoad_GAPConnectionEventLeDataLengthChangedIndication},
-	{GAPConnectionEventLeScOobDataRequestIndication_FSCI_ID, UnLoad_GAPConnectionEventLeScOobDataRequestIndication},
-	{GAPConnectionEventLeScDisplayNumericValueIndication_FSCI_ID, UnLoad_GAPConnectionEventLeScDisplayNumericValueIndication},
-	{GAPConnectionEventLeScKeypressNotificationIndication_FSCI_ID, UnLoad_GAPConnectionEventLeScKeypressNotificationIndication},
-	{GAPLeScPublicKeyRegeneratedIndication_FSCI_ID, UnLoad_GAPLeScPublicKeyRegeneratedIndication},
-	{GAPGenericEventLeScLocalOobDataIndication_FSCI_ID, UnLoad_GAPGenericEventLeScLocalOobDataIndication},
-	{GAPGenericEventHostPrivacyStateChangedIndication_FSCI_ID, UnLoad_GAPGenericEventHostPrivacyStateChangedIndication},
-	{GAPGenericEventControllerPrivacyStateChangedIndication_FSCI_ID, UnLoad_GAPGenericEventControllerPrivacyStateChangedIndication},
-	{GAPGenericEventTxPowerLevelSetCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventTxPowerLevelSetCompleteIndication},
-	{GAPGenericEventLePhyEventIndication_FSCI_ID, UnLoad_GAPGenericEventLePhyEventIndication},
-	{GAPGetBondedDevicesIdentityInformationIndication_FSCI_ID, UnLoad_GAPGetBondedDevicesIdentityInformationIndication},
-	{GAPControllerNotificationIndication_FSCI_ID, UnLoad_GAPControllerNotificationIndication},
-	{GAPBondCreatedIndication_FSCI_ID, UnLoad_GAPBondCreatedIndication},
-	{GAPGenericEventChannelMapSetIndication_FSCI_ID, UnLoad_GAPGenericEventChannelMapSetIndication},
-	{GAPConnectionEventChannelMapReadIndication_FSCI_ID, UnLoad_GAPConnectionEventChannelMapReadIndication},
-	{GAPConnectionEventChannelMapReadFailureIndication_FSCI_ID, UnLoad_GAPConnectionEventChannelMapReadFailureIndication},
-	{GAPGenericEventExtAdvertisingParamSetupCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventExtAdvertisingParamSetupCompleteIndication},
-	{GAPGenericEventExtAdvertisingDataSetupCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventExtAdvertisingDataSetupCompleteIndication},
-	{GAPGenericEventPeriodicAdvParamSetupCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventPeriodicAdvParamSetupCompleteIndication},
-	{GAPGenericEventPeriodicAdvDataSetupCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventPeriodicAdvDataSetupCompleteIndication},
-	{GAPGenericEventPeriodicAdvListUpdateCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventPeriodicAdvListUpdateCompleteIndication},
-	{GAPAdvertisingEventExtAdvertisingStateChangedIndication_FSCI_ID, UnLoad_GAPAdvertisingEventExtAdvertisingStateChangedIndication},
-	{GAPAdvertisingEventAdvertisingSetTerminatedIndication_FSCI_ID, UnLoad_GAPAdvertisingEventAdvertisingSetTerminatedIndication},
-	{GAPAdvertisingEventExtAdvertisingSetRemoveCompletedIndication_FSCI_ID, UnLoad_GAPAdvertisingEventExtAdvertisingSetRemoveCompletedIndication},
-	{GAPAdvertisingEventExtScanReqReceivedIndication_FSCI_ID, UnLoad_GAPAdvertisingEventExtScanReqReceivedIndication},
-	{GAPGenericEventPeriodicAdvertisingStateChangedIndication_FSCI_ID, UnLoad_GAPGenericEventPeriodicAdvertisingStateChangedIndication},
-	{GAPScanningEventExtDeviceScannedIndication_FSCI_ID, UnLoad_GAPScanningEventExtDeviceScannedIndication},
-	{GAPScanningEventPeriodicAdvSyncEstablishedIndication_FSCI_ID, UnLoad_GAPScanningEventPeriodicAdvSyncEstablishedIndication},
-	{GAPScanningEventPeriodicAdvSyncTerminatedIndication_FSCI_ID, UnLoad_GAPScanningEventPeriodicAdvSyncTerminatedIndication},
-	{GAPScanningEventPeriodicAdvSyncLostIndication_FSCI_ID, UnLoad_GAPScanningEventPeriodicAdvSyncLostIndication},
-	{GAPScanningEventPeriodicDeviceScannedIndication_FSCI_ID, UnLoad_GAPScanningEventPeriodicDeviceScannedIndication},
-	{GAPGenericEventPeriodicAdvCreateSyncCancelledIndication_FSCI_ID, UnLoad_GAPGenericEventPeriodicAdvCreateSyncCancelledIndication},
-	{GAPConnectionEventChannelSelectionAlgorithm2Indication_FSCI_ID, UnLoad_GAPConnectionEventChannelSelectionAlgorithm2Indication},
-	{GAPGenericEventTxEntryAvailableIndication_FSCI_ID, UnLoad_GAPGenericEventTxEntryAvailableIndication},
-	{GAPGenericEventControllerLocalRPAReadIndication_FSCI_ID, UnLoad_GAPGenericEventControllerLocalRPAReadIndication},
-	{GAPCheckNvmIndexIndication_FSCI_ID, UnLoad_GAPCheckNvmIndexIndication},
-	{GAPGetDeviceIdFromConnHandleIndication_FSCI_ID, UnLoad_GAPGetDeviceIdFromConnHandleIndication},
-	{GAPGetConnectionHandleFromDeviceIdIndication_FSCI_ID, UnLoad_GAPGetConnectionHandleFromDeviceIdIndication},
-	{GAPPairingEventNoLTKIndication_FSCI_ID, UnLoad_GAPPairingEventNoLTKIndication},
-	{GAPPairingAlreadyStartedIndication_FSCI_ID, UnLoad_GAPPairingAlreadyStartedIndication},
-	{GAPGenericEventConnectionlessCteTransmitParamsSetupCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventConnectionlessCteTransmitParamsSetupCompleteIndication},
-	{GAPGenericEventConnectionlessCteTransmitStateChangedIndication_FSCI_ID, UnLoad_GAPGenericEventConnectionlessCteTransmitStateChangedIndication},
-	{GAPGenericEventConnectionlessIqSamplingStateChangedIndication_FSCI_ID, UnLoad_GAPGenericEventConnectionlessIqSamplingStateChangedIndication},
-	{GAPGenericEventAntennaInformationReadIndication_FSCI_ID, UnLoad_GAPGenericEventAntennaInformationReadIndication},
-	{GAPScanningEventConnectionlessIqReportReceivedIndication_FSCI_ID, UnLoad_GAPScanningEventConnectionlessIqReportReceivedIndication},
-	{GAPConnectionEventIqReportReceivedIndication_FSCI_ID, UnLoad_GAPConnectionEventIqReportReceivedIndication},
-	{GAPConnectionEventCteRequestFailedIndication_FSCI_ID, UnLoad_GAPConnectionEventCteRequestFailedIndication},
-	{GAPConnectionEventCteReceiveParamsSetupCompleteIndication_FSCI_ID, UnLoad_GAPConnectionEventCteReceiveParamsSetupCompleteIndication},
-	{GAPConnectionEventCteTransmitParamsSetupCompleteIndication_FSCI_ID, UnLoad_GAPConnectionEventCteTransmitParamsSetupCompleteIndication},
-	{GAPConnectionEventCteReqStateChangedIndication_FSCI_ID, UnLoad_GAPConnectionEventCteReqStateChangedIndication},
-	{GAPConnectionEventCteRspStateChangedIndication_FSCI_ID, UnLoad_GAPConnectionEventCteRspStateChangedIndication},
-	{GAPGenericEventPeriodicAdvRecvEnableCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventPeriodicAdvRecvEnableCompleteIndication},
-	{GAPGenericEventPeriodicAdvSyncTransferCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventPeriodicAdvSyncTransferCompleteIndication},
-	{GAPGenericEventPeriodicAdvSetInfoTransferCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventPeriodicAdvSetInfoTransferCompleteIndication},
-	{GAPGenericEventSetPeriodicAdvSyncTransferParamsCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventSetPeriodicAdvSyncTransferParamsCompleteIndication},
-	{GAPGenericEventSetDefaultPeriodicAdvSyncTransferParamsCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventSetDefaultPeriodicAdvSyncTransferParamsCompleteIndication},
-	{GAPScanningEventPeriodicAdvSyncTransferReceivedIndication_FSCI_ID, UnLoad_GAPScanningEventPeriodicAdvSyncTransferReceivedIndication},
-	{GAPConnectionEventPathLossThresholdIndication_FSCI_ID, UnLoad_GAPConnectionEventPathLossThresholdIndication},
-	{GAPConnectionEventTransmitPowerReportingIndication_FSCI_ID, UnLoad_GAPConnectionEventTransmitPowerReportingIndication},
-	{GAPConnectionEventEnhancedReadTransmitPowerLevelIndication_FSCI_ID, UnLoad_GAPConnectionEventEnhancedReadTransmitPowerLevelIndication},
-	{GAPConnectionEventPathLossReportingParamsSetupCompleteIndication_FSCI_ID, UnLoad_GAPConnectionEventPathLossReportingParamsSetupCompleteIndication},
-	{GAPConnectionEventPathLossReportingStateChangedIndication_FSCI_ID, UnLoad_GAPConnectionEventPathLossReportingStateChangedIndication},
-	{GAPConnectionEventTransmitPowerReportingStateChangedIndication_FSCI_ID, UnLoad_GAPConnectionEventTransmitPowerReportingStateChangedIndication},
-	{GAPConnectionEventEattConnectionRequestIndication_FSCI_ID, UnLoad_GAPConnectionEventEattConnectionRequestIndication},
-	{GAPConnectionEventEattConnectionCompleteIndication_FSCI_ID, UnLoad_GAPConnectionEventEattConnectionCompleteIndication},
-	{GAPConnectionEventEattReconfigureResponseIndication_FSCI_ID, UnLoad_GAPConnectionEventEattReconfigureResponseIndication},
-	{GAPConnectionEventEattBearerStatusNotificationIndication_FSCI_ID, UnLoad_GAPConnectionEventEattBearerStatusNotificationIndication},
-	{GAPGenericEventLeGenerateDhKeyCompleteIndication_FSCI_ID, UnLoad_GAPGenericEventLeGenerateDhKeyCompleteIndication},
-	{GAPGetHostVersionIndication_FSCI_ID, UnLoad_GAPGetHostVersionIndication},
+	[0x48] = unEvtHandlerTbl_48,
 #endif  /* GAP_ENABLE */
 };
 
@@ -774,6 +829,17 @@ static memStatus_t UnLoad_L2CAPCBEnhancedReconfigureResponseIndication(bleEvtCon
 	return MEM_SUCCESS_c;
 }
 
+/*!*************************************************************************************************
+\fn		static memStatus_t UnLoad_L2CAPCBLeCbDataBatchCompleteIndication(bleEvtContainer_t *container)
+\brief	Credit Based - SDU batch sent or dropped event
+***************************************************************************************************/
+static memStatus_t UnLoad_L2CAPCBLeCbDataBatchCompleteIndication(bleEvtContainer_t *container)
+{
+	L2CAPCBLeCbDataBatchCompleteIndication_t *evt = &(container->Data.L2CAPCBLeCbDataBatchCompleteIndication);
+
+	return MEM_SUCCESS_c;
+}
+
 #endif  /* L2CAPCB_ENABLE */
 
 #if GATT_ENABLE
@@ -2216,6 +2282,31 @@ static memStatus_t UnLoad_GATTDBDynamicAddCharDescriptorWithUniqueValueIndicatio
 	return MEM_SUCCESS_c;
 }
 
+/*!*************************************************************************************************
+\fn		static memStatus_t UnLoad_GATTDBDynamicAddServiceIndication(bleEvtContainer_t *container)
+\brief	Handles assigned to a service added in a single command
+***************************************************************************************************/
+static memStatus_t UnLoad_GATTDBDynamicAddServiceIndication(bleEvtContainer_t *container)
+{
+	GATTDBDynamicAddServiceIndication_t *evt = &(container->Data.GATTDBDynamicAddServiceIndication);
+	uint32_t i;
+
+	if (evt->NbOfCharacteristics > 0 && evt->Characteristics)
+	{
+		for (i = 0; i < evt->NbOfCharacteristics; i++)
+		{
+			if (evt->Characteristics[i].NbOfDescriptors > 0)
+			{
+				MEM_BufferFree(evt->Characteristics[i].DescriptorHandles);
+			}
+		}
+
+		MEM_BufferFree(evt->Characteristics);
+	}
+
+	return MEM_SUCCESS_c;
+}
+
 #endif  /* GATTDB_APP_ENABLE */
 
 #if GATTDB_ATT_ENABLE
@@ -3851,6 +3942,35 @@ static memStatus_t UnLoad_GAPGetHostVersionIndication(bleEvtContainer_t *contain
 	return MEM_SUCCESS_c;
 }
 
+/*!*************************************************************************************************
+\fn		static memStatus_t UnLoad_GAPScanningEventDeviceScannedBatchIndication(bleEvtContainer_t *container)
+\brief	Scanned device reports coalesced by the board
+***************************************************************************************************/
+static memStatus_t UnLoad_GAPScanningEventDeviceScannedBatchIndication(bleEvtContainer_t *container)
+{
+	GAPScanningEventDeviceScannedBatchIndication_t *evt = &(container->Data.GAPScanningEventDeviceScannedBatchIndication);
+	uint32_t i;
+
+	for (i = 0; i < evt->NoOfReports; i++)
+	{
+		if (evt->Reports[i].id == GAPScanningEventDeviceScannedIndication_FSCI_ID && evt->Reports[i].Data.DeviceScanned.DataLength > 0)
+		{
+			MEM_BufferFree(evt->Reports[i].Data.DeviceScanned.Data);
+		}
+		else if (evt->Reports[i].id == GAPScanningEventExtDeviceScannedIndication_FSCI_ID && evt->Reports[i].Data.ExtDeviceScanned.DataLength > 0)
+		{
+			MEM_BufferFree(evt->Reports[i].Data.ExtDeviceScanned.Data);
+		}
+	}
+
+	if (evt->Reports)
+	{
+		MEM_BufferFree(evt->Reports);
+	}
+
+	return MEM_SUCCESS_c;
+}
+
 #endif  /* GAP_ENABLE */
 
 
@@ -3865,16 +3985,23 @@ void KHC_BLE_RX_UnMsgHandler(void *pData, void *param, uint8_t fsciInterface)
 	bleEvtContainer_t *container = (bleEvtContainer_t *)param;
 	uint8_t og = frame->opGroup;
 	uint8_t oc = frame->opCode;
-	uint16_t id = (og << 8) + oc, i;
+	uint16_t id = (og << 8) + oc;
+
+#if FSCI_EVT_ARENA
+	/* All the nested arrays of the event were carved from the arena */
+	(void)unEvtHandlerTbl;
 
-	for (i = 0; i < sizeof(unEvtHandlerTbl) / sizeof(unEvtHandlerTbl[0]); i++)
+	if (container->id == id)
 	{
-		if (unEvtHandlerTbl[i].id == id)
-		{
-			unEvtHandlerTbl[i].handlerFunc(container);
-			break;
-		}
+		KHC_BLE_ResetEvtArena(container, 0);
+	}
+#else
+	/* Skip packets that were not loaded in the container, e.g. taken by an application handler */
+	if (container->id == id && unEvtHandlerTbl[og] && unEvtHandlerTbl[og][oc])
+	{
+		unEvtHandlerTbl[og][oc](container);
 	}
+#endif  /* FSCI_EVT_ARENA */
 
 	/* Clear received packet */
 	MEM_BufferFree(pData);
@@ -759,6 +759,35 @@ class L2CAPCBEnhancedReconfigureResponseIndicationObserver(Observer):
         fsciLibrary.DestroyFSCIFrame(event)
 
 
+class L2CAPCBLeCbDataBatchCompleteIndicationObserver(Observer):
+
+    opGroup = Spec.L2CAPCBLeCbDataBatchCompleteIndicationFrame.opGroup
+    opCode = Spec.L2CAPCBLeCbDataBatchCompleteIndicationFrame.opCode
+
+    @overrides(Observer)
+    def observeEvent(self, framer, event, callback, sync_request):
+        # Call super, print common information
+        Observer.observeEvent(self, framer, event, callback, sync_request)
+        # Get payload
+        fsciFrame = cast(event, POINTER(FsciFrame))
+        data = cast(fsciFrame.contents.data, POINTER(fsciFrame.contents.length * c_uint8))
+        packet = Spec.L2CAPCBLeCbDataBatchCompleteIndicationFrame.getFsciPacketFromByteArray(data.contents, fsciFrame.contents.length)
+        # Create frame object
+        frame = L2CAPCBLeCbDataBatchCompleteIndication()
+        frame.DeviceId = packet.getParamValueAsNumber("DeviceId")
+        frame.ChannelId = packet.getParamValueAsNumber("ChannelId")
+        frame.Status = L2CAPCBConfirmStatus.getEnumString(packet.getParamValueAsNumber("Status"))
+        frame.SdusSent = packet.getParamValueAsNumber("SdusSent")
+        frame.SdusQueued = packet.getParamValueAsNumber("SdusQueued")
+        framer.event_queue.put(frame) if sync_request else None
+
+        if callback is not None:
+            callback(self.deviceName, frame)
+        else:
+            print_event(self.deviceName, frame)
+        fsciLibrary.DestroyFSCIFrame(event)
+
+
 class GATTConfirmObserver(Observer):
 
     opGroup = Spec.GATTConfirmFrame.opGroup
@@ -4159,6 +4188,49 @@ class GATTDBDynamicAddCharDescriptorWithUniqueValueIndicationObserver(Observer):
         fsciLibrary.DestroyFSCIFrame(event)
 
 
+class GATTDBDynamicAddServiceIndicationObserver(Observer):
+
+    opGroup = Spec.GATTDBDynamicAddServiceIndicationFrame.opGroup
+    opCode = Spec.GATTDBDynamicAddServiceIndicationFrame.opCode
+
+    @overrides(Observer)
+    def observeEvent(self, framer, event, callback, sync_request):
+        # Call super, print common information
+        Observer.observeEvent(self, framer, event, callback, sync_request)
+        # Get payload
+        fsciFrame = cast(event, POINTER(FsciFrame))
+        data = cast(fsciFrame.contents.data, POINTER(fsciFrame.contents.length * c_uint8))
+        payload = bytearray(data.contents)
+        # Create frame object
+        frame = GATTDBDynamicAddServiceIndication()
+        curr = 0
+        frame.ServiceHandle = list_to_int(payload[curr:curr + 2])
+        curr += 2
+        frame.NbOfCharacteristics = payload[curr]
+        curr += 1
+        frame.Characteristics = []
+        for _ in range(frame.NbOfCharacteristics):
+            characteristic = GATTDBDynamicAddServiceIndication.Characteristics()
+            characteristic.CharacteristicHandle = list_to_int(payload[curr:curr + 2])
+            curr += 2
+            characteristic.CccdHandle = list_to_int(payload[curr:curr + 2])
+            curr += 2
+            characteristic.NbOfDescriptors = payload[curr]
+            curr += 1
+            characteristic.DescriptorHandles = []
+            for _ in range(characteristic.NbOfDescriptors):
+                characteristic.DescriptorHandles.append(list_to_int(payload[curr:curr + 2]))
+                curr += 2
+            frame.Characteristics.append(characteristic)
+        framer.event_queue.put(frame) if sync_request else None
+
+        if callback is not None:
+            callback(self.deviceName, frame)
+        else:
+            print_event(self.deviceName, frame)
+        fsciLibrary.DestroyFSCIFrame(event)
+
+
 class GATTDBAttConfirmObserver(Observer):
 
     opGroup = Spec.GATTDBAttConfirmFrame.opGroup
@@ -5243,15 +5315,8 @@ class GAPScanningEventDeviceScannedIndicationObserver(Observer):
     opGroup = Spec.GAPScanningEventDeviceScannedIndicationFrame.opGroup
     opCode = Spec.GAPScanningEventDeviceScannedIndicationFrame.opCode
 
-    @overrides(Observer)
-    def observeEvent(self, framer, event, callback, sync_request):
-        # Call super, print common information
-        Observer.observeEvent(self, framer, event, callback, sync_request)
-        # Get payload
-        fsciFrame = cast(event, POINTER(FsciFrame))
-        data = cast(fsciFrame.contents.data, POINTER(fsciFrame.contents.length * c_uint8))
-        packet = Spec.GAPScanningEventDeviceScannedIndicationFrame.getFsciPacketFromByteArray(data.contents, fsciFrame.contents.length)
-        # Create frame object
+    @staticmethod
+    def frameFromPacket(packet):
         frame = GAPScanningEventDeviceScannedIndication()
         frame.ScannedDevice_AddressType = packet.getParamValueAsNumber("ScannedDevice_AddressType")
         frame.ScannedDevice_Address = packet.getParamValueAsList("ScannedDevice_Address")
@@ -5262,6 +5327,18 @@ class GAPScanningEventDeviceScannedIndicationObserver(Observer):
         frame.ScannedDevice_DirectRpaUsed = packet.getParamValueAsNumber("ScannedDevice_DirectRpaUsed")
         frame.ScannedDevice_DirectRpa = packet.getParamValueAsList("ScannedDevice_DirectRpa")
         frame.ScannedDevice_advertisingAddressResolved = packet.getParamValueAsNumber("ScannedDevice_advertisingAddressResolved")
+        return frame
+
+    @overrides(Observer)
+    def observeEvent(self, framer, event, callback, sync_request):
+        # Call super, print common information
+        Observer.observeEvent(self, framer, event, callback, sync_request)
+        # Get payload
+        fsciFrame = cast(event, POINTER(FsciFrame))
+        data = cast(fsciFrame.contents.data, POINTER(fsciFrame.contents.length * c_uint8))
+        packet = Spec.GAPScanningEventDeviceScannedIndicationFrame.getFsciPacketFromByteArray(data.contents, fsciFrame.contents.length)
+        # Create frame object
+        frame = self.frameFromPacket(packet)
         framer.event_queue.put(frame) if sync_request else None
 
         if callback is not None:
@@ -6500,15 +6577,8 @@ class GAPScanningEventExtDeviceScannedIndicationObserver(Observer):
     opGroup = Spec.GAPScanningEventExtDeviceScannedIndicationFrame.opGroup
     opCode = Spec.GAPScanningEventExtDeviceScannedIndicationFrame.opCode
 
-    @overrides(Observer)
-    def observeEvent(self, framer, event, callback, sync_request):
-        # Call super, print common information
-        Observer.observeEvent(self, framer, event, callback, sync_request)
-        # Get payload
-        fsciFrame = cast(event, POINTER(FsciFrame))
-        data = cast(fsciFrame.contents.data, POINTER(fsciFrame.contents.length * c_uint8))
-        packet = Spec.GAPScanningEventExtDeviceScannedIndicationFrame.getFsciPacketFromByteArray(data.contents, fsciFrame.contents.length)
-        # Create frame object
+    @staticmethod
+    def frameFromPacket(packet):
         frame = GAPScanningEventExtDeviceScannedIndication()
         frame.AddressType = packet.getParamValueAsNumber("AddressType")
         frame.Address = packet.getParamValueAsList("Address")
@@ -6525,6 +6595,18 @@ class GAPScanningEventExtDeviceScannedIndicationObserver(Observer):
         frame.DirectRpa = packet.getParamValueAsList("DirectRpa")
         frame.DataLength = packet.getParamValueAsNumber("DataLength")
         frame.Data = packet.getParamValueAsList("Data")
+        return frame
+
+    @overrides(Observer)
+    def observeEvent(self, framer, event, callback, sync_request):
+        # Call super, print common information
+        Observer.observeEvent(self, framer, event, callback, sync_request)
+        # Get payload
+        fsciFrame = cast(event, POINTER(FsciFrame))
+        data = cast(fsciFrame.contents.data, POINTER(fsciFrame.contents.length * c_uint8))
+        packet = Spec.GAPScanningEventExtDeviceScannedIndicationFrame.getFsciPacketFromByteArray(data.contents, fsciFrame.contents.length)
+        # Create frame object
+        frame = self.frameFromPacket(packet)
         framer.event_queue.put(frame) if sync_request else None
 
         if callback is not None:
@@ -7594,6 +7676,53 @@ class GAPGetHostVersionIndicationObserver(Observer):
         fsciLibrary.DestroyFSCIFrame(event)
 
 
+class GAPScanningEventDeviceScannedBatchIndicationObserver(Observer):
+
+    opGroup = Spec.GAPScanningEventDeviceScannedBatchIndicationFrame.opGroup
+    opCode = Spec.GAPScanningEventDeviceScannedBatchIndicationFrame.opCode
+
+    # single scanned device events carried in a batch, by opCode
+    reportObservers = {
+        Spec.GAPScanningEventDeviceScannedIndicationFrame.opCode:
+            (Spec.GAPScanningEventDeviceScannedIndicationFrame, GAPScanningEventDeviceScannedIndicationObserver),
+        Spec.GAPScanningEventExtDeviceScannedIndicationFrame.opCode:
+            (Spec.GAPScanningEventExtDeviceScannedIndicationFrame, GAPScanningEventExtDeviceScannedIndicationObserver),
+    }
+
+    @overrides(Observer)
+    def observeEvent(self, framer, event, callback, sync_request):
+        # Call super, print common information
+        Observer.observeEvent(self, framer, event, callback, sync_request)
+        # Get payload
+        fsciFrame = cast(event, POINTER(FsciFrame))
+        data = cast(fsciFrame.contents.data, POINTER(fsciFrame.contents.length * c_uint8))
+        payload = bytearray(data.contents)
+        # Create frame object
+        frame = GAPScanningEventDeviceScannedBatchIndication()
+        curr = 0
+        noOfRecords = payload[curr]
+        curr += 1
+        frame.Reports = []
+        for _ in range(noOfRecords):
+            opCode = payload[curr]
+            length = list_to_int(payload[curr + 1:curr + 3])
+            curr += 3
+            # records of unknown events are skipped
+            if opCode in self.reportObservers:
+                spec, observer = self.reportObservers[opCode]
+                packet = spec.getFsciPacketFromByteArray(payload[curr:curr + length], length)
+                frame.Reports.append(observer.frameFromPacket(packet))
+            curr += length
+        frame.NoOfReports = len(frame.Reports)
+        framer.event_queue.put(frame) if sync_request else None
+
+        if callback is not None:
+            callback(self.deviceName, frame)
+        else:
+            print_event(self.deviceName, frame)
+        fsciLibrary.DestroyFSCIFrame(event)
+
+
 allObservers = {}
 observersList = [cls(clsName[:-len('Observer')]) for (clsName, cls) in inspect.getmembers(
     sys.modules[__name__], inspect.isclass) if clsName.endswith('Observer') and clsName != 'Observer']
@@ -196,6 +196,44 @@ class L2CAPCBEnhancedCancelConnectionRequest(object):
         self.Cids = Cids
 
 
+class L2CAPCBSendLeCbDataBatchRequest(object):
+
+    class Sdus(object):
+
+        def __init__(self, Length=bytearray(2), Data=[]):
+            self.Length = Length
+            # Array length depends on Length.
+            self.Data = Data
+
+        def pickle(self):
+            result = bytearray()
+            result += to_bytes(self.Length, 2)
+            result += to_bytes(self.Data, self.Length)
+            return result
+
+    def __init__(self, DeviceId=bytearray(1), ChannelId=bytearray(2), NoOfSdus=bytearray(1), Sdus=[]):
+        '''
+        @param DeviceId: The DeviceId for which the command is intended
+        @param ChannelId: The L2CAP Channel Id assigned on the initiator
+        @param NoOfSdus: Number of SDUs in the batch
+        @param Sdus: SDUs sent in order on the channel, none empty
+        '''
+        self.DeviceId = DeviceId
+        self.ChannelId = ChannelId
+        self.NoOfSdus = NoOfSdus
+        # Array length depends on NoOfSdus.
+        self.Sdus = Sdus
+
+    def pickle(self):
+        result = bytearray()
+        result += to_bytes(self.DeviceId, 1)
+        result += to_bytes(self.ChannelId, 2)
+        result += to_bytes(self.NoOfSdus, 1)
+        for i in range(list_to_int(self.NoOfSdus, False)):
+            result += self.Sdus[i].pickle()
+        return result
+
+
 class GATTInitRequest(object):
 
     pass
@@ -3244,6 +3282,78 @@ class GATTDBDynamicEndDatabaseUpdateRequest(object):
     pass
 
 
+class GATTDBDynamicAddServiceRequest(object):
+
+    # each record of the service description is Type(1) Length(2) Value
+    @staticmethod
+    def record(Type, Value):
+        result = bytearray()
+        result += to_bytes(Type, 1)
+        result += to_bytes(len(Value), 2)
+        result += Value
+        return result
+
+    class Service(object):
+
+        def __init__(self, Uuid16=bytearray(2)):
+            self.Uuid16 = Uuid16
+
+        def pickle(self):
+            return GATTDBDynamicAddServiceRequest.record(0x01, to_bytes(self.Uuid16, 2))
+
+    class Characteristic(object):
+
+        def __init__(self, Uuid16=bytearray(2), Properties=bytearray(1), ValueAccessPermissions=bytearray(1), MaxValueLength=bytearray(2), InitialValue=[]):
+            self.Uuid16 = Uuid16
+            self.Properties = Properties
+            self.ValueAccessPermissions = ValueAccessPermissions
+            self.MaxValueLength = MaxValueLength
+            self.InitialValue = InitialValue
+
+        def pickle(self):
+            value = bytearray()
+            value += to_bytes(self.Uuid16, 2)
+            value += to_bytes(self.Properties, 1)
+            value += to_bytes(self.ValueAccessPermissions, 1)
+            value += to_bytes(self.MaxValueLength, 2)
+            value += bytearray(self.InitialValue)
+            return GATTDBDynamicAddServiceRequest.record(0x02, value)
+
+    class Descriptor(object):
+
+        def __init__(self, Uuid16=bytearray(2), DescriptorAccessPermissions=bytearray(1), Value=[]):
+            self.Uuid16 = Uuid16
+            self.DescriptorAccessPermissions = DescriptorAccessPermissions
+            self.Value = Value
+
+        def pickle(self):
+            value = bytearray()
+            value += to_bytes(self.Uuid16, 2)
+            value += to_bytes(self.DescriptorAccessPermissions, 1)
+            value += bytearray(self.Value)
+            return GATTDBDynamicAddServiceRequest.record(0x03, value)
+
+    class Cccd(object):
+
+        def pickle(self):
+            return GATTDBDynamicAddServiceRequest.record(0x04, bytearray())
+
+    def __init__(self, Records=[]):
+        '''
+        @param Records: Service description, a Service followed by Characteristic records, each followed by the Descriptor and Cccd records of that characteristic
+        '''
+        self.Records = Records
+
+    def pickle(self):
+        tlv = bytearray()
+        for record in self.Records:
+            tlv += record.pickle()
+        result = bytearray()
+        result += to_bytes(len(tlv), 2)
+        result += tlv
+        return result
+
+
 class GATTDBAttFindInformationRequest(object):
 
     def __init__(self, DeviceId=bytearray(1), Params_StartingHandle=bytearray(2), Params_EndingHandle=bytearray(2)):
@@ -5604,6 +5714,19 @@ class GAPEattSendCreditsRequest(object):
         self.Credits = Credits
 
 
+class GAPSetScanReportBatchingRequest(object):
+
+    def __init__(self, WindowMs=bytearray(2), MaxSize=bytearray(2), FilterDuplicates=bytearray(1)):
+        '''
+        @param WindowMs: Time the first report of a batch waits for the next ones, in milliseconds; 0 disables batching
+        @param MaxSize: Batch payload size above which the batch is sent; 0 for the largest the board supports
+        @param FilterDuplicates: TRUE to drop the reports with the same address, type and data as one already in the batch
+        '''
+        self.WindowMs = WindowMs
+        self.MaxSize = MaxSize
+        self.FilterDuplicates = FilterDuplicates
+
+
 class FSCICPUResetRequest(object):
 
     pass
@@ -5956,6 +6079,23 @@ class L2CAPCBEnhancedReconfigureResponseIndication(object):
         self.EnhancedReconfigureResponse = EnhancedReconfigureResponse
 
 
+class L2CAPCBLeCbDataBatchCompleteIndication(object):
+
+    def __init__(self, DeviceId=bytearray(1), ChannelId=bytearray(2), Status=L2CAPCBConfirmStatus.gBleSuccess_c, SdusSent=bytearray(1), SdusQueued=bytearray(2)):
+        '''
+        @param DeviceId: The DeviceId of the channel
+        @param ChannelId: The L2CAP Channel Id assigned on the initiator
+        @param Status: gBleSuccess_c if all the SDUs were given to L2CAP
+        @param SdusSent: SDUs of the batch given to L2CAP
+        @param SdusQueued: SDUs of the following batches still queued on the channel
+        '''
+        self.DeviceId = DeviceId
+        self.ChannelId = ChannelId
+        self.Status = Status
+        self.SdusSent = SdusSent
+        self.SdusQueued = SdusQueued
+
+
 class GATTConfirm(object):
 
     def __init__(self, Status=GATTConfirmStatus.gBleSuccess_c):
@@ -7668,6 +7808,30 @@ class GATTDBDynamicAddCharDescriptorWithUniqueValueIndication(object):
         self.DescriptorHandle = DescriptorHandle
 
 
+class GATTDBDynamicAddServiceIndication(object):
+
+    class Characteristics(object):
+
+        def __init__(self, CharacteristicHandle=bytearray(2), CccdHandle=bytearray(2), NbOfDescriptors=bytearray(1), DescriptorHandles=[]):
+            self.CharacteristicHandle = CharacteristicHandle
+            # 0 if the characteristic has no CCCD
+            self.CccdHandle = CccdHandle
+            self.NbOfDescriptors = NbOfDescriptors
+            # Array length depends on NbOfDescriptors.
+            self.DescriptorHandles = DescriptorHandles
+
+    def __init__(self, ServiceHandle=bytearray(2), NbOfCharacteristics=bytearray(1), Characteristics=[]):
+        '''
+        @param ServiceHandle: Handle of the Service declaration
+        @param NbOfCharacteristics: Number of characteristics of the service
+        @param Characteristics: Handles of the characteristics, in the order they were described
+        '''
+        self.ServiceHandle = ServiceHandle
+        self.NbOfCharacteristics = NbOfCharacteristics
+        # Array length depends on NbOfCharacteristics.
+        self.Characteristics = Characteristics
+
+
 class GATTDBAttConfirm(object):
 
     def __init__(self, Status=GATTDBAttConfirmStatus.gBleSuccess_c):
@@ -9261,3 +9425,15 @@ class GAPGetHostVersionIndication(object):
         self.GapHostVersion_BleHostVerPatch = GapHostVersion_BleHostVerPatch
 
 
+class GAPScanningEventDeviceScannedBatchIndication(object):
+
+    def __init__(self, NoOfReports=bytearray(1), Reports=[]):
+        '''
+        @param NoOfReports: Number of reports in the batch
+        @param Reports: GAPScanningEventDeviceScannedIndication and GAPScanningEventExtDeviceScannedIndication frames, in the order they were scanned
+        '''
+        self.NoOfReports = NoOfReports
+        # Array length depends on NoOfReports.
+        self.Reports = Reports
+
+
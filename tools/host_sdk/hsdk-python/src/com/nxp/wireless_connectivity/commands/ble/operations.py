@@ -131,6 +131,13 @@ class L2CAPCBEnhancedCancelConnectionOperation(FsciOperation):
         self.observers = []
         super(L2CAPCBEnhancedCancelConnectionOperation, self).subscribeToEvents()
 
+class L2CAPCBSendLeCbDataBatchOperation(FsciOperation):
+
+    def subscribeToEvents(self):
+        self.spec = Spec.L2CAPCBSendLeCbDataBatchRequestFrame
+        self.observers = [L2CAPCBLeCbDataBatchCompleteIndicationObserver('L2CAPCBLeCbDataBatchCompleteIndication'), ]
+        super(L2CAPCBSendLeCbDataBatchOperation, self).subscribeToEvents()
+
 
 class GATTInitOperation(FsciOperation):
 
@@ -700,6 +707,13 @@ class GATTDBDynamicEndDatabaseUpdateOperation(FsciOperation):
         self.observers = []
         super(GATTDBDynamicEndDatabaseUpdateOperation, self).subscribeToEvents()
 
+class GATTDBDynamicAddServiceOperation(FsciOperation):
+
+    def subscribeToEvents(self):
+        self.spec = Spec.GATTDBDynamicAddServiceRequestFrame
+        self.observers = [GATTDBDynamicAddServiceIndicationObserver('GATTDBDynamicAddServiceIndication'), ]
+        super(GATTDBDynamicAddServiceOperation, self).subscribeToEvents()
+
 
 class GATTDBAttFindInformationOperation(FsciOperation):
 
@@ -1570,6 +1584,13 @@ class GAPEattSendCreditsOperation(FsciOperation):
         self.observers = []
         super(GAPEattSendCreditsOperation, self).subscribeToEvents()
 
+class GAPSetScanReportBatchingOperation(FsciOperation):
+
+    def subscribeToEvents(self):
+        self.spec = Spec.GAPSetScanReportBatchingRequestFrame
+        self.observers = []
+        super(GAPSetScanReportBatchingOperation, self).subscribeToEvents()
+
 
 class FSCICPUResetOperation(FsciOperation):
 
@@ -1727,6 +1748,13 @@ class L2CAPCBEnhancedReconfigureResponseOperation(FsciOperation):
         self.observers = [L2CAPCBEnhancedReconfigureResponseIndicationObserver('L2CAPCBEnhancedReconfigureResponseIndication'), ]
         super(L2CAPCBEnhancedReconfigureResponseOperation, self).subscribeToEvents()
 
+class L2CAPCBLeCbDataBatchCompleteOperation(FsciOperation):
+
+    def subscribeToEvents(self):
+        self.spec = None
+        self.observers = [L2CAPCBLeCbDataBatchCompleteIndicationObserver('L2CAPCBLeCbDataBatchCompleteIndication'), ]
+        super(L2CAPCBLeCbDataBatchCompleteOperation, self).subscribeToEvents()
+
 
 class GATTClientProcedureExchangeMtuOperation(FsciOperation):
 
@@ -2807,6 +2835,13 @@ class GAPGetHostVersionOperation(FsciOperation):
         self.observers = [GAPGetHostVersionIndicationObserver('GAPGetHostVersionIndication'), ]
         super(GAPGetHostVersionOperation, self).subscribeToEvents()
 
+class GAPScanningEventDeviceScannedBatchOperation(FsciOperation):
+
+    def subscribeToEvents(self):
+        self.spec = None
+        self.observers = [GAPScanningEventDeviceScannedBatchIndicationObserver('GAPScanningEventDeviceScannedBatchIndication'), ]
+        super(GAPScanningEventDeviceScannedBatchOperation, self).subscribeToEvents()
+
 
 
 def subscribe_to_async_ble_events_from(device, ack_policy=FsciAckPolicy.GLOBAL):
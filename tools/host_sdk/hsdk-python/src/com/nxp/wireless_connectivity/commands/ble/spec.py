@@ -31,6 +31,7 @@ class Spec(object):
         self.L2CAPCBEnhancedConnectLePsmRequestFrame = self.InitL2CAPCBEnhancedConnectLePsmRequest()
         self.L2CAPCBEnhancedChannelReconfigureRequestFrame = self.InitL2CAPCBEnhancedChannelReconfigureRequest()
         self.L2CAPCBEnhancedCancelConnectionRequestFrame = self.InitL2CAPCBEnhancedCancelConnectionRequest()
+        self.L2CAPCBSendLeCbDataBatchRequestFrame = self.InitL2CAPCBSendLeCbDataBatchRequest()
         self.GATTInitRequestFrame = self.InitGATTInitRequest()
         self.GATTGetMtuRequestFrame = self.InitGATTGetMtuRequest()
         self.GATTClientInitRequestFrame = self.InitGATTClientInitRequest()
@@ -112,6 +113,7 @@ class Spec(object):
         self.GATTDBDynamicRemoveCharacteristicRequestFrame = self.InitGATTDBDynamicRemoveCharacteristicRequest()
         self.GATTDBDynamicAddCharDescriptorWithUniqueValueRequestFrame = self.InitGATTDBDynamicAddCharDescriptorWithUniqueValueRequest()
         self.GATTDBDynamicEndDatabaseUpdateRequestFrame = self.InitGATTDBDynamicEndDatabaseUpdateRequest()
+        self.GATTDBDynamicAddServiceRequestFrame = self.InitGATTDBDynamicAddServiceRequest()
         self.GATTDBAttFindInformationRequestFrame = self.InitGATTDBAttFindInformationRequest()
         self.GATTDBAttFindByTypeValueRequestFrame = self.InitGATTDBAttFindByTypeValueRequest()
         self.GATTDBAttReadByTypeRequestFrame = self.InitGATTDBAttReadByTypeRequest()
@@ -239,6 +241,7 @@ class Spec(object):
         self.GAPEattConnectionAcceptFrame = self.InitGAPEattConnectionAccept()
         self.GAPEattReconfigureRequestFrame = self.InitGAPEattReconfigureRequest()
         self.GAPEattSendCreditsRequestFrame = self.InitGAPEattSendCreditsRequest()
+        self.GAPSetScanReportBatchingRequestFrame = self.InitGAPSetScanReportBatchingRequest()
         self.FSCICPUResetRequestFrame = self.InitFSCICPUResetRequest()
         self.FSCIGetNumberOfFreeBuffersRequestFrame = self.InitFSCIGetNumberOfFreeBuffersRequest()
         self.FSCIAllowDeviceToSleepRequestFrame = self.InitFSCIAllowDeviceToSleepRequest()
@@ -265,6 +268,7 @@ class Spec(object):
         self.L2CAPCBLePsmEnhancedConnectionCompleteIndicationFrame = self.InitL2CAPCBLePsmEnhancedConnectionCompleteIndication()
         self.L2CAPCBEnhancedReconfigureRequestIndicationFrame = self.InitL2CAPCBEnhancedReconfigureRequestIndication()
         self.L2CAPCBEnhancedReconfigureResponseIndicationFrame = self.InitL2CAPCBEnhancedReconfigureResponseIndication()
+        self.L2CAPCBLeCbDataBatchCompleteIndicationFrame = self.InitL2CAPCBLeCbDataBatchCompleteIndication()
         self.GATTConfirmFrame = self.InitGATTConfirm()
         self.GATTGetMtuIndicationFrame = self.InitGATTGetMtuIndication()
         self.GATTClientProcedureExchangeMtuIndicationFrame = self.InitGATTClientProcedureExchangeMtuIndication()
@@ -329,6 +333,7 @@ class Spec(object):
         self.GATTDBDynamicAddCccdIndicationFrame = self.InitGATTDBDynamicAddCccdIndication()
         self.GATTDBDynamicAddCharacteristicDeclarationWithUniqueValueIndicationFrame = self.InitGATTDBDynamicAddCharacteristicDeclarationWithUniqueValueIndication()
         self.GATTDBDynamicAddCharDescriptorWithUniqueValueIndicationFrame = self.InitGATTDBDynamicAddCharDescriptorWithUniqueValueIndication()
+        self.GATTDBDynamicAddServiceIndicationFrame = self.InitGATTDBDynamicAddServiceIndication()
         self.GATTDBAttConfirmFrame = self.InitGATTDBAttConfirm()
         self.GATTDBAttFindInformationIndicationFrame = self.InitGATTDBAttFindInformationIndication()
         self.GATTDBAttFindByTypeValueIndicationFrame = self.InitGATTDBAttFindByTypeValueIndication()
@@ -459,6 +464,7 @@ class Spec(object):
         self.GAPConnectionEventEattBearerStatusNotificationIndicationFrame = self.InitGAPConnectionEventEattBearerStatusNotificationIndication()
         self.GAPGenericEventLeGenerateDhKeyCompleteIndicationFrame = self.InitGAPGenericEventLeGenerateDhKeyCompleteIndication()
         self.GAPGetHostVersionIndicationFrame = self.InitGAPGetHostVersionIndication()
+        self.GAPScanningEventDeviceScannedBatchIndicationFrame = self.InitGAPScanningEventDeviceScannedBatchIndication()
 
 
     def InitL2CAPInitRequest(self):
@@ -605,6 +611,11 @@ class Spec(object):
         cmdParams.append(Cids)
         return FsciFrameDescription(0x42, 0x0B, cmdParams)
 
+    def InitL2CAPCBSendLeCbDataBatchRequest(self):
+        cmdParams = []
+        # not generated, pickle() is used instead; see frames.py
+        return FsciFrameDescription(0x42, 0x0C, cmdParams)
+
     def InitGATTInitRequest(self):
         cmdParams = []
         return FsciFrameDescription(0x45, 0x01, cmdParams)
@@ -1100,6 +1111,11 @@ class Spec(object):
         cmdParams = []
         return FsciFrameDescription(0x46, 0x14, cmdParams)
 
+    def InitGATTDBDynamicAddServiceRequest(self):
+        cmdParams = []
+        # not generated, pickle() is used instead; see frames.py
+        return FsciFrameDescription(0x46, 0x16, cmdParams)
+
     def InitGATTDBAttFindInformationRequest(self):
         cmdParams = []
         DeviceId = FsciParameter("DeviceId", 1)
@@ -2253,6 +2269,16 @@ class Spec(object):
         cmdParams.append(Credits)
         return FsciFrameDescription(0x48, 0x75, cmdParams)
 
+    def InitGAPSetScanReportBatchingRequest(self):
+        cmdParams = []
+        WindowMs = FsciParameter("WindowMs", 2)
+        cmdParams.append(WindowMs)
+        MaxSize = FsciParameter("MaxSize", 2)
+        cmdParams.append(MaxSize)
+        FilterDuplicates = FsciParameter("FilterDuplicates", 1)
+        cmdParams.append(FilterDuplicates)
+        return FsciFrameDescription(0x48, 0x7D, cmdParams)
+
     def InitFSCICPUResetRequest(self):
         cmdParams = []
         return FsciFrameDescription(0xA3, 0x08, cmdParams)
@@ -2411,6 +2437,20 @@ class Spec(object):
         # not generated, cursor based approach in observer; see events.py
         return FsciFrameDescription(0x42, 0x8C, cmdParams)
 
+    def InitL2CAPCBLeCbDataBatchCompleteIndication(self):
+        cmdParams = []
+        DeviceId = FsciParameter("DeviceId", 1)
+        cmdParams.append(DeviceId)
+        ChannelId = FsciParameter("ChannelId", 2)
+        cmdParams.append(ChannelId)
+        Status = FsciParameter("Status", 2)
+        cmdParams.append(Status)
+        SdusSent = FsciParameter("SdusSent", 1)
+        cmdParams.append(SdusSent)
+        SdusQueued = FsciParameter("SdusQueued", 2)
+        cmdParams.append(SdusQueued)
+        return FsciFrameDescription(0x42, 0x8E, cmdParams)
+
     def InitGATTConfirm(self):
         cmdParams = []
         Status = FsciParameter("Status", 2)
@@ -2979,6 +3019,11 @@ class Spec(object):
         cmdParams.append(DescriptorHandle)
         return FsciFrameDescription(0x46, 0x8D, cmdParams)
 
+    def InitGATTDBDynamicAddServiceIndication(self):
+        cmdParams = []
+        # not generated, cursor based approach in observer; see events.py
+        return FsciFrameDescription(0x46, 0x8F, cmdParams)
+
     def InitGATTDBAttConfirm(self):
         cmdParams = []
         Status = FsciParameter("Status", 2)
@@ -4102,3 +4147,8 @@ class Spec(object):
         GapHostVersion_BleHostVerPatch = FsciParameter("GapHostVersion_BleHostVerPatch", 1)
         cmdParams.append(GapHostVersion_BleHostVerPatch)
         return FsciFrameDescription(0x48, 0xF5, cmdParams)
+
+    def InitGAPScanningEventDeviceScannedBatchIndication(self):
+        cmdParams = []
+        # not generated, cursor based approach in observer; see events.py
+        return FsciFrameDescription(0x48, 0xFA, cmdParams)
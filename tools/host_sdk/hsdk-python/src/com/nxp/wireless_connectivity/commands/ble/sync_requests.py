@@ -200,6 +200,71 @@ def L2CAPCBEnhancedCancelConnection(
     request = Frames.L2CAPCBEnhancedCancelConnectionRequest(LePsm, DeviceId, RefuseReason, NoOfChannels, Cids)
     return L2CAPCBEnhancedCancelConnectionOperation(device, request, ack_policy=ack_policy, protocol=protocol, sync_request=True).begin(timeout)
 
+def L2CAPCBSendLeCbDataBatch(
+    device,
+    DeviceId=bytearray(1),
+    ChannelId=bytearray(2),
+    NoOfSdus=bytearray(1),
+    # Array length depends on NoOfSdus.
+    Sdus=[],
+    ack_policy=FsciAckPolicy.GLOBAL,
+    protocol=Protocol.BLE,
+    timeout=1
+):
+    request = Frames.L2CAPCBSendLeCbDataBatchRequest(DeviceId, ChannelId, NoOfSdus, Sdus)
+    return L2CAPCBSendLeCbDataBatchOperation(device, request, ack_policy=ack_policy, protocol=protocol, sync_request=True).begin(timeout)
+
+def L2CAPCBSendLeCbDataStream(
+    device,
+    DeviceId=bytearray(1),
+    ChannelId=bytearray(2),
+    Data=bytearray(),
+    SduSize=23,
+    SdusPerBatch=8,
+    MaxBatchesInFlight=2,
+    ack_policy=FsciAckPolicy.GLOBAL,
+    protocol=Protocol.BLE,
+    timeout=5
+):
+    '''
+    Sends Data over a Credit Based channel as batches of SduSize SDUs, keeping up to
+    MaxBatchesInFlight batches queued on the board, which sends them as the peer gives
+    credits. Each batch is released by its L2CAPCBLeCbDataBatchCompleteIndication.
+    The batches are pipelined with beginAsync(), so do not stream on two channels of
+    the same device at once.
+
+    @param SduSize: bytes per SDU, at most the peer MTU
+    @param MaxBatchesInFlight: at most gFsciBleL2capCbStreamDepth_c of the board
+    @param timeout: seconds to wait for each batch to complete
+    @return: (bytes given to L2CAP before the first error, status of that error or gBleSuccess_c)
+    '''
+    Data = bytearray(Data)
+    offset = 0
+    acked = 0
+    # a name, or a number with BLE_ENUMS_FORCE_INT, as in the events
+    success = L2CAPCBConfirmStatus.getEnumString(L2CAPCBConfirmStatus.gBleSuccess_c)
+    status = success
+    inFlight = []
+
+    while inFlight or (offset < len(Data) and status == success):
+        while offset < len(Data) and status == success and len(inFlight) < MaxBatchesInFlight:
+            sdus = []
+            while offset < len(Data) and len(sdus) < SdusPerBatch:
+                chunk = Data[offset:offset + SduSize]
+                sdus.append(Frames.L2CAPCBSendLeCbDataBatchRequest.Sdus(len(chunk), chunk))
+                offset += len(chunk)
+            request = Frames.L2CAPCBSendLeCbDataBatchRequest(DeviceId, ChannelId, len(sdus), sdus)
+            future = L2CAPCBSendLeCbDataBatchOperation(device, request, ack_policy=ack_policy, protocol=protocol).beginAsync(timeout)
+            inFlight.append((future, [sdu.Length for sdu in sdus]))
+
+        future, lengths = inFlight.pop(0)
+        event = future.result()
+        if status == success:
+            acked += sum(lengths[:event.SdusSent])
+            status = event.Status
+
+    return acked, status
+
 def GATTInit(
     device,
     ack_policy=FsciAckPolicy.GLOBAL,
@@ -1308,6 +1373,17 @@ def GATTDBDynamicEndDatabaseUpdate(
     request = Frames.GATTDBDynamicEndDatabaseUpdateRequest()
     return GATTDBDynamicEndDatabaseUpdateOperation(device, request, ack_policy=ack_policy, protocol=protocol, sync_request=True).begin(timeout)
 
+def GATTDBDynamicAddService(
+    device,
+    # Frames.GATTDBDynamicAddServiceRequest.Service, then Characteristic records each followed by its Descriptor and Cccd records
+    Records=[],
+    ack_policy=FsciAckPolicy.GLOBAL,
+    protocol=Protocol.BLE,
+    timeout=1
+):
+    request = Frames.GATTDBDynamicAddServiceRequest(Records)
+    return GATTDBDynamicAddServiceOperation(device, request, ack_policy=ack_policy, protocol=protocol, sync_request=True).begin(timeout)
+
 def GATTDBAttFindInformation(
     device,
     DeviceId=bytearray(1),
@@ -2874,6 +2950,18 @@ def GAPEattSendCredits(
     request = Frames.GAPEattSendCreditsRequest(DeviceId, BearerId, Credits)
     return GAPEattSendCreditsOperation(device, request, ack_policy=ack_policy, protocol=protocol, sync_request=True).begin(timeout)
 
+def GAPSetScanReportBatching(
+    device,
+    WindowMs=bytearray(2),
+    MaxSize=bytearray(2),
+    FilterDuplicates=bytearray(1),
+    ack_policy=FsciAckPolicy.GLOBAL,
+    protocol=Protocol.BLE,
+    timeout=1
+):
+    request = Frames.GAPSetScanReportBatchingRequest(WindowMs, MaxSize, FilterDuplicates)
+    return GAPSetScanReportBatchingOperation(device, request, ack_policy=ack_policy, protocol=protocol, sync_request=True).begin(timeout)
+
 def FSCICPUReset(
     device,
     ack_policy=FsciAckPolicy.GLOBAL,
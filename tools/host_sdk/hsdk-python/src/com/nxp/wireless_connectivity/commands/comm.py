@@ -7,7 +7,8 @@
 '''
 
 from binascii import hexlify
-from threading import Lock
+from collections import deque
+from threading import Lock, Timer
 import time
 
 from com.nxp.wireless_connectivity.commands.fsci_frame_description import FsciAckPolicy, Protocol
@@ -15,7 +16,7 @@ from com.nxp.wireless_connectivity.hsdk.CUartLibrary import Baudrate
 from com.nxp.wireless_connectivity.hsdk.framing.fsci_command import FsciCommand
 from com.nxp.wireless_connectivity.hsdk.framing.fsci_framer import FsciFramer
 from com.nxp.wireless_connectivity.hsdk.singleton import singleton
-from com.nxp.wireless_connectivity.hsdk.utils import DEBUG, USE_LOGGER, print_command
+from com.nxp.wireless_connectivity.hsdk.utils import DEBUG, USE_LOGGER, print_command, print_event
 
 
 if USE_LOGGER:
@@ -24,6 +25,178 @@ if USE_LOGGER:
     logger = logging.getLogger('root.comm')
 
 
+class FsciTimeout(Exception):
+
+    '''
+    Set on the future of a pipelined request whose deadline passed before its event arrived.
+    '''
+
+
+class PendingRequest(object):
+
+    '''
+    One pipelined request in flight. The same object is queued for every kind of event
+    the request expects, and takes the first of them.
+    '''
+
+    def __init__(self, future):
+        self.future = future
+        # an event was taken for the request, its other queued entries are skipped
+        self.answered = False
+        # the deadline passed or the future was cancelled, the event is discarded
+        self.abandoned = False
+        # when it was abandoned, its late event is only waited for during the grace period
+        self.abandonedAt = None
+        self.timer = None
+
+    def abandon(self):
+        self.abandoned = True
+        self.abandonedAt = time.time()
+
+
+class PendingRequests(object):
+
+    '''
+    The futures of the pipelined requests in flight on one device. Each event resolves the
+    oldest request waiting for its operation group and code, so the events of several
+    requests of the same kind are matched in the order the requests were sent.
+
+    A request whose deadline passed or whose future was cancelled keeps its place for a
+    grace period: the board still answers it, and the late event is discarded instead of
+    being given to the next request. Past the grace period the request is dropped, so a
+    response that is lost for good only costs the requests of the same kind answered
+    during that period.
+    '''
+
+    # seconds an abandoned request keeps its place, waiting for its late event
+    ABANDONED_GRACE = 1.0
+
+    def __init__(self, fsciFramer, unmatched=print_event, grace=ABANDONED_GRACE):
+        '''
+        @param fsciFramer: the framer on which the events are observed
+        @param unmatched: called with the device name and the event when no request
+                          waits for it, e.g. an indication
+        @param grace: seconds a timed out or cancelled request keeps its place
+        '''
+        self.fsciFramer = fsciFramer
+        self.unmatched = unmatched
+        self.grace = grace
+        self.lock = Lock()
+        # (opGroup, opCode) -> deque of PendingRequest
+        self.waiting = {}
+
+    def expect(self, observers, future, timeout=None):
+        '''
+        Registers a future to be resolved by the first event of any of the observers.
+        One observer is added to the framer per operation group and code, and kept.
+
+        @param observers: the observers of the operation, giving the events expected
+        @param future: the future to resolve with the event object
+        @param timeout: seconds after which the future fails with FsciTimeout, enforced
+                        by a timer; None to wait forever
+        '''
+        request = PendingRequest(future)
+
+        with self.lock:
+            for observer in observers:
+                key = (observer.opGroup, observer.opCode)
+
+                if key not in self.waiting:
+                    self.waiting[key] = deque()
+                    self.fsciFramer.addObserver(observer, self.getCallbackFunc(key))
+
+                self.waiting[key].append(request)
+
+            if timeout is not None and observers:
+                request.timer = Timer(timeout, self.expire, [request])
+                request.timer.daemon = True
+                request.timer.start()
+
+        # the grace period of a cancelled request starts with the cancellation
+        future.add_done_callback(lambda f: f.cancelled() and self.cancelled(request))
+
+    def cancelled(self, request):
+        '''
+        Marks a request whose future was cancelled by the caller.
+        '''
+        with self.lock:
+            if not request.answered and not request.abandoned:
+                request.abandon()
+
+    def expire(self, request):
+        '''
+        Fails a request whose deadline passed before its event arrived.
+        '''
+        with self.lock:
+            if request.answered or request.abandoned:
+                return
+
+            request.abandon()
+
+            # from now on the caller can no longer cancel it
+            if not request.future.set_running_or_notify_cancel():
+                return
+
+        # outside the lock, the done callbacks may send the next requests
+        request.future.set_exception(FsciTimeout('No response before the deadline'))
+
+    def getCallbackFunc(self, key):
+        '''
+        Creates the observer callback resolving the futures waiting for one kind of event.
+        '''
+        def func(deviceName, event):
+            self.resolve(deviceName, key, event)
+
+        return func
+
+    def resolve(self, deviceName, key, event):
+        '''
+        Gives the event to the oldest request waiting for it. A request waiting for
+        several kinds of events stays queued for the others once answered, and is
+        skipped. The event of an abandoned request is discarded, unless its grace
+        period is over and the request is skipped.
+        '''
+        target = None
+
+        with self.lock:
+            waiting = self.waiting[key]
+            now = time.time()
+
+            while waiting:
+                request = waiting.popleft()
+
+                # answered by another kind of event
+                if request.answered:
+                    continue
+
+                # its event is taken as lost
+                if request.abandoned and now - request.abandonedAt > self.grace:
+                    continue
+
+                request.answered = True
+
+                if request.timer is not None:
+                    request.timer.cancel()
+
+                # cancelled by the caller, the event belongs to it all the same
+                if not request.abandoned and not request.future.set_running_or_notify_cancel():
+                    request.abandon()
+
+                if not request.abandoned:
+                    target = request
+
+                break
+            else:
+                request = None
+
+        if target is not None:
+            # outside the lock, the done callbacks may send the next requests
+            target.future.set_result(event)
+        elif request is None:
+            # nobody is waiting
+            self.unmatched(deviceName, event)
+
+
 @singleton
 class Comm(object):
 
@@ -45,14 +218,17 @@ class Comm(object):
         self.protocol = protocol
         self.lock = Lock()
         self.fsciFramer = FsciFramer(deviceName, ack_policy=ack_policy, protocol=protocol, baudrate=baudrate)
+        self.pending = PendingRequests(self.fsciFramer)
 
-    def send(self, commandSpec, commandPayload, virtualInterface=0, printCmd=True):
+    def send(self, commandSpec, commandPayload, virtualInterface=0, printCmd=True, pace=True):
         '''
         Wrapper function over the Framer's send method. Builds an packet based on the command specification and
         the frame (which is an object with fields at this point) and calls the Framer send method to send the packet.
 
         @param commandSpec: The specification of the command.
         @param commandPayload: The bytes composing the packet.
+        @param pace: Whether to wait between successive commands. Pipelined requests, which
+                     are matched to their events, do not need it.
         '''
         if printCmd:
             print_command(self.deviceName, commandPayload)
@@ -114,8 +290,8 @@ class Comm(object):
         # reset needs more wait time
         if (commandSpec.opGroup, commandSpec.opCode) == (0xA3, 0x08):
             time.sleep(2)
-        # push firmware chunks as fast as possible
-        elif (commandSpec.opGroup, commandSpec.opCode) == (0xA3, 0x2A):
+        # push firmware chunks and pipelined requests as fast as possible
+        elif (commandSpec.opGroup, commandSpec.opCode) == (0xA3, 0x2A) or not pace:
             pass
         # delay between successive commands, may be tweaked depending on the host system's
         # speed; by default 50ms
@@ -8,6 +8,58 @@
 
 from com.nxp.wireless_connectivity.commands.fsci_parameter import FsciParameterType
 
+# kinds of steps in a decode plan, see compileDecodePlan()
+DECODE_FIXED = 0
+DECODE_ARRAY = 1
+DECODE_SELECT = 2
+
+
+if hasattr(int, 'from_bytes'):
+    def bytesToNumber(value):
+        '''
+        @param value: bytearray, least significant byte first
+        @return: integer
+        '''
+        return int.from_bytes(value, 'little')
+else:
+    # Python 2
+    def bytesToNumber(value):
+        val = 0
+        for i in range(len(value)):
+            val += value[i] << (8 * i)
+        return val
+
+
+def compileDecodePlan(fsciFrameDescription):
+    '''
+    Turns the parameters of a frame into the steps used by fillFromBytes, once per frame.
+    Consecutive fixed size parameters are merged into a single step with precomputed
+    offsets, arrays sized by another parameter take one step each, and only the parameters
+    selected by another parameter's value keep walking the selectDict.
+
+    @param fsciFrameDescription: the FsciFrameDescription
+    @return: a tuple of steps
+    '''
+    plan = []
+    run = None
+
+    for parameter in fsciFrameDescription.cmdParams:
+        if parameter.selectDict is not None:
+            run = None
+            plan.append((DECODE_SELECT, parameter))
+        elif parameter.dependency is not None:
+            run = None
+            plan.append((DECODE_ARRAY, parameter.name, parameter.dependency.name, parameter.size))
+        else:
+            if run is None:
+                # [kind, [(name, start, end), ...], size of the run]
+                run = [DECODE_FIXED, [], 0]
+                plan.append(run)
+            run[1].append((parameter.name, run[2], run[2] + parameter.size))
+            run[2] += parameter.size
+
+    return tuple(tuple(step) if step[0] == DECODE_FIXED else step for step in plan)
+
 
 class FsciDataPacket(object):
 
@@ -22,14 +74,20 @@ class FsciDataPacket(object):
         @param fsciFrameDescription: The packet specification used.
         '''
         self.fsciFrameDescription = fsciFrameDescription
-        self.values = {}  # Map<String, bytearray>
 
-        for param in fsciFrameDescription.cmdParams:
-            if param.selectDict is not None:
-                for selectList in param.selectDict.values():
-                    for subParam in selectList:
-                        self.values[subParam.name] = None
-            self.values[param.name] = None
+        if fsciFrameDescription.emptyValues is None:
+            emptyValues = {}
+
+            for param in fsciFrameDescription.cmdParams:
+                if param.selectDict is not None:
+                    for selectList in param.selectDict.values():
+                        for subParam in selectList:
+                            emptyValues[subParam.name] = None
+                emptyValues[param.name] = None
+
+            fsciFrameDescription.emptyValues = emptyValues
+
+        self.values = dict(fsciFrameDescription.emptyValues)  # Map<String, bytearray>
 
     def setParamValue(self, param, value):
         '''
@@ -133,24 +191,15 @@ class FsciDataPacket(object):
         @param param: String type key of self.values
         @return: integer
         '''
-        val = 0
+        paramValue = self.values.get(param)
 
-        if (param not in self.values) or (self.values[param] is None):
-            return val
-        else:
-            paramObj = self.fsciFrameDescription.getParam(param)
+        if paramValue is None:
+            return 0
 
-            paramValue = self.values[param]
-            assert type(paramValue) is bytearray
-
-            if paramObj.endianness == FsciParameterType.LittleEndianBytes:
-                for i in range(len(paramValue)):
-                    val += paramValue[i] << (8 * i)
-            else:
-                for i in range(len(paramValue) - 1, -1, -1):
-                    val += paramValue[i] << (8 * i)
+        assert type(paramValue) is bytearray
 
-        return val
+        # both endianness values have always been read least significant byte first
+        return bytesToNumber(paramValue)
 
     def getParamValueAsList(self, param):
         '''
@@ -167,8 +216,7 @@ class FsciDataPacket(object):
             paramValue = self.values[param]
             assert type(paramValue) is bytearray
 
-            for i in range(len(paramValue)):
-                val.append(paramValue[i])
+            val = list(paramValue)
 
             if paramObj.endianness == FsciParameterType.LittleEndianBytes:
                 return val[::-1]
@@ -180,62 +228,87 @@ class FsciDataPacket(object):
         This method will be called from the observers' observeEvent methods.
         This is why payload has a ctypes type.
 
-        @param payload: ctypes LP_c_ubyte_Array
+        @param payload: ctypes LP_c_ubyte_Array, or any sequence of bytes
         @param length: number of bytes in payload
         '''
-        copyCursor = 0
+        fsciFrameDescription = self.fsciFrameDescription
 
-        for parameter in self.fsciFrameDescription.cmdParams:
-            if parameter.selectDict is not None:
-                if parameter.dependency is not None:
-                    if self.getParamValue(parameter.dependency.name) is not None:
+        if fsciFrameDescription.decodePlan is None:
+            fsciFrameDescription.decodePlan = compileDecodePlan(fsciFrameDescription)
 
-                        dictValue = self.getParamValueAsNumber(parameter.dependency.name)
-                        if dictValue in parameter.selectDict:
+        # a single copy out of the ctypes array, the fields are then sliced out of it
+        payload = bytearray(payload)
+        values = self.values
+        copyCursor = 0
 
-                            selectedParameters = parameter.selectDict[dictValue]
-                            for selectedParam in selectedParameters:
+        for step in fsciFrameDescription.decodePlan:
+            kind = step[0]
 
-                                size = 0
-                                if selectedParam.dependency is not None:
-                                    size = self.getParamValueAsNumber(
-                                        selectedParam.dependency.name) * selectedParam.size
-                                else:
-                                    size = selectedParam.size
+            if kind == DECODE_FIXED:
+                if payloadLength >= copyCursor + step[2]:
+                    for name, start, end in step[1]:
+                        values[name] = payload[copyCursor + start:copyCursor + end]
+                    copyCursor += step[2]
+                else:
+                    # truncated, keep the fields that fit entirely
+                    for name, start, end in step[1]:
+                        if payloadLength < copyCursor + end:
+                            return
+                        values[name] = payload[copyCursor + start:copyCursor + end]
+                    return
 
-                                try:
-                                    value = bytearray(size)
-                                except OverflowError:
-                                    print ('[fillFromBytes] This error should not cause problems to complex events.')
+            elif kind == DECODE_ARRAY:
+                count = values[step[2]]
+                size = (bytesToNumber(count) if count is not None else 0) * step[3]
 
-                                if payloadLength >= copyCursor + size:
-                                    for i in range(size):
-                                        value[i] = payload[copyCursor + i]
-                                else:
-                                    return
+                if payloadLength < copyCursor + size:
+                    return
 
-                                self.values[parameter.name] = value
-                                copyCursor += size
-            else:
-                size = 0
-                if parameter.dependency is not None:
-                    size = self.getParamValueAsNumber(parameter.dependency.name) * parameter.size
-                else:
-                    size = parameter.size
+                values[step[1]] = payload[copyCursor:copyCursor + size]
+                copyCursor += size
 
-                try:
-                    value = bytearray(size)
-                except OverflowError:
-                    print ('[fillFromBytes] This error should not cause problems to complex events.')
+            else:
+                copyCursor = self.fillSelectFromBytes(step[1], payload, payloadLength, copyCursor)
 
-                if payloadLength >= copyCursor + size:
-                    for i in range(size):
-                        value[i] = payload[copyCursor + i]
-                else:
+                if copyCursor is None:
                     return
 
-                self.values[parameter.name] = value
-                copyCursor += size
+    def fillSelectFromBytes(self, parameter, payload, payloadLength, copyCursor):
+        '''
+        Decodes a parameter whose layout is selected by the value of another parameter.
+
+        @param parameter: the FsciParameter having a selectDict
+        @param payload: bytearray
+        @param payloadLength: number of bytes in payload
+        @param copyCursor: the offset of the parameter in payload
+
+        @return: the offset after the parameter, None if payload is too short
+        '''
+        if parameter.dependency is not None:
+            if self.getParamValue(parameter.dependency.name) is not None:
+
+                dictValue = self.getParamValueAsNumber(parameter.dependency.name)
+                if dictValue in parameter.selectDict:
+
+                    selectedParameters = parameter.selectDict[dictValue]
+                    for selectedParam in selectedParameters:
+
+                        size = 0
+                        if selectedParam.dependency is not None:
+                            size = self.getParamValueAsNumber(
+                                selectedParam.dependency.name) * selectedParam.size
+                        else:
+                            size = selectedParam.size
+
+                        if payloadLength >= copyCursor + size:
+                            value = payload[copyCursor:copyCursor + size]
+                        else:
+                            return None
+
+                        self.values[parameter.name] = value
+                        copyCursor += size
+
+        return copyCursor
 
     def getFrameSize(self):
         '''
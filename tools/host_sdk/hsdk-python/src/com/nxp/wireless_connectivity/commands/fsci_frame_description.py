@@ -24,6 +24,9 @@ class FsciFrameDescription(object):
         self.cmdParams = cmdParams
         self.paramDict = {}
         self.buildParamDict()
+        # built on first use by FsciDataPacket
+        self.emptyValues = None
+        self.decodePlan = None
 
     def buildParamDict(self):
 
@@ -13,6 +13,10 @@ else:
     import queue as Queue
 import abc
 import time
+try:
+    from concurrent.futures import Future
+except ImportError:  # Python 2 without the futures backport
+    Future = None
 
 from com.nxp.wireless_connectivity.commands.comm import Comm
 from com.nxp.wireless_connectivity.commands.fsci_frame_description import FsciAckPolicy, Protocol
@@ -46,13 +50,15 @@ class FsciOperation(object):
         self.callbacks = callbacks
         self.protocol = protocol
         self.sync_request = sync_request
+        # set by beginAsync(), the observers are then shared through comm.pending
+        self.pipelined = False
 
     def sendRequest(self):
         '''
         Sends the request downwards to the Communication module to be transmitted on wire.
         '''
         virtualInterface = 1 if self.protocol == Protocol.Hybrid else 0
-        self.comm.send(self.spec, self.request, virtualInterface)
+        self.comm.send(self.spec, self.request, virtualInterface, pace=not self.pipelined)
 
     @abc.abstractmethod
     def subscribeToEvents(self):
@@ -61,6 +67,9 @@ class FsciOperation(object):
         with specific event observers.
         Reason for abstract method: self.observers will be set from the child class.
         '''
+        if self.pipelined:
+            return
+
         if self.callbacks == []:
             for observer in self.observers:
                 self.comm.fsciFramer.addObserver(observer, sync_request=self.sync_request)
@@ -75,6 +84,10 @@ class FsciOperation(object):
         '''
         Removes the added observers.
         '''
+        if self.pipelined:
+            # shared with the other pipelined requests through comm.pending
+            return
+
         self.comm.fsciFramer.removeObservers(self.observers)
 
     def begin(self, timeout=0.2):
@@ -113,6 +126,39 @@ class FsciOperation(object):
                 time.sleep(timeout)
                 self.unsubscribeFromEvents()
 
+    def beginAsync(self, timeout=None):
+        '''
+        Sends the request without waiting for its event, so that many requests may be in
+        flight on one device. The returned future is resolved with the first event of the
+        operation's observers, matched by operation group and code in the order the
+        requests were sent, or with None if the operation expects no event. The callbacks
+        of the operation are not used.
+
+        Wait with future.result(timeout), add_done_callback(), or, from asyncio,
+        await asyncio.wrap_future(future). Do not mix with begin() on the same device
+        for the same events while requests are in flight.
+
+        @param timeout: seconds after which the future fails with FsciTimeout; None to
+                        only rely on the timeout given to future.result()
+        @return: a concurrent.futures.Future
+        '''
+        if Future is None:
+            raise RuntimeError('beginAsync needs concurrent.futures (Python 3 or the futures backport)')
+
+        future = Future()
+        self.pipelined = True
+
+        # The lock only keeps the registration and the sending in the same order.
+        with self.comm.lock:
+            self.subscribeToEvents()
+            self.comm.pending.expect(self.observers, future, timeout)
+            self.sendRequest()
+
+        if self.observers == []:
+            future.set_result(None)
+
+        return future
+
     def end(self):
         '''
         Method called when we want to end an operation.
@@ -6,7 +6,7 @@
 * SPDX-License-Identifier: BSD-3-Clause
 '''
 
-from ctypes import c_int, c_uint8, c_uint32, c_longlong, Structure, POINTER
+from ctypes import c_int, c_uint8, c_uint32, c_uint64, c_longlong, c_void_p, Structure, POINTER
 
 
 class FsciFrame(Structure):
@@ -26,10 +26,31 @@ class FsciFrame(Structure):
         ('index', c_uint32),
         ('endian', c_int),
         ('virtualInterface', c_uint8),
+        ('firstByteNs', c_uint64),
+        ('completeNs', c_uint64),
         ('direction', c_int)
     ]
 
 
+class RawFrame(Structure):
+
+    '''
+    ctypes Structure that maps over the RawFrame C structure, as received by the
+    TX observers attached with AttachTxToFramer.
+    '''
+
+    _fields_ = [
+        ('packetIndex', c_uint32),
+        ('aRawData', POINTER(c_uint8)),
+        ('cbTotalSize', c_uint32),
+        ('iCrtIndex', c_uint32),
+        ('timestamp', c_longlong),
+        ('timeStampNs', c_uint64),
+        ('writtenNs', c_uint64),
+        ('pShared', c_void_p)
+    ]
+
+
 class Endianess(object):
     Big = 0
     Little = 1
@@ -45,6 +45,7 @@ class DeviceType(object):
     PCAP = 2
     SPI = 3
     BT = 4
+    VIRTUAL = 5
 
 
 class Baudrate(object):
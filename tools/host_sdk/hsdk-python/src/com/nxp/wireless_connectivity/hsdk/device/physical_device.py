@@ -41,6 +41,9 @@ class PhysicalDevice(object):
 
         if self.name.startswith(b'eth'):
             self.device_type = DeviceType.PCAP
+        elif self.name.startswith(b'virtual'):
+            # an emulated board, b'virtual:<script>', see hsdk/doc/Serial.md
+            self.device_type = DeviceType.VIRTUAL
         elif self.name.startswith(b'/dev/spidev'):
             self.device_type = DeviceType.SPI
             self.ll.CSpiLibrary.defaultSettingsSPI.restype = c_void_p
@@ -16,7 +16,7 @@ else:
 import sys
 import traceback
 
-from com.nxp.wireless_connectivity.hsdk.CFsciLibrary import FsciFrame, Endianess
+from com.nxp.wireless_connectivity.hsdk.CFsciLibrary import FsciFrame, RawFrame, Endianess
 from com.nxp.wireless_connectivity.hsdk.CUartLibrary import Baudrate
 from com.nxp.wireless_connectivity.hsdk.device.device_manager import DeviceManager
 from com.nxp.wireless_connectivity.hsdk.device.physical_device import PhysicalDevice
@@ -60,7 +60,7 @@ class FsciDevice(object):
                 print (line.strip())
             raise RuntimeError('FsciDevice __init__: deviceName must be a string, got ' + str(type(deviceName)))
 
-        if deviceName.startswith(('eth', '/dev/ttymxc', '/dev/spidev')):
+        if deviceName.startswith(('eth', '/dev/ttymxc', '/dev/spidev', 'virtual')):
             self.device = PhysicalDevice(type('mock', (object,), {'deviceName': deviceName, 'vid': 'FFFF', 'pid': 'FFFF'}))
         else:
             self.device = DeviceManager().getDevice(deviceName)
@@ -91,16 +91,38 @@ class FsciFramer(Observable):
             @param deviceName: the caller device
             @param fsciFrameReference: pointer to a FSCI frame that is to be handled in the Observer
             '''
+            # read before the observers get the chance to destroy the frame
+            self.lastRxTimestamps = self.getTimestamps(fsciFrameReference)
             self.notifyObservers(
                 self.deviceName,
                 self.getOpGroup(fsciFrameReference),
                 self.getOpCode(fsciFrameReference),
                 fsciFrameReference,
-                self.protocol
+                self.protocol,
+                self.lastRxTimestamps
             )
 
         return CALLBACK(func)
 
+    def getTxCallbackFunc(self):
+        '''
+        Creates a ctypes compatible callback function passing the timestamps of each
+        frame written by the device to the TX observers.
+        '''
+        def func(deviceName, rawFrameReference):
+            '''
+            Called from the device thread once the frame was written.
+
+            @param deviceName: the caller device
+            @param rawFrameReference: pointer to the RawFrame, only valid during the call
+            '''
+            rawFrame = cast(rawFrameReference, POINTER(RawFrame)).contents
+            self.lastTxTimestamps = (rawFrame.packetIndex, rawFrame.timeStampNs, rawFrame.writtenNs)
+            for txObserver in list(self.txObservers):
+                txObserver(self.deviceName, self.lastTxTimestamps)
+
+        return CALLBACK(func)
+
     def __init__(self, deviceName, ack_policy=FsciAckPolicy.GLOBAL, protocol=Protocol.Thread, baudrate=Baudrate.BR115200):
         self.ll = LibraryLoader()
         self.dm = DeviceManager()
@@ -135,6 +157,16 @@ class FsciFramer(Observable):
         self.ll.CFramerLibrary.AttachToFramer.argtypes = [c_void_p, c_void_p, CALLBACK]
         self.ll.CFramerLibrary.AttachToFramer(self.framerPointer, id(self), self.callback)
 
+        # timestamps of the last write and read, (packetIndex, queued ns, written ns) and
+        # (first byte ns, complete ns) using the clock of MonotonicTimeNs; the TX callback
+        # is only attached while a TX observer is registered, see addTxObserver
+        self.lastTxTimestamps = None
+        self.lastRxTimestamps = None
+        self.txObservers = []
+        self.txCallback = self.getTxCallbackFunc()  # to prevent garbage collecting
+        self.ll.CFramerLibrary.AttachTxToFramer.argtypes = [c_void_p, c_void_p, CALLBACK]
+        self.ll.CFramerLibrary.DetachTxFromFramer.argtypes = [c_void_p, c_void_p]
+
         # add the ACK observer when having #define gFsciTxAck_c TRUE
         if config.FSCI_TX_ACK:
             self.addObserver(FSCIACKObserver('FSCI_Ack'))
@@ -194,6 +226,32 @@ class FsciFramer(Observable):
 
         return rc
 
+    def addTxObserver(self, txObserver):
+        '''
+        Registers a function called from the device thread after each write, with the
+        device name and the (packetIndex, queued ns, written ns) timestamps.
+
+        @param txObserver: the function to be called
+        '''
+        if txObserver in self.txObservers:
+            return
+        self.txObservers.append(txObserver)
+        if len(self.txObservers) == 1:
+            self.ll.CFramerLibrary.AttachTxToFramer(self.framerPointer, id(self), self.txCallback)
+
+    def removeTxObserver(self, txObserver):
+        '''
+        Unregisters a function added with addTxObserver. Once none is left, the writes
+        are no longer reported to Python.
+
+        @param txObserver: the function to be removed
+        '''
+        if txObserver not in self.txObservers:
+            return
+        self.txObservers.remove(txObserver)
+        if not self.txObservers:
+            self.ll.CFramerLibrary.DetachTxFromFramer(self.framerPointer, id(self))
+
     def destroyFrame(self, fsciFrameReference):
         '''
         Frees the memory allocated for a frame.
@@ -221,9 +279,22 @@ class FsciFramer(Observable):
         '''
         return cast(fsciFrameReference + 2, POINTER(c_uint8)).contents.value
 
+    def getTimestamps(self, fsciFrameReference):
+        '''
+        Retrieves the monotonic timestamps of a received frame.
+
+        @param fsciFrameReference: pointer to a FSCI frame
+        @return: (firstByteNs, completeNs) tuple, in nanoseconds
+        '''
+        frame = cast(fsciFrameReference, POINTER(FsciFrame)).contents
+        return (frame.firstByteNs, frame.completeNs)
+
     def detach(self):
         self.ll.CFramerLibrary.DetachFromFramer.argtypes = [c_void_p, c_void_p]
         self.ll.CFramerLibrary.DetachFromFramer(self.framerPointer, id(self))
+        if self.txObservers:
+            self.txObservers = []
+            self.ll.CFramerLibrary.DetachTxFromFramer(self.framerPointer, id(self))
 
     def destroy(self):
         self.detach()
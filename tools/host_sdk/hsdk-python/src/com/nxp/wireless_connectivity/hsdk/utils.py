@@ -65,7 +65,22 @@ class Observable(list):
     def removeAllObservers(self):
         self[:] = []
 
-    def notifyObservers(self, deviceName, og, oc, event, protocol):
+    @staticmethod
+    def timestampedCallback(callback, rxTimestamps):
+        '''
+        Wraps an observer callback so that the frame it receives carries the
+        (first byte ns, complete ns) timestamps of the event as rxTimestamps.
+        '''
+        def func(deviceName, frame):
+            try:
+                frame.rxTimestamps = rxTimestamps
+            except AttributeError:
+                pass
+            return callback(deviceName, frame)
+
+        return func
+
+    def notifyObservers(self, deviceName, og, oc, event, protocol, rxTimestamps=None):
 
         observerFound = False
 
@@ -74,6 +89,9 @@ class Observable(list):
             if observer.opGroup == og and observer.opCode == oc:
                 observerFound = True
                 observer.deviceName = deviceName
+                observer.rxTimestamps = rxTimestamps
+                if callback is not None and rxTimestamps is not None:
+                    callback = Observable.timestampedCallback(callback, rxTimestamps)
                 observer.observeEvent(self, event, callback, sync_request)
 
         if not observerFound:
@@ -91,6 +109,7 @@ class Observable(list):
                     from com.nxp.wireless_connectivity.commands.zigbee.events import allObservers
                 try:
                     allObservers[(og, oc)].deviceName = deviceName
+                    allObservers[(og, oc)].rxTimestamps = rxTimestamps
                     allObservers[(og, oc)].observeEvent(self, event, None, False)
                 except KeyError:
                     if DEBUG:
@@ -108,6 +127,8 @@ class Observer(object):
     def __init__(self, name):
         self.name = name
         self.deviceName = None
+        # (first byte ns, complete ns) of the event being observed, see FsciFramer
+        self.rxTimestamps = None
 
     def observeEvent(self, framer, event, callback, sync_request):
         # Cast the event to a FSCI frame.
@@ -1 +1 @@
-__all__ = ['bootloader', 'hrs']
+__all__ = ['bootloader', 'hrs', 'pending_requests']
@@ -0,0 +1,149 @@
+#!/usr/bin/env python
+'''
+* Copyright 2026 NXP
+* All rights reserved.
+*
+* SPDX-License-Identifier: BSD-3-Clause
+'''
+
+import os
+import sys
+import time
+import types
+import unittest
+try:
+    from unittest import mock
+except ImportError:
+    import mock
+from concurrent.futures import Future
+
+sys.path.append(os.path.abspath(os.path.join(os.path.dirname(__file__), '../../../..')))
+
+# PendingRequests only talks to the framer through addObserver, run without the native libraries
+libraryLoader = types.ModuleType('com.nxp.wireless_connectivity.hsdk.library_loader')
+libraryLoader.LibraryLoader = mock.MagicMock()
+sys.modules[libraryLoader.__name__] = libraryLoader
+
+from com.nxp.wireless_connectivity.commands.comm import FsciTimeout, PendingRequests
+
+
+class FakeObserver(object):
+
+    def __init__(self, opGroup, opCode):
+        self.opGroup = opGroup
+        self.opCode = opCode
+
+
+class FakeFramer(object):
+
+    '''
+    Keeps the callback of each observer, so that the test delivers the events.
+    '''
+
+    def __init__(self):
+        self.callbacks = {}
+
+    def addObserver(self, observer, callback=None, sync_request=False):
+        self.callbacks[(observer.opGroup, observer.opCode)] = callback
+
+    def receive(self, key, event):
+        self.callbacks[key]('test', event)
+
+
+CONFIRM = FakeObserver(0x46, 0x80)
+INDICATION = FakeObserver(0x46, 0x8F)
+
+
+class PendingRequestsTest(unittest.TestCase):
+
+    def setUp(self):
+        self.framer = FakeFramer()
+        self.unmatched = []
+        self.pending = PendingRequests(self.framer, lambda deviceName, event: self.unmatched.append(event))
+
+    def expect(self, observers, timeout=None):
+        future = Future()
+        self.pending.expect(observers, future, timeout)
+        return future
+
+    def test_events_in_send_order(self):
+        first = self.expect([CONFIRM])
+        second = self.expect([CONFIRM])
+        self.framer.receive((0x46, 0x80), 'A')
+        self.framer.receive((0x46, 0x80), 'B')
+        self.assertEqual(first.result(0), 'A')
+        self.assertEqual(second.result(0), 'B')
+
+    def test_deadline_without_event(self):
+        future = self.expect([CONFIRM], timeout=0.05)
+        self.assertRaises(FsciTimeout, future.result, 1)
+
+    def test_late_event_then_new_request(self):
+        late = self.expect([CONFIRM], timeout=0.05)
+        self.assertRaises(FsciTimeout, late.result, 1)
+
+        following = self.expect([CONFIRM], timeout=1)
+        # the response of the timed out request arrives, then the one of the new request
+        self.framer.receive((0x46, 0x80), 'late')
+        self.assertFalse(following.done())
+        self.framer.receive((0x46, 0x80), 'B')
+        self.assertEqual(following.result(0), 'B')
+
+        # the matching stays in step for the requests sent afterwards
+        after = self.expect([CONFIRM])
+        self.framer.receive((0x46, 0x80), 'C')
+        self.assertEqual(after.result(0), 'C')
+        self.assertEqual(self.unmatched, [])
+
+    def test_cancelled_request_takes_its_event(self):
+        cancelled = self.expect([CONFIRM])
+        following = self.expect([CONFIRM])
+        self.assertTrue(cancelled.cancel())
+        self.framer.receive((0x46, 0x80), 'A')
+        self.assertFalse(following.done())
+        self.framer.receive((0x46, 0x80), 'B')
+        self.assertEqual(following.result(0), 'B')
+
+    def test_first_of_several_kinds(self):
+        first = self.expect([CONFIRM, INDICATION])
+        second = self.expect([INDICATION])
+        self.framer.receive((0x46, 0x80), 'status')
+        self.framer.receive((0x46, 0x8F), 'handles')
+        self.assertEqual(first.result(0), 'status')
+        self.assertEqual(second.result(0), 'handles')
+
+    def test_unmatched_event(self):
+        self.expect([CONFIRM])
+        self.framer.receive((0x46, 0x80), 'A')
+        self.framer.receive((0x46, 0x80), 'B')
+        self.assertEqual(self.unmatched, ['B'])
+
+    def test_lost_event_after_grace_period(self):
+        self.pending.grace = 0.05
+        lost = self.expect([CONFIRM], timeout=0.05)
+        self.assertRaises(FsciTimeout, lost.result, 1)
+        time.sleep(0.1)
+
+        # the response of the timed out request never arrives
+        following = self.expect([CONFIRM])
+        self.framer.receive((0x46, 0x80), 'B')
+        self.assertEqual(following.result(0), 'B')
+
+    def test_cancelled_request_after_grace_period(self):
+        self.pending.grace = 0.05
+        cancelled = self.expect([CONFIRM])
+        following = self.expect([CONFIRM])
+        self.assertTrue(cancelled.cancel())
+        time.sleep(0.1)
+        self.framer.receive((0x46, 0x80), 'B')
+        self.assertEqual(following.result(0), 'B')
+
+    def test_answered_request_is_not_expired(self):
+        future = self.expect([CONFIRM], timeout=0.05)
+        self.framer.receive((0x46, 0x80), 'A')
+        time.sleep(0.1)
+        self.assertEqual(future.result(0), 'A')
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,182 @@
+/*
+ * \file DecodeTrace.c
+ * Source file that prints a binary trace written by the hsdk libraries built with TRACE=yes.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hsdkTrace.h"
+
+static const char *prios[] = { "", "HSDK_ERROR", "HSDK_WARNING", "HSDK_INFO" };
+
+static char **strings = NULL;
+static uint32_t stringsSize = 0;
+
+static const char *StringById(uint32_t id)
+{
+    if (id == 0 || id > stringsSize || strings[id - 1] == NULL) {
+        return "?";
+    }
+
+    return strings[id - 1];
+}
+
+static int AddString(uint32_t id, const char *text, uint32_t length)
+{
+    if (id == 0) {
+        return 0;
+    }
+
+    if (id > stringsSize) {
+        char **grown = (char **)realloc(strings, id * sizeof(char *));
+
+        if (grown == NULL) {
+            return -1;
+        }
+
+        memset(grown + stringsSize, 0, (id - stringsSize) * sizeof(char *));
+        strings = grown;
+        stringsSize = id;
+    }
+
+    free(strings[id - 1]);
+    strings[id - 1] = (char *)calloc(length + 1, 1);
+
+    if (strings[id - 1] == NULL) {
+        return -1;
+    }
+
+    memcpy(strings[id - 1], text, length);
+
+    return 0;
+}
+
+static int CompareTime(const void *a, const void *b)
+{
+    const TraceRecord *ra = (const TraceRecord *)a;
+    const TraceRecord *rb = (const TraceRecord *)b;
+
+    return ra->timeNs < rb->timeNs ? -1 : ra->timeNs > rb->timeNs;
+}
+
+static void PrintRecord(const TraceRecord *record, uint64_t origin)
+{
+    uint32_t i;
+
+    printf("%14.3f [%u] ", (record->timeNs - origin) / 1000.0, record->threadId);
+
+    switch (record->eventId) {
+        case TRACE_EVT_LOG:
+            printf("%s - %s:%s\n", record->args[0] < 4 ? prios[record->args[0]] : "?",
+                   StringById(record->args[1]), StringById(record->args[2]));
+            break;
+
+        case TRACE_EVT_BYTES:
+            printf("%s: (%u bytes) ", StringById(record->args[0]), record->args[1]);
+
+            for (i = 0; i < record->args[1] && i < 8; i++) {
+                printf("%02X ", (record->args[2 + i / 4] >> (8 * (i % 4))) & 0xFF);
+            }
+
+            printf("%s\n", record->args[1] > 8 ? "..." : "");
+            break;
+
+        case TRACE_EVT_DROPPED:
+            printf("%u records dropped\n", record->args[0]);
+            break;
+
+        default:
+            printf("event 0x%04X: %08X %08X %08X %08X\n", record->eventId,
+                   record->args[0], record->args[1], record->args[2], record->args[3]);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    char magic[8];
+    uint32_t header[2];
+    uint8_t *data;
+    TraceRecord *records;
+    long size, offset;
+    uint32_t count = 0, i;
+    FILE *f;
+
+    if (argc < 2) {
+        printf("Usage: # %s <trace file>\n", argv[0]);
+        return 1;
+    }
+
+    f = fopen(argv[1], "rb");
+
+    if (f == NULL) {
+        printf("Cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    if (fread(magic, 1, sizeof(magic), f) != sizeof(magic) || memcmp(magic, TRACE_FILE_MAGIC, sizeof(magic)) ||
+            fread(header, sizeof(header), 1, f) != 1 ||
+            header[0] != TRACE_FILE_VERSION || header[1] != sizeof(TraceRecord)) {
+        printf("%s is not a version %d trace file\n", argv[1], TRACE_FILE_VERSION);
+        fclose(f);
+        return 1;
+    }
+
+    fseek(f, 0, SEEK_END);
+    size = ftell(f) - (long)(sizeof(magic) + sizeof(header));
+    fseek(f, (long)(sizeof(magic) + sizeof(header)), SEEK_SET);
+
+    data = (uint8_t *)malloc(size > 0 ? size : 1);
+    records = (TraceRecord *)malloc(size > 0 ? size : 1);
+
+    if (data == NULL || records == NULL || fread(data, 1, size, f) != (size_t)size) {
+        printf("Cannot read %s\n", argv[1]);
+        fclose(f);
+        return 1;
+    }
+
+    fclose(f);
+
+    /* First pass: the strings, which may be defined after the records using them. */
+    for (offset = 0; offset + (long)sizeof(TraceRecord) <= size; offset += sizeof(TraceRecord)) {
+        TraceRecord record;
+
+        memcpy(&record, data + offset, sizeof(record));
+
+        if (record.eventId == TRACE_EVT_STRING) {
+            uint32_t length = record.args[1];
+
+            if (offset + (long)sizeof(TraceRecord) + (long)length > size) {
+                break;
+            }
+
+            AddString(record.args[0], (const char *)data + offset + sizeof(TraceRecord), length);
+            offset += (length + sizeof(TraceRecord) - 1) / sizeof(TraceRecord) * sizeof(TraceRecord);
+        } else {
+            records[count++] = record;
+        }
+    }
+
+    /* The threads are drained one after the other, restore the global order. */
+    qsort(records, count, sizeof(TraceRecord), CompareTime);
+
+    for (i = 0; i < count; i++) {
+        PrintRecord(&records[i], records[0].timeNs);
+    }
+
+    for (i = 0; i < stringsSize; i++) {
+        free(strings[i]);
+    }
+
+    free(strings);
+    free(records);
+    free(data);
+
+    return 0;
+}
@@ -0,0 +1,550 @@
+/*
+ * \file FsciBench.c
+ * Source file that measures the throughput and the latency of the whole FSCI receive
+ * and transmit path, against a fake firmware answering on the other end of a pty.
+ *
+ * The host side is the one of an application: PhysicalDevice, Framer and FSCIFramer
+ * from the hsdk libraries, the hsdk-c bindings to serialize the commands and to
+ * decode the events. The fake firmware is a thread of the benchmark, which confirms
+ * every GATTDBWriteAttributeRequest with a GATTDBConfirm followed by a number of
+ * GATTClientNotificationIndication, and allocates nothing so that the allocations
+ * counted are those of the host stack only.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define _GNU_SOURCE
+
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <pty.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "FSCIFrame.h"
+#include "Framer.h"
+#include "PhysicalDevice.h"
+#include "UARTConfiguration.h"
+#include "utils.h"
+
+#include "cmd_ble.h"
+
+#define FSCI_BLE_IF             0
+#define FSCI_SYNC               0x02
+#define FSCI_HEADER_SIZE        5       /* sync, opGroup, opCode, 2 bytes of length */
+
+#define BENCH_HANDLE            0x002A
+#define BENCH_MAX_MIX           16
+#define BENCH_MAX_VALUE         2048
+#define BENCH_DRAIN_TIMEOUT_MS  10000
+
+#define DEFAULT_COMMANDS        10000
+#define DEFAULT_WINDOW          1
+#define DEFAULT_NOTIFICATIONS   4
+#define DEFAULT_MIX             "20:60,100:30,244:10"
+
+/* One size of the value of the commands and notifications, drawn with the given weight. */
+typedef struct {
+    uint32_t size;
+    uint32_t weight;
+} MixEntry;
+
+typedef struct {
+    MixEntry entries[BENCH_MAX_MIX];
+    uint32_t count;
+    uint32_t totalWeight;
+    uint32_t maxSize;
+} SizeMix;
+
+/* The state of the fake firmware, only touched by its thread once started. */
+typedef struct {
+    int fd;
+    uint32_t notifications;
+    const SizeMix *mix;
+    uint32_t seed;
+    uint8_t *rx;
+    uint32_t rxLength;
+    uint32_t rxSize;
+    uint8_t *tx;
+    uint32_t txHead;
+    uint32_t txTail;
+    uint32_t txSize;
+    volatile int stop;
+} FakeFirmware;
+
+static SizeMix mix;
+static uint64_t *sentNs = NULL;
+static uint64_t *latencyNs = NULL;
+static volatile uint32_t confirmed = 0;
+static volatile uint32_t notified = 0;
+static volatile uint32_t decodeErrors = 0;
+static volatile uint64_t rxBytes = 0;
+static uint32_t inFlight = 0;
+static pthread_mutex_t windowLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t windowCond = PTHREAD_COND_INITIALIZER;
+
+/*
+ * Allocations made by any thread of the process. The hsdk libraries and the hsdk-c
+ * bindings are resolved against the malloc of the executable, so defining it here
+ * counts theirs as well.
+ */
+#ifdef __GLIBC__
+static volatile uint64_t allocations = 0;
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+
+void *malloc(size_t size)
+{
+    __atomic_fetch_add(&allocations, 1, __ATOMIC_RELAXED);
+    return __libc_malloc(size);
+}
+
+void *calloc(size_t count, size_t size)
+{
+    __atomic_fetch_add(&allocations, 1, __ATOMIC_RELAXED);
+    return __libc_calloc(count, size);
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    __atomic_fetch_add(&allocations, 1, __ATOMIC_RELAXED);
+    return __libc_realloc(ptr, size);
+}
+
+#define ALLOCATIONS() __atomic_load_n(&allocations, __ATOMIC_RELAXED)
+#define COUNTS_ALLOCATIONS 1
+#else
+#define ALLOCATIONS() 0
+#define COUNTS_ALLOCATIONS 0
+#endif
+
+static uint32_t NextRandom(uint32_t *seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return *seed >> 8;
+}
+
+static uint32_t DrawSize(const SizeMix *m, uint32_t *seed)
+{
+    uint32_t pick = NextRandom(seed) % m->totalWeight;
+    uint32_t i;
+
+    for (i = 0; i < m->count - 1; i++) {
+        if (pick < m->entries[i].weight) {
+            break;
+        }
+
+        pick -= m->entries[i].weight;
+    }
+
+    return m->entries[i].size;
+}
+
+/*
+ * Parses "size:weight,size:weight,...", a missing weight counts as 1.
+ */
+static int ParseMix(const char *text, SizeMix *m)
+{
+    const char *p = text;
+
+    memset(m, 0, sizeof(SizeMix));
+
+    while (*p) {
+        char *end;
+        unsigned long size, weight = 1;
+
+        if (m->count == BENCH_MAX_MIX) {
+            return -1;
+        }
+
+        size = strtoul(p, &end, 10);
+
+        if (end == p || size > BENCH_MAX_VALUE) {
+            return -1;
+        }
+
+        p = end;
+
+        if (*p == ':') {
+            weight = strtoul(p + 1, &end, 10);
+
+            if (end == p + 1 || weight == 0 || weight > 1000000) {
+                return -1;
+            }
+
+            p = end;
+        }
+
+        if (*p == ',') {
+            p++;
+        } else if (*p) {
+            return -1;
+        }
+
+        m->entries[m->count].size = (uint32_t)size;
+        m->entries[m->count].weight = (uint32_t)weight;
+        m->totalWeight += (uint32_t)weight;
+        m->maxSize = size > m->maxSize ? (uint32_t)size : m->maxSize;
+        m->count++;
+    }
+
+    return m->count ? 0 : -1;
+}
+
+/*
+ * Appends a frame to the TX buffer of the fake firmware. The buffer is sized at start
+ * for the largest burst the host can cause, so it never overflows.
+ */
+static void FirmwareQueue(FakeFirmware *fw, uint8_t og, uint8_t oc, const uint8_t *payload, uint16_t length)
+{
+    uint8_t *out;
+    uint8_t crc;
+    uint32_t i;
+
+    if (fw->txHead == fw->txTail) {
+        fw->txHead = fw->txTail = 0;
+    } else if (fw->txTail + FSCI_HEADER_SIZE + length + 1 > fw->txSize) {
+        memmove(fw->tx, fw->tx + fw->txHead, fw->txTail - fw->txHead);
+        fw->txTail -= fw->txHead;
+        fw->txHead = 0;
+    }
+
+    out = fw->tx + fw->txTail;
+    out[0] = FSCI_SYNC;
+    out[1] = og;
+    out[2] = oc;
+    out[3] = length & 0xFF;
+    out[4] = length >> 8;
+    memcpy(out + FSCI_HEADER_SIZE, payload, length);
+
+    crc = 0;
+
+    for (i = 1; i < FSCI_HEADER_SIZE + (uint32_t)length; i++) {
+        crc ^= out[i];
+    }
+
+    out[FSCI_HEADER_SIZE + length] = crc;
+    fw->txTail += FSCI_HEADER_SIZE + length + 1;
+}
+
+static void FirmwareAnswer(FakeFirmware *fw, uint8_t og, uint8_t oc)
+{
+    static uint8_t notification[FSCI_HEADER_SIZE + BENCH_MAX_VALUE];
+    uint8_t status[2] = { 0, 0 };
+    uint32_t i;
+
+    if (og != (GATTDBWriteAttributeRequest_FSCI_ID >> 8) || oc != (GATTDBWriteAttributeRequest_FSCI_ID & 0xFF)) {
+        return;
+    }
+
+    FirmwareQueue(fw, GATTDBConfirm_FSCI_ID >> 8, GATTDBConfirm_FSCI_ID & 0xFF, status, sizeof(status));
+
+    for (i = 0; i < fw->notifications; i++) {
+        uint16_t size = (uint16_t)DrawSize(fw->mix, &fw->seed);
+
+        notification[0] = 0;                    /* DeviceId */
+        notification[1] = BENCH_HANDLE & 0xFF;  /* CharacteristicValueHandle */
+        notification[2] = BENCH_HANDLE >> 8;
+        notification[3] = size & 0xFF;          /* ValueLength */
+        notification[4] = size >> 8;
+        memset(notification + 5, (uint8_t)i, size);
+
+        FirmwareQueue(fw, GATTClientNotificationIndication_FSCI_ID >> 8, GATTClientNotificationIndication_FSCI_ID & 0xFF,
+                      notification, 5 + size);
+    }
+}
+
+/*
+ * Answers the complete commands at the start of the RX buffer and keeps what is left.
+ * Bytes that cannot start a frame are skipped, the checksum is not verified.
+ */
+static void FirmwareParse(FakeFirmware *fw)
+{
+    uint32_t offset = 0;
+
+    while (offset < fw->rxLength) {
+        uint8_t *frame = fw->rx + offset;
+        uint32_t length;
+
+        if (frame[0] != FSCI_SYNC) {
+            offset++;
+            continue;
+        }
+
+        if (fw->rxLength - offset < FSCI_HEADER_SIZE) {
+            break;
+        }
+
+        length = frame[3] | (frame[4] << 8);
+
+        if (fw->rxLength - offset < FSCI_HEADER_SIZE + length + 1) {
+            break;
+        }
+
+        FirmwareAnswer(fw, frame[1], frame[2]);
+        offset += FSCI_HEADER_SIZE + length + 1;
+    }
+
+    memmove(fw->rx, fw->rx + offset, fw->rxLength - offset);
+    fw->rxLength -= offset;
+}
+
+static void *FirmwareThreadRoutine(void *lpParam)
+{
+    FakeFirmware *fw = (FakeFirmware *)lpParam;
+
+    while (!fw->stop) {
+        struct pollfd pfd;
+        ssize_t n;
+
+        pfd.fd = fw->fd;
+        pfd.events = POLLIN | (fw->txHead != fw->txTail ? POLLOUT : 0);
+        pfd.revents = 0;
+
+        if (poll(&pfd, 1, 100) <= 0) {
+            continue;
+        }
+
+        if (pfd.revents & POLLOUT) {
+            n = write(fw->fd, fw->tx + fw->txHead, fw->txTail - fw->txHead);
+
+            if (n > 0) {
+                fw->txHead += (uint32_t)n;
+            }
+        }
+
+        if (pfd.revents & POLLIN) {
+            n = read(fw->fd, fw->rx + fw->rxLength, fw->rxSize - fw->rxLength);
+
+            if (n > 0) {
+                fw->rxLength += (uint32_t)n;
+                FirmwareParse(fw);
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Decodes every frame as the applications do, the confirm of the oldest command
+ * ends its latency and frees a place in the window.
+ */
+static void BenchCallback(void *callee, void *response)
+{
+    static bleEvtContainer_t container;
+    FSCIFrame *frame = (FSCIFrame *)response;
+    uint64_t now = MonotonicTimeNs();
+
+    rxBytes += FSCI_HEADER_SIZE + frame->length + 1;
+    KHC_BLE_RX_MsgHandler(response, &container, FSCI_BLE_IF);
+    DestroyFSCIFrame(frame);
+
+    if (container.id == GATTDBConfirm_FSCI_ID) {
+        latencyNs[confirmed] = now - sentNs[confirmed];
+        confirmed++;
+
+        pthread_mutex_lock(&windowLock);
+        inFlight--;
+        pthread_cond_signal(&windowCond);
+        pthread_mutex_unlock(&windowLock);
+    } else if (container.id == GATTClientNotificationIndication_FSCI_ID &&
+               container.Data.GATTClientNotificationIndication.CharacteristicValueHandle == BENCH_HANDLE) {
+        notified++;
+    } else {
+        decodeErrors++;
+    }
+
+    container.id = 0;
+}
+
+static int CompareLatency(const void *a, const void *b)
+{
+    uint64_t la = *(const uint64_t *)a;
+    uint64_t lb = *(const uint64_t *)b;
+
+    return la < lb ? -1 : la > lb;
+}
+
+static double Percentile(const uint64_t *sorted, uint32_t count, double p)
+{
+    uint32_t rank = (uint32_t)(p * count + 0.999999);
+
+    return sorted[rank ? rank - 1 : 0] / 1000.0;
+}
+
+static void Usage(const char *name)
+{
+    printf("Usage: # %s [-c commands] [-w window] [-n notifications] [-m size:weight,...]\n", name);
+    printf("    -c  number of GATTDBWriteAttributeRequest sent, default %d\n", DEFAULT_COMMANDS);
+    printf("    -w  commands sent before waiting for a confirm, default %d\n", DEFAULT_WINDOW);
+    printf("    -n  notifications sent by the firmware after each confirm, default %d\n", DEFAULT_NOTIFICATIONS);
+    printf("    -m  sizes of the values of the commands and notifications, default %s\n", DEFAULT_MIX);
+}
+
+int main(int argc, char **argv)
+{
+    static uint8_t value[BENCH_MAX_VALUE];
+    uint32_t commands = DEFAULT_COMMANDS, window = DEFAULT_WINDOW, notifications = DEFAULT_NOTIFICATIONS;
+    uint32_t seed = 1, i, frames;
+    uint64_t txBytes = 0, allocs, start, elapsed;
+    FakeFirmware fw;
+    UARTConfigurationData *config;
+    PhysicalDevice *device;
+    Framer *framer;
+    pthread_t firmwareThread;
+    char name[128];
+    int master, slave, opt, rc = 0;
+
+    if (ParseMix(DEFAULT_MIX, &mix)) {
+        return 1;
+    }
+
+    while ((opt = getopt(argc, argv, "c:w:n:m:h")) != -1) {
+        switch (opt) {
+            case 'c':
+                commands = (uint32_t)strtoul(optarg, NULL, 10);
+                break;
+            case 'w':
+                window = (uint32_t)strtoul(optarg, NULL, 10);
+                break;
+            case 'n':
+                notifications = (uint32_t)strtoul(optarg, NULL, 10);
+                break;
+            case 'm':
+                if (ParseMix(optarg, &mix)) {
+                    printf("Invalid size mix %s, sizes are at most %d bytes\n", optarg, BENCH_MAX_VALUE);
+                    return 1;
+                }
+                break;
+            default:
+                Usage(argv[0]);
+                return 1;
+        }
+    }
+
+    if (commands == 0 || window == 0 || notifications > 1000) {
+        Usage(argv[0]);
+        return 1;
+    }
+
+    if (openpty(&master, &slave, name, NULL, NULL) == -1) {
+        perror("openpty");
+        return 1;
+    }
+
+    memset(&fw, 0, sizeof(fw));
+    fw.fd = master;
+    fw.notifications = notifications;
+    fw.mix = &mix;
+    fw.seed = 2;
+    fw.rxSize = 2 * (FSCI_HEADER_SIZE + 4 + BENCH_MAX_VALUE + 1);
+    fw.txSize = (window + 1) * (notifications + 1) * (FSCI_HEADER_SIZE + 5 + mix.maxSize + 1);
+    fw.rx = (uint8_t *)malloc(fw.rxSize);
+    fw.tx = (uint8_t *)malloc(fw.txSize);
+    sentNs = (uint64_t *)calloc(commands, sizeof(uint64_t));
+    latencyNs = (uint64_t *)calloc(commands, sizeof(uint64_t));
+
+    if (fw.rx == NULL || fw.tx == NULL || sentNs == NULL || latencyNs == NULL) {
+        printf("Out of memory\n");
+        return 1;
+    }
+
+    fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+
+    config = defaultConfigurationData();
+    device = InitPhysicalDevice(UART, config, name, GLOBAL);
+
+    if (device == NULL || OpenPhysicalDevice(device)) {
+        printf("Cannot open %s\n", name);
+        return 1;
+    }
+
+    framer = InitializeFramer(device, FSCI, 2, 1, _LITTLE_ENDIAN);
+    AttachToFramer(framer, NULL, BenchCallback);
+    pthread_create(&firmwareThread, NULL, FirmwareThreadRoutine, &fw);
+
+    printf("%u commands, window %u, %u notifications per command, sizes", commands, window, notifications);
+
+    for (i = 0; i < mix.count; i++) {
+        printf(" %u:%u", mix.entries[i].size, mix.entries[i].weight);
+    }
+
+    printf(", %s\n", COUNTS_ALLOCATIONS ? "counting allocations" : "allocations not counted");
+
+    allocs = ALLOCATIONS();
+    start = MonotonicTimeNs();
+
+    for (i = 0; i < commands; i++) {
+        GATTDBWriteAttributeRequest_t req;
+
+        pthread_mutex_lock(&windowLock);
+
+        while (inFlight == window) {
+            pthread_cond_wait(&windowCond, &windowLock);
+        }
+
+        inFlight++;
+        pthread_mutex_unlock(&windowLock);
+
+        req.Handle = BENCH_HANDLE;
+        req.ValueLength = (uint16_t)DrawSize(&mix, &seed);
+        req.Value = value;
+        txBytes += FSCI_HEADER_SIZE + 4 + req.ValueLength + 1;
+
+        sentNs[i] = MonotonicTimeNs();
+        GATTDBWriteAttributeRequest(&req, framer, FSCI_BLE_IF);
+    }
+
+    for (i = 0; i < BENCH_DRAIN_TIMEOUT_MS && (confirmed < commands || notified < commands * notifications); i++) {
+        usleep(1000);
+    }
+
+    elapsed = MonotonicTimeNs() - start;
+    allocs = ALLOCATIONS() - allocs;
+
+    fw.stop = 1;
+    pthread_join(firmwareThread, NULL);
+
+    frames = commands + confirmed + notified;
+
+    if (confirmed < commands || notified < commands * notifications || decodeErrors) {
+        printf("Incomplete: %u/%u confirms, %u/%u notifications, %u unexpected frames\n",
+               confirmed, commands, notified, commands * notifications, decodeErrors);
+        rc = 1;
+    }
+
+    printf("frames      %u sent, %u received, %.0f frames/s\n", commands, confirmed + notified, frames * 1e9 / elapsed);
+    printf("bytes       %llu sent, %llu received, %.3f MB/s\n", (unsigned long long)txBytes, (unsigned long long)rxBytes,
+           (txBytes + rxBytes) * 1e3 / elapsed);
+
+    if (confirmed) {
+        qsort(latencyNs, confirmed, sizeof(uint64_t), CompareLatency);
+        printf("latency us  p50 %.1f, p99 %.1f, p999 %.1f, max %.1f\n", Percentile(latencyNs, confirmed, 0.5),
+               Percentile(latencyNs, confirmed, 0.99), Percentile(latencyNs, confirmed, 0.999),
+               latencyNs[confirmed - 1] / 1000.0);
+    }
+
+    if (COUNTS_ALLOCATIONS) {
+        printf("allocations %llu, %.2f per frame\n", (unsigned long long)allocs, (double)allocs / frames);
+    }
+
+    DestroyFramer(framer);
+    DestroyPhysicalDevice(device);
+    freeConfigurationData(config);
+    close(master);
+    free(fw.rx);
+    free(fw.tx);
+    free(sentNs);
+    free(latencyNs);
+
+    return rc;
+}
@@ -0,0 +1,79 @@
+/*
+ * \file VirtualBoard.c
+ * Source file that serves a virtual board on a pseudo-terminal, for the applications
+ * opening a serial port: the UART device of hsdk, hsdk-c or the Python bindings.
+ *
+ * The board answers from the script given as argument, see doc/Serial.md, and runs
+ * until SIGINT or SIGTERM.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define _GNU_SOURCE
+
+#include <pty.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "VirtualBoard.h"
+
+int main(int argc, char **argv)
+{
+    VirtualBoard *board;
+    struct termios tty;
+    sigset_t signals;
+    char name[256];
+    int master, slave, signal;
+
+    if (argc > 2) {
+        printf("Usage: %s [script]\n", argv[0]);
+        return 1;
+    }
+
+    board = CreateVirtualBoard(argc == 2 ? argv[1] : NULL);
+
+    if (board == NULL) {
+        printf("Cannot create the board, see the log for the script errors\n");
+        return 1;
+    }
+
+    /* Raw until the host configures the port, the line discipline would echo the frames back. */
+    cfmakeraw(&tty);
+
+    if (openpty(&master, &slave, name, &tty, NULL) == -1) {
+        perror("openpty");
+        DestroyVirtualBoard(board);
+        return 1;
+    }
+
+    /* SIGINT and SIGTERM are waited for below instead of killing the process. */
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+    if (VirtualBoardStart(board, master) != 0) {
+        printf("Cannot start the board\n");
+        DestroyVirtualBoard(board);
+        return 1;
+    }
+
+    /* The slave stays open here, else the master reports a hang up between two hosts. */
+    printf("%s\n", name);
+    fflush(stdout);
+
+    sigwait(&signals, &signal);
+
+    VirtualBoardStop(board);
+    DestroyVirtualBoard(board);
+    close(slave);
+    close(master);
+
+    return 0;
+}
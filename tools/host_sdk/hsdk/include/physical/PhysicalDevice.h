@@ -21,7 +21,9 @@
 
 #include "EventManager.h"
 #include "hsdkOSCommon.h"
+#include "hsdkReactor.h"
 #include "MessageQueue.h"
+#include "RawFrame.h"
 #include "utils.h"
 
 #ifdef _WINDLL
@@ -48,7 +50,8 @@ typedef enum {
     USB,
     PCAP,
     SPI,
-    BT
+    BT,
+    VIRTUAL     /**< An emulated board, see VirtualDevice.h. */
 } DeviceType;
 
 /**
@@ -71,6 +74,29 @@ typedef enum {
     GLOBAL
 } FsciAckPolicy;
 
+/**
+ * @brief A frame sent with FSCI TX ACK enabled and not acknowledged yet.
+ */
+typedef struct {
+    void *frame;            /**< The RawFrame, kept for retransmission. */
+    uint64_t deadlineMs;    /**< Monotonic time, in milliseconds, at which the frame is sent again. */
+    uint8_t retriesLeft;    /**< Retransmissions left before the frame is dropped. */
+} TxAckSlot;
+
+/**
+ * @brief Frames in flight when more than one unacknowledged frame is allowed.
+ * @details FSCI ACKs carry no sequence number, so each ACK retires the oldest slot.
+ */
+typedef struct {
+    TxAckSlot *slots;       /**< The outstanding frames, oldest first. */
+    uint32_t size;          /**< The maximum number of outstanding frames. */
+    uint32_t count;         /**< The number of outstanding frames. */
+    uint8_t stalled;        /**< Set while the device thread waits for a free slot. */
+    uint32_t acksReceived;  /**< ACKs announced by the framer and not processed yet, counted as events collapse on Windows. */
+    Lock lock;              /**< Guards the window and serializes the writes to the device. */
+    Event sSlotFree;        /**< Signaled when a slot frees up while the device thread is stalled. */
+} TxAckWindow;
+
 /**
  * @brief Generic structure for interfacing with the lower level hardware.
  */
@@ -81,6 +107,7 @@ typedef struct {
     ConfigParams *configParams; /**< Pointer to the configuration parameters. */
     MessageQueue *inMessages;   /**< An inbox message queue for the device from which to send to the hardware. */
     EventManager *evtManager;   /**< Subscription based event handler to notify all registered components of an event. */
+    EventManager *txEvtManager; /**< Notifies the registered components of each frame written to the hardware. */
     void *deviceHandle;         /**< A generic handle for the device to send and receive data. */
     Thread eventThread;         /**< The thread to wait for events from the device. */
     Event startThread;          /**< An event used to synchronize the main thread and the eventThread. */
@@ -90,6 +117,7 @@ typedef struct {
     int(*close) (void *);                       /**< Function pointer for the device specific close function. */
     int(*write) (void *, uint8_t *, uint32_t);  /**< Function pointer to the device specific function to write data into it. */
     int(*read) (void *, uint8_t *, uint32_t *); /**< Function pointer to the device specific function for reading data from it. */
+    int(*writeVector) (void *, uint8_t **, uint32_t *, uint32_t);  /**< Optional, writes several buffers at once. Used by TxCoalesceBytes. */
     int(*initialize) (void *, uint8_t);         /**< SPI specific: read data available on the bus at thread start. */
     int(*configure) (void *, void *);           /**< Configuration function. */
 
@@ -98,6 +126,13 @@ typedef struct {
     Event sAnnounceTXACK;           /**< A semaphore to indicate TX ACK has been received */
     Event     startTXACKTimeoutThread;  /**< An event used to synchronize the ACK timeout thread and the startTXACKTimeoutThread. */
     Event     stopTXACKTimeoutThread;   /**< An event used to synchronize the ACK timeout thread and the stopTXACKTimeoutThread. */
+    TxAckWindow *txAckWindow;   /**< The retransmit queue when TxAckWindow is above 1, NULL for stop-and-wait. */
+
+    Reactor *reactor;           /**< The shared event loop serving the device instead of eventThread, NULL if it has its own thread. */
+    ReactorSource *rxSource;    /**< The device data, watched by reactor while opened. */
+    ReactorSource *txSource;    /**< inMessages->sAnnounceData, watched by reactor while opened. */
+    void *rxAsyncMask;          /**< The context of the waitable event behind rxSource. */
+    uint8_t *rxBuffer;          /**< Receives the device data when served by reactor. */
 } PhysicalDevice;
 
 
@@ -112,6 +147,8 @@ typedef struct {
 * Public macros
 *************************************************************************************
 ********************************************************************************** */
+/* Most bytes handed to the observers by one read of the device. */
+#define DEVICE_RX_SIZE  0x8FF
 
 /*! *********************************************************************************
 *************************************************************************************
@@ -124,8 +161,11 @@ DLLEXPORT int OpenPhysicalDevice(PhysicalDevice *);
 DLLEXPORT int ClosePhysicalDevice(PhysicalDevice *);
 DLLEXPORT int ConfigurePhysicalDevice(PhysicalDevice *, void *);
 DLLEXPORT int WritePhysicalDevice(void *, uint8_t *, uint32_t);
+DLLEXPORT int WriteRawFramePhysicalDevice(void *, RawFrame *);
 DLLEXPORT void AttachToPhysicalDevice(void *, void *, void(*Callback)(void *, void *));
 DLLEXPORT void DetachFromPhysicalDevice(void *, void *);
+DLLEXPORT void AttachTxToPhysicalDevice(void *, void *, void(*Callback)(void *, void *));
+DLLEXPORT void DetachTxFromPhysicalDevice(void *, void *);
 
 #ifdef __cplusplus
 } /* extern "C" */
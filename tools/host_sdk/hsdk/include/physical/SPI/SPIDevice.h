@@ -46,6 +46,8 @@ typedef struct {
     File uioPortHandle;
     /* Used to read packets in two chunks: header + payload and CRC. */
     uint8_t lengthFieldSize;
+    /* When not 0, the number of bytes clocked in per transfer by the bulk reads. */
+    uint32_t bulkReadBytes;
 } SPIHandle;
 
 /*! *********************************************************************************
@@ -59,6 +61,9 @@ typedef struct {
 * Public macros
 *************************************************************************************
 ********************************************************************************** */
+/* Largest transfer accepted by spidev with its default bufsiz. */
+#define SPI_BULK_READ_MAX   4096
+
 #define DK07_HOST       (1)
 #define IMX6ULEVK_HOST  (0)
 
@@ -0,0 +1,145 @@
+/*
+ * \file VirtualBoard.h
+ * This is the header file for the VirtualBoard module.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __VIRTUAL_BOARD__
+#define __VIRTUAL_BOARD__
+
+/************************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+************************************************************************************/
+#include <stdint.h>
+
+#include "hsdkOSCommon.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public macros
+*************************************************************************************
+********************************************************************************** */
+/* Largest FSCI payload received or sent by the board, the length field has 2 bytes. */
+#define VIRTUAL_MAX_PAYLOAD         0xFFFF
+
+/* Output waiting for the host above which stream frames are dropped instead of queued. */
+#define VIRTUAL_MAX_BACKLOG         (256 * 1024)
+
+/* Longest sleep of the board thread when no stream is due. */
+#define VIRTUAL_IDLE_MS             100
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public type definitions
+*************************************************************************************
+********************************************************************************** */
+struct VirtualBoard;
+
+/**
+ * @brief Called by the board thread for every FSCI command, before the reply table.
+ * @details It may answer with VirtualBoardSend. Returns 1 if the command was handled,
+ * 0 to let the reply table answer it.
+ */
+typedef int (*VirtualCommandHandler)(void *context, struct VirtualBoard *board, uint8_t opGroup, uint8_t opCode,
+                                     uint8_t *payload, uint16_t length);
+
+/**
+ * @brief A frame sent when a command is received.
+ */
+typedef struct {
+    uint8_t cmdOpGroup;     /**< The command answered. */
+    uint8_t cmdOpCode;
+    uint8_t opGroup;        /**< The frame sent back. */
+    uint8_t opCode;
+    uint16_t length;
+    uint8_t *payload;
+} VirtualReply;
+
+/**
+ * @brief A frame sent repeatedly at a given rate, e.g. notifications or scan reports.
+ */
+typedef struct {
+    uint32_t rate;          /**< Frames per second. */
+    uint8_t opGroup;
+    uint8_t opCode;
+    uint16_t length;
+    uint8_t *payload;
+    uint8_t running;        /**< 0 until started by a trigger. */
+    uint64_t nextNs;        /**< MonotonicTimeNs() at which the next frame is due. */
+    uint64_t sent;          /**< Frames queued for the host. */
+    uint64_t dropped;       /**< Frames skipped because the host did not keep up. */
+} VirtualStream;
+
+/**
+ * @brief Starts or stops a stream when a command is received.
+ */
+typedef struct {
+    uint8_t cmdOpGroup;
+    uint8_t cmdOpCode;
+    uint32_t stream;        /**< Index of the stream. */
+    uint8_t start;          /**< 1 to start the stream, 0 to stop it. */
+} VirtualTrigger;
+
+/**
+ * @brief An emulated board, answering FSCI commands on the board end of a link.
+ */
+typedef struct VirtualBoard {
+    File handle;                    /**< The board end of the link, not owned. */
+    Thread boardThread;             /**< Parses the commands and sends the replies and streams. */
+    Event stopThread;               /**< Signals boardThread to exit. */
+    Lock lock;                      /**< Guards the tables and the output. */
+
+    VirtualReply *replies;
+    uint32_t cReplies;
+    VirtualStream *streams;
+    uint32_t cStreams;
+    VirtualTrigger *triggers;
+    uint32_t cTriggers;
+    VirtualCommandHandler handler;  /**< Optional, tried before the replies. */
+    void *handlerContext;
+
+    uint8_t *rxBuffer;              /**< Bytes from the host not parsed yet. */
+    uint32_t rxLength;
+    uint8_t *txBuffer;              /**< Frames not written to the host yet. */
+    uint32_t txHead;
+    uint32_t txTail;
+    uint32_t txSize;
+    uint8_t hostClosed;             /**< Set when the host end is gone, the output is then dropped. */
+
+    uint64_t commands;              /**< Commands received. */
+    uint64_t unanswered;            /**< Commands with neither a handler nor a reply. */
+} VirtualBoard;
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public prototypes
+*************************************************************************************
+********************************************************************************** */
+DLLEXPORT VirtualBoard *CreateVirtualBoard(const char *scriptPath);
+DLLEXPORT int DestroyVirtualBoard(VirtualBoard *board);
+DLLEXPORT int VirtualBoardLoadScript(VirtualBoard *board, const char *scriptPath);
+DLLEXPORT int VirtualBoardAddReply(VirtualBoard *board, uint8_t cmdOpGroup, uint8_t cmdOpCode,
+                                   uint8_t opGroup, uint8_t opCode, const uint8_t *payload, uint16_t length);
+DLLEXPORT int VirtualBoardAddStream(VirtualBoard *board, uint32_t rate, uint8_t opGroup, uint8_t opCode,
+                                    const uint8_t *payload, uint16_t length, uint8_t running);
+DLLEXPORT int VirtualBoardAddTrigger(VirtualBoard *board, uint8_t cmdOpGroup, uint8_t cmdOpCode, uint32_t stream, uint8_t start);
+DLLEXPORT void VirtualBoardSetHandler(VirtualBoard *board, VirtualCommandHandler handler, void *context);
+DLLEXPORT int VirtualBoardSend(VirtualBoard *board, uint8_t opGroup, uint8_t opCode, const uint8_t *payload, uint16_t length);
+DLLEXPORT int VirtualBoardStart(VirtualBoard *board, File handle);
+DLLEXPORT int VirtualBoardStop(VirtualBoard *board);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
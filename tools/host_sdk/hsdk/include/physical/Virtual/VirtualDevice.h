@@ -0,0 +1,62 @@
+/*
+ * \file VirtualDevice.h
+ * This is the header file for the VirtualDevice module.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __VIRTUAL_DEV__
+#define __VIRTUAL_DEV__
+
+/************************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+************************************************************************************/
+#include "hsdkOSCommon.h"
+#include "PhysicalDevice.h"
+#include "VirtualBoard.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public macros
+*************************************************************************************
+********************************************************************************** */
+/* Optional prefix of the device names of VIRTUAL devices, followed by the script path. */
+#define VIRTUAL_DEVICE_PREFIX   "virtual:"
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public type definitions
+*************************************************************************************
+********************************************************************************** */
+/**
+ * @brief Structure to identify a virtual board, served over a socketpair.
+ */
+typedef struct {
+    VirtualBoard *board;    /**< Answers the commands written to portHandle. */
+    File portHandle;        /**< The host end of the socketpair. */
+    File boardHandle;       /**< The board end of the socketpair. */
+} VirtualHandle;
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public prototypes
+*************************************************************************************
+********************************************************************************** */
+int AttachToVirtualDevice(PhysicalDevice *pDevice, char *deviceName);
+int DetachFromVirtualDevice(PhysicalDevice *pDevice);
+DLLEXPORT VirtualBoard *VirtualDeviceBoard(PhysicalDevice *pDevice);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
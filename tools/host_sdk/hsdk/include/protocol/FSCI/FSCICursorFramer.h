@@ -0,0 +1,41 @@
+/*
+* \file FSCICursorFramer.h
+* This is the header file for the FSCICursorFramer module.
+*
+* Copyright 2026 NXP
+* All rights reserved.
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#ifndef __FSCI_CURSOR_FRAMER_H__
+#define __FSCI_CURSOR_FRAMER_H__
+
+/*! *********************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+********************************************************************************** */
+#include <stdint.h>
+
+#include "Framer.h"
+#include "FSCIFrame.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public prototypes
+*************************************************************************************
+********************************************************************************** */
+DLLEXPORT FrameStatus FSCIParseFrame(uint8_t *pData, uint32_t cbData, uint8_t lengthFieldSize, uint8_t crcFieldSize, endianness endian, FSCIFrame *frame, uint32_t *cbFrame);
+FrameStatus FSCICursorStateMachineDispatch(Framer *framer, void **currentFrame, uint32_t *dataSize);
+int FSCICursorQueueDataVerification(Framer *framer, uint32_t *dataSize);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
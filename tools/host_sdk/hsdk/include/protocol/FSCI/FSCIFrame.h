@@ -60,6 +60,11 @@ typedef struct {
     uint32_t index;             /**< The index in the global sequence of received packets of the packet containing the SYNC byte. */
     endianness endian;          /**< The endianness of the frame. */
     uint8_t virtualInterface;   /**< The virtual interface on which the FSCIFrame is going to operate. */
+    /*! MonotonicTimeNs when the read holding the SYNC byte completed, or when the
+     * frame started to be decoded if the framer uses the RX ring. 0 for TX frames.
+     */
+    uint64_t firstByteNs;
+    uint64_t completeNs;        /**< MonotonicTimeNs when the frame was recognized as complete, 0 for TX frames. */
 } FSCIFrame;
 
 /*! *********************************************************************************
@@ -57,6 +57,8 @@ typedef enum {
 * Public macros
 *************************************************************************************
 ********************************************************************************** */
+/* Received frames announcing a longer payload are treated as desynchronization. */
+#define FSCI_MTU        2048
 
 /*! *********************************************************************************
 *************************************************************************************
@@ -70,6 +72,9 @@ FrameStatus FSCIStateMachineDispatch(Framer *framer, void **currentFrame, uint32
 int FSCIQueueDataVerification(Framer *framer, uint32_t *dataSize);
 void FSCIFramerInitialization(Framer *framer);
 DLLEXPORT void FSCI_transmitPayload(Framer *framer, uint8_t OG, uint8_t OC, void *pMsg, uint16_t msgLen, uint32_t fsciInterface);
+DLLEXPORT void *FSCI_reservePayload(Framer *framer, uint16_t msgLen, uint32_t fsciInterface);
+DLLEXPORT void FSCI_transmitReserved(Framer *framer, uint8_t OG, uint8_t OC, void *pMsg, uint16_t msgLen, uint32_t fsciInterface);
+DLLEXPORT void FSCI_releaseReserved(Framer *framer, void *pMsg);
 
 #ifdef __cplusplus
 } /* extern "C" */
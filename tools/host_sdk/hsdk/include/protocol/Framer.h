@@ -21,6 +21,7 @@
 #include "hsdkOSCommon.h"
 #include "MessageQueue.h"
 #include "PhysicalDevice.h"
+#include "RingQueue.h"
 #include "utils.h"
 
 #ifdef _WINDLL
@@ -59,6 +60,17 @@ typedef struct {
     void *frame;        /**< Pointer to the actual frame object. */
 } FrameResponse;
 
+/**
+ * @brief The frames decoded during one wake up of the framer thread, handed to the
+ * observers attached with AttachBatchToFramer. The observers own the frames, while
+ * the structure itself is only valid for the duration of the callback.
+ */
+typedef struct {
+    uint32_t count;     /**< Number of frames in the batch. */
+    void **frames;      /**< The decoded frames, in reception order. */
+    uint32_t capacity;  /**< Allocated number of entries in frames. */
+} FramerBatch;
+
 /**
  * @brief The protocols supported by the library.
  */
@@ -75,6 +87,8 @@ typedef struct _Framer {
     /***********************************************************************
     Protocol related fields
     ************************************************************************/
+    /** The protocol the framer decodes. */
+    FramerProtocol protocol;
     /** The number of bytes the length field has in protocols. */
     uint8_t lengthFieldSize;
     /** The number of bytes the CRC field has in protocols. */
@@ -90,20 +104,40 @@ typedef struct _Framer {
     /** A pointer to the queue into which the device puts messages to be merged into
     protocol specific frames. */
     MessageQueue *queue;
+    /** Lock-free alternative to queue, used instead of it when RxRingSize is set in
+    hsdk.conf. Exactly one of queue and ring is not NULL. */
+    RingQueue *ring;
+    /** Scratch buffer used by FramerGetWindow() to linearize bytes that straddle two
+    received chunks or the end of the ring. Grown on demand, never shrunk. */
+    uint8_t *window;
+    /** The allocated size of window. */
+    uint32_t cbWindowSize;
     /** Pointer to the event manager. A outside module wanting to receive processed
     frames from this framer will subscribe with a callback to the EventManager. */
     EventManager *evtManager;
+    /** Event manager for observers receiving a FramerBatch per wake up instead of one
+    notification per frame. When it has observers, evtManager is not notified. */
+    EventManager *batchEvtManager;
+    /** Frames accumulated for the batch observers during the current wake up. */
+    FramerBatch batch;
 
     /***********************************************************************
      Fields related to framer inner workings: threads, events, state.
     ************************************************************************/
     /** The thread of the framer. */
     Thread framerThread;
+    /** Replaces framerThread when the device is served by an event loop. */
+    ReactorSource *reactorSource;
     /** Event to stop the thread on destruction. */
     Event stopThread;
     /** The current state the framer is in. It's a travesty to keep it an int but
     each specific implementation of a protocol state machine has a different enum. */
     int currentState;
+    /** The frame being built by the state machine, kept from one wake up to the next. */
+    void *currentFrame;
+    /** Keep decoding until the received data is exhausted on each wake up, instead
+    of decoding a single frame and signalling the thread again. */
+    uint8_t drainOnWakeup;
 
     /***********************************************************************
      Framer function pointers
@@ -144,8 +178,13 @@ DLLEXPORT Framer *InitializeFramer(void *connDev, FramerProtocol protocol, uint8
 DLLEXPORT int DestroyFramer(Framer *framer);
 DLLEXPORT int SendFrame(Framer *framer, void *frame);
 DLLEXPORT int SendBytes(Framer *framer, uint8_t *packet, uint32_t size);
+DLLEXPORT int SendRawFrame(Framer *framer, RawFrame *frame);
 DLLEXPORT void AttachToFramer(Framer *framer, void *observer, void(*Callback)(void *, void *));
 DLLEXPORT void DetachFromFramer(Framer *framer, void *observer);
+DLLEXPORT void AttachBatchToFramer(Framer *framer, void *observer, void(*Callback)(void *, void *));
+DLLEXPORT void DetachBatchFromFramer(Framer *framer, void *observer);
+DLLEXPORT void AttachTxToFramer(Framer *framer, void *observer, void(*Callback)(void *, void *));
+DLLEXPORT void DetachTxFromFramer(Framer *framer, void *observer);
 DLLEXPORT uint8_t *PackageFrame(Framer *framer, void *frame, uint32_t *size);
 DLLEXPORT void SetLengthFieldSize(Framer *framer, uint8_t lengthFieldSize);
 DLLEXPORT void SetCrcFieldSize(Framer *framer, uint8_t crcFieldSize);
@@ -156,6 +195,14 @@ uint8_t *ReadMultiByte(MessageQueue *queue, uint32_t cbDemanded);
 uint8_t *ReadDataUntilByte(MessageQueue *queue, uint16_t *cbSize, uint8_t startByte, uint8_t *found);
 uint8_t *PeekMultiByte(MessageQueue *queue, uint32_t cbDemanded);
 
+uint32_t FramerGetContentSize(Framer *framer);
+uint8_t FramerReadSingleByte(Framer *framer);
+uint8_t *FramerReadMultiByte(Framer *framer, uint32_t cbDemanded);
+uint8_t *FramerReadDataUntilByte(Framer *framer, uint16_t *cbSize, uint8_t startByte, uint8_t *found);
+uint8_t *FramerPeekMultiByte(Framer *framer, uint32_t cbDemanded);
+uint8_t *FramerGetWindow(Framer *framer, uint32_t cbDemanded, uint32_t *cbWindow);
+void FramerConsume(Framer *framer, uint32_t cbConsumed);
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
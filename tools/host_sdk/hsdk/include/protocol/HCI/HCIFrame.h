@@ -0,0 +1,110 @@
+/*
+ * \file HCIFrame.h
+ * This is the header file for the HCIFrame module.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __HCI_FRAME__
+#define __HCI_FRAME__
+
+/************************************************************************************
+ ************************************************************************************
+ * Include
+ ************************************************************************************
+ ***********************************************************************************/
+#include <stdint.h>
+#include <time.h>
+
+#include "Framer.h"
+#include "utils.h"
+
+#ifdef _WINDLL
+#define DLLEXPORT __declspec(dllexport)
+#else
+#define DLLEXPORT
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Public type definitions
+ ************************************************************************************
+ ********************************************************************************* */
+/**
+ * @brief The packet indicators of the HCI UART transport (H4).
+ */
+typedef enum {
+    HCI_COMMAND_PACKET = 0x01,
+    HCI_ACL_DATA_PACKET = 0x02,
+    HCI_SCO_DATA_PACKET = 0x03,
+    HCI_EVENT_PACKET = 0x04,
+    HCI_ISO_DATA_PACKET = 0x05
+} HCIPacketType;
+
+/**
+ * @brief A structure for the HCI protocol over UART.
+ */
+typedef struct {
+    uint8_t type;       /**< The packet indicator, one of HCIPacketType. */
+    /*! The opcode of a command, the event code of an event, or the connection
+     * handle together with its flags for ACL, SCO and ISO data.
+     */
+    uint16_t id;
+    uint32_t length;    /**< The length of the payload of the HCIFrame. */
+    uint8_t *data;      /**< The payload of the HCIFrame. */
+    /*! Timestamp of the HCIFrame. It is the recorded timestamp of the RX of the packet
+     * indicator if it is a received frame. It is the creation time of a TX frame.
+     */
+    time_t timeStamp;
+    uint32_t index;     /**< The index in the global sequence of received packets of the packet containing the packet indicator. */
+    /*! MonotonicTimeNs when the read holding the packet indicator completed, or when
+     * the frame was decoded if the framer uses the RX ring. 0 for TX frames.
+     */
+    uint64_t firstByteNs;
+    uint64_t completeNs;    /**< MonotonicTimeNs when the frame was recognized as complete, 0 for TX frames. */
+} HCIFrame;
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Public memory declarations
+ ************************************************************************************
+ ********************************************************************************* */
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Public macros
+ ************************************************************************************
+ ********************************************************************************* */
+/* Header sizes, packet indicator included. */
+#define HCI_COMMAND_HEADER_SIZE 4
+#define HCI_ACL_HEADER_SIZE     5
+#define HCI_SCO_HEADER_SIZE     4
+#define HCI_EVENT_HEADER_SIZE   3
+#define HCI_ISO_HEADER_SIZE     5
+#define HCI_MAX_HEADER_SIZE     5
+
+/* The ISO data length field is 14 bits wide. */
+#define HCI_ISO_LENGTH_MASK     0x3FFF
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Public prototypes
+ ************************************************************************************
+ ********************************************************************************* */
+DLLEXPORT HCIFrame *CreateHCIFrame(uint8_t type, uint16_t id, uint8_t *data, uint32_t length);
+DLLEXPORT uint8_t HCIHeaderSize(uint8_t type);
+DLLEXPORT void DestroyHCIFrame(HCIFrame *);
+DLLEXPORT void PrintHCIFrame(HCIFrame *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
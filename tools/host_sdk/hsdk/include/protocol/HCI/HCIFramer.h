@@ -0,0 +1,68 @@
+/*
+* \file HCIFramer.h
+* This is the header file for the HCIFramer module.
+*
+* Copyright 2026 NXP
+* All rights reserved.
+*
+* SPDX-License-Identifier: BSD-3-Clause
+*/
+
+#ifndef __HCI_FRAMER__
+#define __HCI_FRAMER__
+
+/************************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+************************************************************************************/
+#include <stdint.h>
+
+#include "Framer.h"
+#include "HCIFrame.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public macros
+*************************************************************************************
+********************************************************************************** */
+/* H4 has no sync byte, so ACL and ISO headers announcing a longer payload are treated
+   as desynchronization. The whole packet must fit in the framer's RX ring. */
+#define HCI_MTU         2048
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public type definitions
+*************************************************************************************
+********************************************************************************** */
+/**
+ * @brief The HCI framer keeps no partial frame, so it is either looking for a frame
+ * or has just delivered one.
+ */
+typedef enum {
+    HCI_SM_JUNK_DATA,
+    HCI_SM_FINISHED_FRAME
+} HCIStateMachine;
+
+/*! *********************************************************************************
+*************************************************************************************
+* Public prototypes
+*************************************************************************************
+********************************************************************************** */
+uint8_t *CreateHCIPacket(Framer *framer, void *, uint32_t *);
+int HCIStartState(void);
+int HCIFinalState(void);
+DLLEXPORT FrameStatus HCIParseFrame(uint8_t *pData, uint32_t cbData, HCIFrame *frame, uint32_t *cbFrame);
+FrameStatus HCIStateMachineDispatch(Framer *framer, void **currentFrame, uint32_t *dataSize);
+int HCIQueueDataVerification(Framer *framer, uint32_t *dataSize);
+void HCIFramerInitialization(Framer *framer);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif
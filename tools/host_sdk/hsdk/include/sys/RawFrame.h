@@ -35,6 +35,19 @@ extern "C" {
 * Public type definitions
 *************************************************************************************
 ********************************************************************************** */
+/**
+ * @brief Bytes received from the device, shared read only by the RawFrames of all the
+ * observers of a read. It is released along with the last of these RawFrames.
+ */
+typedef struct {
+    volatile long refCount;     /**< The number of RawFrames referencing the buffer, plus one while it is being created. */
+    uint32_t packetIndex;       /**< The index of the global count of received RawFrames. */
+    uint32_t cbTotalSize;       /**< The number of bytes received. */
+    time_t timeStamp;           /**< Timestamp of the read. */
+    uint64_t timeStampNs;       /**< MonotonicTimeNs() when the bytes were read. */
+    uint8_t aRawData[1];        /**< The bytes received, allocated with the structure. */
+} RxBuffer;
+
 /**
  * @brief Simple structure for encapsulating data. Has no protocol representation.
  */
@@ -44,6 +57,9 @@ typedef struct {
     uint32_t cbTotalSize;   /**< The size of the payload of the RawFrame. */
     uint32_t iCrtIndex;     /**< An index into the array used in processing the data contained within the structure. */
     time_t timeStamp;       /**< Timestamp of the creation of the RawFrame. */
+    uint64_t timeStampNs;   /**< MonotonicTimeNs() when the bytes were read for RX, when the frame was queued to the device for TX. */
+    uint64_t writtenNs;     /**< TX only: MonotonicTimeNs() when the device finished writing the frame, 0 before. */
+    RxBuffer *pShared;      /**< RX only: the buffer aRawData points into, NULL if the RawFrame owns its data. */
 } RawFrame;
 
 /*! *********************************************************************************
@@ -65,8 +81,12 @@ typedef struct {
 ********************************************************************************** */
 uint8_t *GetAckFrame(uint8_t lengthFieldSize);
 RawFrame *CreateTxRawFrame(uint8_t *data, uint32_t size);
+RawFrame *CreateTxRawFrameInPlace(uint32_t size);
 RawFrame *CreateRxRawFrame(uint8_t *data, uint32_t size);
 RawFrame *CloneRawFrame(RawFrame *frame);
+RxBuffer *CreateRxBuffer(uint8_t *data, uint32_t size);
+RawFrame *CreateRxRawFrameFromBuffer(RxBuffer *buffer);
+void ReleaseRxBuffer(RxBuffer *buffer);
 DLLEXPORT void DestroyRawFrame(RawFrame *frame);
 
 #ifdef __cplusplus
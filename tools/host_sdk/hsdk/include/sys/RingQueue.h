@@ -0,0 +1,92 @@
+/*
+ * \file RingQueue.h
+ * This is the header file for the RingQueue module.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __RING_QUEUE_H__
+#define __RING_QUEUE_H__
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Include
+ ************************************************************************************
+ ********************************************************************************* */
+#include "hsdkOSCommon.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Public macros
+ ************************************************************************************
+ ********************************************************************************* */
+/* Assumed size of a cache line, used to keep producer and consumer indexes apart. */
+#define RING_QUEUE_CACHE_LINE   64
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Public type definitions
+ ************************************************************************************
+ ********************************************************************************* */
+/**
+ * @brief Bounded byte queue for passing a stream between exactly one producer thread
+ * and exactly one consumer thread without locks or per-message allocations.
+ * @details The indexes are free running and wrap naturally on 32 bits; the number of
+ * bytes stored is always head - tail. Each side only writes its own index, so the
+ * producer and consumer fields live on separate cache lines.
+ */
+typedef struct {
+    /** Producer owned: total number of bytes written. */
+    volatile uint32_t head;
+    /** Producer private copy of tail, refreshed only when the queue looks full. */
+    uint32_t cachedTail;
+    uint8_t producerPad[RING_QUEUE_CACHE_LINE - 2 * sizeof(uint32_t)];
+
+    /** Consumer owned: total number of bytes read. */
+    volatile uint32_t tail;
+    uint8_t consumerPad[RING_QUEUE_CACHE_LINE - sizeof(uint32_t)];
+
+    /** Set by a producer blocked in RingQueuePutWait(), cleared by the consumer. */
+    volatile uint32_t spaceWanted;
+
+    uint8_t *buffer;            /**< Storage, capacity bytes long. */
+    uint32_t capacity;          /**< Size of the storage, always a power of two. */
+    uint32_t mask;              /**< capacity - 1, used to wrap the indexes. */
+    Semaphore sAnnounceData;    /**< An event to indicate availability of bytes to be processed, same as MessageQueue. */
+    Event sSpaceAvailable;      /**< Signalled by the consumer only while spaceWanted is set. */
+} RingQueue;
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Public prototypes
+ ************************************************************************************
+ ********************************************************************************* */
+RingQueue *InitializeRingQueue(uint32_t capacity);
+int DestroyRingQueue(RingQueue *pRingQueue);
+int ClearRingQueue(RingQueue *pRingQueue);
+
+/* Producer side. */
+uint32_t RingQueuePut(RingQueue *pRingQueue, const uint8_t *pData, uint32_t cSize);
+uint32_t RingQueuePutWait(RingQueue *pRingQueue, const uint8_t *pData, uint32_t cSize, int64_t milisecondsToWait);
+uint32_t RingQueueGetFreeSpace(RingQueue *pRingQueue);
+
+/* Consumer side. */
+uint32_t RingQueueGet(RingQueue *pRingQueue, uint8_t *pDest, uint32_t cSize);
+uint32_t RingQueuePeek(RingQueue *pRingQueue, uint8_t *pDest, uint32_t cSize);
+uint8_t *RingQueueReadPointer(RingQueue *pRingQueue, uint32_t *cContiguous);
+void RingQueueAdvance(RingQueue *pRingQueue, uint32_t cSize);
+uint32_t RingQueueGetContentSize(RingQueue *pRingQueue);
+uint8_t RingQueueIsEmpty(RingQueue *pRingQueue);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,119 @@
+/*
+ * \file hsdkAtomic.h
+ * This is the header file for the atomic accesses shared by the lock-free modules.
+ * It is internal to the library: the functions are defined static in every source
+ * file including it.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __HSDK_ATOMIC_H__
+#define __HSDK_ATOMIC_H__
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Include
+ ************************************************************************************
+ ********************************************************************************* */
+#include "hsdkOSCommon.h"
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Private functions
+ ************************************************************************************
+ ********************************************************************************* */
+
+/*! *********************************************************************************
+ * \brief  Read a value published by another thread. The acquire barrier ensures the
+ *         data it covers is visible before it is touched.
+ ********************************************************************************** */
+static uint32_t LoadAcquire(volatile uint32_t *pValue)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_load_n(pValue, __ATOMIC_ACQUIRE);
+#else
+    uint32_t value = *pValue;
+    MemoryBarrier();
+    return value;
+#endif
+}
+
+/*! *********************************************************************************
+ * \brief  Publish a value to another thread once the data it covers is written, or
+ *         no longer needed.
+ ********************************************************************************** */
+static void StoreRelease(volatile uint32_t *pValue, uint32_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_store_n(pValue, value, __ATOMIC_RELEASE);
+#else
+    MemoryBarrier();
+    *pValue = value;
+#endif
+}
+
+static void *LoadAcquirePtr(void *volatile *pPtr)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_load_n(pPtr, __ATOMIC_ACQUIRE);
+#else
+    void *value = *pPtr;
+    MemoryBarrier();
+    return value;
+#endif
+}
+
+static void StoreReleasePtr(void *volatile *pPtr, void *value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_store_n(pPtr, value, __ATOMIC_RELEASE);
+#else
+    MemoryBarrier();
+    *pPtr = value;
+#endif
+}
+
+/*! *********************************************************************************
+ * \brief  Replace *pPtr by value if it still is expected.
+ *
+ * \return 1 if replaced, 0 otherwise
+ ********************************************************************************** */
+static int CompareExchangePtr(void *volatile *pPtr, void *expected, void *value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_compare_exchange_n(pPtr, &expected, value, 0, __ATOMIC_RELEASE, __ATOMIC_RELAXED);
+#else
+    return InterlockedCompareExchangePointer(pPtr, value, expected) == expected;
+#endif
+}
+
+/*! *********************************************************************************
+ * \brief  Replace *pValue by value if it still is expected.
+ *
+ * \return 1 if replaced, 0 otherwise
+ ********************************************************************************** */
+static int CompareExchange(volatile uint32_t *pValue, uint32_t expected, uint32_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_compare_exchange_n(pValue, &expected, value, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+#else
+    return (uint32_t)InterlockedCompareExchange((volatile LONG *)pValue, (LONG)value, (LONG)expected) == expected;
+#endif
+}
+
+/*! *********************************************************************************
+ * \brief  Order a store against the following load.
+ ********************************************************************************** */
+static void FullBarrier(void)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_thread_fence(__ATOMIC_SEQ_CST);
+#else
+    MemoryBarrier();
+#endif
+}
+
+#endif /* __HSDK_ATOMIC_H__ */
@@ -246,6 +246,18 @@ DLLEXPORT int HSDKCloseFile(File f);
 ********************************************************************************** */
 DLLEXPORT int HSDKWriteFile(File file, uint8_t *buffer, uint32_t count);
 /*! *********************************************************************************
+* \brief  Writes several buffers to the file, in order, with as few system calls as
+*         possible (writev on Linux and OS X)
+*
+* \param[in] file      The file
+* \param[in] buffers   The buffers from which data is written to the file
+* \param[in] counts    The number of bytes of each buffer
+* \param[in] cBuffers  The number of buffers
+*
+* \return Number of bytes written, -1 on failure; on Windows GetLastError tells why
+********************************************************************************** */
+DLLEXPORT int HSDKWriteFileVector(File file, uint8_t **buffers, uint32_t *counts, uint32_t cBuffers);
+/*! *********************************************************************************
 * \brief  Reads from the file
 *
 * \param[in] file  The file
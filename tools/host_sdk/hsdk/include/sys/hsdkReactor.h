@@ -0,0 +1,91 @@
+/*
+ * \file hsdkReactor.h
+ * This is the header file for the Reactor module.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __HSDK_REACTOR_H__
+#define __HSDK_REACTOR_H__
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Include
+ ************************************************************************************
+ ********************************************************************************* */
+#include <stdint.h>
+
+#include "hsdkOSCommon.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Public macros
+ ************************************************************************************
+ ********************************************************************************* */
+/* Maximum number of event loops shared by the devices. */
+#define REACTOR_MAX_LOOPS       64
+
+/* Maximum number of ready events handled per wake up of a loop. */
+#define REACTOR_MAX_EVENTS      64
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Public type definitions
+ ************************************************************************************
+ ********************************************************************************* */
+/**
+ * @brief Called from the loop thread when the event of a source is ready.
+ */
+typedef void (*ReactorHandler)(void *context);
+
+/**
+ * @brief An event watched by a loop, with the function handling it.
+ */
+typedef struct ReactorSource {
+    Event event;                        /**< The watched event. */
+    ReactorHandler handler;             /**< Called when the event is ready. */
+    void *context;                      /**< Passed to the handler. */
+    uint8_t edgeTriggered;              /**< 1 if the handler is only called again for new data. */
+    uint8_t enabled;                    /**< 0 while the source is ignored. */
+    uint8_t removed;                    /**< Set by ReactorRemove, freed by the loop. */
+    struct ReactorSource *nextRemoved;  /**< Sources waiting for the end of the dispatch. */
+} ReactorSource;
+
+/**
+ * @brief One event loop and its thread.
+ */
+typedef struct {
+    int pollHandle;             /**< The epoll instance. */
+    Event stopThread;           /**< Signals the loop to exit. */
+    Thread loopThread;          /**< Waits for and dispatches the events. */
+    volatile int threadId;      /**< HSDKThreadId() of loopThread, 0 before it starts. */
+    uint32_t index;             /**< Position of the loop, used for the CPU affinity. */
+    uint8_t pinCpu;             /**< Whether the thread is bound to CPU index. */
+    Lock lock;                  /**< Held during a dispatch, so a source is not freed under it. */
+    ReactorSource *removed;     /**< Sources removed since the last dispatch. */
+} Reactor;
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Public prototypes
+ ************************************************************************************
+ ********************************************************************************* */
+DLLEXPORT Reactor *ReactorAcquire(uint32_t cLoops, uint8_t pinCpus);
+DLLEXPORT void ReactorRelease(Reactor *reactor);
+DLLEXPORT ReactorSource *ReactorAdd(Reactor *reactor, Event e, uint8_t edgeTriggered, ReactorHandler handler, void *context);
+DLLEXPORT int ReactorEnable(Reactor *reactor, ReactorSource *source, uint8_t enabled);
+DLLEXPORT void ReactorRemove(Reactor *reactor, ReactorSource *source);
+DLLEXPORT int ReactorPending(Event e);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,101 @@
+/*
+ * \file hsdkTrace.h
+ * This is the header file for the Trace module.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef __HSDK_TRACE_H__
+#define __HSDK_TRACE_H__
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Include
+ ************************************************************************************
+ ********************************************************************************* */
+#include <stdint.h>
+
+#include "hsdkOSCommon.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Public macros
+ ************************************************************************************
+ ********************************************************************************* */
+/* The first bytes of a trace file, followed by TRACE_FILE_VERSION and the record size. */
+#define TRACE_FILE_MAGIC        "HSDKTRC1"
+#define TRACE_FILE_VERSION      1
+
+#define DEFAULT_TRACE           "hsdk.trace"
+
+/* Number of records in the ring of each thread, a power of two. */
+#define TRACE_RING_RECORDS      4096
+
+/* Maximum number of distinct strings referenced by the records. */
+#define TRACE_MAX_STRINGS       1024
+
+/* How often the logger thread writes the records to the trace file. */
+#define TRACE_DRAIN_PERIOD_MS   50
+
+#ifdef USE_TRACE
+#define HSDK_TRACE(eventId, a0, a1, a2, a3) TraceEvent((eventId), (a0), (a1), (a2), (a3))
+#else
+#define HSDK_TRACE(eventId, a0, a1, a2, a3)
+#endif
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Public type definitions
+ ************************************************************************************
+ ********************************************************************************* */
+/**
+ * @brief The identifiers of the trace records, with the meaning of their arguments.
+ */
+typedef enum {
+    /*! Definition of a string: args[0] is its id, args[1] its length. The bytes follow
+     * the record in the file, padded to a multiple of the record size.
+     */
+    TRACE_EVT_STRING = 0,
+    TRACE_EVT_LOG = 1,          /**< logMessage: args[0] priority, args[1] tag string, args[2] message string. */
+    TRACE_EVT_BYTES = 2,        /**< printBuffer: args[0] tag string, args[1] size, args[2..3] first 8 bytes. */
+    TRACE_EVT_DROPPED = 3,      /**< args[0] records lost by the thread because its ring was full. */
+    TRACE_EVT_USER = 0x100      /**< First identifier free for the applications. */
+} TraceEventId;
+
+/**
+ * @brief A fixed size trace record, written as is to the trace file.
+ */
+typedef struct {
+    uint64_t timeNs;        /**< MonotonicTimeNs() when the record was made. */
+    uint32_t threadId;      /**< The thread that made the record. */
+    uint16_t eventId;       /**< One of TraceEventId, or an application identifier. */
+    uint16_t reserved;
+    uint32_t args[4];       /**< Meaning depends on eventId. */
+} TraceRecord;
+
+/*! *********************************************************************************
+ ************************************************************************************
+ * Public prototypes
+ ************************************************************************************
+ ********************************************************************************* */
+int TraceOpen(const char *filename);
+void TraceClose(void);
+uint32_t TraceDrain(void);
+void TraceMuteThread(void);
+DLLEXPORT void TraceEvent(uint16_t eventId, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+DLLEXPORT void TraceEventFromThread(uint32_t threadId, uint16_t eventId, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+DLLEXPORT void TraceBytes(const char *tag, const uint8_t *data, uint32_t size);
+DLLEXPORT uint32_t TraceString(const char *s);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -54,6 +54,15 @@ typedef struct {
     uint8_t numberOfRetries;
     int timeoutAckMs;
     uint8_t fsciRxAck;
+    uint32_t rxRingSize;    /**< When not 0, size in bytes of the lock-free RX ring used by the framers. */
+    uint8_t fsciCursorFramer;   /**< When not 0, FSCI frames are parsed in place by the cursor framer. */
+    uint8_t framerBatchDispatch;    /**< When not 0, the framers decode all the complete frames on each wake up. */
+    uint8_t txAckWindow;    /**< The number of frames that may wait for an FSCI TX ACK at once, 0 and 1 for stop-and-wait. */
+    uint32_t txCoalesceBytes;   /**< When not 0, the queued TX frames are written together, up to this many bytes per write. */
+    int txCoalesceLatencyMs;    /**< How long a coalesced write may wait for more frames once the TX queue is empty. */
+    uint32_t spiBulkReadBytes;  /**< When not 0, SPI devices clock in this many bytes per transfer and split the FSCI frames out of them. */
+    uint8_t reactorThreads;     /**< When not 0, UART devices and their framers share this many event loops instead of a thread each. */
+    uint8_t reactorPinCpus;     /**< When not 0, event loop i is bound to CPU i. */
 } ConfigParams;
 
 /*! *********************************************************************************
@@ -81,6 +90,7 @@ DLLEXPORT uint32_t Read32(uint8_t *, endianness);
 DLLEXPORT uint64_t Read64(uint8_t *, endianness);
 DLLEXPORT ConfigParams *ParseConfig(void);
 DLLEXPORT char *UARTSystemPath(char *uartPath);
+DLLEXPORT uint64_t MonotonicTimeNs(void);
 
 #ifdef __cplusplus
 }
@@ -205,14 +205,15 @@ void PCAPCallback(u_char *userData, const struct pcap_pkthdr *h, const u_char *b
     printf("[%ld.%06ld] caplen %d, len %d\n", h->ts.tv_sec, h->ts.tv_usec, h->caplen, h->len);
 #endif
     /* Strip Ethernet header */
-    RawFrame *frame = CreateRxRawFrame(((uint8_t *)bytes) + SIZE_ETHERNET, h->caplen - SIZE_ETHERNET);
-    if (frame == NULL) {
+    RxBuffer *buffer = CreateRxBuffer(((uint8_t *)bytes) + SIZE_ETHERNET, h->caplen - SIZE_ETHERNET);
+    if (buffer == NULL) {
         logMessage(HSDK_ERROR, "[PCAPDevice]PCAPCallback", "Memory allocation failed", HSDKThreadId());
+        return;
     }
-    /* Notify */
-    NotifyOnSameEvent(((PhysicalDevice *)userData)->evtManager, frame, (void *(*)(void *))CloneRawFrame);
-    /* Destroy */
-    DestroyRawFrame(frame);
+    /* Notify, all observers share the buffer */
+    NotifyOnSameEvent(((PhysicalDevice *)userData)->evtManager, buffer, (void *(*)(void *))CreateRxRawFrameFromBuffer);
+    /* Release */
+    ReleaseRxBuffer(buffer);
 }
 
 /*! *********************************************************************************
@@ -38,6 +38,10 @@
 #   include "SPIDevice.h"
 #endif
 
+#ifdef __linux__virtual__
+#   include "VirtualDevice.h"
+#endif
+
 #include "UARTDevice.h"
 #include "UART/UARTConfiguration.h"
 
@@ -49,7 +53,8 @@
 * Private macros
 *************************************************************************************
 ************************************************************************************/
-#define RX_SIZE 0x8FF
+#define TX_ACK_WINDOW_MAX_SIZE 64
+#define TX_COALESCE_MAX_FRAMES 64
 
 /************************************************************************************
 *************************************************************************************
@@ -57,8 +62,26 @@
 *************************************************************************************
 ************************************************************************************/
 static void *DeviceThreadRoutine(void *lpParameter);
+static uint32_t DeviceRead(PhysicalDevice *device, uint8_t *dataBuffer);
+static Event DeviceTxReady(PhysicalDevice *device, Event txEvent);
+static int DeviceReactorAttach(PhysicalDevice *device);
+static void DeviceReactorDetach(PhysicalDevice *device);
+static void DeviceReactorRead(void *context);
+static void DeviceReactorTx(void *context);
 static int AttachToConcreteImplementation(PhysicalDevice *device, char *deviceName);
 static int DetachFromConcreteImplementation(PhysicalDevice *device);
+static TxAckWindow *CreateTxAckWindow(uint32_t size);
+static void ClearTxAckWindow(TxAckWindow *window);
+static void DestroyTxAckWindow(TxAckWindow *window);
+static uint64_t TxAckNowMs(void);
+static void TxFrameWritten(PhysicalDevice *device, RawFrame *tx);
+static int TxCoalesceWaitData(PhysicalDevice *device, int64_t timeoutMs);
+static int TxCoalesceSend(PhysicalDevice *device, RawFrame *tx);
+static int TxAckWindowIsFull(TxAckWindow *window);
+static int TxAckWindowSend(PhysicalDevice *device, RawFrame *tx);
+static void TxAckWindowRemove(TxAckWindow *window, uint32_t index);
+static int64_t TxAckWindowRetransmit(PhysicalDevice *device);
+static void *WaitACKWindow(void *lpParameter);
 
 /************************************************************************************
 *************************************************************************************
@@ -152,6 +175,14 @@ PhysicalDevice *InitPhysicalDevice(DeviceType type, void *pConfigData, char *dev
         return NULL;
     }
 
+    pConnDev->txEvtManager = CreateEventManager();
+    if (pConnDev->txEvtManager == NULL) {
+        logMessage(HSDK_ERROR, "[PhysicalDevice]InitPhysicalDevice", "EventManager creation failed", HSDKThreadId());
+        DestroyEventManager(pConnDev->evtManager);
+        free(pConnDev);
+        return NULL;
+    }
+
     logMessage(HSDK_INFO, "[PhysicalDevice]InitPhysicalDevice", "Created event manager for device", HSDKThreadId());
 
     pConnDev->status = PHYS_CLOSED;
@@ -208,15 +239,39 @@ PhysicalDevice *InitPhysicalDevice(DeviceType type, void *pConfigData, char *dev
 
     logMessage(HSDK_INFO, "[PhysicalDevice]InitPhysicalDevice", "Created stopTXACKTimeoutThread event", HSDKThreadId());
 
+    // Allow several frames to wait for their TX ACK at once, instead of one.
+    if (pConnDev->configParams->fsciTxAck && pConnDev->configParams->txAckWindow > 1) {
+        pConnDev->txAckWindow = CreateTxAckWindow(pConnDev->configParams->txAckWindow);
+        if (pConnDev->txAckWindow == NULL) {
+            logMessage(HSDK_ERROR, "[PhysicalDevice]InitPhysicalDevice", "TX ACK window creation failed", HSDKThreadId());
+            free(pConnDev);
+            return NULL;
+        }
+
+        logMessage(HSDK_INFO, "[PhysicalDevice]InitPhysicalDevice", "Created TX ACK window", HSDKThreadId());
+    }
 
 
     pConnDev->eventThread = INVALID_THREAD_HANDLE;
     pConnDev->type = type;
 
-    AttachToConcreteImplementation(pConnDev, deviceName);
+    if (AttachToConcreteImplementation(pConnDev, deviceName) != HSDK_ERROR_SUCCESS) {
+        // Refused by OpenPhysicalDevice, e.g. a virtual board whose script has errors.
+        pConnDev->status = PHYS_ERROR;
+    }
 
     logMessage(HSDK_INFO, "[PhysicalDevice]AttachToConcreteImplementation", "Attached to a concrete implementation", HSDKThreadId());
 
+    // Share an event loop with the other devices instead of a thread of its own. The TX ACK
+    // timers and the blocking handshake with them need threads, so those devices keep theirs.
+    if (pConnDev->configParams->reactorThreads && (type == UART || type == VIRTUAL) && !pConnDev->configParams->fsciTxAck) {
+        pConnDev->reactor = ReactorAcquire(pConnDev->configParams->reactorThreads, pConnDev->configParams->reactorPinCpus);
+
+        if (pConnDev->reactor == NULL) {
+            logMessage(HSDK_WARNING, "[PhysicalDevice]InitPhysicalDevice", "No event loop, using a device thread", HSDKThreadId());
+        }
+    }
+
     return pConnDev;
 }
 
@@ -271,6 +326,9 @@ int DestroyPhysicalDevice(PhysicalDevice *device)
         return err;
     }
 
+    DestroyTxAckWindow(device->txAckWindow);
+    device->txAckWindow = NULL;
+
     err = HSDKDestroyEvent(device->startThread);
     if (err != HSDK_ERROR_SUCCESS) {
         logMessage(HSDK_ERROR, "[PhysicalDevice]DestroyPhysicalDevice", "Error stopping device thread", HSDKThreadId());
@@ -285,6 +343,10 @@ int DestroyPhysicalDevice(PhysicalDevice *device)
     }
 
     DestroyEventManager(device->evtManager);
+    DestroyEventManager(device->txEvtManager);
+
+    ReactorRelease(device->reactor);
+    device->reactor = NULL;
 
     err = DetachFromConcreteImplementation(device);
     if (err != HSDK_ERROR_SUCCESS) {
@@ -326,6 +388,11 @@ int OpenPhysicalDevice(PhysicalDevice *device)
     int ret = device->open(device->deviceHandle, device->configurationData);
     if (ret == HSDK_ERROR_SUCCESS) {
         device->status = PHYS_OPENED;
+
+        if (device->reactor) {
+            return DeviceReactorAttach(device);
+        }
+
         int sig = HSDKSignalEvent(device->startThread);
         if (sig != HSDK_ERROR_SUCCESS) {
             logMessage(HSDK_WARNING, "[PhysicalDevice]OpenPhysicalDevice", "Failed to signal thread to start", HSDKThreadId());
@@ -383,26 +450,31 @@ int ClosePhysicalDevice(PhysicalDevice *crtDevice)
 
     int err;
 
-    if (crtDevice->stopThread == INVALID_EVENT_HANDLE) {
-        logMessage(HSDK_ERROR, "[PhysicalDevice]ClosePhysicalDevice", "stopThread event is invalid", HSDKThreadId());
-        return HSDK_ERROR_INVALID;
-    }
+    if (crtDevice->reactor) {
+        /* No thread to stop, the loop only stops watching the device. */
+        DeviceReactorDetach(crtDevice);
+    } else {
+        if (crtDevice->stopThread == INVALID_EVENT_HANDLE) {
+            logMessage(HSDK_ERROR, "[PhysicalDevice]ClosePhysicalDevice", "stopThread event is invalid", HSDKThreadId());
+            return HSDK_ERROR_INVALID;
+        }
 
-    err = HSDKSignalEvent(crtDevice->stopThread);
-    if (err != HSDK_ERROR_SUCCESS) {
-        logMessage(HSDK_ERROR, "[PhysicalDevice]ClosePhysicalDevice", "stopThread signaling error", HSDKThreadId());
-        return err;
-    }
+        err = HSDKSignalEvent(crtDevice->stopThread);
+        if (err != HSDK_ERROR_SUCCESS) {
+            logMessage(HSDK_ERROR, "[PhysicalDevice]ClosePhysicalDevice", "stopThread signaling error", HSDKThreadId());
+            return err;
+        }
 
-    if (crtDevice->eventThread == INVALID_THREAD_HANDLE) {
-        logMessage(HSDK_ERROR, "[PhysicalDevice]ClosePhysicalDevice", "EventThread thread is invalid", HSDKThreadId());
-        return HSDK_ERROR_INVALID;
-    }
+        if (crtDevice->eventThread == INVALID_THREAD_HANDLE) {
+            logMessage(HSDK_ERROR, "[PhysicalDevice]ClosePhysicalDevice", "EventThread thread is invalid", HSDKThreadId());
+            return HSDK_ERROR_INVALID;
+        }
 
-    err = HSDKDestroyThread(crtDevice->eventThread);
-    if (err != HSDK_ERROR_SUCCESS) {
-        logMessage(HSDK_ERROR, "[PhysicalDevice]ClosePhysicalDevice", "Error destroying thread eventThread", HSDKThreadId());
-        return err;
+        err = HSDKDestroyThread(crtDevice->eventThread);
+        if (err != HSDK_ERROR_SUCCESS) {
+            logMessage(HSDK_ERROR, "[PhysicalDevice]ClosePhysicalDevice", "Error destroying thread eventThread", HSDKThreadId());
+            return err;
+        }
     }
 
     err = crtDevice->close(crtDevice->deviceHandle);
@@ -415,6 +487,7 @@ int ClosePhysicalDevice(PhysicalDevice *crtDevice)
     crtDevice->status = PHYS_CLOSED;
 
     ClearMessageQueue(crtDevice->inMessages);
+    ClearTxAckWindow(crtDevice->txAckWindow);
 
     return HSDK_ERROR_SUCCESS;
 }
@@ -463,6 +536,32 @@ int WritePhysicalDevice(void *device, uint8_t *buf, uint32_t size)
     return err;
 }
 
+/*! *********************************************************************************
+* \brief   Puts an already built frame in the thread message queue, without copying
+*          it. The device thread writes its data as is and then destroys it.
+*
+* \param[in, out] device   pointer to the PhysicalDevice structure.
+* \param[in] tx            the frame to be written, owned by the device from now on
+*
+* \return 0 for success
+********************************************************************************** */
+int WriteRawFramePhysicalDevice(void *device, RawFrame *tx)
+{
+    PhysicalDevice *crtDevice = (PhysicalDevice *) device;
+    // Check if the device exists
+    if (crtDevice == NULL || tx == NULL) {
+        logMessage(HSDK_ERROR, "[PhysicalDevice]WriteRawFramePhysicalDevice", "Physical device or frame is NULL", HSDKThreadId());
+        DestroyRawFrame(tx);
+        return HSDK_ERROR_INVALID;
+    }
+
+    /* The frame may have been built well before, stamp when it is queued. */
+    tx->timeStampNs = MonotonicTimeNs();
+    MessageQueuePut(crtDevice->inMessages, tx);
+
+    return HSDKSignalEvent(crtDevice->inMessages->sAnnounceData);
+}
+
 
 /*! *********************************************************************************
 * \brief    Attach a framer for the current UART device. This enables events triggered
@@ -498,6 +597,29 @@ void DetachFromPhysicalDevice(void *dev, void *observer)
     DeregisterFromEvent(physDev->evtManager, observer);
 }
 
+/*! *********************************************************************************
+* \brief    Registers an observer called from the device thread with each RawFrame
+*           once its first write to the hardware returned, with writtenNs set. The
+*           frame is only valid during the callback and must not be freed.
+*
+* \param[in,out] dev    pointer to the physDev device
+* \param[in] observer   pointer to the observer that will receive the frames
+* \param[in] Callback   callback function called with the observer and the RawFrame
+*
+* \return none
+********************************************************************************** */
+void AttachTxToPhysicalDevice(void *dev, void *observer, void(*Callback) (void *callee, void *object))
+{
+    PhysicalDevice *physDev = (PhysicalDevice *) dev;
+    RegisterToEventManager(physDev->txEvtManager, observer, Callback);
+}
+
+void DetachTxFromPhysicalDevice(void *dev, void *observer)
+{
+    PhysicalDevice *physDev = (PhysicalDevice *) dev;
+    DeregisterFromEvent(physDev->txEvtManager, observer);
+}
+
 
 /************************************************************************************
 *************************************************************************************
@@ -587,10 +709,10 @@ static void *WaitACK(void* lpParameter) //PhysicalDevice* device, RawFrame* tx)
 #elif _WIN32
                 else if (rc == int(WAIT_OBJECT_0)) {
 #endif
-                    // ACK received 
+                    // ACK received; free the frame first, the lock lets the next one take lastTx
+                    DestroyRawFrame(lastTx);
                     HSDKReleaseLock(device->inMessages->lock);
                     flagReleaseLock = 1;// lock released
-                    DestroyRawFrame(lastTx);
 
                     break;
                 }
@@ -623,6 +745,408 @@ static void *WaitACK(void* lpParameter) //PhysicalDevice* device, RawFrame* tx)
     return NULL;
 }
 
+/*! *********************************************************************************
+* \brief    Thread function used instead of WaitACK when several frames may wait for
+*           their ACK at once. It retires the oldest outstanding frame on each ACK
+*           and resends, on its own, every frame whose timer expired.
+*
+* \param[in] lpParameter    pointer to a PhysicalDevice
+*
+* \return None
+********************************************************************************** */
+static void *WaitACKWindow(void *lpParameter)
+{
+    PhysicalDevice *device = (PhysicalDevice *)lpParameter;
+    TxAckWindow *window = device->txAckWindow;
+    int64_t timeout = INFINITE_WAIT;
+    int triggeredEvent;
+    int ret;
+
+    Event eventArray[3];
+    eventArray[0] = device->stopTXACKTimeoutThread;
+    eventArray[1] = device->sAnnounceTXACK;
+    eventArray[2] = device->startTXACKTimeoutThread;
+
+    while (1) {
+        triggeredEvent = -1;
+        ret = HSDKWaitMultipleEvents(eventArray, 3, timeout, &triggeredEvent);
+
+        if (ret == HSDK_ERROR_SUCCESS) {
+            switch (triggeredEvent) {
+                case 0:
+                    logMessage(HSDK_INFO, "[PhysicalDevice]WaitACKWindow", "Wait ACK device thread finished", HSDKThreadId());
+                    return NULL;
+
+                /* Case 1 - ACKs received, each belongs to the oldest outstanding frame.
+                   One wake up may stand for several ACKs, drain them all. */
+                case 1:
+                    HSDKResetEvent(eventArray[1]);
+                    HSDKAcquireLock(window->lock);
+
+                    while (window->acksReceived > 0) {
+                        window->acksReceived--;
+
+                        if (window->count > 0) {
+                            TxAckWindowRemove(window, 0);
+                        } else {
+                            logMessage(HSDK_WARNING, "[PhysicalDevice]WaitACKWindow", "ACK received with no frame outstanding", HSDKThreadId());
+                        }
+                    }
+
+                    HSDKReleaseLock(window->lock);
+                    break;
+
+                /* Case 2 - a frame was sent, the nearest deadline may have changed. */
+                case 2:
+                    HSDKResetEvent(eventArray[2]);
+                    break;
+            }
+        }
+
+        /* A timeout is reported as an error, check the timers in any case. */
+        timeout = TxAckWindowRetransmit(device);
+    }
+
+    return NULL;
+}
+
+/*! *********************************************************************************
+* \brief    Allocates the retransmit queue of a device.
+*
+* \param[in] size   the maximum number of outstanding frames
+*
+* \return NULL on allocation failure, a pointer to the TxAckWindow otherwise
+********************************************************************************** */
+static TxAckWindow *CreateTxAckWindow(uint32_t size)
+{
+    TxAckWindow *window = (TxAckWindow *)calloc(1, sizeof(TxAckWindow));
+
+    if (window == NULL) {
+        return NULL;
+    }
+
+    if (size > TX_ACK_WINDOW_MAX_SIZE) {
+        size = TX_ACK_WINDOW_MAX_SIZE;
+    }
+
+    window->slots = (TxAckSlot *)calloc(size, sizeof(TxAckSlot));
+    if (window->slots == NULL) {
+        free(window);
+        return NULL;
+    }
+
+    window->size = size;
+    window->lock = HSDKCreateLock();
+    window->sSlotFree = HSDKCreateEvent(0);
+
+    return window;
+}
+
+/*! *********************************************************************************
+* \brief    Drops the outstanding frames, e.g. when the device is closed.
+*
+* \param[in,out] window     pointer to the TxAckWindow, may be NULL
+*
+* \return None
+********************************************************************************** */
+static void ClearTxAckWindow(TxAckWindow *window)
+{
+    if (window == NULL) {
+        return;
+    }
+
+    HSDKAcquireLock(window->lock);
+
+    while (window->count > 0) {
+        TxAckWindowRemove(window, window->count - 1);
+    }
+
+    window->stalled = 0;
+    window->acksReceived = 0;
+    HSDKReleaseLock(window->lock);
+}
+
+/*! *********************************************************************************
+* \brief    Drops the outstanding frames and deallocates the retransmit queue.
+*
+* \param[in,out] window     pointer to the TxAckWindow, may be NULL
+*
+* \return None
+********************************************************************************** */
+static void DestroyTxAckWindow(TxAckWindow *window)
+{
+    if (window == NULL) {
+        return;
+    }
+
+    ClearTxAckWindow(window);
+    HSDKDestroyEvent(window->sSlotFree);
+    HSDKDestroyLock(window->lock);
+    free(window->slots);
+    free(window);
+}
+
+/*! *********************************************************************************
+* \brief    Reads a monotonic clock, used for the retransmit timers.
+*
+* \return the current time in milliseconds
+********************************************************************************** */
+static uint64_t TxAckNowMs(void)
+{
+    return MonotonicTimeNs() / 1000000;
+}
+
+/*! *********************************************************************************
+* \brief    Stamps a frame whose first write returned and hands it to the TX
+*           observers. Called before the frame may be released by an ACK.
+*
+* \param[in] device     pointer to the PhysicalDevice
+* \param[in,out] tx     the frame that was written
+*
+* \return None
+********************************************************************************** */
+static void TxFrameWritten(PhysicalDevice *device, RawFrame *tx)
+{
+    tx->writtenNs = MonotonicTimeNs();
+    NotifyOnEvent(device->txEvtManager, tx);
+}
+
+/*! *********************************************************************************
+* \brief    Waits for a frame to be queued to the device, taking one announcement.
+*
+* \param[in] device     pointer to the PhysicalDevice
+* \param[in] timeoutMs  how long to wait, 0 to only poll
+*
+* \return 1 if a frame was announced, 0 otherwise
+********************************************************************************** */
+static int TxCoalesceWaitData(PhysicalDevice *device, int64_t timeoutMs)
+{
+#ifdef _WIN32
+    return HSDKWaitEvent(device->inMessages->sAnnounceData, timeoutMs) == ERROR_SUCCESS;
+#else
+    return HSDKWaitEvent(device->inMessages->sAnnounceData, timeoutMs) == 1;
+#endif
+}
+
+/*! *********************************************************************************
+* \brief    Writes the given frame together with the frames queued behind it, up to
+*           TxCoalesceBytes, with a single call to the device. Once the queue is empty
+*           it waits for more frames for at most TxCoalesceLatencyMs after the first
+*           frame was queued, so a lone frame is written at once with the default 0.
+*           A device served by an event loop never waits, which would hold up the
+*           other devices of the loop, and writes what is queued.
+*           Only used without FSCI TX ACK, which needs to follow each frame.
+*           Takes the announcement the device thread woke up for, and those of the
+*           other frames written.
+*
+* \param[in] device     pointer to the PhysicalDevice
+* \param[in] tx         the frame taken from the queue, owned by the function
+*
+* \return the result of the write
+********************************************************************************** */
+static int TxCoalesceSend(PhysicalDevice *device, RawFrame *tx)
+{
+    RawFrame *batch[TX_COALESCE_MAX_FRAMES];
+    uint8_t *buffers[TX_COALESCE_MAX_FRAMES];
+    uint32_t counts[TX_COALESCE_MAX_FRAMES];
+    uint32_t cbBudget = device->configParams->txCoalesceBytes;
+    uint32_t cFrames = 0, cbBatch = 0, cAnnounced = 1, i;
+    int latencyMs = device->reactor ? 0 : device->configParams->txCoalesceLatencyMs;
+    uint64_t deadlineNs = tx->timeStampNs + (uint64_t)latencyMs * 1000000;
+    uint64_t nowNs;
+    int err;
+
+    HSDKResetEvent(device->inMessages->sAnnounceData);
+
+    while (tx != NULL) {
+        batch[cFrames] = tx;
+        buffers[cFrames] = tx->aRawData;
+        counts[cFrames] = tx->cbTotalSize;
+        cbBatch += tx->cbTotalSize;
+        cFrames++;
+
+        if (cFrames == TX_COALESCE_MAX_FRAMES) {
+            break;
+        }
+
+        /* Only this thread takes frames out, so the front cannot change under us. */
+        tx = (RawFrame *)PeekFront(device->inMessages);
+
+        /* An announcement may be late for a frame already taken, so keep waiting
+           until the deadline rather than until the first one. */
+        while (tx == NULL && latencyMs > 0 && cbBatch < cbBudget) {
+            nowNs = MonotonicTimeNs();
+
+            if (nowNs >= deadlineNs ||
+                !TxCoalesceWaitData(device, (int64_t)((deadlineNs - nowNs + 999999) / 1000000))) {
+                break;
+            }
+
+            cAnnounced++;
+            tx = (RawFrame *)PeekFront(device->inMessages);
+        }
+
+        /* The first frame goes out alone if it is above the budget by itself. */
+        if (tx == NULL || cbBatch + tx->cbTotalSize > cbBudget) {
+            break;
+        }
+
+        MessageQueueGet(device->inMessages);
+    }
+
+#ifndef _WIN32
+    /* Each queued frame is announced once, take the announcements of the frames
+       written here so that the thread does not wake up for nothing. */
+    while (cAnnounced < cFrames && TxCoalesceWaitData(device, 0)) {
+        cAnnounced++;
+    }
+#endif
+
+    /* Give back those taken for frames left queued, above the budget. */
+    for (; cAnnounced > cFrames; cAnnounced--) {
+        HSDKSignalEvent(device->inMessages->sAnnounceData);
+    }
+
+    err = device->writeVector(device->deviceHandle, buffers, counts, cFrames);
+
+    for (i = 0; i < cFrames; i++) {
+        TxFrameWritten(device, batch[i]);
+        DestroyRawFrame(batch[i]);
+    }
+
+    return err;
+}
+
+/*! *********************************************************************************
+* \brief    Checks whether another frame may be sent. When it may not, the device
+*           thread is marked as stalled, so that the next freed slot signals it.
+*
+* \param[in,out] window     pointer to the TxAckWindow
+*
+* \return 1 if all the slots are taken, 0 otherwise
+********************************************************************************** */
+static int TxAckWindowIsFull(TxAckWindow *window)
+{
+    int full;
+
+    HSDKAcquireLock(window->lock);
+    full = (window->count == window->size);
+    window->stalled = (uint8_t)full;
+    HSDKReleaseLock(window->lock);
+
+    return full;
+}
+
+/*! *********************************************************************************
+* \brief    Writes a frame and keeps it in the retransmit queue until its ACK
+*           arrives. The caller made sure that a slot is free.
+*
+* \param[in,out] device     pointer to the PhysicalDevice
+* \param[in] tx             the frame to be sent, owned by the window from now on
+*
+* \return the result of the device write
+********************************************************************************** */
+static int TxAckWindowSend(PhysicalDevice *device, RawFrame *tx)
+{
+    TxAckWindow *window = device->txAckWindow;
+    TxAckSlot *slot;
+    int err;
+
+    HSDKAcquireLock(window->lock);
+
+    /* Add the slot before writing, the ACK may come back before write returns. */
+    slot = &window->slots[window->count++];
+    slot->frame = tx;
+    slot->deadlineMs = TxAckNowMs() + device->configParams->timeoutAckMs;
+    slot->retriesLeft = device->configParams->numberOfRetries;
+
+    err = device->write(device->deviceHandle, tx->aRawData, tx->cbTotalSize);
+    TxFrameWritten(device, tx);
+
+    HSDKReleaseLock(window->lock);
+
+    HSDKSignalEvent(device->startTXACKTimeoutThread);
+
+    return err;
+}
+
+/*! *********************************************************************************
+* \brief    Removes an outstanding frame, keeping the others in sending order, and
+*           wakes up the device thread if it waits for a free slot. Called with the
+*           window lock held.
+*
+* \param[in,out] window     pointer to the TxAckWindow
+* \param[in] index          the slot to be removed
+*
+* \return None
+********************************************************************************** */
+static void TxAckWindowRemove(TxAckWindow *window, uint32_t index)
+{
+    DestroyRawFrame((RawFrame *)window->slots[index].frame);
+
+    window->count--;
+    memmove(&window->slots[index], &window->slots[index + 1], (window->count - index) * sizeof(TxAckSlot));
+
+    if (window->stalled) {
+        window->stalled = 0;
+        HSDKSignalEvent(window->sSlotFree);
+    }
+}
+
+/*! *********************************************************************************
+* \brief    Resends each outstanding frame whose timer expired and restarts its
+*           timer. The frames that are still in time are not sent again. A frame
+*           that expires with no retries left is dropped.
+*
+* \param[in,out] device     pointer to the PhysicalDevice
+*
+* \return the number of milliseconds until the nearest deadline, INFINITE_WAIT if
+*         no frame is outstanding
+********************************************************************************** */
+static int64_t TxAckWindowRetransmit(PhysicalDevice *device)
+{
+    TxAckWindow *window = device->txAckWindow;
+    uint64_t now = TxAckNowMs();
+    uint64_t nearest = UINT64_MAX;
+    uint32_t i = 0;
+    TxAckSlot *slot;
+    RawFrame *tx;
+
+    HSDKAcquireLock(window->lock);
+
+    while (i < window->count) {
+        slot = &window->slots[i];
+
+        if (slot->deadlineMs <= now) {
+            if (slot->retriesLeft == 0) {
+                logMessage(HSDK_WARNING, "[PhysicalDevice]TxAckWindowRetransmit", "No ACK received, frame dropped", HSDKThreadId());
+                TxAckWindowRemove(window, i);
+                continue;
+            }
+
+            logMessage(HSDK_INFO, "[PhysicalDevice]TxAckWindowRetransmit", "timeout", HSDKThreadId());
+
+            tx = (RawFrame *)slot->frame;
+            if (device->write(device->deviceHandle, tx->aRawData, tx->cbTotalSize) == -1) {
+                logMessage(HSDK_ERROR, "[PhysicalDevice]TxAckWindowRetransmit", strerror(errno), HSDKThreadId());
+            }
+
+            slot->retriesLeft--;
+            slot->deadlineMs = now + device->configParams->timeoutAckMs;
+        }
+
+        if (slot->deadlineMs < nearest) {
+            nearest = slot->deadlineMs;
+        }
+
+        i++;
+    }
+
+    HSDKReleaseLock(window->lock);
+
+    return (nearest == UINT64_MAX) ? INFINITE_WAIT : (int64_t)(nearest - now);
+}
+
 /*! *********************************************************************************
 * \brief  Thread function which waits for either its termination or an event from the
 * associated TTY/SPIDEV/COM port.
@@ -634,18 +1158,16 @@ static void *WaitACK(void* lpParameter) //PhysicalDevice* device, RawFrame* tx)
 static void *DeviceThreadRoutine(void *lpParameter)
 {
     PhysicalDevice *device = (PhysicalDevice *) lpParameter;
-    uint8_t *dataBuffer = (uint8_t *)calloc(RX_SIZE, sizeof(uint8_t));
+    uint8_t *dataBuffer = (uint8_t *)malloc(DEVICE_RX_SIZE);
     int8_t ret = 0;
-    uint32_t bytesRead;
-    int err, triggeredEvent;
+    int triggeredEvent;
     uint8_t loop = 1;
     void *asyncMask = NULL;
-    RawFrame *tx;
     Thread ackTimeoutThread; // thread to process ACK timeout
 
     if (device->configParams->fsciTxAck) {
         // Create a new thread to process ACK timeout
-        ackTimeoutThread = HSDKCreateThread(WaitACK, device);
+        ackTimeoutThread = HSDKCreateThread(device->txAckWindow ? WaitACKWindow : WaitACK, device);
         if (ackTimeoutThread == INVALID_THREAD_HANDLE) {
             logMessage(HSDK_ERROR, "[PhysicalDevice]DeviceThreadRoutine", "ackTimeoutThread is NULL", HSDKThreadId());
             return NULL;
@@ -725,44 +1247,17 @@ static void *DeviceThreadRoutine(void *lpParameter)
 
             /* Case 1 - RX from the board - not used for PCAP. The handling of packets from board is made in PCAPCallback. */
             case 1:
-                bytesRead = (uint32_t)RX_SIZE;
-                err = device->read(device->deviceHandle, dataBuffer, &bytesRead);
-                if (err == HSDK_ERROR_SUCCESS && bytesRead > 0) {
-                    RawFrame *frame = CreateRxRawFrame(dataBuffer, bytesRead);
-                    NotifyOnSameEvent(device->evtManager, frame, (void *(*)(void *))CloneRawFrame);
-                    DestroyRawFrame(frame);
-                }
+                DeviceRead(device, dataBuffer);
 
                 if (device->type != SPI) {
                     HSDKFinishTriggerableEvent(asyncMask);
                     eventArray[1] = device->waitable(device->deviceHandle, &asyncMask);
                 }
 
-                memset(dataBuffer, 0, RX_SIZE);
                 break;
 
             case 2:
-                tx = (RawFrame *)MessageQueueGet(device->inMessages);
-                if (tx != NULL) {
-                    int err = device->write(device->deviceHandle, tx->aRawData, tx->cbTotalSize);
-
-                    if (device->configParams->fsciTxAck) {
-                        
-                        HSDKAcquireLock(device->inMessages->lock);
-                        lastTx = tx;
-                        HSDKSignalEvent(device->startTXACKTimeoutThread);
-                    }
-                    else
-                    {
-                        DestroyRawFrame(tx);
-                    }
-                    
-                    if (err < 0) {
-                        device->status = PHYS_ERROR;
-                    }
-                }
-
-                HSDKResetEvent(eventArray[2]);
+                eventArray[2] = DeviceTxReady(device, eventArray[2]);
         }
     }
 
@@ -776,12 +1271,176 @@ threadFinishLabel:
 }
 
 
+/*! *********************************************************************************
+* \brief    Reads what the device has and hands it to the observers.
+*
+* \param[in] device         pointer to the PhysicalDevice
+* \param[in] dataBuffer     receives the data, DEVICE_RX_SIZE bytes
+*
+* \return   the number of bytes read
+********************************************************************************** */
+static uint32_t DeviceRead(PhysicalDevice *device, uint8_t *dataBuffer)
+{
+    uint32_t bytesRead = (uint32_t)DEVICE_RX_SIZE;
+    int err = device->read(device->deviceHandle, dataBuffer, &bytesRead);
+
+    if (err != HSDK_ERROR_SUCCESS || bytesRead == 0) {
+        return 0;
+    }
+
+    /* Copied once, each observer gets a RawFrame over the same bytes. */
+    RxBuffer *buffer = CreateRxBuffer(dataBuffer, bytesRead);
+
+    if (buffer == NULL) {
+        logMessage(HSDK_ERROR, "[PhysicalDevice]DeviceRead", "Memory allocation failed", HSDKThreadId());
+    } else {
+        NotifyOnSameEvent(device->evtManager, buffer, (void *(*)(void *))CreateRxRawFrameFromBuffer);
+        ReleaseRxBuffer(buffer);
+    }
+
+    return bytesRead;
+}
+
+/*! *********************************************************************************
+* \brief    Writes the next queued frame, or the queued frames when coalescing.
+*
+* \param[in] device     pointer to the PhysicalDevice
+* \param[in] txEvent    the TX event that was signaled: the announcement of the
+*                       queue, or the free slot of the TX ACK window
+*
+* \return   the TX event to wait for next
+********************************************************************************** */
+static Event DeviceTxReady(PhysicalDevice *device, Event txEvent)
+{
+    RawFrame *tx;
+
+    if (txEvent != device->inMessages->sAnnounceData) {
+        /* A slot was freed, go back to the queued frames. */
+        HSDKResetEvent(txEvent);
+        return device->inMessages->sAnnounceData;
+    }
+
+    if (device->txAckWindow && TxAckWindowIsFull(device->txAckWindow)) {
+        /* Leave the frames queued until an ACK or a drop frees a slot. */
+        return device->txAckWindow->sSlotFree;
+    }
+
+    tx = (RawFrame *)MessageQueueGet(device->inMessages);
+    if (tx != NULL && device->txAckWindow) {
+        if (TxAckWindowSend(device, tx) < 0) {
+            device->status = PHYS_ERROR;
+        }
+    } else if (tx != NULL && device->writeVector && device->configParams->txCoalesceBytes &&
+               !device->configParams->fsciTxAck) {
+        if (TxCoalesceSend(device, tx) < 0) {
+            device->status = PHYS_ERROR;
+        }
+
+        /* The announcements were already taken. */
+        return txEvent;
+    } else if (tx != NULL) {
+        int err = device->write(device->deviceHandle, tx->aRawData, tx->cbTotalSize);
+        TxFrameWritten(device, tx);
+
+        if (device->configParams->fsciTxAck) {
+            HSDKAcquireLock(device->inMessages->lock);
+            lastTx = tx;
+            HSDKSignalEvent(device->startTXACKTimeoutThread);
+        } else {
+            DestroyRawFrame(tx);
+        }
+
+        if (err < 0) {
+            device->status = PHYS_ERROR;
+        }
+    }
+
+    HSDKResetEvent(txEvent);
+
+    return txEvent;
+}
+
+/*! *********************************************************************************
+* \brief    Has the event loop of the device watch its data and its TX queue, in
+*           place of the device thread.
+*
+* \param[in] device     pointer to the opened PhysicalDevice
+*
+* \return   0 for success
+********************************************************************************** */
+static int DeviceReactorAttach(PhysicalDevice *device)
+{
+    device->rxBuffer = (uint8_t *)malloc(DEVICE_RX_SIZE);
+
+    if (device->rxBuffer != NULL) {
+        /* Edge triggered: DeviceReactorRead reads until the device has nothing left. */
+        device->rxSource = ReactorAdd(device->reactor, device->waitable(device->deviceHandle, &device->rxAsyncMask),
+                                      1, DeviceReactorRead, device);
+        device->txSource = ReactorAdd(device->reactor, device->inMessages->sAnnounceData, 0, DeviceReactorTx, device);
+    }
+
+    if (device->rxSource == NULL || device->txSource == NULL) {
+        logMessage(HSDK_ERROR, "[PhysicalDevice]OpenPhysicalDevice", "Cannot watch the device from the event loop", HSDKThreadId());
+        DeviceReactorDetach(device);
+        device->close(device->deviceHandle);
+        device->status = PHYS_ERROR;
+        return HSDK_ERROR_INVALID;
+    }
+
+    logMessage(HSDK_INFO, "[PhysicalDevice]OpenPhysicalDevice", "Device served by an event loop", HSDKThreadId());
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+/*! *********************************************************************************
+* \brief    Stops watching the device. Once this returns, the loop does not touch it.
+********************************************************************************** */
+static void DeviceReactorDetach(PhysicalDevice *device)
+{
+    ReactorRemove(device->reactor, device->rxSource);
+    ReactorRemove(device->reactor, device->txSource);
+    device->rxSource = NULL;
+    device->txSource = NULL;
+
+    if (device->rxAsyncMask != NULL) {
+        HSDKFinishTriggerableEvent(device->rxAsyncMask);
+        device->rxAsyncMask = NULL;
+    }
+
+    free(device->rxBuffer);
+    device->rxBuffer = NULL;
+}
+
+/*! *********************************************************************************
+* \brief    Event loop handler for the device data. The loop calls it again only for
+*           new data, so it reads until the device is drained: a short read took all
+*           there was, a full one may have left some.
+********************************************************************************** */
+static void DeviceReactorRead(void *context)
+{
+    PhysicalDevice *device = (PhysicalDevice *)context;
+
+    while (DeviceRead(device, device->rxBuffer) == DEVICE_RX_SIZE && ReactorPending(device->rxSource->event)) {
+    }
+}
+
+/*! *********************************************************************************
+* \brief    Event loop handler for the TX queue, called once per queued frame. There
+*           is no TX ACK window to wait for on a device served by a loop.
+********************************************************************************** */
+static void DeviceReactorTx(void *context)
+{
+    PhysicalDevice *device = (PhysicalDevice *)context;
+
+    DeviceTxReady(device, device->inMessages->sAnnounceData);
+}
+
+
 static int AttachToConcreteImplementation(PhysicalDevice *device, char *deviceName)
 {
     switch (device->type) {
         case UART:
-            AttachToUARTDevice(device, deviceName);
-            break;
+            return AttachToUARTDevice(device, deviceName);
 #ifdef __linux__pcap__
         case PCAP:
             AttachToPCAPDevice(device, deviceName);
@@ -796,6 +1455,10 @@ static int AttachToConcreteImplementation(PhysicalDevice *device, char *deviceNa
         case BT:
             AttachToBTDevice(device);
             break;
+#endif
+#ifdef __linux__virtual__
+        case VIRTUAL:
+            return AttachToVirtualDevice(device, deviceName);
 #endif
         default:
             logMessage(HSDK_ERROR, "[PhysicalDevice]AttachToConcreteImplementation", "Not implemented", HSDKThreadId());
@@ -825,6 +1488,11 @@ static int DetachFromConcreteImplementation(PhysicalDevice *device)
         case BT:
             DetachFromBTDevice(device);
             break;
+#endif
+#ifdef __linux__virtual__
+        case VIRTUAL:
+            DetachFromVirtualDevice(device);
+            break;
 #endif
         default:
             logMessage(HSDK_ERROR, "[PhysicalDevice]AttachToConcreteImplementation", "Not implemented", HSDKThreadId());
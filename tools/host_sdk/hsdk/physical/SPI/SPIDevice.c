@@ -13,6 +13,7 @@
 * Include
 *************************************************************************************
 ************************************************************************************/
+#include <errno.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -39,6 +40,8 @@ static int SPIOpenPort(void *pDevice, void *configData);
 static int SPIClosePort(void *pDevice);
 static int SPIWrite(void *specificData, uint8_t *buf, uint32_t size);
 static int SPIReadFSCIData(SPIHandle *device, uint8_t *buffer, uint32_t *count);
+static int SPITransfer(SPIHandle *device, uint8_t *buffer, uint32_t count);
+static int SPIBulkReadFSCIData(SPIHandle *device, uint8_t *buffer, uint32_t capacity, uint32_t *count);
 static int SPIRead(void *specificData, uint8_t *buf, uint32_t *size);
 static int SPIInitialize(void *specificData, uint8_t clearBus);
 static int SPIConfigure(void *specificData, void *configData);
@@ -123,6 +126,12 @@ int InitDeviceAsSPI(PhysicalDevice *device)
     device->configure = SPIConfigure;
     device->waitable = SPIGetWaitEvent;
 
+    if (device->configParams != NULL) {
+        uint32_t bulkReadBytes = device->configParams->spiBulkReadBytes;
+
+        ((SPIHandle *)device->deviceHandle)->bulkReadBytes = (bulkReadBytes > SPI_BULK_READ_MAX) ? SPI_BULK_READ_MAX : bulkReadBytes;
+    }
+
     return HSDK_ERROR_SUCCESS;
 }
 
@@ -422,6 +431,152 @@ static int SPIReadFSCIData(SPIHandle *device, uint8_t *buffer, uint32_t *count)
 }
 
 
+/*! *********************************************************************************
+* \brief  Clock in bytes from the SPI device with a single full-duplex transfer.
+*
+* \param[in]  device   a pointer to the SPI device
+* \param[out] buffer   a byte array where the data shall be read into
+* \param[in]  count    number of bytes to be read
+*
+* \return 0 for success, -1 for failure
+********************************************************************************** */
+static int SPITransfer(SPIHandle *device, uint8_t *buffer, uint32_t count)
+{
+    struct spi_ioc_transfer xfer;
+
+    memset(&xfer, 0, sizeof(xfer));
+    xfer.rx_buf = (unsigned long)buffer;
+    xfer.len = count;
+
+    if (ioctl(device->portHandle, SPI_IOC_MESSAGE(1), &xfer) < 0) {
+        logMessage(HSDK_WARNING, "[SPIDevice]SPITransfer", strerror(errno), HSDKThreadId());
+        return HSDK_ERROR_INVALID;
+    }
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+/*! *********************************************************************************
+* \brief  Bulk variant of SPIReadFSCIData. Windows of bulkReadBytes are clocked in
+*         one transfer each and every FSCI frame they hold is kept, packed at the start
+*         of buffer. Only the rest of a frame cut by the end of a window is read on its
+*         own. Reading stops after a window ending with a header worth of 0xFF.
+*
+* \param[in]     device     a pointer to the SPI device
+* \param[in,out] buffer     a byte array where the data shall be read into
+* \param[in]     capacity   the size of buffer
+* \param[out]    count      number of bytes successfully read
+*
+* \return a positive integer for success, -1 for failure
+********************************************************************************** */
+static int SPIBulkReadFSCIData(SPIHandle *device, uint8_t *buffer, uint32_t capacity, uint32_t *count)
+{
+    int rc = HSDK_ERROR_SUCCESS;
+    uint32_t fsci_header_len = 3 + device->lengthFieldSize;
+    uint32_t idle = 0, window, pos, end, start, have, frame_len;
+    uint8_t warned = 0;
+
+    *count = 0;
+
+    while (idle < fsci_header_len) {
+        window = device->bulkReadBytes;
+
+        if (window > capacity - *count) {
+            window = capacity - *count;
+        }
+
+        if (window < fsci_header_len) {
+            logMessage(HSDK_WARNING, "[SPIDevice]SPIBulkReadFSCIData", "RX buffer full - reading resumes on the next interrupt", HSDKThreadId());
+            break;
+        }
+
+        /* The window lands right after the frames kept so far. */
+        rc = SPITransfer(device, buffer + *count, window);
+
+        if (rc != HSDK_ERROR_SUCCESS) {
+            break;
+        }
+
+        pos = *count;
+        end = *count + window;
+
+        /* Frames may follow an idle run inside the window, so all of it is scanned. */
+        while (pos < end) {
+            if (buffer[pos] == 0xFF) {
+                idle++;
+                pos++;
+                continue;
+            }
+
+            idle = 0;
+
+            if (buffer[pos] != 0x02) {
+                if (!warned) {
+                    logMessage(HSDK_WARNING, "[SPIDevice]SPIBulkReadFSCIData", "Unexpected bytes - skipped", HSDKThreadId());
+                    warned = 1;
+                }
+
+                pos++;
+                continue;
+            }
+
+            start = pos;
+            have = end - pos;
+
+            if (have < fsci_header_len) {
+                /* The header is cut, read the rest of it. */
+                if (fsci_header_len > capacity - *count) {
+                    logMessage(HSDK_WARNING, "[SPIDevice]SPIBulkReadFSCIData", "Frame does not fit in the RX buffer - frame dismissed", HSDKThreadId());
+                    /* Keep the frames read so far. */
+                    return HSDK_ERROR_SUCCESS;
+                }
+
+                memmove(buffer + *count, buffer + start, have);
+                rc = SPITransfer(device, buffer + *count + have, fsci_header_len - have);
+
+                if (rc != HSDK_ERROR_SUCCESS) {
+                    return rc;
+                }
+
+                start = *count;
+                have = fsci_header_len;
+            }
+
+            if (fsci_header_len == 4) {
+                frame_len = fsci_header_len + buffer[start + 3] + 1;  // +1 for CRC
+            } else {
+                frame_len = fsci_header_len + buffer[start + 3] + (buffer[start + 4] << 8) + 1;  // +1 for CRC
+            }
+
+            if (frame_len > capacity - *count) {
+                logMessage(HSDK_WARNING, "[SPIDevice]SPIBulkReadFSCIData", "Frame does not fit in the RX buffer - frame dismissed", HSDKThreadId());
+                /* Keep the frames read so far. */
+                return HSDK_ERROR_SUCCESS;
+            }
+
+            if (have >= frame_len) {
+                memmove(buffer + *count, buffer + start, frame_len);
+                pos = start + frame_len;
+            } else {
+                /* The frame goes on past the window, read the rest of it alone. */
+                memmove(buffer + *count, buffer + start, have);
+                rc = SPITransfer(device, buffer + *count + have, frame_len - have);
+
+                if (rc != HSDK_ERROR_SUCCESS) {
+                    return rc;
+                }
+
+                pos = end;
+            }
+
+            *count += frame_len;
+        }
+    }
+
+    return rc;
+}
+
+
 /*! *********************************************************************************
 * \brief  Read data from the SPI device.
 *
@@ -436,9 +591,11 @@ static int SPIRead(void *specificData, uint8_t *buffer, uint32_t *count)
     SPIHandle *device = (SPIHandle *)specificData;
 
     int rc = 0;
-    uint32_t temp;
+    uint32_t temp, capacity;
     ssize_t nb;
 
+    /* The size of buffer comes in count, used by the bulk reads. */
+    capacity = *count;
     *count = 0;
 
     /* Read the interrupt. */
@@ -463,7 +620,11 @@ static int SPIRead(void *specificData, uint8_t *buffer, uint32_t *count)
 #endif
 
     /* Process available data. */
-    rc = SPIReadFSCIData(device, buffer, count);
+    if (device->bulkReadBytes) {
+        rc = SPIBulkReadFSCIData(device, buffer, capacity, count);
+    } else {
+        rc = SPIReadFSCIData(device, buffer, count);
+    }
 
 #if DK07_HOST
     csfdrc  = write(csfd, "1", 1);
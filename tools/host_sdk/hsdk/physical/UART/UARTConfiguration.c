@@ -290,6 +290,7 @@ int InitPort(File portHandle, UARTConfigurationData *config)
 
 #elif __linux__ || __APPLE__
 
+#include <errno.h>
 #include <stdio.h>
 #include <string.h>
 #include <sys/ioctl.h>
@@ -424,6 +425,10 @@ int InitPort(File portHandle, UARTConfigurationData *config)
     }
 
     rc = ioctl(portHandle, TIOCMGET, &argp);
+    if (rc == -1 && errno == ENOTTY) {
+        // A pty, e.g. the virtual board demo or socat, has no modem lines to drive.
+        return 0;
+    }
     if (rc == -1) {
         perror("InitPort ioctl(portHandle, TIOCMGET, &argp)");
         return -1;
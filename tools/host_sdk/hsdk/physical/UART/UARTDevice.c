@@ -40,6 +40,7 @@ static void InitDeviceAsUART(PhysicalDevice *device);
 static int UARTOpenPort(void *pDevice, void *configData);
 static int UARTClosePort(void *pDevice);
 static int UARTWrite(void *specificData, uint8_t *buf, uint32_t size);
+static int UARTWriteVector(void *specificData, uint8_t **buffers, uint32_t *counts, uint32_t cBuffers);
 static int UARTRead(void *specificData, uint8_t *buf, uint32_t *size);
 static int UARTConfigure(void *specificData, void *configData);
 static Event UARTGetWaitEvent(void *, void **);
@@ -97,6 +98,7 @@ int DetachFromUARTDevice(PhysicalDevice *pDevice)
     pDevice->close = NULL;
     pDevice->read = NULL;
     pDevice->write = NULL;
+    pDevice->writeVector = NULL;
     pDevice->configure = NULL;
 
     return HSDK_ERROR_SUCCESS;
@@ -113,6 +115,7 @@ void InitDeviceAsUART(PhysicalDevice *device)
     device->close = UARTClosePort;
     device->read = UARTRead;
     device->write = UARTWrite;
+    device->writeVector = UARTWriteVector;
     device->configure = UARTConfigure;
     device->waitable = UARTGetWaitEvent;
 }
@@ -278,6 +281,28 @@ static int UARTWrite(void *specificData, uint8_t *buffer, uint32_t count)
     return err;
 }
 
+/*! *********************************************************************************
+* \brief  Write several buffers to the UART device with a single gather write.
+*
+* \param[in] specificData   a pointer to the UART device
+* \param[in] buffers        the byte arrays to be sent, in order
+* \param[in] counts         number of bytes of each array
+* \param[in] cBuffers       number of arrays
+*
+* \return a positive integer for success, -1 for failure
+********************************************************************************** */
+static int UARTWriteVector(void *specificData, uint8_t **buffers, uint32_t *counts, uint32_t cBuffers)
+{
+    UARTHandle *device = (UARTHandle *)specificData;
+
+    int err = HSDKWriteFileVector(device->portHandle, buffers, counts, cBuffers);
+
+    if (err == -1) {
+        logMessage(HSDK_WARNING, "[UARTDevice]UARTWriteVector", "Error writing data to port", HSDKThreadId());
+    }
+    return err;
+}
+
 /*! *********************************************************************************
 * \brief  Read data to the UART device.
 *
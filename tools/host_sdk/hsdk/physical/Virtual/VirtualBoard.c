@@ -0,0 +1,784 @@
+/*
+ * \file VirtualBoard.c
+ * This is a source file for the VirtualBoard module.
+ *
+ * Emulates a board on the other end of a socketpair or pty: it answers the FSCI
+ * commands from a reply table, optionally through an in-process handler first, and
+ * sends streams of frames at a target rate.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/************************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+************************************************************************************/
+#define _GNU_SOURCE
+
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "VirtualBoard.h"
+#include "utils.h"
+
+#include "hsdkError.h"
+#include "hsdkLogger.h"
+
+/************************************************************************************
+*************************************************************************************
+* Private macros
+*************************************************************************************
+************************************************************************************/
+#define FSCI_SYNC               0x02
+#define FSCI_HEADER_SIZE        5       /* sync, opGroup, opCode, 2 bytes of length */
+#define FSCI_FRAME_SIZE(len)    (FSCI_HEADER_SIZE + (uint32_t)(len) + 1)
+
+#define RX_BUFFER_SIZE          (2 * FSCI_FRAME_SIZE(VIRTUAL_MAX_PAYLOAD))
+#define TX_BUFFER_SIZE          4096
+#define MAX_SCRIPT_LINE         4096
+
+/* A stream further behind than this restarts from now instead of catching up. */
+#define MAX_STREAM_LAG_NS       1000000000ULL
+
+/************************************************************************************
+*************************************************************************************
+* Private prototypes
+*************************************************************************************
+************************************************************************************/
+static void *BoardThreadRoutine(void *lpParam);
+static int QueueFrame(VirtualBoard *board, uint8_t opGroup, uint8_t opCode, const uint8_t *payload, uint16_t length);
+static void FlushOutput(VirtualBoard *board);
+static void HandleCommand(VirtualBoard *board, uint8_t opGroup, uint8_t opCode, uint8_t *payload, uint16_t length);
+static void ParseCommands(VirtualBoard *board);
+static int64_t RunStreams(VirtualBoard *board);
+static int ParseHex(char *text, uint8_t *out, uint32_t *length);
+
+/************************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+************************************************************************************/
+
+/*! *********************************************************************************
+* \brief  Creates a board, with the replies and streams of a script.
+*
+* \param[in] scriptPath  the script to load, NULL or empty for an empty board
+*
+* \return the board, NULL on failure
+********************************************************************************** */
+VirtualBoard *CreateVirtualBoard(const char *scriptPath)
+{
+    VirtualBoard *board = (VirtualBoard *)calloc(1, sizeof(VirtualBoard));
+
+    if (board == NULL) {
+        logMessage(HSDK_ERROR, "[VirtualBoard]CreateVirtualBoard", "Memory allocation failed", HSDKThreadId());
+        return NULL;
+    }
+
+    HSDKInvalidateDescriptor(&board->handle);
+    board->lock = HSDKCreateLock();
+    board->stopThread = HSDKCreateEvent(0);
+    board->rxBuffer = (uint8_t *)malloc(RX_BUFFER_SIZE);
+    board->txBuffer = (uint8_t *)malloc(TX_BUFFER_SIZE);
+    board->txSize = TX_BUFFER_SIZE;
+
+    if (board->lock == NULL || board->stopThread == INVALID_EVENT_HANDLE ||
+            board->rxBuffer == NULL || board->txBuffer == NULL) {
+        logMessage(HSDK_ERROR, "[VirtualBoard]CreateVirtualBoard", "Resource allocation failed", HSDKThreadId());
+        DestroyVirtualBoard(board);
+        return NULL;
+    }
+
+    if (scriptPath && *scriptPath && VirtualBoardLoadScript(board, scriptPath) != HSDK_ERROR_SUCCESS) {
+        DestroyVirtualBoard(board);
+        return NULL;
+    }
+
+    return board;
+}
+
+/*! *********************************************************************************
+* \brief  Stops the board if running and frees it.
+*
+* \param[in] board  the board
+*
+* \return HSDK_ERROR_SUCCESS, HSDK_ERROR_INVALID if board is NULL
+********************************************************************************** */
+int DestroyVirtualBoard(VirtualBoard *board)
+{
+    uint32_t i;
+
+    if (board == NULL) {
+        logMessage(HSDK_ERROR, "[VirtualBoard]DestroyVirtualBoard", "Argument is null", HSDKThreadId());
+        return HSDK_ERROR_INVALID;
+    }
+
+    if (HSDKIsDescriptorValid(board->handle)) {
+        VirtualBoardStop(board);
+    }
+
+    for (i = 0; i < board->cReplies; i++) {
+        free(board->replies[i].payload);
+    }
+
+    for (i = 0; i < board->cStreams; i++) {
+        free(board->streams[i].payload);
+    }
+
+    free(board->replies);
+    free(board->streams);
+    free(board->triggers);
+    free(board->rxBuffer);
+    free(board->txBuffer);
+
+    if (board->stopThread != INVALID_EVENT_HANDLE) {
+        HSDKDestroyEvent(board->stopThread);
+    }
+
+    if (board->lock != NULL) {
+        HSDKDestroyLock(board->lock);
+        free(board->lock);
+    }
+
+    free(board);
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+/*! *********************************************************************************
+* \brief  Adds the replies, streams and triggers of a script to the board. One entry
+*         per line, numbers in hexadecimal except the rate, '#' starts a comment:
+*
+*         reply  <cmd OG> <cmd OC> <OG> <OC> [payload]
+*         stream <frames per second> <OG> <OC> [payload]
+*         start  <cmd OG> <cmd OC> <stream index>
+*         stop   <cmd OG> <cmd OC> <stream index>
+*
+*         The payload is a sequence of hexadecimal bytes, spaces are ignored. Streams
+*         are numbered from 0 in the order of the script; a stream named by a start
+*         line waits for its command, the others run as soon as the board starts.
+*
+* \param[in] board       the board
+* \param[in] scriptPath  the path of the script
+*
+* \return HSDK_ERROR_SUCCESS, HSDK_ERROR_INVALID if the script cannot be read or parsed
+********************************************************************************** */
+int VirtualBoardLoadScript(VirtualBoard *board, const char *scriptPath)
+{
+    uint8_t *payload;
+    char line[MAX_SCRIPT_LINE], message[128];
+    uint32_t lineNo = 0;
+    int rc = HSDK_ERROR_SUCCESS;
+    FILE *f = fopen(scriptPath, "r");
+
+    if (f == NULL) {
+        logMessage(HSDK_ERROR, "[VirtualBoard]VirtualBoardLoadScript", "Cannot open the script", HSDKThreadId());
+        return HSDK_ERROR_INVALID;
+    }
+
+    payload = (uint8_t *)malloc(VIRTUAL_MAX_PAYLOAD);
+
+    if (payload == NULL) {
+        fclose(f);
+        return HSDK_ERROR_ALLOC;
+    }
+
+    while (rc == HSDK_ERROR_SUCCESS && fgets(line, sizeof(line), f)) {
+        char keyword[16], *rest;
+        unsigned int a, b, c, d;
+        uint32_t length = 0;
+        int n = 0;
+
+        lineNo++;
+
+        if ((rest = strchr(line, '#')) != NULL) {
+            *rest = '\0';
+        }
+
+        if (sscanf(line, "%15s%n", keyword, &n) != 1) {
+            continue;
+        }
+
+        rest = line + n;
+
+        if (!strcmp(keyword, "reply") && sscanf(rest, "%x %x %x %x%n", &a, &b, &c, &d, &n) == 4 &&
+                ParseHex(rest + n, payload, &length) == 0) {
+            rc = VirtualBoardAddReply(board, a, b, c, d, payload, (uint16_t)length);
+        } else if (!strcmp(keyword, "stream") && sscanf(rest, "%u %x %x%n", &a, &b, &c, &n) == 3 &&
+                   ParseHex(rest + n, payload, &length) == 0) {
+            rc = VirtualBoardAddStream(board, a, b, c, payload, (uint16_t)length, 1) < 0 ? HSDK_ERROR_INVALID : HSDK_ERROR_SUCCESS;
+        } else if ((!strcmp(keyword, "start") || !strcmp(keyword, "stop")) &&
+                   sscanf(rest, "%x %x %u", &a, &b, &c) == 3) {
+            rc = VirtualBoardAddTrigger(board, a, b, c, !strcmp(keyword, "start"));
+        } else {
+            rc = HSDK_ERROR_INVALID;
+        }
+
+        if (rc != HSDK_ERROR_SUCCESS) {
+            snprintf(message, sizeof(message), "Invalid entry at line %u of the script", lineNo);
+            logMessage(HSDK_ERROR, "[VirtualBoard]VirtualBoardLoadScript", message, HSDKThreadId());
+        }
+    }
+
+    free(payload);
+    fclose(f);
+
+    return rc;
+}
+
+/*! *********************************************************************************
+* \brief  Adds a frame sent when a command is received. Several replies to the same
+*         command are sent in the order they were added.
+*
+* \return HSDK_ERROR_SUCCESS, HSDK_ERROR_ALLOC
+********************************************************************************** */
+int VirtualBoardAddReply(VirtualBoard *board, uint8_t cmdOpGroup, uint8_t cmdOpCode,
+                         uint8_t opGroup, uint8_t opCode, const uint8_t *payload, uint16_t length)
+{
+    VirtualReply *replies, *reply;
+    uint8_t *copy = (uint8_t *)malloc(length ? length : 1);
+
+    if (copy == NULL) {
+        return HSDK_ERROR_ALLOC;
+    }
+
+    memcpy(copy, payload, length);
+    HSDKAcquireLock(board->lock);
+
+    replies = (VirtualReply *)realloc(board->replies, (board->cReplies + 1) * sizeof(VirtualReply));
+
+    if (replies == NULL) {
+        HSDKReleaseLock(board->lock);
+        free(copy);
+        return HSDK_ERROR_ALLOC;
+    }
+
+    board->replies = replies;
+    reply = &replies[board->cReplies++];
+    reply->cmdOpGroup = cmdOpGroup;
+    reply->cmdOpCode = cmdOpCode;
+    reply->opGroup = opGroup;
+    reply->opCode = opCode;
+    reply->length = length;
+    reply->payload = copy;
+
+    HSDKReleaseLock(board->lock);
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+/*! *********************************************************************************
+* \brief  Adds a frame sent rate times per second while the stream runs.
+*
+* \param[in] running  1 to run from the start of the board, 0 to wait for a trigger
+*
+* \return the index of the stream, -1 on failure
+********************************************************************************** */
+int VirtualBoardAddStream(VirtualBoard *board, uint32_t rate, uint8_t opGroup, uint8_t opCode,
+                          const uint8_t *payload, uint16_t length, uint8_t running)
+{
+    VirtualStream *streams, *stream;
+    uint8_t *copy;
+    int index;
+
+    if (rate == 0) {
+        logMessage(HSDK_ERROR, "[VirtualBoard]VirtualBoardAddStream", "The rate of a stream must not be 0", HSDKThreadId());
+        return -1;
+    }
+
+    copy = (uint8_t *)malloc(length ? length : 1);
+
+    if (copy == NULL) {
+        return -1;
+    }
+
+    memcpy(copy, payload, length);
+    HSDKAcquireLock(board->lock);
+
+    streams = (VirtualStream *)realloc(board->streams, (board->cStreams + 1) * sizeof(VirtualStream));
+
+    if (streams == NULL) {
+        HSDKReleaseLock(board->lock);
+        free(copy);
+        return -1;
+    }
+
+    board->streams = streams;
+    index = (int)board->cStreams++;
+    stream = &streams[index];
+    memset(stream, 0, sizeof(VirtualStream));
+    stream->rate = rate;
+    stream->opGroup = opGroup;
+    stream->opCode = opCode;
+    stream->length = length;
+    stream->payload = copy;
+    stream->running = running;
+    stream->nextNs = MonotonicTimeNs();
+
+    HSDKReleaseLock(board->lock);
+
+    return index;
+}
+
+/*! *********************************************************************************
+* \brief  Starts or stops a stream when a command is received. A stream with a start
+*         trigger does not run until its command is received.
+*
+* \return HSDK_ERROR_SUCCESS, HSDK_ERROR_INVALID for an unknown stream, HSDK_ERROR_ALLOC
+********************************************************************************** */
+int VirtualBoardAddTrigger(VirtualBoard *board, uint8_t cmdOpGroup, uint8_t cmdOpCode, uint32_t stream, uint8_t start)
+{
+    VirtualTrigger *triggers, *trigger;
+
+    HSDKAcquireLock(board->lock);
+
+    if (stream >= board->cStreams) {
+        HSDKReleaseLock(board->lock);
+        logMessage(HSDK_ERROR, "[VirtualBoard]VirtualBoardAddTrigger", "Unknown stream", HSDKThreadId());
+        return HSDK_ERROR_INVALID;
+    }
+
+    triggers = (VirtualTrigger *)realloc(board->triggers, (board->cTriggers + 1) * sizeof(VirtualTrigger));
+
+    if (triggers == NULL) {
+        HSDKReleaseLock(board->lock);
+        return HSDK_ERROR_ALLOC;
+    }
+
+    board->triggers = triggers;
+    trigger = &triggers[board->cTriggers++];
+    trigger->cmdOpGroup = cmdOpGroup;
+    trigger->cmdOpCode = cmdOpCode;
+    trigger->stream = stream;
+    trigger->start = start;
+
+    if (start) {
+        board->streams[stream].running = 0;
+    }
+
+    HSDKReleaseLock(board->lock);
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+/*! *********************************************************************************
+* \brief  Sets the function given every command before the reply table.
+*
+* \param[in] handler  the handler, NULL to only use the reply table
+* \param[in] context  passed to the handler
+********************************************************************************** */
+void VirtualBoardSetHandler(VirtualBoard *board, VirtualCommandHandler handler, void *context)
+{
+    HSDKAcquireLock(board->lock);
+    board->handler = handler;
+    board->handlerContext = context;
+    HSDKReleaseLock(board->lock);
+}
+
+/*! *********************************************************************************
+* \brief  Sends a frame to the host, from a handler or from any other thread.
+*
+* \return HSDK_ERROR_SUCCESS, HSDK_ERROR_ALLOC
+********************************************************************************** */
+int VirtualBoardSend(VirtualBoard *board, uint8_t opGroup, uint8_t opCode, const uint8_t *payload, uint16_t length)
+{
+    int rc;
+
+    HSDKAcquireLock(board->lock);
+    rc = QueueFrame(board, opGroup, opCode, payload, length);
+
+    if (HSDKIsDescriptorValid(board->handle)) {
+        FlushOutput(board);
+    }
+
+    HSDKReleaseLock(board->lock);
+
+    return rc;
+}
+
+/*! *********************************************************************************
+* \brief  Starts serving the board end of a link. The handle is made non-blocking
+*         and is not closed by the board.
+*
+* \param[in] handle  e.g. one end of a socketpair or the master of a pty
+*
+* \return HSDK_ERROR_SUCCESS, HSDK_ERROR_INVALID if already started or the thread fails
+********************************************************************************** */
+int VirtualBoardStart(VirtualBoard *board, File handle)
+{
+    uint64_t now = MonotonicTimeNs();
+    uint32_t i;
+
+    if (HSDKIsDescriptorValid(board->handle) || !HSDKIsDescriptorValid(handle)) {
+        logMessage(HSDK_ERROR, "[VirtualBoard]VirtualBoardStart", "Already started or invalid handle", HSDKThreadId());
+        return HSDK_ERROR_INVALID;
+    }
+
+    fcntl(handle, F_SETFL, fcntl(handle, F_GETFL) | O_NONBLOCK);
+
+    HSDKAcquireLock(board->lock);
+
+    board->handle = handle;
+    board->hostClosed = 0;
+    board->rxLength = 0;
+
+    for (i = 0; i < board->cStreams; i++) {
+        board->streams[i].nextNs = now;
+    }
+
+    HSDKReleaseLock(board->lock);
+
+    board->boardThread = HSDKCreateThread(BoardThreadRoutine, board);
+
+    if (!board->boardThread) {
+        logMessage(HSDK_ERROR, "[VirtualBoard]VirtualBoardStart", "Thread creation failed", HSDKThreadId());
+        HSDKInvalidateDescriptor(&board->handle);
+        return HSDK_ERROR_INVALID;
+    }
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+/*! *********************************************************************************
+* \brief  Stops serving the link. Output not written yet is discarded.
+*
+* \return HSDK_ERROR_SUCCESS, HSDK_ERROR_INVALID if not started
+********************************************************************************** */
+int VirtualBoardStop(VirtualBoard *board)
+{
+    char message[128];
+
+    if (!HSDKIsDescriptorValid(board->handle)) {
+        return HSDK_ERROR_INVALID;
+    }
+
+    HSDKSignalEvent(board->stopThread);
+    HSDKDestroyThread(board->boardThread);
+    HSDKResetEvent(board->stopThread);
+
+    HSDKAcquireLock(board->lock);
+    HSDKInvalidateDescriptor(&board->handle);
+    board->txHead = board->txTail = 0;
+    HSDKReleaseLock(board->lock);
+
+    snprintf(message, sizeof(message), "%llu commands received, %llu without reply",
+             (unsigned long long)board->commands, (unsigned long long)board->unanswered);
+    logMessage(HSDK_INFO, "[VirtualBoard]VirtualBoardStop", message, HSDKThreadId());
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+/************************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+************************************************************************************/
+
+/*! *********************************************************************************
+* \brief  Waits for commands and for the next stream frame, until stopThread.
+********************************************************************************** */
+static void *BoardThreadRoutine(void *lpParam)
+{
+    VirtualBoard *board = (VirtualBoard *)lpParam;
+    struct pollfd fds[2];
+    int64_t timeoutMs = 0;
+
+    fds[0].fd = board->stopThread->event;
+    fds[0].events = POLLIN;
+    fds[1].fd = board->handle;
+
+    while (1) {
+        int rc;
+
+        HSDKAcquireLock(board->lock);
+        fds[1].events = POLLIN | (board->txHead != board->txTail ? POLLOUT : 0);
+        HSDKReleaseLock(board->lock);
+
+        rc = poll(fds, 2, (int)timeoutMs);
+
+        if (rc == -1 && errno != EINTR) {
+            logMessage(HSDK_ERROR, "[VirtualBoard]BoardThreadRoutine", strerror(errno), HSDKThreadId());
+            break;
+        }
+
+        if (rc > 0 && (fds[0].revents & POLLIN)) {
+            break;
+        }
+
+        if (rc > 0 && (fds[1].revents & (POLLIN | POLLHUP))) {
+            ssize_t cb = read(board->handle, board->rxBuffer + board->rxLength, RX_BUFFER_SIZE - board->rxLength);
+
+            if (cb > 0) {
+                board->rxLength += (uint32_t)cb;
+                ParseCommands(board);
+            } else if (cb == 0 || (errno != EAGAIN && errno != EINTR)) {
+                /* The host end was closed, writing to it would raise SIGPIPE. */
+                HSDKAcquireLock(board->lock);
+                board->hostClosed = 1;
+                HSDKReleaseLock(board->lock);
+                fds[1].fd = -1;
+            }
+        }
+
+        timeoutMs = RunStreams(board);
+
+        HSDKAcquireLock(board->lock);
+        FlushOutput(board);
+        HSDKReleaseLock(board->lock);
+    }
+
+    return NULL;
+}
+
+/*! *********************************************************************************
+* \brief  Appends a frame to the output. The board lock must be held.
+********************************************************************************** */
+static int QueueFrame(VirtualBoard *board, uint8_t opGroup, uint8_t opCode, const uint8_t *payload, uint16_t length)
+{
+    uint32_t size = FSCI_FRAME_SIZE(length), i;
+    uint8_t *out, crc = 0;
+
+    if (board->txHead == board->txTail) {
+        board->txHead = board->txTail = 0;
+    }
+
+    if (board->txTail + size > board->txSize && board->txHead) {
+        memmove(board->txBuffer, board->txBuffer + board->txHead, board->txTail - board->txHead);
+        board->txTail -= board->txHead;
+        board->txHead = 0;
+    }
+
+    if (board->txTail + size > board->txSize) {
+        uint32_t grown = board->txSize * 2 > board->txTail + size ? board->txSize * 2 : board->txTail + size;
+        uint8_t *buffer = (uint8_t *)realloc(board->txBuffer, grown);
+
+        if (buffer == NULL) {
+            logMessage(HSDK_ERROR, "[VirtualBoard]QueueFrame", "Memory allocation failed", HSDKThreadId());
+            return HSDK_ERROR_ALLOC;
+        }
+
+        board->txBuffer = buffer;
+        board->txSize = grown;
+    }
+
+    out = board->txBuffer + board->txTail;
+    out[0] = FSCI_SYNC;
+    out[1] = opGroup;
+    out[2] = opCode;
+    out[3] = length & 0xFF;
+    out[4] = length >> 8;
+    memcpy(out + FSCI_HEADER_SIZE, payload, length);
+
+    for (i = 1; i < FSCI_HEADER_SIZE + (uint32_t)length; i++) {
+        crc ^= out[i];
+    }
+
+    out[FSCI_HEADER_SIZE + length] = crc;
+    board->txTail += size;
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+/*! *********************************************************************************
+* \brief  Writes as much of the output as the link takes. The board lock must be held.
+********************************************************************************** */
+static void FlushOutput(VirtualBoard *board)
+{
+    if (board->hostClosed) {
+        board->txHead = board->txTail;
+        return;
+    }
+
+    while (board->txHead != board->txTail) {
+        ssize_t cb = write(board->handle, board->txBuffer + board->txHead, board->txTail - board->txHead);
+
+        if (cb <= 0) {
+            break;
+        }
+
+        board->txHead += (uint32_t)cb;
+    }
+}
+
+/*! *********************************************************************************
+* \brief  Answers a command with the handler, else with the reply table, and runs the
+*         triggers of the command in both cases.
+********************************************************************************** */
+static void HandleCommand(VirtualBoard *board, uint8_t opGroup, uint8_t opCode, uint8_t *payload, uint16_t length)
+{
+    VirtualCommandHandler handler;
+    void *context;
+    int handled = 0, answered = 0;
+    uint32_t i;
+
+    board->commands++;
+
+    HSDKAcquireLock(board->lock);
+    handler = board->handler;
+    context = board->handlerContext;
+    HSDKReleaseLock(board->lock);
+
+    /* Called unlocked, so that it can use VirtualBoardSend. */
+    if (handler) {
+        handled = handler(context, board, opGroup, opCode, payload, length);
+    }
+
+    HSDKAcquireLock(board->lock);
+
+    for (i = 0; i < board->cReplies; i++) {
+        VirtualReply *reply = &board->replies[i];
+
+        if (!handled && reply->cmdOpGroup == opGroup && reply->cmdOpCode == opCode) {
+            QueueFrame(board, reply->opGroup, reply->opCode, reply->payload, reply->length);
+            answered = 1;
+        }
+    }
+
+    for (i = 0; i < board->cTriggers; i++) {
+        VirtualTrigger *trigger = &board->triggers[i];
+
+        if (trigger->cmdOpGroup == opGroup && trigger->cmdOpCode == opCode) {
+            VirtualStream *stream = &board->streams[trigger->stream];
+
+            if (trigger->start && !stream->running) {
+                stream->nextNs = MonotonicTimeNs();
+            }
+
+            stream->running = trigger->start;
+            answered = 1;
+        }
+    }
+
+    HSDKReleaseLock(board->lock);
+
+    if (!handled && !answered) {
+        board->unanswered++;
+    }
+}
+
+/*! *********************************************************************************
+* \brief  Handles the complete commands at the start of rxBuffer and keeps the rest.
+*         Bytes that cannot start a frame are skipped, the checksum is not verified.
+********************************************************************************** */
+static void ParseCommands(VirtualBoard *board)
+{
+    uint32_t offset = 0;
+
+    while (offset < board->rxLength) {
+        uint8_t *frame = board->rxBuffer + offset;
+        uint16_t length;
+
+        if (frame[0] != FSCI_SYNC) {
+            offset++;
+            continue;
+        }
+
+        if (board->rxLength - offset < FSCI_HEADER_SIZE) {
+            break;
+        }
+
+        length = frame[3] | (frame[4] << 8);
+
+        if (board->rxLength - offset < FSCI_FRAME_SIZE(length)) {
+            break;
+        }
+
+        HandleCommand(board, frame[1], frame[2], frame + FSCI_HEADER_SIZE, length);
+        offset += FSCI_FRAME_SIZE(length);
+    }
+
+    memmove(board->rxBuffer, board->rxBuffer + offset, board->rxLength - offset);
+    board->rxLength -= offset;
+}
+
+/*! *********************************************************************************
+* \brief  Queues the frames of the running streams which are due.
+*
+* \return the time until the next frame is due, in milliseconds
+********************************************************************************** */
+static int64_t RunStreams(VirtualBoard *board)
+{
+    uint64_t now = MonotonicTimeNs(), next = now + VIRTUAL_IDLE_MS * 1000000ULL;
+    uint32_t i;
+
+    HSDKAcquireLock(board->lock);
+
+    for (i = 0; i < board->cStreams; i++) {
+        VirtualStream *stream = &board->streams[i];
+        uint64_t periodNs = 1000000000ULL / stream->rate;
+
+        if (!stream->running) {
+            continue;
+        }
+
+        if (now > stream->nextNs + MAX_STREAM_LAG_NS) {
+            stream->nextNs = now;
+        }
+
+        while (stream->nextNs <= now) {
+            if (board->txTail - board->txHead > VIRTUAL_MAX_BACKLOG) {
+                stream->dropped++;
+            } else if (QueueFrame(board, stream->opGroup, stream->opCode, stream->payload, stream->length) == HSDK_ERROR_SUCCESS) {
+                stream->sent++;
+            }
+
+            stream->nextNs += periodNs ? periodNs : 1;
+        }
+
+        if (stream->nextNs < next) {
+            next = stream->nextNs;
+        }
+    }
+
+    HSDKReleaseLock(board->lock);
+
+    /* Rounded up, the frames due meanwhile are sent together. */
+    return (int64_t)((next - now + 999999) / 1000000);
+}
+
+/*! *********************************************************************************
+* \brief  Parses hexadecimal bytes, spaces between the bytes are allowed.
+*
+* \return 0, -1 for an odd number of digits, another character or too many bytes
+********************************************************************************** */
+static int ParseHex(char *text, uint8_t *out, uint32_t *length)
+{
+    int high = -1;
+
+    *length = 0;
+
+    for (; *text; text++) {
+        int digit;
+
+        if (isspace((unsigned char)*text)) {
+            continue;
+        }
+
+        if (!isxdigit((unsigned char)*text)) {
+            return -1;
+        }
+
+        digit = isdigit((unsigned char)*text) ? *text - '0' : (tolower((unsigned char)*text) - 'a' + 10);
+
+        if (high < 0) {
+            high = digit;
+        } else if (*length == VIRTUAL_MAX_PAYLOAD) {
+            return -1;
+        } else {
+            out[(*length)++] = (uint8_t)(high << 4 | digit);
+            high = -1;
+        }
+    }
+
+    return high < 0 ? 0 : -1;
+}
@@ -0,0 +1,254 @@
+/*
+ * \file VirtualDevice.c
+ * This is a source file for the VirtualDevice module.
+ *
+ * A PhysicalDevice backed by a socketpair, whose other end is served by a
+ * VirtualBoard instead of a real board.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/************************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+************************************************************************************/
+#define _GNU_SOURCE
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+
+#include "PhysicalDevice.h"
+#include "VirtualDevice.h"
+
+#include "hsdkError.h"
+#include "hsdkLogger.h"
+
+/************************************************************************************
+*************************************************************************************
+* Private prototypes
+*************************************************************************************
+************************************************************************************/
+static void InitDeviceAsVirtual(PhysicalDevice *device);
+static int VirtualOpen(void *pDevice, void *configData);
+static int VirtualClose(void *pDevice);
+static int VirtualWrite(void *specificData, uint8_t *buf, uint32_t size);
+static int VirtualWriteVector(void *specificData, uint8_t **buffers, uint32_t *counts, uint32_t cBuffers);
+static int VirtualRead(void *specificData, uint8_t *buf, uint32_t *size);
+static int VirtualConfigure(void *specificData, void *configData);
+static Event VirtualGetWaitEvent(void *, void **);
+
+/************************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+************************************************************************************/
+
+/*! *********************************************************************************
+* \brief  Creates the board behind a VIRTUAL device.
+*
+* \param[in] deviceName  the script of the board, optionally after VIRTUAL_DEVICE_PREFIX;
+*                        "virtual" alone or an empty name give a board without script
+*
+* \return HSDK_ERROR_SUCCESS, HSDK_ERROR_ALLOC, HSDK_ERROR_INVALID for a bad script
+********************************************************************************** */
+int AttachToVirtualDevice(PhysicalDevice *pDevice, char *deviceName)
+{
+    const char *script = deviceName ? deviceName : "";
+    VirtualHandle *device;
+
+    if (!strncmp(script, VIRTUAL_DEVICE_PREFIX, strlen(VIRTUAL_DEVICE_PREFIX))) {
+        script += strlen(VIRTUAL_DEVICE_PREFIX);
+    } else if (!strcmp(script, "virtual")) {
+        script = "";
+    }
+
+    device = (VirtualHandle *)calloc(1, sizeof(VirtualHandle));
+
+    if (!device) {
+        logMessage(HSDK_ERROR, "[VirtualDevice]AttachToVirtualDevice", "Memory allocation failed", HSDKThreadId());
+        return HSDK_ERROR_ALLOC;
+    }
+
+    device->board = CreateVirtualBoard(script);
+
+    if (!device->board) {
+        free(device);
+        return HSDK_ERROR_INVALID;
+    }
+
+    HSDKInvalidateDescriptor(&device->portHandle);
+    HSDKInvalidateDescriptor(&device->boardHandle);
+    pDevice->deviceHandle = device;
+    InitDeviceAsVirtual(pDevice);
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+int DetachFromVirtualDevice(PhysicalDevice *pDevice)
+{
+    VirtualHandle *device = (VirtualHandle *)pDevice->deviceHandle;
+
+    if (!device) {
+        logMessage(HSDK_ERROR, "[VirtualDevice]DetachFromVirtualDevice", "Argument is null", HSDKThreadId());
+        return HSDK_ERROR_INVALID;
+    }
+
+    if (HSDKIsDescriptorValid(device->portHandle)) {
+        VirtualClose(device);
+    }
+
+    DestroyVirtualBoard(device->board);
+    free(device);
+
+    pDevice->deviceHandle = NULL;
+    pDevice->open = NULL;
+    pDevice->close = NULL;
+    pDevice->read = NULL;
+    pDevice->write = NULL;
+    pDevice->writeVector = NULL;
+    pDevice->configure = NULL;
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+/*! *********************************************************************************
+* \brief  Gives the board of a VIRTUAL device, to add replies, streams or a command
+*         handler from the application.
+*
+* \return the board, NULL if the device is not VIRTUAL
+********************************************************************************** */
+VirtualBoard *VirtualDeviceBoard(PhysicalDevice *pDevice)
+{
+    if (!pDevice || pDevice->type != VIRTUAL || !pDevice->deviceHandle) {
+        return NULL;
+    }
+
+    return ((VirtualHandle *)pDevice->deviceHandle)->board;
+}
+
+/************************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+************************************************************************************/
+static void InitDeviceAsVirtual(PhysicalDevice *device)
+{
+    device->open = VirtualOpen;
+    device->close = VirtualClose;
+    device->read = VirtualRead;
+    device->write = VirtualWrite;
+    device->writeVector = VirtualWriteVector;
+    device->configure = VirtualConfigure;
+    device->waitable = VirtualGetWaitEvent;
+}
+
+static Event VirtualGetWaitEvent(void *device, void **asyncMask)
+{
+    VirtualHandle *pDevice = (VirtualHandle *)device;
+    return HSDKDeviceTriggerableEvent(pDevice->portHandle, asyncMask);
+}
+
+/*! *********************************************************************************
+* \brief  Creates the socketpair and starts the board on its other end.
+*
+* \param[in] pDevice     pointer to a VirtualHandle
+* \param[in] configData  not used
+*
+* \return HSDK_ERROR_SUCCESS, HSDK_ERROR_INVALID
+********************************************************************************** */
+static int VirtualOpen(void *pDevice, void *configData)
+{
+    VirtualHandle *device = (VirtualHandle *)pDevice;
+    int handles[2];
+
+    if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, handles) == -1) {
+        logMessage(HSDK_ERROR, "[VirtualDevice]VirtualOpen", "socketpair failed", HSDKThreadId());
+        return HSDK_ERROR_INVALID;
+    }
+
+    if (VirtualBoardStart(device->board, handles[1]) != HSDK_ERROR_SUCCESS) {
+        close(handles[0]);
+        close(handles[1]);
+        return HSDK_ERROR_INVALID;
+    }
+
+    device->portHandle = handles[0];
+    device->boardHandle = handles[1];
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+/*! *********************************************************************************
+* \brief  Stops the board and closes both ends of the socketpair.
+*
+* \return HSDK_ERROR_SUCCESS, HSDK_ERROR_INVALID if not opened
+********************************************************************************** */
+static int VirtualClose(void *pDevice)
+{
+    VirtualHandle *device = (VirtualHandle *)pDevice;
+
+    if (device == NULL || !HSDKIsDescriptorValid(device->portHandle)) {
+        logMessage(HSDK_WARNING, "[VirtualDevice]VirtualClose", "Trying to close an already closed device", HSDKThreadId());
+        return HSDK_ERROR_INVALID;
+    }
+
+    VirtualBoardStop(device->board);
+    HSDKCloseFile(device->portHandle);
+    HSDKCloseFile(device->boardHandle);
+    HSDKInvalidateDescriptor(&device->portHandle);
+    HSDKInvalidateDescriptor(&device->boardHandle);
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+static int VirtualWrite(void *specificData, uint8_t *buffer, uint32_t count)
+{
+    VirtualHandle *device = (VirtualHandle *)specificData;
+
+    int err = HSDKWriteFile(device->portHandle, buffer, count);
+
+    if (err == -1) {
+        logMessage(HSDK_WARNING, "[VirtualDevice]VirtualWrite", "Error writing data to the board", HSDKThreadId());
+    }
+    return err;
+}
+
+static int VirtualWriteVector(void *specificData, uint8_t **buffers, uint32_t *counts, uint32_t cBuffers)
+{
+    VirtualHandle *device = (VirtualHandle *)specificData;
+
+    int err = HSDKWriteFileVector(device->portHandle, buffers, counts, cBuffers);
+
+    if (err == -1) {
+        logMessage(HSDK_WARNING, "[VirtualDevice]VirtualWriteVector", "Error writing data to the board", HSDKThreadId());
+    }
+    return err;
+}
+
+static int VirtualRead(void *specificData, uint8_t *buffer, uint32_t *count)
+{
+    VirtualHandle *device = (VirtualHandle *)specificData;
+
+    int err = HSDKReadFile(device->portHandle, buffer, count);
+
+    if (err != HSDK_ERROR_SUCCESS) {
+        logMessage(HSDK_WARNING, "[VirtualDevice]VirtualRead", "Error reading data from the board", HSDKThreadId());
+    }
+    return err;
+}
+
+/*! *********************************************************************************
+* \brief  A virtual board has no line settings, the configuration is ignored.
+*
+* \return HSDK_ERROR_SUCCESS
+********************************************************************************** */
+static int VirtualConfigure(void *specificData, void *configData)
+{
+    return HSDK_ERROR_SUCCESS;
+}
@@ -0,0 +1,295 @@
+/*
+ * \file FSCICursorFramer.c
+ * This is a source file for the FSCICursorFramer module.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/************************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+************************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "hsdkLogger.h"
+#include "utils.h"
+#include "RawFrame.h"
+#include "FSCIFrame.h"
+#include "FSCIFramer.h"
+#include "FSCICursorFramer.h"
+
+/************************************************************************************
+*************************************************************************************
+* Private prototypes
+*************************************************************************************
+************************************************************************************/
+static FrameStatus FSCICursorParseWindow(Framer *framer, FSCIFrame *frame, uint32_t *cbFrame, uint32_t dataSize);
+static FSCIFrame *FSCICursorCopyFrame(Framer *framer, FSCIFrame *parsed);
+
+/************************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+************************************************************************************/
+#if defined __APPLE__ || defined __UCLIBC__
+uint8_t __attribute__((weak)) *FramerGetWindow(Framer *framer, uint32_t cbDemanded, uint32_t *cbWindow)
+{
+    *cbWindow = 0;
+    return NULL;
+}
+void __attribute__((weak)) FramerConsume(Framer *framer, uint32_t cbConsumed)
+{
+}
+#endif
+
+/*! *********************************************************************************
+* \brief    Parses one FSCI frame in place, without allocating or copying anything.
+*           The fields of the caller supplied frame are filled in and its data points
+*           inside pData, so it is only valid as long as pData is.
+*
+* \param[in] pData              contiguous received bytes, starting at the first
+*                               byte not yet parsed
+* \param[in] cbData             the number of bytes in pData
+* \param[in] lengthFieldSize    the size of the length field, 1 or 2 bytes
+* \param[in] crcFieldSize       the size of the checksum field, 1 or 2 bytes
+* \param[in] endian             the endianness of the length and checksum fields
+* \param[out] frame             filled in for VALID_FRAME and INVALID_CRC
+* \param[out] cbFrame           the number of bytes taken by the frame or by the junk
+*                               run found at the start of pData; for
+*                               INSUFFICIENT_DATA, the number of bytes needed
+*
+* \return VALID_FRAME, INVALID_CRC, JUNK_DATA or INSUFFICIENT_DATA
+********************************************************************************** */
+FrameStatus FSCIParseFrame(uint8_t *pData, uint32_t cbData, uint8_t lengthFieldSize, uint8_t crcFieldSize, endianness endian, FSCIFrame *frame, uint32_t *cbFrame)
+{
+    uint32_t cbHeader = FSCI_SYNC_SIZE + FSCI_OGF_SIZE + FSCI_OCF_SIZE + lengthFieldSize;
+    uint32_t length, i;
+    uint8_t *pSync, *pCrc;
+    uint8_t calculatedCRC = 0;
+
+    if (cbData == 0) {
+        *cbFrame = cbHeader;
+        return INSUFFICIENT_DATA;
+    }
+
+    if (pData[0] != FSCI_SYNC_BYTE) {
+        pSync = (uint8_t *)memchr(pData, FSCI_SYNC_BYTE, cbData);
+        *cbFrame = pSync ? (uint32_t)(pSync - pData) : cbData;
+        return JUNK_DATA;
+    }
+
+    if (cbData < cbHeader) {
+        *cbFrame = cbHeader;
+        return INSUFFICIENT_DATA;
+    }
+
+    length = (lengthFieldSize == 1) ? pData[cbHeader - 1] : Read16(pData + FSCI_SYNC_SIZE + FSCI_OGF_SIZE + FSCI_OCF_SIZE, endian);
+
+    /* Protection against very large or desynchronized packets: drop only the SYNC
+       byte, so that a real frame starting inside this header is not lost. */
+    if (length > FSCI_MTU) {
+        *cbFrame = FSCI_SYNC_SIZE;
+        return JUNK_DATA;
+    }
+
+    *cbFrame = cbHeader + length + crcFieldSize;
+
+    if (cbData < *cbFrame) {
+        return INSUFFICIENT_DATA;
+    }
+
+    /* The checksum covers the opGroup, opCode, length and data fields. */
+    for (i = FSCI_SYNC_SIZE; i < cbHeader + length; i++) {
+        calculatedCRC ^= pData[i];
+    }
+
+    pCrc = pData + cbHeader + length;
+
+    frame->sync = pData[0];
+    frame->opGroup = pData[FSCI_SYNC_SIZE];
+    frame->opCode = pData[FSCI_SYNC_SIZE + FSCI_OGF_SIZE];
+    frame->length = length;
+    frame->data = length ? (pData + cbHeader) : NULL;
+    frame->timeStamp = 0;
+    frame->index = 0;
+    frame->firstByteNs = 0;
+    frame->completeNs = 0;
+    frame->endian = endian;
+    frame->virtualInterface = 0;
+
+    if (crcFieldSize == 2) {
+        /* Same check as FSCISecondCrcField. */
+        frame->crc = Read16(pCrc, endian);
+        return ((pCrc[0] ^ calculatedCRC) == pCrc[1]) ? VALID_FRAME : INVALID_CRC;
+    }
+
+    frame->crc = pCrc[0];
+    return (pCrc[0] == calculatedCRC) ? VALID_FRAME : INVALID_CRC;
+}
+
+/*! *********************************************************************************
+* \brief    Alternative to FSCIStateMachineDispatch which keeps no partial frame
+*           between calls. The framer's receive window is parsed with
+*           FSCIParseFrame and the bytes are released only once a whole frame or junk
+*           run is recognized, so the only allocation is the delivered FSCIFrame,
+*           which carries its payload in the same block.
+*
+* \param[in,out] framer         pointer to a Framer object
+* \param[in,out] currentFrame   receives the frame to be dispatched, if any
+* \param[in,out] dataSize       the number of bytes available, decreased by the
+*                               number of bytes consumed
+*
+* \return the status of the current frame.
+********************************************************************************** */
+FrameStatus FSCICursorStateMachineDispatch(Framer *framer, void **currentFrame, uint32_t *dataSize)
+{
+    FSCIFrame parsed;
+    uint32_t cbFrame;
+    FrameStatus status = FSCICursorParseWindow(framer, &parsed, &cbFrame, *dataSize);
+
+    if (status == INSUFFICIENT_DATA) {
+        framer->currentState = FSCI_SM_JUNK_DATA;
+        return status;
+    }
+
+    if (status == VALID_FRAME) {
+        /* Copy before consuming, the window may point into the RX storage. */
+        *currentFrame = FSCICursorCopyFrame(framer, &parsed);
+    } else if (status == INVALID_CRC) {
+        /* Nothing is handed to the thread routine, so report it from here. */
+        logMessage(HSDK_WARNING, "[FSCICursorFramer]FSCICursorStateMachineDispatch", "Invalid CRC detected - frame dismissed.", HSDKThreadId());
+    }
+
+    FramerConsume(framer, cbFrame);
+    *dataSize -= cbFrame;
+    framer->currentState = FSCI_SM_FINISHED_FRAME;
+
+    return status;
+}
+
+/*! *********************************************************************************
+* \brief    Verifies if the data left inside the queue is enough to be considered a
+*           new packet, looking at the receive window in place.
+*
+* \param[in] framer             pointer to the Framer
+* \param[in, out] dataSize      pointer to a variable indicating the size of the queue
+*
+* \return 1 if is enough data to keep the loop open for a new packet 0 otherwise
+********************************************************************************** */
+int FSCICursorQueueDataVerification(Framer *framer, uint32_t *dataSize)
+{
+    FSCIFrame parsed;
+    uint8_t *pWindow;
+    uint32_t cbFrame;
+    uint32_t cbHeader = FSCI_SYNC_SIZE + FSCI_OGF_SIZE + FSCI_OCF_SIZE + framer->lengthFieldSize;
+    uint32_t cbWindow;
+
+    pWindow = FramerGetWindow(framer, cbHeader, &cbWindow);
+
+    if (cbWindow > *dataSize) {
+        cbWindow = *dataSize;
+    }
+
+    if (FSCIParseFrame(pWindow, cbWindow, framer->lengthFieldSize, framer->crcFieldSize, framer->framerEndianness, &parsed, &cbFrame) != INSUFFICIENT_DATA) {
+        return 1;
+    }
+
+    return (cbFrame <= *dataSize);
+}
+
+/************************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+************************************************************************************/
+
+/*! *********************************************************************************
+* \brief    Parses the front of the receive window, widening the window when the
+*           frame continues past the contiguous bytes. That happens at most twice:
+*           once to see the length field and once to see the whole frame.
+*
+* \param[in] framer             pointer to the Framer
+* \param[out] frame             the parsed frame, pointing into the window
+* \param[out] cbFrame           see FSCIParseFrame
+* \param[in] dataSize           the number of bytes the thread routine accounted for
+*
+* \return the status returned by FSCIParseFrame
+********************************************************************************** */
+static FrameStatus FSCICursorParseWindow(Framer *framer, FSCIFrame *frame, uint32_t *cbFrame, uint32_t dataSize)
+{
+    uint32_t cbDemanded = FSCI_SYNC_SIZE + FSCI_OGF_SIZE + FSCI_OCF_SIZE + framer->lengthFieldSize;
+    uint32_t cbWindow;
+    uint8_t *pWindow, attempt;
+    FrameStatus status = INSUFFICIENT_DATA;
+
+    for (attempt = 0; attempt < 2; attempt++) {
+        pWindow = FramerGetWindow(framer, cbDemanded, &cbWindow);
+
+        /* Bytes received after the thread routine sampled the size are left for the
+           next round, to keep its accounting exact. */
+        if (cbWindow > dataSize) {
+            cbWindow = dataSize;
+        }
+
+        status = FSCIParseFrame(pWindow, cbWindow, framer->lengthFieldSize, framer->crcFieldSize, framer->framerEndianness, frame, cbFrame);
+
+        if (status != INSUFFICIENT_DATA || *cbFrame > dataSize || *cbFrame <= cbWindow) {
+            break;
+        }
+
+        cbDemanded = *cbFrame;
+    }
+
+    return status;
+}
+
+/*! *********************************************************************************
+* \brief    Allocates the frame delivered to the observers, with the payload stored
+*           right after the structure. DestroyFSCIFrame releases both at once.
+*
+* \param[in] framer     pointer to the Framer from where the message queue is accessed
+* \param[in] parsed     frame returned by FSCIParseFrame
+*
+* \return a pointer to a FSCIFrame, NULL on allocation failure
+********************************************************************************** */
+static FSCIFrame *FSCICursorCopyFrame(Framer *framer, FSCIFrame *parsed)
+{
+    RawFrame *rawFrame;
+    FSCIFrame *frame = (FSCIFrame *)malloc(sizeof(FSCIFrame) + parsed->length);
+
+    if (frame == NULL) {
+        logMessage(HSDK_WARNING, "[FSCICursorFramer]FSCICursorCopyFrame", "frame memory allocation failed", HSDKThreadId());
+        return NULL;
+    }
+
+    *frame = *parsed;
+
+    if (parsed->length) {
+        frame->data = (uint8_t *)(frame + 1);
+        memcpy(frame->data, parsed->data, parsed->length);
+    }
+
+    frame->completeNs = MonotonicTimeNs();
+
+    if (framer->ring) {
+        /* The ring keeps no per-read boundaries, stamp the frame on decoding. */
+        frame->timeStamp = time(NULL);
+        frame->firstByteNs = frame->completeNs;
+    } else {
+        /* The SYNC byte is the first byte of the front RawFrame. */
+        rawFrame = (RawFrame *)PeekFront(framer->queue);
+
+        if (rawFrame) {
+            frame->timeStamp = rawFrame->timeStamp;
+            frame->firstByteNs = rawFrame->timeStampNs;
+            frame->index = rawFrame->packetIndex;
+        }
+    }
+
+    return frame;
+}
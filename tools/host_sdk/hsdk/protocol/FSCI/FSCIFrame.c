@@ -210,7 +210,8 @@ void PrintFSCIFrame(Framer *framer, FSCIFrame *frame)
 void DestroyFSCIFrame(FSCIFrame *frame)
 {
     if (frame) {
-        if (frame->data) {
+        /* Frames built by the cursor framer carry the payload in the same block. */
+        if (frame->data && frame->data != (uint8_t *)(frame + 1)) {
             free(frame->data);
         }
         frame->data = NULL;
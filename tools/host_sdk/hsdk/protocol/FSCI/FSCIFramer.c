@@ -23,13 +23,13 @@
 #include "RawFrame.h"
 #include "FSCIFrame.h"
 #include "FSCIFramer.h"
+#include "FSCICursorFramer.h"
 
 /************************************************************************************
 *************************************************************************************
 * Private macros
 *************************************************************************************
 ************************************************************************************/
-#define FSCI_MTU        2048
 
 /************************************************************************************
 *************************************************************************************
@@ -38,6 +38,7 @@
 ************************************************************************************/
 static uint8_t *CreatePacket(Framer *framer, uint8_t ogf, uint8_t ocf, uint32_t length, uint8_t *data, uint32_t crc, uint8_t crcFieldSize, uint32_t *size);
 static uint8_t CalculateCRC(Framer *framer, FSCIFrame *frame);
+static RawFrame *FSCIReservedFrame(Framer *framer, void *pMsg);
 static FSCIFrame *FSCIHandleNewFrame(Framer *framer);
 static FrameStatus FSCIJunkData(Framer *framer, FSCIFrame **currentFrame, uint32_t *dataSize);
 static FrameStatus FSCISyncField(Framer *framer, FSCIFrame **currentFrame, uint32_t *dataSize);
@@ -72,18 +73,26 @@ static FrameStatus FSCISecondCrcField(Framer *framer, FSCIFrame **currentFrame,
 *************************************************************************************
 ************************************************************************************/
 #if defined __APPLE__ || defined __UCLIBC__
-uint8_t __attribute__((weak)) ReadSingleByte(MessageQueue *queue)
+uint8_t __attribute__((weak)) FramerReadSingleByte(Framer *framer)
 {
     return 0;
 }
-uint8_t __attribute__((weak)) *ReadMultiByte(MessageQueue *queue, uint32_t cbDemanded)
+uint8_t __attribute__((weak)) *FramerReadMultiByte(Framer *framer, uint32_t cbDemanded)
 {
     return NULL;
 }
-uint8_t __attribute__((weak)) *ReadDataUntilByte(MessageQueue *queue, uint16_t *cbSize, uint8_t startByte, uint8_t *found)
+uint8_t __attribute__((weak)) *FramerReadDataUntilByte(Framer *framer, uint16_t *cbSize, uint8_t startByte, uint8_t *found)
 {
     return NULL;
 }
+uint8_t __attribute__((weak)) *FramerPeekMultiByte(Framer *framer, uint32_t cbDemanded)
+{
+    return NULL;
+}
+int __attribute__((weak)) SendRawFrame(Framer *framer, RawFrame *frame)
+{
+    return -1;
+}
 #endif
 
 /*! *********************************************************************************
@@ -117,6 +126,115 @@ void FSCI_transmitPayload(Framer *framer, uint8_t OG, uint8_t OC, void *pMsg, ui
     }
 }
 
+/*! *********************************************************************************
+* \brief    Reserves the buffer of a frame to be sent and returns where its payload
+*           goes, with room left in front for the SYNC, opGroup, opCode and length
+*           fields and behind for the checksum. The caller serializes the payload in
+*           place and hands it to FSCI_transmitReserved, so it is never copied again.
+*
+* \param[in] framer            pointer to a Framer object
+* \param[in] msgLen            the size of the payload
+* \param[in] fsciInterface     the virtual interface, 0 for none
+*
+* \return a pointer to the payload, NULL on failure
+********************************************************************************** */
+void *FSCI_reservePayload(Framer *framer, uint16_t msgLen, uint32_t fsciInterface)
+{
+    RawFrame *tx;
+    uint32_t cbHeader;
+
+    if (!framer) {
+        return NULL;
+    }
+
+    cbHeader = FSCI_SYNC_SIZE + FSCI_OGF_SIZE + FSCI_OCF_SIZE + framer->lengthFieldSize;
+    tx = CreateTxRawFrameInPlace(cbHeader + msgLen + (fsciInterface ? 2 : 1));
+
+    if (!tx) {
+        logMessage(HSDK_ERROR, "[FSCIFramer]FSCI_reservePayload", "TX frame memory allocation failed", HSDKThreadId());
+        return NULL;
+    }
+
+    return tx->aRawData + cbHeader;
+}
+
+/*! *********************************************************************************
+* \brief    Fills in the header and the checksum around a payload returned by
+*           FSCI_reservePayload and queues the frame to the device as it is. The
+*           same result as FSCI_transmitPayload, without the copies.
+*
+* \param[in] framer            pointer to a Framer object
+* \param[in] OG                the operation group
+* \param[in] OC                the operation code
+* \param[in] pMsg              the payload, owned by the TX path from now on
+* \param[in] msgLen            the size of the payload, as reserved
+* \param[in] fsciInterface     the virtual interface, as reserved
+*
+* \return None
+********************************************************************************** */
+void FSCI_transmitReserved(Framer *framer, uint8_t OG, uint8_t OC, void *pMsg, uint16_t msgLen, uint32_t fsciInterface)
+{
+    RawFrame *tx;
+    uint8_t crc[2], len[2];
+    uint32_t i, crt = 0;
+
+    if (!framer || !pMsg) {
+        return;
+    }
+
+    tx = FSCIReservedFrame(framer, pMsg);
+
+    if (tx->cbTotalSize != FSCI_SYNC_SIZE + FSCI_OGF_SIZE + FSCI_OCF_SIZE + framer->lengthFieldSize + msgLen + (fsciInterface ? 2 : 1)) {
+        logMessage(HSDK_ERROR, "[FSCIFramer]FSCI_transmitReserved", "Length or interface differs from the reservation", HSDKThreadId());
+        DestroyRawFrame(tx);
+        return;
+    }
+
+    tx->aRawData[crt++] = FSCI_SYNC_BYTE;
+    tx->aRawData[crt++] = OG;
+    tx->aRawData[crt++] = OC;
+
+    Store16(msgLen, len, framer->framerEndianness);
+
+    for (i = 0; i < framer->lengthFieldSize; i++) {
+        tx->aRawData[crt++] = len[i];
+    }
+
+    /* Same checksum as CreateFSCIFrameAdHoc, over everything but SYNC. */
+    crc[0] = 0;
+    for (i = FSCI_SYNC_SIZE; i < crt + msgLen; i++) {
+        crc[0] ^= tx->aRawData[i];
+    }
+
+    crt += msgLen;
+    tx->aRawData[crt++] = crc[0];
+
+    if (fsciInterface) {
+        crc[1] = crc[0];
+        crc[0] += fsciInterface;
+        crc[1] ^= crc[0];
+        tx->aRawData[crt - 1] = crc[0];
+        tx->aRawData[crt++] = crc[1];
+    }
+
+    SendRawFrame(framer, tx);
+}
+
+/*! *********************************************************************************
+* \brief    Gives up a payload returned by FSCI_reservePayload without sending it.
+*
+* \param[in] framer    pointer to a Framer object
+* \param[in] pMsg      the payload
+*
+* \return None
+********************************************************************************** */
+void FSCI_releaseReserved(Framer *framer, void *pMsg)
+{
+    if (framer && pMsg) {
+        DestroyRawFrame(FSCIReservedFrame(framer, pMsg));
+    }
+}
+
 /*! *********************************************************************************
 * \brief    The state machine used for merging the data received into frames.
 *
@@ -217,13 +335,12 @@ int FSCIQueueDataVerification(Framer *framer, uint32_t *dataSize)
     else {
         /** If the data in the queue is enough to be consider at least a no data FSCI packet verify
             if the data in the queue is at least as big as the length of the presumed packet*/
-        MessageQueue *queue = framer->queue;
         uint32_t length = 0; // length of the presumed packet 
         uint8_t returnValue = 0;
         /** Size of a FSCI packet header adding the size of the FSCI sync byte */
         uint8_t lenNoDataPacket = FSCI_SYNC_SIZE + FSCI_OGF_SIZE + FSCI_OCF_SIZE + framer->lengthFieldSize;
         
-        uint8_t *peekData = PeekMultiByte(queue, lenNoDataPacket);
+        uint8_t *peekData = FramerPeekMultiByte(framer, lenNoDataPacket);
 
         if(peekData != NULL) {
             /** Verify if the first byte is the sync one */
@@ -287,10 +404,17 @@ int FSCIFinalState (void)
 void FSCIFramerInitialization(Framer *framer)
 {
     framer->CreatePacket = CreateFSCIPacket;
-    framer->StateMachineDispatch = FSCIStateMachineDispatch;
-    framer->QueueDataVerification = FSCIQueueDataVerification;
     framer->SMStartState = FSCIStartState;
     framer->SMFinalState = FSCIFinalState;
+
+    if (((PhysicalDevice *)framer->physicalLayer)->configParams->fsciCursorFramer) {
+        framer->StateMachineDispatch = FSCICursorStateMachineDispatch;
+        framer->QueueDataVerification = FSCICursorQueueDataVerification;
+        return;
+    }
+
+    framer->StateMachineDispatch = FSCIStateMachineDispatch;
+    framer->QueueDataVerification = FSCIQueueDataVerification;
 }
 
 /************************************************************************************
@@ -353,6 +477,22 @@ static uint8_t *CreatePacket(Framer *framer, uint8_t ogf, uint8_t ocf, uint32_t
     return packet;
 }
 
+/*! *********************************************************************************
+* \brief    Finds the frame a reserved payload belongs to. The RawFrame, the header
+*           and the payload are laid out back to back in one block.
+*
+* \param[in] framer    pointer to a Framer object
+* \param[in] pMsg      a payload returned by FSCI_reservePayload
+*
+* \return a pointer to the RawFrame
+********************************************************************************** */
+static RawFrame *FSCIReservedFrame(Framer *framer, void *pMsg)
+{
+    uint8_t *pData = (uint8_t *)pMsg - (FSCI_SYNC_SIZE + FSCI_OGF_SIZE + FSCI_OCF_SIZE + framer->lengthFieldSize);
+
+    return (RawFrame *)pData - 1;
+}
+
 /*! *********************************************************************************
 * \brief    Computes the XOR CRC validation code for the received FSCIFrame.
 *
@@ -396,13 +536,19 @@ static uint8_t CalculateCRC(Framer *framer, FSCIFrame *frame)
 ********************************************************************************** */
 static FSCIFrame *FSCIHandleNewFrame(Framer *framer)
 {
-    MessageQueue *queue = framer->queue;
+    RawFrame *rawFrame = NULL;
 
-    RawFrame *rawFrame = (RawFrame *)PeekFront(queue);
+    if (framer->ring) {
+        if (RingQueueIsEmpty(framer->ring)) {
+            return NULL;
+        }
+    } else {
+        rawFrame = (RawFrame *)PeekFront(framer->queue);
 
-    if (rawFrame == NULL) {
-        logMessage(HSDK_WARNING, "[FSCIFramer]FSCIHandleNewFrame", "PeekFront returned NULL", HSDKThreadId());
-        return NULL;
+        if (rawFrame == NULL) {
+            logMessage(HSDK_WARNING, "[FSCIFramer]FSCIHandleNewFrame", "PeekFront returned NULL", HSDKThreadId());
+            return NULL;
+        }
     }
 
     FSCIFrame *workingCopy = (FSCIFrame *)calloc(1, sizeof(FSCIFrame));
@@ -412,8 +558,15 @@ static FSCIFrame *FSCIHandleNewFrame(Framer *framer)
         return NULL;
     }
 
-    workingCopy->timeStamp = rawFrame->timeStamp;
-    workingCopy->index = rawFrame->packetIndex;
+    if (rawFrame) {
+        workingCopy->timeStamp = rawFrame->timeStamp;
+        workingCopy->firstByteNs = rawFrame->timeStampNs;
+        workingCopy->index = rawFrame->packetIndex;
+    } else {
+        /* The ring keeps no per-read boundaries, stamp the frame on decoding. */
+        workingCopy->timeStamp = time(NULL);
+        workingCopy->firstByteNs = MonotonicTimeNs();
+    }
 
     return workingCopy;
 }
@@ -430,11 +583,10 @@ static FSCIFrame *FSCIHandleNewFrame(Framer *framer)
 ********************************************************************************** */
 static FrameStatus FSCIJunkData(Framer *framer, FSCIFrame **currentFrame, uint32_t *dataSize)
 {
-    MessageQueue *queue = framer->queue;
     FSCIFrame *workingCopy = *currentFrame;
     uint16_t cbJunkSize = 0;
     uint8_t found = 0;
-    workingCopy->data = ReadDataUntilByte(queue, &cbJunkSize, FSCI_SYNC_BYTE, &found);
+    workingCopy->data = FramerReadDataUntilByte(framer, &cbJunkSize, FSCI_SYNC_BYTE, &found);
 
     if (!cbJunkSize) {
         free(workingCopy->data);
@@ -463,8 +615,7 @@ static FrameStatus FSCISyncField(Framer *framer, FSCIFrame **currentFrame, uint3
     if (*dataSize < 1)
         return INSUFFICIENT_DATA;
 
-    MessageQueue *queue = framer->queue;
-    (*currentFrame)->sync = ReadSingleByte(queue);
+    (*currentFrame)->sync = FramerReadSingleByte(framer);
     *dataSize -= 1;
     framer->currentState = FSCI_SM_OGF;
     return SUFFICIENT_DATA;
@@ -484,8 +635,7 @@ static FrameStatus FSCIOpGroupField(Framer *framer, FSCIFrame **currentFrame, ui
     if (*dataSize < 1)
         return INSUFFICIENT_DATA;
 
-    MessageQueue *queue = framer->queue;
-    (*currentFrame)->opGroup = ReadSingleByte(queue);
+    (*currentFrame)->opGroup = FramerReadSingleByte(framer);
     *dataSize -= 1;
     framer->currentState = FSCI_SM_OCF;
     return SUFFICIENT_DATA;
@@ -505,8 +655,7 @@ static FrameStatus FSCIOpCodeField(Framer *framer, FSCIFrame **currentFrame, uin
     if (*dataSize < 1)
         return INSUFFICIENT_DATA;
 
-    MessageQueue *queue = framer->queue;
-    (*currentFrame)->opCode = ReadSingleByte(queue);
+    (*currentFrame)->opCode = FramerReadSingleByte(framer);
     *dataSize -= 1;
     framer->currentState = FSCI_SM_LENGTH;
     return SUFFICIENT_DATA;
@@ -527,13 +676,12 @@ static FrameStatus FSCILengthField(Framer *framer, FSCIFrame **currentFrame, uin
     if (*dataSize < framer->lengthFieldSize)
         return INSUFFICIENT_DATA;
 
-    MessageQueue *queue = framer->queue;
     FSCIFrame *workingCopy = *currentFrame;
 
     if (framer->lengthFieldSize == 1) {
-        workingCopy->length = ReadSingleByte(queue);
+        workingCopy->length = FramerReadSingleByte(framer);
     } else {
-        uint8_t *multibyte_length = ReadMultiByte(queue, framer->lengthFieldSize);
+        uint8_t *multibyte_length = FramerReadMultiByte(framer, framer->lengthFieldSize);
         workingCopy->length = Read16(multibyte_length, framer->framerEndianness);
         free(multibyte_length);
     }
@@ -567,8 +715,7 @@ static FrameStatus FSCIDataField(Framer *framer, FSCIFrame **currentFrame, uint3
         return INSUFFICIENT_DATA;
     }
 
-    MessageQueue *queue = framer->queue;
-    (*currentFrame)->data = ReadMultiByte(queue, (*currentFrame)->length);
+    (*currentFrame)->data = FramerReadMultiByte(framer, (*currentFrame)->length);
     *dataSize -= (*currentFrame)->length;
     framer->currentState = FSCI_SM_CRC_FST;
     return SUFFICIENT_DATA;
@@ -591,8 +738,7 @@ static FrameStatus FSCICrcField(Framer *framer, FSCIFrame **currentFrame, uint32
 
     FSCIFrame *workingCopy = *currentFrame;
 
-    MessageQueue *queue = framer->queue;
-    uint8_t crc = ReadSingleByte(queue);
+    uint8_t crc = FramerReadSingleByte(framer);
     uint8_t calculatedCRC = CalculateCRC(framer, workingCopy);
 
     workingCopy->crc = crc;
@@ -608,6 +754,7 @@ static FrameStatus FSCICrcField(Framer *framer, FSCIFrame **currentFrame, uint32
         }
     } else if (crc == calculatedCRC) {
         framer->currentState = FSCI_SM_FINISHED_FRAME;
+        workingCopy->completeNs = MonotonicTimeNs();
         return VALID_FRAME;
     } else {
         framer->currentState = FSCI_SM_FINISHED_FRAME;
@@ -633,9 +780,8 @@ static FrameStatus FSCISecondCrcField(Framer *framer, FSCIFrame **currentFrame,
         return INVALID_CRC;
     }
 
-    MessageQueue *queue = framer->queue;
     FSCIFrame *workingCopy = *currentFrame;
-    uint8_t crc = ReadSingleByte(queue);
+    uint8_t crc = FramerReadSingleByte(framer);
     *dataSize -= 1;
 
     uint8_t calculatedCRC = CalculateCRC(framer, workingCopy);
@@ -645,6 +791,7 @@ static FrameStatus FSCISecondCrcField(Framer *framer, FSCIFrame **currentFrame,
     workingCopy->crc = Read16(aCRCArray, framer->framerEndianness);
 
     if ((oldCRC ^ calculatedCRC) == crc) {
+        workingCopy->completeNs = MonotonicTimeNs();
         return VALID_FRAME;
     } else {
         return INVALID_CRC;
@@ -22,6 +22,7 @@
 #include "Framer.h"
 #include "FSCIFrame.h"
 #include "FSCIFramer.h"
+#include "HCIFramer.h"
 
 #include "hsdkError.h"
 #include "hsdkLogger.h"
@@ -31,6 +32,16 @@
  * Private macros
  *************************************************************************************
  ************************************************************************************/
+/* How long a device thread waits for the framer to make room in a full RX ring. A
+   device served by an event loop never waits, the framer runs on the same thread. */
+#define RX_RING_FULL_TIMEOUT_MS 1000
+/* Sync, opGroup, opCode, length, interface and CRC fields around an FSCI payload,
+   which also covers the packet indicator and header of an H4 packet. */
+#define RX_FRAME_OVERHEAD_MAX   8
+#define RX_FRAME_MAX_SIZE       (((FSCI_MTU > HCI_MTU) ? FSCI_MTU : HCI_MTU) + RX_FRAME_OVERHEAD_MAX)
+/* The framers only consume whole frames, so the ring must hold the rest of a frame
+   plus a whole device read, else a full ring could never make room for the read. */
+#define RX_RING_MIN_SIZE        (RX_FRAME_MAX_SIZE + DEVICE_RX_SIZE)
 
 /************************************************************************************
  *************************************************************************************
@@ -41,7 +52,13 @@ static void SendFsciAck(Framer *framer, FSCIFrame *frame);
 static void AttachToConcreteImplementation(Framer *framer, FramerProtocol protocol);
 static void DetachFromConcreteImplementation(Framer *framer);
 static void *FramerThreadRoutine(void *lpParam);
+static Event FramerAnnounceEvent(Framer *framer);
+static void FramerProcess(Framer *framer);
+static void FramerReactorProcess(void *context);
 static void FramerCallback(void *callee, void *object);
+static uint8_t *FramerReserveWindow(Framer *framer, uint32_t cbDemanded);
+static void FramerDeliverFrame(Framer *framer, void *frame);
+static void FramerFlushBatch(Framer *framer);
 
 /************************************************************************************
  *************************************************************************************
@@ -119,7 +136,7 @@ uint8_t *ReadDataUntilByte(MessageQueue *queue, uint16_t *cbSize, uint8_t startB
             }
         }
 
-        if (pRawFrame->aRawData[pRawFrame->iCrtIndex] == startByte) {
+        if (pRawFrame->iCrtIndex < pRawFrame->cbTotalSize && pRawFrame->aRawData[pRawFrame->iCrtIndex] == startByte) {
             *found = 1;
         }
 
@@ -248,6 +265,275 @@ uint8_t *PeekMultiByte(MessageQueue *queue, uint32_t cbDemanded)
     return aResult;
 }
 
+/*! *********************************************************************************
+ * \brief   Number of received bytes not yet consumed by the state machine, taken
+ *          from whichever queue the framer was initialized with.
+ *
+ * \param[in] framer
+ *
+ * \return the number of bytes available
+ ********************************************************************************** */
+uint32_t FramerGetContentSize(Framer *framer)
+{
+    if (framer->ring) {
+        return RingQueueGetContentSize(framer->ring);
+    }
+
+    return MessageQueueGetContentSize(framer->queue);
+}
+
+/*! *********************************************************************************
+ * \brief   Reads a single byte from the framer's received data.
+ *
+ * \param[in] framer
+ *
+ * \return a uint8 for the byte
+ ********************************************************************************** */
+uint8_t FramerReadSingleByte(Framer *framer)
+{
+    uint8_t single = 0;
+
+    if (framer->ring) {
+        RingQueueGet(framer->ring, &single, 1);
+        return single;
+    }
+
+    return ReadSingleByte(framer->queue);
+}
+
+/*! *********************************************************************************
+ * \brief   Reads a number of bytes from the framer's received data.
+ *
+ * \param[in] framer
+ * \param[in] cbDemanded
+ *
+ * \return an array of bytes
+ ********************************************************************************** */
+uint8_t *FramerReadMultiByte(Framer *framer, uint32_t cbDemanded)
+{
+    uint8_t *aResult;
+
+    if (!framer->ring) {
+        return ReadMultiByte(framer->queue, cbDemanded);
+    }
+
+    aResult = (uint8_t *)calloc(cbDemanded, sizeof(uint8_t));
+
+    if (aResult) {
+        /* Partial result if not enough data, same as ReadMultiByte. */
+        RingQueueGet(framer->ring, aResult, cbDemanded);
+    }
+
+    return aResult;
+}
+
+/*! *********************************************************************************
+ * \brief   Reads the framer's received data until the startByte, see ReadDataUntilByte.
+ *
+ * \param[in] framer
+ * \param[in,out] cbSize    current number of bytes to be processed
+ * \param[in] startByte     synchronization byte, usually 0x02
+ * \param[in,out] found     flag that indicates whether the frames have the startByte
+ *
+ * \return  NULL in case of allocation failure, otherwise an array of bytes with the
+ *          junk bytes received until the next SYNC byte
+ ********************************************************************************** */
+uint8_t *FramerReadDataUntilByte(Framer *framer, uint16_t *cbSize, uint8_t startByte, uint8_t *found)
+{
+    uint32_t cbTotal, cbContiguous, cbJunk;
+    uint8_t *pData, *pStart, *aResult;
+
+    if (!framer->ring) {
+        return ReadDataUntilByte(framer->queue, cbSize, startByte, found);
+    }
+
+    /* Search the junk in place, in at most two contiguous segments of the ring. */
+    cbTotal = RingQueueGetContentSize(framer->ring);
+    pData = RingQueueReadPointer(framer->ring, &cbContiguous);
+
+    if (cbContiguous > cbTotal) {
+        cbContiguous = cbTotal;
+    }
+
+    pStart = (uint8_t *)memchr(pData, startByte, cbContiguous);
+    cbJunk = pStart ? (uint32_t)(pStart - pData) : cbContiguous;
+
+    if (!pStart && cbTotal > cbContiguous) {
+        pData = framer->ring->buffer;
+        pStart = (uint8_t *)memchr(pData, startByte, cbTotal - cbContiguous);
+        cbJunk += pStart ? (uint32_t)(pStart - pData) : (cbTotal - cbContiguous);
+    }
+
+    if (cbJunk > UINT16_MAX) {
+        cbJunk = UINT16_MAX;
+        pStart = NULL;
+    }
+
+    aResult = (uint8_t *)calloc(cbJunk ? cbJunk : 1, sizeof(uint8_t));
+
+    if (!aResult) {
+        return NULL;
+    }
+
+    RingQueueGet(framer->ring, aResult, cbJunk);
+    *found = (pStart != NULL);
+    *cbSize = (uint16_t)cbJunk;
+
+    return aResult;
+}
+
+/*! *********************************************************************************
+ * \brief   Peek a number of bytes from the framer's received data.
+ *
+ * \param[in] framer
+ * \param[in] cbDemanded
+ *
+ * \return an array of bytes
+ ********************************************************************************** */
+uint8_t *FramerPeekMultiByte(Framer *framer, uint32_t cbDemanded)
+{
+    uint8_t *aResult;
+
+    if (!framer->ring) {
+        return PeekMultiByte(framer->queue, cbDemanded);
+    }
+
+    aResult = (uint8_t *)calloc(cbDemanded, sizeof(uint8_t));
+
+    if (aResult) {
+        RingQueuePeek(framer->ring, aResult, cbDemanded);
+    }
+
+    return aResult;
+}
+
+/*! *********************************************************************************
+ * \brief   Gives direct access to the oldest received bytes without consuming them.
+ * \details When the first cbDemanded bytes are already contiguous, in the front
+ *          RawFrame or before the end of the ring, a pointer into that storage is
+ *          returned and nothing is copied. Otherwise they are gathered into the
+ *          framer's window buffer. The bytes stay valid until FramerConsume() or the
+ *          next call.
+ *
+ * \param[in] framer
+ * \param[in] cbDemanded   number of bytes that must be contiguous, if available
+ * \param[out] cbWindow    number of bytes readable at the returned address; can be
+ *                         more than cbDemanded, or less when not enough was received
+ *
+ * \return a pointer to the front of the received data, NULL if there is none
+ ********************************************************************************** */
+uint8_t *FramerGetWindow(Framer *framer, uint32_t cbDemanded, uint32_t *cbWindow)
+{
+    uint32_t cbTotal, cbContiguous, cbChunk;
+    uint8_t *pData;
+    Node *pNode;
+    RawFrame *pRawFrame;
+
+    *cbWindow = 0;
+
+    if (framer->ring) {
+        cbTotal = RingQueueGetContentSize(framer->ring);
+        pData = RingQueueReadPointer(framer->ring, &cbContiguous);
+
+        if (cbContiguous > cbTotal) {
+            cbContiguous = cbTotal;
+        }
+
+        if (cbContiguous >= cbDemanded || cbContiguous == cbTotal) {
+            *cbWindow = cbContiguous;
+            return cbContiguous ? pData : NULL;
+        }
+
+        if (FramerReserveWindow(framer, cbDemanded) == NULL) {
+            return NULL;
+        }
+
+        *cbWindow = RingQueuePeek(framer->ring, framer->window, cbDemanded);
+        return framer->window;
+    }
+
+    /* Only this thread removes nodes, but the device thread links new ones at the
+       tail, so walking the list must be done under the queue lock. */
+    HSDKAcquireLock(framer->queue->lock);
+
+    pNode = framer->queue->head;
+
+    if (pNode == NULL) {
+        HSDKReleaseLock(framer->queue->lock);
+        return NULL;
+    }
+
+    pRawFrame = (RawFrame *)pNode->data;
+    cbContiguous = pRawFrame->cbTotalSize - pRawFrame->iCrtIndex;
+
+    if (cbContiguous >= cbDemanded || pNode->next == NULL) {
+        HSDKReleaseLock(framer->queue->lock);
+        *cbWindow = cbContiguous;
+        return pRawFrame->aRawData + pRawFrame->iCrtIndex;
+    }
+
+    if (FramerReserveWindow(framer, cbDemanded) == NULL) {
+        HSDKReleaseLock(framer->queue->lock);
+        return NULL;
+    }
+
+    while (pNode != NULL && *cbWindow < cbDemanded) {
+        pRawFrame = (RawFrame *)pNode->data;
+        cbChunk = pRawFrame->cbTotalSize - pRawFrame->iCrtIndex;
+
+        if (cbChunk > cbDemanded - *cbWindow) {
+            cbChunk = cbDemanded - *cbWindow;
+        }
+
+        memcpy(framer->window + *cbWindow, pRawFrame->aRawData + pRawFrame->iCrtIndex, cbChunk);
+        *cbWindow += cbChunk;
+        pNode = pNode->next;
+    }
+
+    HSDKReleaseLock(framer->queue->lock);
+
+    return framer->window;
+}
+
+/*! *********************************************************************************
+ * \brief   Releases bytes from the front of the received data, typically after they
+ *          were parsed through FramerGetWindow().
+ *
+ * \param[in] framer
+ * \param[in] cbConsumed   number of bytes to release
+ *
+ * \return None
+ ********************************************************************************** */
+void FramerConsume(Framer *framer, uint32_t cbConsumed)
+{
+    RawFrame *pRawFrame;
+    uint32_t cbChunk;
+
+    if (framer->ring) {
+        RingQueueAdvance(framer->ring, cbConsumed);
+        return;
+    }
+
+    while (cbConsumed > 0) {
+        pRawFrame = (RawFrame *)PeekFront(framer->queue);
+
+        if (pRawFrame == NULL) {
+            break;
+        }
+
+        cbChunk = pRawFrame->cbTotalSize - pRawFrame->iCrtIndex;
+
+        if (cbChunk > cbConsumed) {
+            pRawFrame->iCrtIndex += cbConsumed;
+            break;
+        }
+
+        cbConsumed -= cbChunk;
+        MessageQueueGet(framer->queue);
+        DestroyRawFrame(pRawFrame);
+    }
+}
+
 /*! *********************************************************************************
  * \brief   Transmit a frame to the lower layer device to which the framer is connected
  *
@@ -278,6 +564,11 @@ int SendBytes(Framer *framer, uint8_t *packet, uint32_t size)
     return WritePhysicalDevice(framer->physicalLayer, packet, size);
 }
 
+int SendRawFrame(Framer *framer, RawFrame *frame)
+{
+    return WriteRawFramePhysicalDevice(framer->physicalLayer, frame);
+}
+
 static void SendFsciAck(Framer *framer, FSCIFrame *frame)
 {
     PhysicalDevice *device = (PhysicalDevice *)(framer->physicalLayer);
@@ -333,6 +624,7 @@ Framer *InitializeFramer(void *connDev, FramerProtocol protocol, uint8_t lengthF
     logMessage(HSDK_INFO, "[Framer]InitializeFramer", "Allocated memory for Framer", HSDKThreadId());
 
     framer->physicalLayer = connDev;
+    framer->protocol = protocol;
     framer->lengthFieldSize = lengthFieldSize;
     framer->crcFieldSize = crcFieldSize;
     framer->framerEndianness = endian;
@@ -347,15 +639,28 @@ Framer *InitializeFramer(void *connDev, FramerProtocol protocol, uint8_t lengthF
 
     logMessage(HSDK_INFO, "[Framer]InitializeFramer", "Created stopThread event", HSDKThreadId());
 
-    framer->queue = InitializeMessageQueue(INT32_MAX);
+    if (((PhysicalDevice *)connDev)->configParams->rxRingSize) {
+        uint32_t ringSize = ((PhysicalDevice *)connDev)->configParams->rxRingSize;
+        framer->ring = InitializeRingQueue((ringSize < RX_RING_MIN_SIZE) ? RX_RING_MIN_SIZE : ringSize);
 
-    if (framer->queue == NULL) {
-        logMessage(HSDK_ERROR, "[Framer]InitializeFramer", "MessageQueue init failed", HSDKThreadId());
-        free(framer);
-        return NULL;
-    }
+        if (framer->ring == NULL) {
+            logMessage(HSDK_ERROR, "[Framer]InitializeFramer", "RingQueue init failed", HSDKThreadId());
+            free(framer);
+            return NULL;
+        }
 
-    logMessage(HSDK_INFO, "[Framer]InitializeFramer", "Initialized framer's message queue", HSDKThreadId());
+        logMessage(HSDK_INFO, "[Framer]InitializeFramer", "Initialized framer's ring queue", HSDKThreadId());
+    } else {
+        framer->queue = InitializeMessageQueue(INT32_MAX);
+
+        if (framer->queue == NULL) {
+            logMessage(HSDK_ERROR, "[Framer]InitializeFramer", "MessageQueue init failed", HSDKThreadId());
+            free(framer);
+            return NULL;
+        }
+
+        logMessage(HSDK_INFO, "[Framer]InitializeFramer", "Initialized framer's message queue", HSDKThreadId());
+    }
 
     framer->evtManager = CreateEventManager();
 
@@ -365,17 +670,39 @@ Framer *InitializeFramer(void *connDev, FramerProtocol protocol, uint8_t lengthF
         return NULL;
     }
 
+    framer->batchEvtManager = CreateEventManager();
+
+    if (framer->batchEvtManager == NULL) {
+        logMessage(HSDK_ERROR, "[Framer]InitializeFramer", "EventManager creation failed", HSDKThreadId());
+        free(framer);
+        return NULL;
+    }
+
     logMessage(HSDK_INFO, "[Framer]InitializeFramer", "Created event manager for framer", HSDKThreadId());
 
+    framer->drainOnWakeup = ((PhysicalDevice *)connDev)->configParams->framerBatchDispatch;
+
     AttachToPhysicalDevice(connDev, framer, FramerCallback);
     AttachToConcreteImplementation(framer, protocol);
 
-    framer->framerThread = HSDKCreateThread(FramerThreadRoutine, framer);
+    if (((PhysicalDevice *)connDev)->reactor) {
+        /* Decoded on the event loop of the device, right after its reads. */
+        framer->currentState = framer->SMStartState();
+        framer->reactorSource = ReactorAdd(((PhysicalDevice *)connDev)->reactor, FramerAnnounceEvent(framer), 0,
+                                           FramerReactorProcess, framer);
+    } else {
+        framer->framerThread = HSDKCreateThread(FramerThreadRoutine, framer);
+    }
 
-    if (!framer->framerThread) {
+    if (!framer->framerThread && !framer->reactorSource) {
         DetachFromPhysicalDevice(connDev, framer);
-        DestroyMessageQueue(framer->queue);
-        framer->queue = NULL;
+        if (framer->ring) {
+            DestroyRingQueue(framer->ring);
+            framer->ring = NULL;
+        } else {
+            DestroyMessageQueue(framer->queue);
+            framer->queue = NULL;
+        }
         HSDKDestroyEvent(framer->stopThread);
 
         free(framer);
@@ -419,18 +746,23 @@ int DestroyFramer(Framer *framer)
 
     DetachFromPhysicalDevice(framer->physicalLayer, framer);
 
-    err = HSDKSignalEvent(framer->stopThread);
+    if (framer->reactorSource) {
+        ReactorRemove(((PhysicalDevice *)framer->physicalLayer)->reactor, framer->reactorSource);
+        framer->reactorSource = NULL;
+    } else {
+        err = HSDKSignalEvent(framer->stopThread);
 
-    if (err != HSDK_ERROR_SUCCESS) {
-        logMessage(HSDK_ERROR, "[Framer]DestroyFramer", "Error in signaling the framer to stop", HSDKThreadId());
-        return err;
-    }
+        if (err != HSDK_ERROR_SUCCESS) {
+            logMessage(HSDK_ERROR, "[Framer]DestroyFramer", "Error in signaling the framer to stop", HSDKThreadId());
+            return err;
+        }
 
-    err = HSDKDestroyThread(framer->framerThread);
+        err = HSDKDestroyThread(framer->framerThread);
 
-    if (err != HSDK_ERROR_SUCCESS) {
-        logMessage(HSDK_ERROR, "[Framer]DestroyFramer", "Error in closing the framer thread", HSDKThreadId());
-        return err;
+        if (err != HSDK_ERROR_SUCCESS) {
+            logMessage(HSDK_ERROR, "[Framer]DestroyFramer", "Error in closing the framer thread", HSDKThreadId());
+            return err;
+        }
     }
 
     err = HSDKDestroyEvent(framer->stopThread);
@@ -441,9 +773,17 @@ int DestroyFramer(Framer *framer)
     }
 
     DestroyEventManager(framer->evtManager);
+    DestroyEventManager(framer->batchEvtManager);
+    free(framer->batch.frames);
+    free(framer->window);
 
-    err = DestroyMessageQueue(framer->queue);
-    framer->queue = NULL;
+    if (framer->ring) {
+        err = DestroyRingQueue(framer->ring);
+        framer->ring = NULL;
+    } else {
+        err = DestroyMessageQueue(framer->queue);
+        framer->queue = NULL;
+    }
 
     if (err != HSDK_ERROR_SUCCESS) {
         logMessage(HSDK_ERROR, "[Framer]DestroyFramer", "Error in destroying the Message Queue", HSDKThreadId());
@@ -471,6 +811,48 @@ void DetachFromFramer(Framer *framer, void *observer)
     DeregisterFromEvent(framer->evtManager, observer);
 }
 
+/*! *********************************************************************************
+ * \brief   Registers an observer receiving all the frames decoded during a wake up of
+ *          the framer thread in a single call, as a FramerBatch. While at least one
+ *          batch observer is attached, the observers registered with AttachToFramer
+ *          are no longer notified.
+ *
+ * \param[in] framer
+ * \param[in] observer     the object passed back to the callback
+ * \param[in] Callback     called with the observer and a pointer to a FramerBatch
+ *
+ * \return None
+ ********************************************************************************** */
+void AttachBatchToFramer(Framer *framer, void *observer, void(*Callback) (void *, void *))
+{
+    RegisterToEventManager(framer->batchEvtManager, observer, Callback);
+}
+
+void DetachBatchFromFramer(Framer *framer, void *observer)
+{
+    DeregisterFromEvent(framer->batchEvtManager, observer);
+}
+
+/*! *********************************************************************************
+ * \brief   Registers an observer receiving each RawFrame written by the underlying
+ *          device, with its timeStampNs and writtenNs set. See AttachTxToPhysicalDevice.
+ *
+ * \param[in] framer
+ * \param[in] observer     the object passed back to the callback
+ * \param[in] Callback     called from the device thread with the observer and the RawFrame
+ *
+ * \return None
+ ********************************************************************************** */
+void AttachTxToFramer(Framer *framer, void *observer, void(*Callback) (void *, void *))
+{
+    AttachTxToPhysicalDevice(framer->physicalLayer, observer, Callback);
+}
+
+void DetachTxFromFramer(Framer *framer, void *observer)
+{
+    DetachTxFromPhysicalDevice(framer->physicalLayer, observer);
+}
+
 /************************************************************************************
  *************************************************************************************
  * Private functions
@@ -489,17 +871,13 @@ void DetachFromFramer(Framer *framer, void *observer)
 static void *FramerThreadRoutine(void *lpParam)
 {
     Framer *framer = (Framer *)lpParam;
-    FrameStatus status;
-    void *response = NULL;
     uint8_t loop = 1;
     int triggeredEvent;
     int8_t ret = 0;
-    uint32_t cbCrtAvailable, cbSaved;
-    PhysicalDevice* device = (PhysicalDevice*)(framer->physicalLayer);
 
     Event eventArray[2];
     eventArray[0] = framer->stopThread;
-    eventArray[1] = framer->queue->sAnnounceData;
+    eventArray[1] = FramerAnnounceEvent(framer);
 
     framer->currentState = framer->SMStartState();
 
@@ -519,68 +897,224 @@ static void *FramerThreadRoutine(void *lpParam)
             case 1:
                 /* poll waked up on sAnnounceData, so we clear the event immediately */
                 HSDKResetEvent(eventArray[1]);
+                FramerProcess(framer);
+        }
+    }
 
-                cbCrtAvailable = MessageQueueGetContentSize(framer->queue);
+    return NULL;
+}
 
-                if (cbCrtAvailable == 0) {
-                    continue;
-                }
+/*! *********************************************************************************
+ * \brief   The event signaled each time received data is queued to the framer.
+ ********************************************************************************** */
+static Event FramerAnnounceEvent(Framer *framer)
+{
+    return framer->ring ? framer->ring->sAnnounceData : framer->queue->sAnnounceData;
+}
 
-                cbSaved = cbCrtAvailable;
-                status = framer->StateMachineDispatch(framer, &response, &cbCrtAvailable);
-                MessageQueueDecrementSize(framer->queue, cbSaved - cbCrtAvailable);
-
-                if (response) {
-                    if (status == INVALID_CRC) {
-                        logMessage(HSDK_WARNING, "[Framer]FramerThreadRoutine", "Invalid CRC detected - frame dismissed.", HSDKThreadId());
-                    } else if (status == VALID_FRAME) {
-                        if (device->configParams->fsciRxAck) {
-                            // verify received packet is not an ACK
-                            if (((FSCIFrame*)response)->opGroup != 0xA4 || ((FSCIFrame*)response)->opCode != 0xFD) {
-                                /* Prevent other TXs until we send back the ACK. */
-                                HSDKAcquireLock(device->inMessages->lock);
-                            }
-                            SendFsciAck(framer, (FSCIFrame*)response);
-                        }
-                        
-                        if (device->configParams->fsciTxAck) {
-                            if (((FSCIFrame*)response)->opGroup == 0xA4 || ((FSCIFrame*)response)->opCode == 0xFD) {
-                                HSDKSignalEvent(device->sAnnounceTXACK);
-                            }
-                        }
+/*! *********************************************************************************
+ * \brief   Decodes the queued data, one frame or all of them with drainOnWakeup,
+ *          and hands the frames to the observers. Signals the framer again when
+ *          frames are left. Run by the framer thread, or by the event loop of the
+ *          device.
+ *
+ * \param[in] framer    a pointer to the Framer
+ ********************************************************************************** */
+static void FramerProcess(Framer *framer)
+{
+    FrameStatus status;
+    uint32_t cbCrtAvailable, cbSaved;
+    PhysicalDevice* device = (PhysicalDevice*)(framer->physicalLayer);
+
+    cbCrtAvailable = FramerGetContentSize(framer);
+
+    if (cbCrtAvailable == 0) {
+        return;
+    }
+
+    do {
+        cbSaved = cbCrtAvailable;
+        status = framer->StateMachineDispatch(framer, &framer->currentFrame, &cbCrtAvailable);
+
+        /* The ring accounts for consumed bytes by itself. */
+        if (!framer->ring) {
+            MessageQueueDecrementSize(framer->queue, cbSaved - cbCrtAvailable);
+        }
 
-                        NotifyOnEvent(framer->evtManager, response);
-                        response = NULL;
-                    } else {
-                        /* No action taken for JUNK_DATA, INSUFFICIENT_DATA or SUFFICIENT_DATA */
+        if (framer->currentFrame) {
+            if (status == INVALID_CRC) {
+                logMessage(HSDK_WARNING, "[Framer]FramerProcess", "Invalid CRC detected - frame dismissed.", HSDKThreadId());
+            } else if (status == VALID_FRAME && framer->protocol != FSCI) {
+                FramerDeliverFrame(framer, framer->currentFrame);
+                framer->currentFrame = NULL;
+            } else if (status == VALID_FRAME) {
+                if (device->configParams->fsciRxAck) {
+                    // verify received packet is not an ACK
+                    if (((FSCIFrame*)framer->currentFrame)->opGroup != 0xA4 || ((FSCIFrame*)framer->currentFrame)->opCode != 0xFD) {
+                        /* Prevent other TXs until we send back the ACK. */
+                        HSDKAcquireLock(device->inMessages->lock);
                     }
+                    SendFsciAck(framer, (FSCIFrame*)framer->currentFrame);
                 }
 
-                /* keep the loop going if there's data left to process */
-                if (cbCrtAvailable > 0 && status != INSUFFICIENT_DATA) {
-                    if((status == VALID_FRAME && framer->QueueDataVerification(framer, &cbCrtAvailable)) ||
-                        (status != VALID_FRAME)) {
-                        HSDKSignalEvent(eventArray[1]);
-                    }         
+                if (device->configParams->fsciTxAck) {
+                    if (((FSCIFrame*)framer->currentFrame)->opGroup == 0xA4 && ((FSCIFrame*)framer->currentFrame)->opCode == 0xFD) {
+                        if (device->txAckWindow) {
+                            HSDKAcquireLock(device->txAckWindow->lock);
+                            device->txAckWindow->acksReceived++;
+                            HSDKReleaseLock(device->txAckWindow->lock);
+                        }
+                        HSDKSignalEvent(device->sAnnounceTXACK);
+                    }
                 }
 
-                if (framer->currentState == framer->SMFinalState()) {
-                    framer->currentState = framer->SMStartState();
-                }
+                FramerDeliverFrame(framer, framer->currentFrame);
+                framer->currentFrame = NULL;
+            } else {
+                /* No action taken for JUNK_DATA, INSUFFICIENT_DATA or SUFFICIENT_DATA */
+            }
+        }
+
+        if (framer->currentState == framer->SMFinalState()) {
+            framer->currentState = framer->SMStartState();
+        }
+    } while (framer->drainOnWakeup && cbCrtAvailable > 0 && status != INSUFFICIENT_DATA);
+
+    FramerFlushBatch(framer);
+
+    /* keep the loop going if there's data left to process */
+    if (!framer->drainOnWakeup && cbCrtAvailable > 0 && status != INSUFFICIENT_DATA) {
+        if((status == VALID_FRAME && framer->QueueDataVerification(framer, &cbCrtAvailable)) ||
+            (status != VALID_FRAME)) {
+            HSDKSignalEvent(FramerAnnounceEvent(framer));
         }
     }
+}
 
-    return NULL;
+/*! *********************************************************************************
+ * \brief   Event loop handler for the data queued to the framer, see FramerProcess.
+ ********************************************************************************** */
+static void FramerReactorProcess(void *context)
+{
+    Framer *framer = (Framer *)context;
+
+    HSDKResetEvent(FramerAnnounceEvent(framer));
+    FramerProcess(framer);
 }
 
 static void FramerCallback(void *callee, void *object)
 {
     Framer *framer = (Framer *)callee;
     RawFrame *frame = (RawFrame *)object;
+
+    if (framer->ring) {
+        uint32_t cbData = frame->cbTotalSize - frame->iCrtIndex;
+        uint32_t cbStored;
+
+        if (framer->reactorSource) {
+            /* On an event loop the framer runs on this thread: make room rather than
+               wait for it, as nobody else would. */
+            while (RingQueueGetFreeSpace(framer->ring) < cbData) {
+                uint32_t cbQueued = FramerGetContentSize(framer);
+
+                FramerProcess(framer);
+
+                if (FramerGetContentSize(framer) == cbQueued) {
+                    break;
+                }
+            }
+
+            cbStored = RingQueuePut(framer->ring, frame->aRawData + frame->iCrtIndex, cbData);
+        } else {
+            cbStored = RingQueuePutWait(framer->ring, frame->aRawData + frame->iCrtIndex, cbData, RX_RING_FULL_TIMEOUT_MS);
+        }
+
+        if (!cbStored) {
+            logMessage(HSDK_WARNING, "[Framer]FramerCallback", "RX ring full - bytes dropped.", HSDKThreadId());
+        }
+
+        DestroyRawFrame(frame);
+        HSDKSignalEvent(framer->ring->sAnnounceData);
+        return;
+    }
+
     MessageQueuePutWithSize(framer->queue, frame, frame->cbTotalSize);
     HSDKSignalEvent(framer->queue->sAnnounceData);
 }
 
+/*! *********************************************************************************
+ * \brief   Makes sure the window buffer can hold cbDemanded bytes.
+ *
+ * \return the window buffer, NULL on allocation failure
+ ********************************************************************************** */
+static uint8_t *FramerReserveWindow(Framer *framer, uint32_t cbDemanded)
+{
+    uint8_t *tmp;
+
+    if (framer->cbWindowSize < cbDemanded) {
+        tmp = (uint8_t *)realloc(framer->window, cbDemanded);
+
+        if (tmp == NULL) {
+            logMessage(HSDK_ERROR, "[Framer]FramerGetWindow", "Window allocation failed", HSDKThreadId());
+            return NULL;
+        }
+
+        framer->window = tmp;
+        framer->cbWindowSize = cbDemanded;
+    }
+
+    return framer->window;
+}
+
+/*! *********************************************************************************
+ * \brief   Hands a decoded frame to the observers, or keeps it for the batch
+ *          observers if there are any.
+ ********************************************************************************** */
+static void FramerDeliverFrame(Framer *framer, void *frame)
+{
+    void **tmp;
+    uint32_t capacity;
+
+    if (framer->batchEvtManager->obsList->next == NULL) {
+        NotifyOnEvent(framer->evtManager, frame);
+        return;
+    }
+
+    if (framer->batch.count == framer->batch.capacity) {
+        capacity = framer->batch.capacity ? (2 * framer->batch.capacity) : 16;
+        tmp = (void **)realloc(framer->batch.frames, capacity * sizeof(void *));
+
+        if (tmp == NULL) {
+            /* Do not lose the frame, deliver what was gathered so far. */
+            FramerFlushBatch(framer);
+
+            if (framer->batch.capacity == 0) {
+                logMessage(HSDK_ERROR, "[Framer]FramerDeliverFrame", "Batch allocation failed", HSDKThreadId());
+                NotifyOnEvent(framer->evtManager, frame);
+                return;
+            }
+        } else {
+            framer->batch.frames = tmp;
+            framer->batch.capacity = capacity;
+        }
+    }
+
+    framer->batch.frames[framer->batch.count++] = frame;
+}
+
+/*! *********************************************************************************
+ * \brief   Notifies the batch observers of the frames gathered so far, if any.
+ ********************************************************************************** */
+static void FramerFlushBatch(Framer *framer)
+{
+    if (framer->batch.count == 0) {
+        return;
+    }
+
+    NotifyOnEvent(framer->batchEvtManager, &framer->batch);
+    framer->batch.count = 0;
+}
+
 static void AttachToConcreteImplementation(Framer *framer, FramerProtocol protocol)
 {
     switch (protocol) {
@@ -589,7 +1123,7 @@ static void AttachToConcreteImplementation(Framer *framer, FramerProtocol protoc
             break;
 
         case HCI:
-            // HCIFramerInitialization(framer);
+            HCIFramerInitialization(framer);
             break;
 
         case ASCII:
@@ -0,0 +1,148 @@
+/*
+ * \file HCIFrame.c
+ * This is a source file for the HCIFrame module.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/************************************************************************************
+ *************************************************************************************
+ * Include
+ *************************************************************************************
+ ************************************************************************************/
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "HCIFrame.h"
+
+/************************************************************************************
+ *************************************************************************************
+ * Public functions
+ *************************************************************************************
+ ************************************************************************************/
+
+/*! *********************************************************************************
+ * \brief  Create a HCI frame, with the payload stored right after the structure.
+ *
+ * \param[in] type      the packet indicator, one of HCIPacketType
+ * \param[in] id        the opcode, event code or connection handle with its flags
+ * \param[in] data      the payload of the frame
+ * \param[in] length    the size of the payload
+ *
+ * \return NULL if allocation failed or the type is unknown, a pointer to HCIFrame
+ *         otherwise
+ ********************************************************************************** */
+HCIFrame *CreateHCIFrame(uint8_t type, uint16_t id, uint8_t *data, uint32_t length)
+{
+    HCIFrame *frame;
+
+    if (HCIHeaderSize(type) == 0) {
+        return NULL;
+    }
+
+    frame = (HCIFrame *)calloc(1, sizeof(HCIFrame) + length);
+
+    if (!frame) {
+        return NULL;
+    }
+
+    frame->type = type;
+    frame->id = id;
+    frame->length = length;
+
+    if (length) {
+        frame->data = (uint8_t *)(frame + 1);
+        memcpy(frame->data, data, length);
+    }
+
+    frame->timeStamp = time(NULL);
+
+    return frame;
+}
+
+/*! *********************************************************************************
+ * \brief  Gives the size of the header of a packet, packet indicator included.
+ *
+ * \param[in] type  the packet indicator
+ *
+ * \return the size of the header, 0 for an unknown packet indicator
+ ********************************************************************************** */
+uint8_t HCIHeaderSize(uint8_t type)
+{
+    switch (type) {
+        case HCI_COMMAND_PACKET:
+            return HCI_COMMAND_HEADER_SIZE;
+
+        case HCI_ACL_DATA_PACKET:
+            return HCI_ACL_HEADER_SIZE;
+
+        case HCI_SCO_DATA_PACKET:
+            return HCI_SCO_HEADER_SIZE;
+
+        case HCI_EVENT_PACKET:
+            return HCI_EVENT_HEADER_SIZE;
+
+        case HCI_ISO_DATA_PACKET:
+            return HCI_ISO_HEADER_SIZE;
+
+        default:
+            return 0;
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  Print a HCI frame as it goes on the wire.
+ *
+ * \param[in] frame     a pointer to the HCIFrame to be printed
+ *
+ * \return none
+ ********************************************************************************** */
+void PrintHCIFrame(HCIFrame *frame)
+{
+    if (frame) {
+        uint32_t i;
+#ifdef DEBUG
+        printf("Index: %d\n", frame->index);
+#endif
+        printf("%02X ", frame->type);
+
+        if (frame->type == HCI_EVENT_PACKET) {
+            printf("%02X ", frame->id & 0xFF);
+        } else {
+            printf("%02X %02X ", frame->id & 0xFF, frame->id >> 8);
+        }
+
+        printf("%02X ", frame->length & 0xFF);
+
+        if (frame->type == HCI_ACL_DATA_PACKET || frame->type == HCI_ISO_DATA_PACKET) {
+            printf("%02X ", (frame->length >> 8) & 0xFF);
+        }
+
+        for (i = 0; i < frame->length; i++)
+            printf("%02X ", frame->data[i]);
+        printf("\n\n");
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  Deallocate memory required by a frame.
+ *
+ * \param[in] frame a pointer to the HCIFrame to be freed
+ *
+ * \return none
+ ********************************************************************************** */
+void DestroyHCIFrame(HCIFrame *frame)
+{
+    if (frame) {
+        /* The payload is normally stored in the same block. */
+        if (frame->data && frame->data != (uint8_t *)(frame + 1)) {
+            free(frame->data);
+        }
+        frame->data = NULL;
+        free(frame);
+    }
+}
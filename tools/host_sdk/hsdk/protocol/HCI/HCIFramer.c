@@ -0,0 +1,381 @@
+/*
+ * \file HCIFramer.c
+ * This is a source file for the HCIFramer module.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/************************************************************************************
+*************************************************************************************
+* Include
+*************************************************************************************
+************************************************************************************/
+#include <stdlib.h>
+#include <string.h>
+
+#include "hsdkLogger.h"
+#include "utils.h"
+#include "RawFrame.h"
+#include "HCIFrame.h"
+#include "HCIFramer.h"
+
+/************************************************************************************
+*************************************************************************************
+* Private prototypes
+*************************************************************************************
+************************************************************************************/
+static FrameStatus HCIParseWindow(Framer *framer, HCIFrame *frame, uint32_t *cbFrame, uint32_t dataSize);
+static HCIFrame *HCICopyFrame(Framer *framer, HCIFrame *parsed);
+
+/************************************************************************************
+*************************************************************************************
+* Public functions
+*************************************************************************************
+************************************************************************************/
+#if defined __APPLE__ || defined __UCLIBC__
+uint8_t __attribute__((weak)) *FramerGetWindow(Framer *framer, uint32_t cbDemanded, uint32_t *cbWindow)
+{
+    *cbWindow = 0;
+    return NULL;
+}
+void __attribute__((weak)) FramerConsume(Framer *framer, uint32_t cbConsumed)
+{
+}
+#endif
+
+/*! *********************************************************************************
+* \brief    Transform a HCIFrame into an array of bytes, packet indicator first, as
+*           expected by the HCI UART transport. Used for a function pointer in the
+*           Framer structure.
+*
+* \param[in] framer     a pointer to a Framer object
+* \param[in] frame      a generic pointer to a frame, which is casted to a pointer to
+*                       a HCIFrame
+* \param[in,out] size   a pointer to a variable holding the size of the returned array
+*
+* \return an array of bytes if succeeds, NULL otherwise
+********************************************************************************** */
+uint8_t *CreateHCIPacket(Framer *framer, void *frame, uint32_t *size)
+{
+    HCIFrame *hciFrame = (HCIFrame *)frame;
+    uint8_t cbHeader = HCIHeaderSize(hciFrame->type);
+    uint8_t *packet;
+
+    *size = 0;
+
+    if (cbHeader == 0) {
+        logMessage(HSDK_ERROR, "[HCIFramer]CreateHCIPacket", "Unknown packet indicator", HSDKThreadId());
+        return NULL;
+    }
+
+    packet = (uint8_t *)malloc(cbHeader + hciFrame->length);
+
+    if (packet == NULL) {
+        return NULL;
+    }
+
+    packet[0] = hciFrame->type;
+
+    switch (hciFrame->type) {
+        case HCI_EVENT_PACKET:
+            packet[1] = (uint8_t)hciFrame->id;
+            packet[2] = (uint8_t)hciFrame->length;
+            break;
+
+        case HCI_ACL_DATA_PACKET:
+        case HCI_ISO_DATA_PACKET:
+            Store16(hciFrame->id, packet + 1, _LITTLE_ENDIAN);
+            Store16((uint16_t)hciFrame->length, packet + 3, _LITTLE_ENDIAN);
+            break;
+
+        default:
+            /* Commands and SCO data, with a one byte length. */
+            Store16(hciFrame->id, packet + 1, _LITTLE_ENDIAN);
+            packet[3] = (uint8_t)hciFrame->length;
+    }
+
+    if (hciFrame->length) {
+        memcpy(packet + cbHeader, hciFrame->data, hciFrame->length);
+    }
+
+    *size = cbHeader + hciFrame->length;
+
+    return packet;
+}
+
+/*! *********************************************************************************
+* \brief    Parses one H4 packet in place, without allocating or copying anything.
+*           The fields of the caller supplied frame are filled in and its data points
+*           inside pData, so it is only valid as long as pData is.
+*
+* \param[in] pData      contiguous received bytes, starting at the first byte not
+*                       yet parsed
+* \param[in] cbData     the number of bytes in pData
+* \param[out] frame     filled in for VALID_FRAME
+* \param[out] cbFrame   the number of bytes taken by the frame or by the junk run
+*                       found at the start of pData, 1 for a header announcing more
+*                       than HCI_MTU; for INSUFFICIENT_DATA, the number of bytes
+*                       needed
+*
+* \return VALID_FRAME, JUNK_DATA or INSUFFICIENT_DATA
+********************************************************************************** */
+FrameStatus HCIParseFrame(uint8_t *pData, uint32_t cbData, HCIFrame *frame, uint32_t *cbFrame)
+{
+    uint32_t cbHeader, length, i;
+
+    if (cbData == 0) {
+        *cbFrame = 1;
+        return INSUFFICIENT_DATA;
+    }
+
+    cbHeader = HCIHeaderSize(pData[0]);
+
+    if (cbHeader == 0) {
+        /* H4 has no sync byte, skip up to the next known packet indicator. */
+        for (i = 1; i < cbData && HCIHeaderSize(pData[i]) == 0; i++);
+        *cbFrame = i;
+        return JUNK_DATA;
+    }
+
+    if (cbData < cbHeader) {
+        *cbFrame = cbHeader;
+        return INSUFFICIENT_DATA;
+    }
+
+    switch (pData[0]) {
+        case HCI_EVENT_PACKET:
+            frame->id = pData[1];
+            length = pData[2];
+            break;
+
+        case HCI_ACL_DATA_PACKET:
+            frame->id = Read16(pData + 1, _LITTLE_ENDIAN);
+            length = Read16(pData + 3, _LITTLE_ENDIAN);
+            break;
+
+        case HCI_ISO_DATA_PACKET:
+            frame->id = Read16(pData + 1, _LITTLE_ENDIAN);
+            length = Read16(pData + 3, _LITTLE_ENDIAN) & HCI_ISO_LENGTH_MASK;
+            break;
+
+        default:
+            frame->id = Read16(pData + 1, _LITTLE_ENDIAN);
+            length = pData[3];
+    }
+
+    if (length > HCI_MTU) {
+        /* Most likely a stray packet indicator, drop it and resynchronize on the next byte. */
+        *cbFrame = 1;
+        return JUNK_DATA;
+    }
+
+    *cbFrame = cbHeader + length;
+
+    if (cbData < *cbFrame) {
+        return INSUFFICIENT_DATA;
+    }
+
+    frame->type = pData[0];
+    frame->length = length;
+    frame->data = length ? (pData + cbHeader) : NULL;
+    frame->timeStamp = 0;
+    frame->index = 0;
+    frame->firstByteNs = 0;
+    frame->completeNs = 0;
+
+    return VALID_FRAME;
+}
+
+/*! *********************************************************************************
+* \brief    Framer state machine entry point. The framer's receive window is parsed
+*           with HCIParseFrame and the bytes are released only once a whole packet or
+*           junk run is recognized, so the only allocation is the delivered HCIFrame,
+*           which carries its payload in the same block.
+*
+* \param[in,out] framer         pointer to a Framer object
+* \param[in,out] currentFrame   receives the frame to be dispatched, if any
+* \param[in,out] dataSize       the number of bytes available, decreased by the
+*                               number of bytes consumed
+*
+* \return the status of the current frame.
+********************************************************************************** */
+FrameStatus HCIStateMachineDispatch(Framer *framer, void **currentFrame, uint32_t *dataSize)
+{
+    HCIFrame parsed;
+    uint32_t cbFrame;
+    FrameStatus status = HCIParseWindow(framer, &parsed, &cbFrame, *dataSize);
+
+    if (status == INSUFFICIENT_DATA) {
+        framer->currentState = HCI_SM_JUNK_DATA;
+        return status;
+    }
+
+    if (status == VALID_FRAME) {
+        /* Copy before consuming, the window may point into the RX storage. */
+        *currentFrame = HCICopyFrame(framer, &parsed);
+    }
+
+    FramerConsume(framer, cbFrame);
+    *dataSize -= cbFrame;
+    framer->currentState = HCI_SM_FINISHED_FRAME;
+
+    return status;
+}
+
+/*! *********************************************************************************
+* \brief    Verifies if the data left inside the queue is enough to be considered a
+*           new packet, looking at the receive window in place.
+*
+* \param[in] framer             pointer to the Framer
+* \param[in, out] dataSize      pointer to a variable indicating the size of the queue
+*
+* \return 1 if is enough data to keep the loop open for a new packet 0 otherwise
+********************************************************************************** */
+int HCIQueueDataVerification(Framer *framer, uint32_t *dataSize)
+{
+    HCIFrame parsed;
+    uint8_t *pWindow;
+    uint32_t cbFrame;
+    uint32_t cbWindow;
+
+    pWindow = FramerGetWindow(framer, HCI_MAX_HEADER_SIZE, &cbWindow);
+
+    if (cbWindow > *dataSize) {
+        cbWindow = *dataSize;
+    }
+
+    if (HCIParseFrame(pWindow, cbWindow, &parsed, &cbFrame) != INSUFFICIENT_DATA) {
+        return 1;
+    }
+
+    return (cbFrame <= *dataSize);
+}
+
+/*! *********************************************************************************
+* \brief    Return the start state of the HCI state machine.
+********************************************************************************** */
+int HCIStartState(void)
+{
+    return HCI_SM_JUNK_DATA;
+}
+
+/*! *********************************************************************************
+* \brief    Return the final state of the HCI state machine.
+********************************************************************************** */
+int HCIFinalState(void)
+{
+    return HCI_SM_FINISHED_FRAME;
+}
+
+/*! *********************************************************************************
+* \brief    Assigns the HCI implementations to the function pointers of the framer.
+*           The length field, CRC field and endianness given to InitializeFramer do
+*           not apply, H4 fixes them per packet type.
+*
+* \param[in,out] framer     pointer to the Framer
+*
+* \return None
+********************************************************************************** */
+void HCIFramerInitialization(Framer *framer)
+{
+    framer->CreatePacket = CreateHCIPacket;
+    framer->SMStartState = HCIStartState;
+    framer->SMFinalState = HCIFinalState;
+    framer->StateMachineDispatch = HCIStateMachineDispatch;
+    framer->QueueDataVerification = HCIQueueDataVerification;
+}
+
+/************************************************************************************
+*************************************************************************************
+* Private functions
+*************************************************************************************
+************************************************************************************/
+
+/*! *********************************************************************************
+* \brief    Parses the front of the receive window, widening the window when the
+*           packet continues past the contiguous bytes. That happens at most twice:
+*           once to see the length field and once to see the whole packet.
+*
+* \param[in] framer             pointer to the Framer
+* \param[out] frame             the parsed frame, pointing into the window
+* \param[out] cbFrame           see HCIParseFrame
+* \param[in] dataSize           the number of bytes the thread routine accounted for
+*
+* \return the status returned by HCIParseFrame
+********************************************************************************** */
+static FrameStatus HCIParseWindow(Framer *framer, HCIFrame *frame, uint32_t *cbFrame, uint32_t dataSize)
+{
+    uint32_t cbDemanded = HCI_MAX_HEADER_SIZE;
+    uint32_t cbWindow;
+    uint8_t *pWindow, attempt;
+    FrameStatus status = INSUFFICIENT_DATA;
+
+    for (attempt = 0; attempt < 2; attempt++) {
+        pWindow = FramerGetWindow(framer, cbDemanded, &cbWindow);
+
+        /* Bytes received after the thread routine sampled the size are left for the
+           next round, to keep its accounting exact. */
+        if (cbWindow > dataSize) {
+            cbWindow = dataSize;
+        }
+
+        status = HCIParseFrame(pWindow, cbWindow, frame, cbFrame);
+
+        if (status != INSUFFICIENT_DATA || *cbFrame > dataSize || *cbFrame <= cbWindow) {
+            break;
+        }
+
+        cbDemanded = *cbFrame;
+    }
+
+    return status;
+}
+
+/*! *********************************************************************************
+* \brief    Allocates the frame delivered to the observers, with the payload stored
+*           right after the structure. DestroyHCIFrame releases both at once.
+*
+* \param[in] framer     pointer to the Framer from where the message queue is accessed
+* \param[in] parsed     frame returned by HCIParseFrame
+*
+* \return a pointer to a HCIFrame, NULL on allocation failure
+********************************************************************************** */
+static HCIFrame *HCICopyFrame(Framer *framer, HCIFrame *parsed)
+{
+    RawFrame *rawFrame;
+    HCIFrame *frame = (HCIFrame *)malloc(sizeof(HCIFrame) + parsed->length);
+
+    if (frame == NULL) {
+        logMessage(HSDK_WARNING, "[HCIFramer]HCICopyFrame", "frame memory allocation failed", HSDKThreadId());
+        return NULL;
+    }
+
+    *frame = *parsed;
+
+    if (parsed->length) {
+        frame->data = (uint8_t *)(frame + 1);
+        memcpy(frame->data, parsed->data, parsed->length);
+    }
+
+    frame->completeNs = MonotonicTimeNs();
+
+    if (framer->ring) {
+        /* The ring keeps no per-read boundaries, stamp the frame on decoding. */
+        frame->timeStamp = time(NULL);
+        frame->firstByteNs = frame->completeNs;
+    } else {
+        /* The packet indicator is the first byte of the front RawFrame. */
+        rawFrame = (RawFrame *)PeekFront(framer->queue);
+
+        if (rawFrame) {
+            frame->timeStamp = rawFrame->timeStamp;
+            frame->firstByteNs = rawFrame->timeStampNs;
+            frame->index = rawFrame->packetIndex;
+        }
+    }
+
+    return frame;
+}
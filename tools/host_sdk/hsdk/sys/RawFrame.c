@@ -14,9 +14,12 @@
 * Include
 *************************************************************************************
 ************************************************************************************/
+#include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 #include "RawFrame.h"
+#include "utils.h"
+#include "hsdkOSCommon.h"
 
 /************************************************************************************
 *************************************************************************************
@@ -30,6 +33,8 @@
 *************************************************************************************
 ************************************************************************************/
 RawFrame *CreateRawFrame(uint8_t *data, uint32_t size);
+static long AtomicIncrement(volatile long *pValue);
+static long AtomicDecrement(volatile long *pValue);
 
 /************************************************************************************
 *************************************************************************************
@@ -106,6 +111,108 @@ RawFrame *CreateTxRawFrame(uint8_t *data, uint32_t size)
 }
 
 
+/*! *********************************************************************************
+* \brief    Creates a RawFrame to be sent, whose data is left uninitialized for the
+*           caller to fill in place. The data is stored right after the structure,
+*           in the same block. It increments tx counter
+*
+* \param[in] size   the number of bytes to be sent
+*
+* \return   NULL on allocation failure, a pointer to a RawFrame object
+********************************************************************************** */
+RawFrame *CreateTxRawFrameInPlace(uint32_t size)
+{
+    RawFrame *frame = (RawFrame *)malloc(sizeof(RawFrame) + size);
+
+    if (!frame) {
+        return NULL;
+    }
+
+    frame->packetIndex = TxIndex++;
+    frame->aRawData = (uint8_t *)(frame + 1);
+    frame->cbTotalSize = size;
+    frame->iCrtIndex = 0;
+    frame->timeStamp = time(NULL);
+    frame->timeStampNs = MonotonicTimeNs();
+    frame->writtenNs = 0;
+    frame->pShared = NULL;
+
+    return frame;
+}
+
+/*! *********************************************************************************
+* \brief    Creates a buffer holding bytes received from the device, to be shared by
+*           the RawFrames handed to its observers. It increments rx counter. The
+*           caller holds a reference that is given up with ReleaseRxBuffer.
+*
+* \param[in] data   the bytes received
+* \param[in] size   the number of bytes received
+*
+* \return   NULL on allocation failure, a pointer to a RxBuffer object
+********************************************************************************** */
+RxBuffer *CreateRxBuffer(uint8_t *data, uint32_t size)
+{
+    RxBuffer *buffer = (RxBuffer *)malloc(offsetof(RxBuffer, aRawData) + (size ? size : 1));
+
+    if (!buffer) {
+        return NULL;
+    }
+
+    buffer->refCount = 1;
+    buffer->packetIndex = RxIndex++;
+    buffer->cbTotalSize = size;
+    buffer->timeStamp = time(NULL);
+    buffer->timeStampNs = MonotonicTimeNs();
+    memcpy(buffer->aRawData, data, size);
+
+    return buffer;
+}
+
+/*! *********************************************************************************
+* \brief    Creates a RawFrame over a shared RxBuffer, without copying the data. The
+*           RawFrame has its own processing index and takes a reference to the buffer,
+*           given up by DestroyRawFrame. The data must not be modified.
+*
+* \param[in] buffer     the RxBuffer
+*
+* \return   NULL on allocation failure, a pointer to a RawFrame object
+********************************************************************************** */
+RawFrame *CreateRxRawFrameFromBuffer(RxBuffer *buffer)
+{
+    RawFrame *frame = (RawFrame *)malloc(sizeof(RawFrame));
+
+    if (!frame) {
+        return NULL;
+    }
+
+    AtomicIncrement(&buffer->refCount);
+
+    frame->packetIndex = buffer->packetIndex;
+    frame->aRawData = buffer->aRawData;
+    frame->cbTotalSize = buffer->cbTotalSize;
+    frame->iCrtIndex = 0;
+    frame->timeStamp = buffer->timeStamp;
+    frame->timeStampNs = buffer->timeStampNs;
+    frame->writtenNs = 0;
+    frame->pShared = buffer;
+
+    return frame;
+}
+
+/*! *********************************************************************************
+* \brief    Gives up a reference to a RxBuffer, freeing it with the last one.
+*
+* \param[in] buffer     the RxBuffer
+*
+* \return   none
+********************************************************************************** */
+void ReleaseRxBuffer(RxBuffer *buffer)
+{
+    if (buffer != NULL && AtomicDecrement(&buffer->refCount) == 0) {
+        free(buffer);
+    }
+}
+
 /*! *********************************************************************************
 * \brief    Free the memory allocated for a RawFrame object.
 *
@@ -116,7 +223,12 @@ RawFrame *CreateTxRawFrame(uint8_t *data, uint32_t size)
 void DestroyRawFrame(RawFrame *frame)
 {
     if (frame != NULL) {
-        if (frame->aRawData != NULL) {
+        if (frame->pShared != NULL) {
+            /* The data belongs to the shared buffer. */
+            ReleaseRxBuffer(frame->pShared);
+        }
+        /* Data created in place is released along with the frame. */
+        else if (frame->aRawData != NULL && frame->aRawData != (uint8_t *)(frame + 1)) {
             free(frame->aRawData);
         }
 
@@ -134,6 +246,8 @@ RawFrame *CloneRawFrame(RawFrame *frame)
     }
 
     newFrame->timeStamp = frame->timeStamp;
+    newFrame->timeStampNs = frame->timeStampNs;
+    newFrame->writtenNs = frame->writtenNs;
     newFrame->aRawData = (uint8_t *)calloc(frame->cbTotalSize, sizeof(uint8_t));
 
     if (!newFrame->aRawData) {
@@ -176,6 +290,7 @@ RawFrame *CreateRawFrame(uint8_t *data, uint32_t size)
     }
 
     frame->timeStamp = time(NULL);
+    frame->timeStampNs = MonotonicTimeNs();
     frame->aRawData = (uint8_t *)calloc(size, sizeof(uint8_t));
 
     if (!frame->aRawData) {
@@ -190,3 +305,32 @@ RawFrame *CreateRawFrame(uint8_t *data, uint32_t size)
 
     return frame;
 }
+
+/*! *********************************************************************************
+* \brief  Atomically increment a reference count.
+*
+* \return the new value
+********************************************************************************** */
+static long AtomicIncrement(volatile long *pValue)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_add_fetch(pValue, 1, __ATOMIC_RELAXED);
+#else
+    return InterlockedIncrement(pValue);
+#endif
+}
+
+/*! *********************************************************************************
+* \brief  Atomically decrement a reference count. The last owner observes all the
+*         accesses made through the other references before it frees the object.
+*
+* \return the new value
+********************************************************************************** */
+static long AtomicDecrement(volatile long *pValue)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __atomic_sub_fetch(pValue, 1, __ATOMIC_ACQ_REL);
+#else
+    return InterlockedDecrement(pValue);
+#endif
+}
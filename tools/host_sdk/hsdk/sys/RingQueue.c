@@ -0,0 +1,334 @@
+/*
+ * \file RingQueue.c
+ * This is a source file for the RingQueue module.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/************************************************************************************
+ *************************************************************************************
+ * Include
+ *************************************************************************************
+ ************************************************************************************/
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "RingQueue.h"
+#include "hsdkAtomic.h"
+
+#include "hsdkError.h"
+
+/************************************************************************************
+ *************************************************************************************
+ * Private macros
+ *************************************************************************************
+ ************************************************************************************/
+#define RING_QUEUE_MIN_CAPACITY 64
+
+/************************************************************************************
+ *************************************************************************************
+ * Private prototypes
+ *************************************************************************************
+ ************************************************************************************/
+static void CopyOut(RingQueue *pRingQueue, uint32_t from, uint8_t *pDest, uint32_t cSize);
+
+/************************************************************************************
+ *************************************************************************************
+ * Public functions
+ *************************************************************************************
+ ************************************************************************************/
+
+/*! *********************************************************************************
+ * \brief  Allocate a ring queue.
+ *
+ * \param[in] capacity  minimum number of bytes the queue must hold; rounded up to
+ *                      the next power of two
+ *
+ * \return NULL on allocation failure, a pointer to the RingQueue otherwise
+ ********************************************************************************** */
+RingQueue *InitializeRingQueue(uint32_t capacity)
+{
+    uint32_t size = RING_QUEUE_MIN_CAPACITY;
+
+    if (capacity > 0x80000000) {
+        return NULL;
+    }
+
+    while (size < capacity) {
+        size <<= 1;
+    }
+
+    RingQueue *pRingQueue = (RingQueue *) calloc(1, sizeof(RingQueue));
+    if (pRingQueue == NULL) {
+        return NULL;
+    }
+
+    pRingQueue->buffer = (uint8_t *) malloc(size);
+    if (pRingQueue->buffer == NULL) {
+        free(pRingQueue);
+        return NULL;
+    }
+
+    pRingQueue->capacity = size;
+    pRingQueue->mask = size - 1;
+    pRingQueue->sAnnounceData = HSDKCreateEvent(0);
+    pRingQueue->sSpaceAvailable = HSDKCreateEvent(0);
+
+    return pRingQueue;
+}
+
+/*! *********************************************************************************
+ * \brief  Destroy the given ring queue. Neither side may use it afterwards.
+ *
+ * \param[in,out] pRingQueue    pointer to the queue to be freed
+ *
+ * \return HSDK_ERROR_SUCCESS
+ ********************************************************************************** */
+int DestroyRingQueue(RingQueue *pRingQueue)
+{
+    HSDKDestroyEvent(pRingQueue->sAnnounceData);
+    HSDKDestroyEvent(pRingQueue->sSpaceAvailable);
+    free(pRingQueue->buffer);
+    free(pRingQueue);
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+/*! *********************************************************************************
+ * \brief  Discard all the bytes currently stored. Must be called from the consumer.
+ *
+ * \param[in,out] pRingQueue    pointer to the queue
+ *
+ * \return HSDK_ERROR_SUCCESS
+ ********************************************************************************** */
+int ClearRingQueue(RingQueue *pRingQueue)
+{
+    RingQueueAdvance(pRingQueue, RingQueueGetContentSize(pRingQueue));
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+/*! *********************************************************************************
+ * \brief  Append bytes to the queue. Must be called from the producer.
+ * \details The write is all or nothing, so that a full queue drops whole chunks
+ * instead of splicing a partial one into the stream.
+ *
+ * \param[in,out] pRingQueue    pointer to the queue
+ * \param[in] pData             bytes to be stored
+ * \param[in] cSize             number of bytes to be stored
+ *
+ * \return cSize on success, 0 if there is not enough free space
+ ********************************************************************************** */
+uint32_t RingQueuePut(RingQueue *pRingQueue, const uint8_t *pData, uint32_t cSize)
+{
+    uint32_t head = pRingQueue->head;
+    uint32_t offset, first;
+
+    if (cSize > pRingQueue->capacity - (head - pRingQueue->cachedTail)) {
+        pRingQueue->cachedTail = LoadAcquire(&pRingQueue->tail);
+
+        if (cSize > pRingQueue->capacity - (head - pRingQueue->cachedTail)) {
+            return 0;
+        }
+    }
+
+    offset = head & pRingQueue->mask;
+    first = pRingQueue->capacity - offset;
+
+    if (first >= cSize) {
+        memcpy(pRingQueue->buffer + offset, pData, cSize);
+    } else {
+        memcpy(pRingQueue->buffer + offset, pData, first);
+        memcpy(pRingQueue->buffer, pData + first, cSize - first);
+    }
+
+    StoreRelease(&pRingQueue->head, head + cSize);
+
+    return cSize;
+}
+
+/*! *********************************************************************************
+ * \brief  Append bytes to the queue, blocking while it is full. Must be called from
+ *         the producer.
+ * \details The consumer only pays for a wake up when the producer is actually
+ * waiting, so the uncontended path stays free of system calls. Waiting pushes the
+ * back pressure down into the driver buffers instead of losing bytes here.
+ *
+ * \param[in,out] pRingQueue        pointer to the queue
+ * \param[in] pData                 bytes to be stored
+ * \param[in] cSize                 number of bytes to be stored
+ * \param[in] milisecondsToWait     how long to wait for the consumer to make room
+ *
+ * \return cSize on success, 0 if the queue did not drain in time or cSize exceeds
+ *         the capacity
+ ********************************************************************************** */
+uint32_t RingQueuePutWait(RingQueue *pRingQueue, const uint8_t *pData, uint32_t cSize, int64_t milisecondsToWait)
+{
+    if (cSize > pRingQueue->capacity) {
+        return 0;
+    }
+
+    while (!RingQueuePut(pRingQueue, pData, cSize)) {
+        pRingQueue->spaceWanted = 1;
+        FullBarrier();
+
+        /* The consumer may have advanced before it could see the flag. */
+        if (RingQueuePut(pRingQueue, pData, cSize)) {
+            break;
+        }
+
+        if (HSDKWaitEvent(pRingQueue->sSpaceAvailable, milisecondsToWait) != 1) {
+            pRingQueue->spaceWanted = 0;
+            return 0;
+        }
+    }
+
+    return cSize;
+}
+
+/*! *********************************************************************************
+ * \brief  Number of bytes that can be written without dropping. Must be called from
+ *         the producer.
+ *
+ * \param[in] pRingQueue    pointer to the queue
+ *
+ * \return the free space in bytes
+ ********************************************************************************** */
+uint32_t RingQueueGetFreeSpace(RingQueue *pRingQueue)
+{
+    pRingQueue->cachedTail = LoadAcquire(&pRingQueue->tail);
+
+    return pRingQueue->capacity - (pRingQueue->head - pRingQueue->cachedTail);
+}
+
+/*! *********************************************************************************
+ * \brief  Remove bytes from the front of the queue. Must be called from the consumer.
+ *
+ * \param[in,out] pRingQueue    pointer to the queue
+ * \param[out] pDest            buffer receiving the bytes
+ * \param[in] cSize             maximum number of bytes to be read
+ *
+ * \return the number of bytes copied into pDest
+ ********************************************************************************** */
+uint32_t RingQueueGet(RingQueue *pRingQueue, uint8_t *pDest, uint32_t cSize)
+{
+    uint32_t cRead = RingQueuePeek(pRingQueue, pDest, cSize);
+
+    RingQueueAdvance(pRingQueue, cRead);
+
+    return cRead;
+}
+
+/*! *********************************************************************************
+ * \brief  Copy bytes from the front of the queue without removing them. Must be
+ *         called from the consumer.
+ *
+ * \param[in] pRingQueue    pointer to the queue
+ * \param[out] pDest        buffer receiving the bytes
+ * \param[in] cSize         maximum number of bytes to be read
+ *
+ * \return the number of bytes copied into pDest
+ ********************************************************************************** */
+uint32_t RingQueuePeek(RingQueue *pRingQueue, uint8_t *pDest, uint32_t cSize)
+{
+    uint32_t available = RingQueueGetContentSize(pRingQueue);
+
+    if (cSize > available) {
+        cSize = available;
+    }
+
+    CopyOut(pRingQueue, pRingQueue->tail, pDest, cSize);
+
+    return cSize;
+}
+
+/*! *********************************************************************************
+ * \brief  Zero-copy access to the front of the queue. Must be called from the
+ *         consumer; the bytes stay valid until RingQueueAdvance() releases them.
+ *
+ * \param[in] pRingQueue        pointer to the queue
+ * \param[out] cContiguous      number of bytes readable at the returned address; it
+ *                              can be less than the content size when the data wraps
+ *
+ * \return pointer to the oldest byte in the queue
+ ********************************************************************************** */
+uint8_t *RingQueueReadPointer(RingQueue *pRingQueue, uint32_t *cContiguous)
+{
+    uint32_t available = RingQueueGetContentSize(pRingQueue);
+    uint32_t offset = pRingQueue->tail & pRingQueue->mask;
+    uint32_t first = pRingQueue->capacity - offset;
+
+    *cContiguous = (available < first) ? available : first;
+
+    return pRingQueue->buffer + offset;
+}
+
+/*! *********************************************************************************
+ * \brief  Release bytes from the front of the queue. Must be called from the
+ *         consumer.
+ *
+ * \param[in,out] pRingQueue    pointer to the queue
+ * \param[in] cSize             number of bytes to release, at most the content size
+ *
+ * \return None
+ ********************************************************************************** */
+void RingQueueAdvance(RingQueue *pRingQueue, uint32_t cSize)
+{
+    StoreRelease(&pRingQueue->tail, pRingQueue->tail + cSize);
+    FullBarrier();
+
+    if (pRingQueue->spaceWanted) {
+        pRingQueue->spaceWanted = 0;
+        HSDKSignalEvent(pRingQueue->sSpaceAvailable);
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  Number of bytes waiting in the queue. Must be called from the consumer.
+ *
+ * \param[in] pRingQueue    pointer to the queue
+ *
+ * \return the content size in bytes
+ ********************************************************************************** */
+uint32_t RingQueueGetContentSize(RingQueue *pRingQueue)
+{
+    return LoadAcquire(&pRingQueue->head) - pRingQueue->tail;
+}
+
+/*! *********************************************************************************
+ * \brief  Checks if the queue is empty. Must be called from the consumer.
+ *
+ * \param[in] pRingQueue    pointer to the queue
+ *
+ * \return 1 if the queue is empty and 0 otherwise.
+ ********************************************************************************** */
+uint8_t RingQueueIsEmpty(RingQueue *pRingQueue)
+{
+    return (RingQueueGetContentSize(pRingQueue) == 0);
+}
+
+/************************************************************************************
+ *************************************************************************************
+ * Private functions
+ *************************************************************************************
+ ************************************************************************************/
+
+/*! *********************************************************************************
+ * \brief  Copy cSize bytes starting at the free running index from, handling the
+ *         wrap around the end of the storage.
+ ********************************************************************************** */
+static void CopyOut(RingQueue *pRingQueue, uint32_t from, uint8_t *pDest, uint32_t cSize)
+{
+    uint32_t offset = from & pRingQueue->mask;
+    uint32_t first = pRingQueue->capacity - offset;
+
+    if (first >= cSize) {
+        memcpy(pDest, pRingQueue->buffer + offset, cSize);
+    } else {
+        memcpy(pDest, pRingQueue->buffer + offset, first);
+        memcpy(pDest + first, pRingQueue->buffer, cSize - first);
+    }
+}
@@ -13,14 +13,20 @@
 
 #include "hsdkOSCommon.h"
 #include "hsdkLogger.h"
+#include "hsdkTrace.h"
 
 #define DEBUG 0
 #define USE_AIO 0
 
+/* The number of buffers handed to a single writev call. */
+#define HSDK_WRITEV_MAX 64
+
 
 void printBuffer(const char *tag, uint8_t *buff, int size)
 {
-#if DEBUG
+#ifdef USE_TRACE
+    TraceBytes(tag, buff, (uint32_t)size);
+#elif DEBUG
     int i;
     printf("%s: ", tag);
 
@@ -153,6 +159,46 @@ int HSDKWriteFile(File file, uint8_t *buffer, uint32_t count)
 #endif
 }
 
+int HSDKWriteFileVector(File file, uint8_t **buffers, uint32_t *counts, uint32_t cBuffers)
+{
+    /* No gather write on serial handles, copy into a single buffer. */
+    uint32_t i, cbTotal = 0;
+    uint8_t *buffer;
+    int rc;
+
+    for (i = 0; i < cBuffers; i++) {
+        cbTotal += counts[i];
+    }
+
+    buffer = (uint8_t *)malloc(cbTotal);
+
+    if (buffer == NULL) {
+        logMessage(HSDK_ERROR, "[hsdkFile]HSDKWriteFileVector", "Failed to allocate the gather buffer", HSDKThreadId());
+        SetLastError(ERROR_NOT_ENOUGH_MEMORY);
+        return -1;
+    }
+
+    for (cbTotal = 0, i = 0; i < cBuffers; i++) {
+        memcpy(buffer + cbTotal, buffers[i], counts[i]);
+        cbTotal += counts[i];
+    }
+
+    rc = HSDKWriteFile(file, buffer, cbTotal);
+
+#if !USE_AIO
+    /* With AIO the completion routine releases the buffer. */
+    free(buffer);
+#endif
+
+    /* HSDKWriteFile returns a Windows error code, callers expect a byte count or -1. */
+    if (rc != ERROR_SUCCESS) {
+        SetLastError((DWORD)rc);
+        return -1;
+    }
+
+    return (int)cbTotal;
+}
+
 int HSDKReadFile(File file, uint8_t *buffer, uint32_t *count)
 {
     OVERLAPPED ov;
@@ -205,6 +251,7 @@ void HSDKInvalidateDescriptor(File *f)
 #include <unistd.h>
 
 #include <sys/types.h>
+#include <sys/uio.h>
 
 #if USE_AIO
 #include <aio.h>
@@ -286,6 +333,73 @@ int HSDKWriteFile(File file, uint8_t *buffer, uint32_t count)
     return rc;
 }
 
+int HSDKWriteFileVector(File file, uint8_t **buffers, uint32_t *counts, uint32_t cBuffers)
+{
+    uint32_t i, cbWritten = 0;
+
+#if USE_AIO
+    /* aio_write has no gather form, keep the requests in order one by one. */
+    for (i = 0; i < cBuffers; i++) {
+        if (HSDKWriteFile(file, buffers[i], counts[i]) == -1) {
+            return -1;
+        }
+
+        cbWritten += counts[i];
+    }
+
+    return (int)cbWritten;
+#else
+    struct iovec iov[HSDK_WRITEV_MAX];
+    uint32_t cIov;
+    ssize_t rc;
+
+    while (cBuffers) {
+        cIov = (cBuffers < HSDK_WRITEV_MAX) ? cBuffers : HSDK_WRITEV_MAX;
+
+        for (i = 0; i < cIov; i++) {
+            printBuffer("TX", buffers[i], counts[i]);
+            iov[i].iov_base = buffers[i];
+            iov[i].iov_len = counts[i];
+        }
+
+        i = 0;
+
+        while (i < cIov) {
+            rc = writev(file, iov + i, (int)(cIov - i));
+
+            if (rc == -1) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                perror("HSDKWriteFileVector writev");
+                logMessage(HSDK_ERROR, "[HSDKWriteFileVector] writev", strerror(errno), HSDKThreadId());
+                return -1;
+            }
+
+            cbWritten += (uint32_t)rc;
+
+            /* Skip what was written, a partial write may end inside a buffer. */
+            while (i < cIov && (size_t)rc >= iov[i].iov_len) {
+                rc -= (ssize_t)iov[i].iov_len;
+                i++;
+            }
+
+            if (i < cIov) {
+                iov[i].iov_base = (uint8_t *)iov[i].iov_base + rc;
+                iov[i].iov_len -= (size_t)rc;
+            }
+        }
+
+        buffers += cIov;
+        counts += cIov;
+        cBuffers -= cIov;
+    }
+
+    return (int)cbWritten;
+#endif
+}
+
 int HSDKReadFile(File file, uint8_t *buffer, uint32_t *count)
 {
     int rc = read(file, buffer, *count);
@@ -12,6 +12,7 @@
 #include "hsdkLogger.h"
 
 #include "hsdkError.h"
+#include "hsdkTrace.h"
 
 #include <stdio.h>
 #include <string.h>
@@ -25,10 +26,13 @@
 
 Logger *logger = NULL;
 FILE *logFile = NULL;
-#ifdef USE_LOGGER
+#if defined(USE_LOGGER) || defined(USE_TRACE)
 static Lock initialLock;
 static int initialLockSet = 0;
 #endif
+#ifdef USE_TRACE
+static volatile int traceStopping = 0;
+#endif
 
 #ifndef LOG_PRIORITY
 #define LOG_PRIORITY 3
@@ -65,10 +69,14 @@ static void *LoggerThreadRoutine(void *lpParameter)
 
                 if (line != NULL) {
                     fprintf(logFile, "%s", line);
-                    fflush(logFile);
                     free(line);
                 }
 
+                /* Flush once the burst of messages is written, not after each line. */
+                if (MessageQueueGetContentSize(logger->queue) == 0) {
+                    fflush(logFile);
+                }
+
                 HSDKResetEvent(eventArray[1]);
         }
     }
@@ -79,17 +87,44 @@ static void *LoggerThreadRoutine(void *lpParameter)
         char *line = (char *)MessageQueueGet(logger->queue);
         if (line != NULL) {
             fprintf(logFile, "%s", line);
-            fflush(logFile);
             free(line);
         }
     }
+    fflush(logFile);
+
+    return NULL;
+}
+
+#ifdef USE_TRACE
+/*! *********************************************************************************
+ * \brief  Periodically write the records of all the threads to the trace file.
+ ********************************************************************************** */
+static void *TraceThreadRoutine(void *lpParameter)
+{
+    /* The wait below would otherwise trace a timeout at each period. */
+    TraceMuteThread();
+
+    while (!traceStopping) {
+        HSDKWaitEvent(logger->stopThread, TRACE_DRAIN_PERIOD_MS);
+        TraceDrain();
+    }
 
     return NULL;
 }
+#endif
 
 void logMessage(int prio, const char *messageTag, const char *message, int threadId)
 {
-#ifdef USE_LOGGER
+#ifdef USE_TRACE
+    if (prio > LOG_PRIORITY) {
+        return;
+    }
+
+    /* No formatting on the caller thread, the decoder rebuilds the line. */
+    if (logger != NULL) {
+        TraceEventFromThread((uint32_t)threadId, TRACE_EVT_LOG, (uint32_t)prio, TraceString(messageTag), TraceString(message), 0);
+    }
+#elif defined(USE_LOGGER)
     if (prio > LOG_PRIORITY) {
         return;
     }
@@ -107,7 +142,7 @@ void logMessage(int prio, const char *messageTag, const char *message, int threa
 
 void initLogger(char *filename)
 {
-#ifdef USE_LOGGER
+#if defined(USE_LOGGER) || defined(USE_TRACE)
     if (logger == NULL) {
         if (!initialLockSet) {
             initialLock = HSDKCreateLock();
@@ -127,12 +162,18 @@ void initLogger(char *filename)
 
             logger->referenceCount = 0;
             logger->stopThread = HSDKCreateEvent(0);
+#ifdef USE_TRACE
+            traceStopping = 0;
+            TraceOpen(filename);
+            logger->loggerThread = HSDKCreateThread(TraceThreadRoutine, NULL);
+#else
             logger->loggerThread = HSDKCreateThread(LoggerThreadRoutine, NULL);
 
             if (filename)
                 logFile = fopen(filename, "w");
             else
                 logFile = fopen(DEFAULT_LOG, "w");
+#endif
         }
         logger->referenceCount++;
         HSDKReleaseLock(initialLock);
@@ -148,7 +189,7 @@ void initLogger(char *filename)
 
 void closeLogger()
 {
-#ifdef USE_LOGGER
+#if defined(USE_LOGGER) || defined(USE_TRACE)
     if (logger->referenceCount) {
         HSDKAcquireLock(initialLock);
         if (logger->referenceCount) {
@@ -160,13 +201,21 @@ void closeLogger()
     if (!logger->referenceCount) {
         HSDKAcquireLock(initialLock);
         if (logger != NULL) {
+#ifdef USE_TRACE
+            traceStopping = 1;
+#endif
             HSDKSignalEvent(logger->stopThread);
             HSDKDestroyThread(logger->loggerThread);
             HSDKDestroyEvent(logger->stopThread);
             DestroyMessageQueue(logger->queue);
 
             logger->queue = NULL;
+#ifdef USE_TRACE
+            /* Writes what was recorded since the last period. */
+            TraceClose();
+#else
             fclose(logFile);
+#endif
             free(logger);
             logger = NULL;
             logFile = NULL;
@@ -0,0 +1,469 @@
+/*
+ * \file hsdkReactor.c
+ * This is a source file for the Reactor module.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/************************************************************************************
+ *************************************************************************************
+ * Include
+ *************************************************************************************
+ ************************************************************************************/
+#ifdef __linux__
+#define _GNU_SOURCE
+#endif
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "hsdkReactor.h"
+
+#include "hsdkError.h"
+#include "hsdkLogger.h"
+
+#ifdef __linux__
+
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/epoll.h>
+
+/************************************************************************************
+ *************************************************************************************
+ * Private prototypes
+ *************************************************************************************
+ ************************************************************************************/
+static void *ReactorThreadRoutine(void *lpParameter);
+static Reactor *CreateReactor(uint32_t index, uint8_t pinCpu);
+static void DestroyReactor(Reactor *reactor);
+static int ReactorLock(Reactor *reactor);
+static void ReactorUnlock(Reactor *reactor, int locked);
+
+/************************************************************************************
+ *************************************************************************************
+ * Private memory declarations
+ *************************************************************************************
+ ************************************************************************************/
+static Reactor *loops[REACTOR_MAX_LOOPS];
+static uint32_t cLoopsCreated = 0;
+static uint32_t nextLoop = 0;
+static uint32_t referenceCount = 0;
+static Lock poolLock;
+static int poolLockSet = 0;
+
+/************************************************************************************
+ *************************************************************************************
+ * Public functions
+ *************************************************************************************
+ ************************************************************************************/
+
+/*! *********************************************************************************
+ * \brief  Take a reference on the pool of event loops, starting it on first use,
+ *         and give the loop the caller should use. The loops are handed out in
+ *         turn, so the devices are spread evenly.
+ *
+ * \param[in] cLoops    the number of loops of the pool, only used when starting it
+ * \param[in] pinCpus   1 to bind loop i to CPU i, only used when starting the pool
+ *
+ * \return the loop, NULL if the pool cannot be started
+ ********************************************************************************** */
+Reactor *ReactorAcquire(uint32_t cLoops, uint8_t pinCpus)
+{
+    Reactor *reactor = NULL;
+    uint32_t i;
+
+    if (!poolLockSet) {
+        poolLock = HSDKCreateLock();
+        poolLockSet = 1;
+    }
+
+    HSDKAcquireLock(poolLock);
+
+    if (referenceCount == 0) {
+        if (cLoops == 0) {
+            cLoops = 1;
+        } else if (cLoops > REACTOR_MAX_LOOPS) {
+            cLoops = REACTOR_MAX_LOOPS;
+        }
+
+        for (i = 0; i < cLoops; i++) {
+            loops[i] = CreateReactor(i, pinCpus);
+
+            if (loops[i] == NULL) {
+                logMessage(HSDK_ERROR, "[Reactor]ReactorAcquire", "Event loop creation failed", HSDKThreadId());
+                break;
+            }
+        }
+
+        cLoopsCreated = i;
+        nextLoop = 0;
+    }
+
+    if (cLoopsCreated > 0) {
+        reactor = loops[nextLoop++ % cLoopsCreated];
+        referenceCount++;
+    }
+
+    HSDKReleaseLock(poolLock);
+
+    return reactor;
+}
+
+/*! *********************************************************************************
+ * \brief  Give back a reference taken with ReactorAcquire. The last one stops the
+ *         loops; all the sources must have been removed before.
+ *
+ * \param[in] reactor   the loop returned by ReactorAcquire
+ ********************************************************************************** */
+void ReactorRelease(Reactor *reactor)
+{
+    uint32_t i;
+
+    if (reactor == NULL) {
+        return;
+    }
+
+    HSDKAcquireLock(poolLock);
+
+    if (referenceCount && --referenceCount == 0) {
+        for (i = 0; i < cLoopsCreated; i++) {
+            DestroyReactor(loops[i]);
+            loops[i] = NULL;
+        }
+
+        cLoopsCreated = 0;
+    }
+
+    HSDKReleaseLock(poolLock);
+}
+
+/*! *********************************************************************************
+ * \brief  Watch an event from a loop. May be called from any thread, including
+ *         from a handler of the same loop.
+ *
+ * \param[in] reactor       the loop
+ * \param[in] e             the event; a device event or an HSDKCreateEvent one
+ * \param[in] edgeTriggered 1 to call the handler only when new data arrives, so it
+ *                          must read all there is; 0 to call it while data is left
+ * \param[in] handler       called from the loop thread when the event is ready
+ * \param[in] context       passed to the handler
+ *
+ * \return the source, enabled, NULL on failure
+ ********************************************************************************** */
+ReactorSource *ReactorAdd(Reactor *reactor, Event e, uint8_t edgeTriggered, ReactorHandler handler, void *context)
+{
+    ReactorSource *source = (ReactorSource *)calloc(1, sizeof(ReactorSource));
+    struct epoll_event evt;
+
+    if (source == NULL) {
+        logMessage(HSDK_ERROR, "[Reactor]ReactorAdd", "Memory allocation failed", HSDKThreadId());
+        return NULL;
+    }
+
+    source->event = e;
+    source->handler = handler;
+    source->context = context;
+    source->edgeTriggered = edgeTriggered;
+    source->enabled = 1;
+
+    memset(&evt, 0, sizeof(evt));
+    evt.events = (e->gpioPollEvent ? EPOLLPRI : EPOLLIN) | (edgeTriggered ? EPOLLET : 0);
+    evt.data.ptr = source;
+
+    if (epoll_ctl(reactor->pollHandle, EPOLL_CTL_ADD, e->event, &evt) == -1) {
+        logMessage(HSDK_ERROR, "[Reactor]ReactorAdd", strerror(errno), HSDKThreadId());
+        free(source);
+        return NULL;
+    }
+
+    return source;
+}
+
+/*! *********************************************************************************
+ * \brief  Stop or resume calling the handler of a source. A level triggered source
+ *         with data left would otherwise keep the loop spinning while its owner
+ *         cannot make progress.
+ *
+ * \param[in] reactor   the loop of the source
+ * \param[in] source    the source returned by ReactorAdd
+ * \param[in] enabled   0 to ignore the source, 1 to watch it again
+ *
+ * \return HSDK_ERROR_SUCCESS, HSDK_ERROR_INVALID if the loop rejected the change
+ ********************************************************************************** */
+int ReactorEnable(Reactor *reactor, ReactorSource *source, uint8_t enabled)
+{
+    struct epoll_event evt;
+
+    if (source->enabled == enabled) {
+        return HSDK_ERROR_SUCCESS;
+    }
+
+    memset(&evt, 0, sizeof(evt));
+    evt.events = enabled ? ((source->event->gpioPollEvent ? EPOLLPRI : EPOLLIN) | (source->edgeTriggered ? EPOLLET : 0)) : 0;
+    evt.data.ptr = source;
+
+    if (epoll_ctl(reactor->pollHandle, EPOLL_CTL_MOD, source->event->event, &evt) == -1) {
+        logMessage(HSDK_ERROR, "[Reactor]ReactorEnable", strerror(errno), HSDKThreadId());
+        return HSDK_ERROR_INVALID;
+    }
+
+    source->enabled = enabled;
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+/*! *********************************************************************************
+ * \brief  Stop watching a source. Once this returns, its handler is not running and
+ *         is not called anymore, so the context may be freed. The source itself is
+ *         freed by the loop.
+ *
+ * \param[in] reactor   the loop of the source
+ * \param[in] source    the source returned by ReactorAdd
+ ********************************************************************************** */
+void ReactorRemove(Reactor *reactor, ReactorSource *source)
+{
+    int locked;
+
+    if (source == NULL) {
+        return;
+    }
+
+    locked = ReactorLock(reactor);
+
+    epoll_ctl(reactor->pollHandle, EPOLL_CTL_DEL, source->event->event, NULL);
+
+    /* It may still be in the events returned by the current wait. */
+    source->removed = 1;
+    source->nextRemoved = reactor->removed;
+    reactor->removed = source;
+
+    ReactorUnlock(reactor, locked);
+}
+
+/*! *********************************************************************************
+ * \brief  Check, without waiting, whether an event has data left. Lets an edge
+ *         triggered handler stop reading before a read that would block.
+ *
+ * \param[in] e     the event
+ *
+ * \return 1 if data is ready, 0 otherwise
+ ********************************************************************************** */
+int ReactorPending(Event e)
+{
+    struct pollfd pfd;
+
+    pfd.fd = e->event;
+    pfd.events = e->gpioPollEvent ? POLLPRI : POLLIN;
+    pfd.revents = 0;
+
+    return poll(&pfd, 1, 0) > 0 && (pfd.revents & pfd.events);
+}
+
+/************************************************************************************
+ *************************************************************************************
+ * Private functions
+ *************************************************************************************
+ ************************************************************************************/
+
+/*! *********************************************************************************
+ * \brief  Wait for the ready sources of a loop and call their handlers, until the
+ *         stop event is signaled.
+ *
+ * \param[in] lpParameter   pointer to the Reactor
+ *
+ * \return NULL
+ ********************************************************************************** */
+static void *ReactorThreadRoutine(void *lpParameter)
+{
+    Reactor *reactor = (Reactor *)lpParameter;
+    struct epoll_event events[REACTOR_MAX_EVENTS];
+    ReactorSource *source;
+    int cEvents, i, stop = 0;
+
+    reactor->threadId = HSDKThreadId();
+
+    if (reactor->pinCpu) {
+        cpu_set_t cpus;
+        long cCpus = sysconf(_SC_NPROCESSORS_ONLN);
+
+        CPU_ZERO(&cpus);
+        CPU_SET(reactor->index % (cCpus > 0 ? cCpus : 1), &cpus);
+
+        if (pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus) != 0) {
+            logMessage(HSDK_WARNING, "[Reactor]ReactorThreadRoutine", "Could not bind the loop to its CPU", HSDKThreadId());
+        }
+    }
+
+    while (!stop) {
+        cEvents = epoll_wait(reactor->pollHandle, events, REACTOR_MAX_EVENTS, -1);
+
+        if (cEvents == -1) {
+            if (errno == EINTR) {
+                continue;
+            }
+
+            logMessage(HSDK_ERROR, "[Reactor]ReactorThreadRoutine", strerror(errno), HSDKThreadId());
+            break;
+        }
+
+        HSDKAcquireLock(reactor->lock);
+
+        for (i = 0; i < cEvents; i++) {
+            source = (ReactorSource *)events[i].data.ptr;
+
+            if (source == NULL) {
+                stop = 1;
+            } else if (!source->removed && source->enabled) {
+                source->handler(source->context);
+            }
+        }
+
+        while (reactor->removed != NULL) {
+            source = reactor->removed;
+            reactor->removed = source->nextRemoved;
+            free(source);
+        }
+
+        HSDKReleaseLock(reactor->lock);
+    }
+
+    logMessage(HSDK_INFO, "[Reactor]ReactorThreadRoutine", "Event loop finished", HSDKThreadId());
+
+    return NULL;
+}
+
+static Reactor *CreateReactor(uint32_t index, uint8_t pinCpu)
+{
+    Reactor *reactor = (Reactor *)calloc(1, sizeof(Reactor));
+    struct epoll_event evt;
+
+    if (reactor == NULL) {
+        return NULL;
+    }
+
+    reactor->index = index;
+    reactor->pinCpu = pinCpu;
+    reactor->pollHandle = epoll_create1(EPOLL_CLOEXEC);
+
+    if (reactor->pollHandle == -1) {
+        free(reactor);
+        return NULL;
+    }
+
+    reactor->stopThread = HSDKCreateEvent(0);
+    reactor->lock = HSDKCreateLock();
+
+    /* The stop event is the only source without a ReactorSource. */
+    memset(&evt, 0, sizeof(evt));
+    evt.events = EPOLLIN;
+    evt.data.ptr = NULL;
+
+    if (reactor->stopThread == INVALID_EVENT_HANDLE ||
+            epoll_ctl(reactor->pollHandle, EPOLL_CTL_ADD, reactor->stopThread->event, &evt) == -1) {
+        if (reactor->stopThread != INVALID_EVENT_HANDLE) {
+            HSDKDestroyEvent(reactor->stopThread);
+        }
+        HSDKDestroyLock(reactor->lock);
+        free(reactor->lock);
+        close(reactor->pollHandle);
+        free(reactor);
+        return NULL;
+    }
+
+    reactor->loopThread = HSDKCreateThread(ReactorThreadRoutine, reactor);
+
+    if (!reactor->loopThread) {
+        HSDKDestroyEvent(reactor->stopThread);
+        HSDKDestroyLock(reactor->lock);
+        free(reactor->lock);
+        close(reactor->pollHandle);
+        free(reactor);
+        return NULL;
+    }
+
+    return reactor;
+}
+
+static void DestroyReactor(Reactor *reactor)
+{
+    ReactorSource *source;
+
+    HSDKSignalEvent(reactor->stopThread);
+    HSDKDestroyThread(reactor->loopThread);
+
+    /* Removed after the last dispatch. */
+    while (reactor->removed != NULL) {
+        source = reactor->removed;
+        reactor->removed = source->nextRemoved;
+        free(source);
+    }
+
+    HSDKDestroyEvent(reactor->stopThread);
+    HSDKDestroyLock(reactor->lock);
+    free(reactor->lock);
+    close(reactor->pollHandle);
+    free(reactor);
+}
+
+/*! *********************************************************************************
+ * \brief  Wait for the current dispatch to end, unless called from a handler.
+ *
+ * \return 1 if the lock was taken and must be released
+ ********************************************************************************** */
+static int ReactorLock(Reactor *reactor)
+{
+    if (reactor->threadId == HSDKThreadId()) {
+        return 0;
+    }
+
+    HSDKAcquireLock(reactor->lock);
+
+    return 1;
+}
+
+static void ReactorUnlock(Reactor *reactor, int locked)
+{
+    if (locked) {
+        HSDKReleaseLock(reactor->lock);
+    }
+}
+
+#else
+
+/* Only the Linux builds have an event loop, the devices keep their own threads. */
+Reactor *ReactorAcquire(uint32_t cLoops, uint8_t pinCpus)
+{
+    return NULL;
+}
+
+void ReactorRelease(Reactor *reactor)
+{
+}
+
+ReactorSource *ReactorAdd(Reactor *reactor, Event e, uint8_t edgeTriggered, ReactorHandler handler, void *context)
+{
+    return NULL;
+}
+
+int ReactorEnable(Reactor *reactor, ReactorSource *source, uint8_t enabled)
+{
+    return HSDK_ERROR_INVALID;
+}
+
+void ReactorRemove(Reactor *reactor, ReactorSource *source)
+{
+}
+
+int ReactorPending(Event e)
+{
+    return 0;
+}
+
+#endif
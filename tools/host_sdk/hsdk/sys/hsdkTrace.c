@@ -0,0 +1,501 @@
+/*
+ * \file hsdkTrace.c
+ * This is a source file for the Trace module.
+ *
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/************************************************************************************
+ *************************************************************************************
+ * Include
+ *************************************************************************************
+ ************************************************************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hsdkTrace.h"
+#include "hsdkAtomic.h"
+
+#include "hsdkError.h"
+#include "utils.h"
+
+/************************************************************************************
+ *************************************************************************************
+ * Private macros
+ *************************************************************************************
+ ************************************************************************************/
+#if defined(_MSC_VER)
+#define TRACE_THREAD_LOCAL __declspec(thread)
+#else
+#define TRACE_THREAD_LOCAL __thread
+#endif
+
+/************************************************************************************
+ *************************************************************************************
+ * Private type definitions
+ *************************************************************************************
+ ************************************************************************************/
+/**
+ * @brief The records of one thread, written only by that thread and read only by the
+ * logger thread. The indexes are free running; head - tail records are pending.
+ */
+typedef struct TraceRing {
+    volatile uint32_t head;     /**< Owner: number of records made. */
+    volatile uint32_t tail;     /**< Logger thread: number of records written to the file. */
+    volatile uint32_t dropped;  /**< Owner: records lost because the ring was full. */
+    volatile uint32_t owned;    /**< 1 while a thread records in the ring, 0 once it exited. */
+    uint32_t reported;          /**< Logger thread: dropped records already in the file. */
+    uint32_t threadId;          /**< The owner. */
+    struct TraceRing *next;     /**< The ring of another thread. */
+    TraceRecord records[TRACE_RING_RECORDS];
+} TraceRing;
+
+/**
+ * @brief An interned string. str is published last, with a release store.
+ */
+typedef struct {
+    const char *volatile str;
+    uint32_t hash;
+} TraceStringEntry;
+
+/************************************************************************************
+ *************************************************************************************
+ * Private prototypes
+ *************************************************************************************
+ ************************************************************************************/
+static TraceRing *TraceRingForThread(uint32_t threadId);
+#ifdef _WIN32
+static void WINAPI TraceRingRelease(void *ring);
+#else
+static void TraceRingRelease(void *ring);
+#endif
+static int RingPut(TraceRing *ring, uint32_t threadId, uint16_t eventId, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3);
+static void WriteStrings(void);
+
+/************************************************************************************
+ *************************************************************************************
+ * Private memory declarations
+ *************************************************************************************
+ ************************************************************************************/
+static FILE *traceFile = NULL;
+static volatile uint32_t traceEnabled = 0;
+static TraceRing *volatile traceRings = NULL;
+
+static TRACE_THREAD_LOCAL TraceRing *threadRing = NULL;
+static TRACE_THREAD_LOCAL uint8_t threadMuted = 0;
+
+/* Hands the ring of an exiting thread back for reuse by the next thread. */
+#ifdef _WIN32
+static DWORD ringExitKey = FLS_OUT_OF_INDEXES;
+#else
+static pthread_key_t ringExitKey;
+#endif
+static int ringExitKeySet = 0;
+
+static TraceStringEntry strings[TRACE_MAX_STRINGS];
+static uint8_t stringWritten[TRACE_MAX_STRINGS];    /* logger thread only */
+static volatile uint32_t stringsAdded = 0;
+static uint32_t stringsSeen = 0;                    /* logger thread only */
+static Lock stringsLock;
+static int stringsLockSet = 0;
+
+/************************************************************************************
+ *************************************************************************************
+ * Public functions
+ *************************************************************************************
+ ************************************************************************************/
+
+/*! *********************************************************************************
+ * \brief  Create the trace file and start accepting records.
+ *
+ * \param[in] filename  the trace file, DEFAULT_TRACE if NULL
+ *
+ * \return HSDK_ERROR_SUCCESS, HSDK_ERROR_INVALID if the file cannot be created
+ ********************************************************************************** */
+int TraceOpen(const char *filename)
+{
+    uint32_t header[2] = { TRACE_FILE_VERSION, sizeof(TraceRecord) };
+
+    if (traceFile != NULL) {
+        return HSDK_ERROR_SUCCESS;
+    }
+
+    traceFile = fopen(filename ? filename : DEFAULT_TRACE, "wb");
+
+    if (traceFile == NULL) {
+        return HSDK_ERROR_INVALID;
+    }
+
+    fwrite(TRACE_FILE_MAGIC, 1, 8, traceFile);
+    fwrite(header, sizeof(header), 1, traceFile);
+
+    if (!stringsLockSet) {
+        stringsLock = HSDKCreateLock();
+        stringsLockSet = 1;
+    }
+
+    if (!ringExitKeySet) {
+#ifdef _WIN32
+        ringExitKey = FlsAlloc(TraceRingRelease);
+        ringExitKeySet = (ringExitKey != FLS_OUT_OF_INDEXES);
+#else
+        ringExitKeySet = (pthread_key_create(&ringExitKey, TraceRingRelease) == 0);
+#endif
+    }
+
+    /* A new file needs all the strings again. */
+    memset(stringWritten, 0, sizeof(stringWritten));
+    stringsSeen = (uint32_t)-1;
+
+    StoreRelease(&traceEnabled, 1);
+
+    return HSDK_ERROR_SUCCESS;
+}
+
+/*! *********************************************************************************
+ * \brief  Stop accepting records, write the pending ones and close the trace file.
+ *         The rings are kept, a thread may still hold a pointer to its own.
+ ********************************************************************************** */
+void TraceClose(void)
+{
+    if (traceFile == NULL) {
+        return;
+    }
+
+    StoreRelease(&traceEnabled, 0);
+    TraceDrain();
+
+    fclose(traceFile);
+    traceFile = NULL;
+}
+
+/*! *********************************************************************************
+ * \brief  Write the records of all the threads to the trace file, followed by the
+ *         strings interned since the last call. Called from the logger thread only.
+ *
+ * \return the number of records written
+ ********************************************************************************** */
+uint32_t TraceDrain(void)
+{
+    TraceRing *ring;
+    uint32_t drained = 0;
+
+    if (traceFile == NULL) {
+        return 0;
+    }
+
+    for (ring = (TraceRing *)LoadAcquirePtr((void *volatile *)&traceRings); ring != NULL; ring = ring->next) {
+        uint32_t tail = ring->tail;
+        uint32_t head = LoadAcquire(&ring->head);
+
+        while (tail != head) {
+            uint32_t index = tail & (TRACE_RING_RECORDS - 1);
+            uint32_t count = head - tail;
+
+            if (count > TRACE_RING_RECORDS - index) {
+                count = TRACE_RING_RECORDS - index;
+            }
+
+            fwrite(&ring->records[index], sizeof(TraceRecord), count, traceFile);
+            tail += count;
+            drained += count;
+        }
+
+        StoreRelease(&ring->tail, tail);
+
+        /* Reported by the logger thread, the owner may never find room again. */
+        if (LoadAcquire(&ring->dropped) != ring->reported) {
+            TraceRecord record;
+            uint32_t dropped = ring->dropped;
+
+            memset(&record, 0, sizeof(record));
+            record.timeNs = MonotonicTimeNs();
+            record.threadId = ring->threadId;
+            record.eventId = TRACE_EVT_DROPPED;
+            record.args[0] = dropped - ring->reported;
+
+            fwrite(&record, sizeof(record), 1, traceFile);
+            ring->reported = dropped;
+            drained++;
+        }
+    }
+
+    WriteStrings();
+
+    if (drained) {
+        fflush(traceFile);
+    }
+
+    return drained;
+}
+
+/*! *********************************************************************************
+ * \brief  Make no more records from the calling thread. Used by the logger thread,
+ *         whose periodic wake ups would otherwise fill the trace.
+ ********************************************************************************** */
+void TraceMuteThread(void)
+{
+    threadMuted = 1;
+}
+
+/*! *********************************************************************************
+ * \brief  Make a record in the ring of the calling thread. Lock free; the record is
+ *         counted as dropped if the ring is full.
+ *
+ * \param[in] eventId   one of TraceEventId, or an application identifier
+ * \param[in] a0..a3    the arguments of the record
+ ********************************************************************************** */
+void TraceEvent(uint16_t eventId, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    if (!LoadAcquire(&traceEnabled)) {
+        return;
+    }
+
+    TraceEventFromThread((uint32_t)HSDKThreadId(), eventId, a0, a1, a2, a3);
+}
+
+/*! *********************************************************************************
+ * \brief  Same as TraceEvent, for callers which already know their thread id.
+ ********************************************************************************** */
+void TraceEventFromThread(uint32_t threadId, uint16_t eventId, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    TraceRing *ring = threadRing;
+
+    if (threadMuted || !LoadAcquire(&traceEnabled)) {
+        return;
+    }
+
+    if (ring == NULL) {
+        ring = TraceRingForThread(threadId);
+
+        if (ring == NULL) {
+            return;
+        }
+    }
+
+    if (!RingPut(ring, threadId, eventId, a0, a1, a2, a3)) {
+        StoreRelease(&ring->dropped, ring->dropped + 1);
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  Record the size and the first bytes of a buffer.
+ *
+ * \param[in] tag   describes the buffer, interned with TraceString
+ * \param[in] data  the buffer
+ * \param[in] size  the size of the buffer
+ ********************************************************************************** */
+void TraceBytes(const char *tag, const uint8_t *data, uint32_t size)
+{
+    uint32_t head[2] = { 0, 0 };
+    uint32_t i;
+
+    if (!LoadAcquire(&traceEnabled) || threadMuted) {
+        return;
+    }
+
+    for (i = 0; i < size && i < 8; i++) {
+        head[i / 4] |= (uint32_t)data[i] << (8 * (i % 4));
+    }
+
+    TraceEvent(TRACE_EVT_BYTES, TraceString(tag), size, head[0], head[1]);
+}
+
+/*! *********************************************************************************
+ * \brief  Give the id of a string, to be used as a record argument. Equal strings
+ *         share an id; the text is written once per trace file.
+ *
+ * \param[in] s     the string
+ *
+ * \return the id of the string, 0 for NULL or when TRACE_MAX_STRINGS are in use
+ ********************************************************************************** */
+uint32_t TraceString(const char *s)
+{
+    uint32_t hash = 2166136261u;
+    uint32_t i, n;
+    const char *p;
+
+    if (s == NULL || !stringsLockSet) {
+        return 0;
+    }
+
+    /* FNV-1a */
+    for (p = s; *p; p++) {
+        hash = (hash ^ (uint8_t)*p) * 16777619u;
+    }
+
+    for (n = 0, i = hash & (TRACE_MAX_STRINGS - 1); n < TRACE_MAX_STRINGS; n++, i = (i + 1) & (TRACE_MAX_STRINGS - 1)) {
+        const char *str = (const char *)LoadAcquirePtr((void *volatile *)&strings[i].str);
+
+        if (str == NULL) {
+            char *copy;
+
+            HSDKAcquireLock(stringsLock);
+
+            if (strings[i].str != NULL) {
+                /* Taken meanwhile, check it. */
+                HSDKReleaseLock(stringsLock);
+                str = strings[i].str;
+            } else {
+                copy = strdup(s);
+
+                if (copy != NULL) {
+                    strings[i].hash = hash;
+                    StoreReleasePtr((void *volatile *)&strings[i].str, copy);
+                    StoreRelease(&stringsAdded, stringsAdded + 1);
+                }
+
+                HSDKReleaseLock(stringsLock);
+                return copy != NULL ? i + 1 : 0;
+            }
+        }
+
+        if (strings[i].hash == hash && strcmp(str, s) == 0) {
+            return i + 1;
+        }
+    }
+
+    return 0;
+}
+
+/************************************************************************************
+ *************************************************************************************
+ * Private functions
+ *************************************************************************************
+ ************************************************************************************/
+
+/*! *********************************************************************************
+ * \brief  Give the calling thread the ring of a thread which exited, or allocate one
+ *         and publish it to the logger thread. The rings are never freed, so their
+ *         number is bounded by the number of threads recording at the same time.
+ *         The records left by the previous owner carry its thread id and are still
+ *         written to the file.
+ ********************************************************************************** */
+static TraceRing *TraceRingForThread(uint32_t threadId)
+{
+    TraceRing *ring;
+    TraceRing *first;
+
+    for (ring = (TraceRing *)LoadAcquirePtr((void *volatile *)&traceRings); ring != NULL; ring = ring->next) {
+        if (!LoadAcquire(&ring->owned) && CompareExchange(&ring->owned, 0, 1)) {
+            break;
+        }
+    }
+
+    if (ring == NULL) {
+        ring = (TraceRing *)calloc(1, sizeof(TraceRing));
+
+        if (ring == NULL) {
+            return NULL;
+        }
+
+        ring->owned = 1;
+
+        do {
+            first = (TraceRing *)LoadAcquirePtr((void *volatile *)&traceRings);
+            ring->next = first;
+        } while (!CompareExchangePtr((void *volatile *)&traceRings, first, ring));
+    }
+
+    ring->threadId = threadId;
+    threadRing = ring;
+
+    if (ringExitKeySet) {
+#ifdef _WIN32
+        FlsSetValue(ringExitKey, ring);
+#else
+        pthread_setspecific(ringExitKey, ring);
+#endif
+    }
+
+    return ring;
+}
+
+/*! *********************************************************************************
+ * \brief  Called at the exit of a thread which made records, marks its ring free.
+ *
+ * \param[in] ring  the ring of the thread
+ ********************************************************************************** */
+#ifdef _WIN32
+static void WINAPI TraceRingRelease(void *ring)
+#else
+static void TraceRingRelease(void *ring)
+#endif
+{
+    if (ring != NULL) {
+        StoreRelease(&((TraceRing *)ring)->owned, 0);
+    }
+}
+
+/*! *********************************************************************************
+ * \brief  Append a record to a ring.
+ *
+ * \return 1 if the record was stored, 0 if the ring is full
+ ********************************************************************************** */
+static int RingPut(TraceRing *ring, uint32_t threadId, uint16_t eventId, uint32_t a0, uint32_t a1, uint32_t a2, uint32_t a3)
+{
+    uint32_t head = ring->head;
+    TraceRecord *record;
+
+    if (head - LoadAcquire(&ring->tail) >= TRACE_RING_RECORDS) {
+        return 0;
+    }
+
+    record = &ring->records[head & (TRACE_RING_RECORDS - 1)];
+    record->timeNs = MonotonicTimeNs();
+    record->threadId = threadId;
+    record->eventId = eventId;
+    record->reserved = 0;
+    record->args[0] = a0;
+    record->args[1] = a1;
+    record->args[2] = a2;
+    record->args[3] = a3;
+
+    StoreRelease(&ring->head, head + 1);
+
+    return 1;
+}
+
+/*! *********************************************************************************
+ * \brief  Write a TRACE_EVT_STRING record, followed by the text, for every string not
+ *         yet in the trace file.
+ ********************************************************************************** */
+static void WriteStrings(void)
+{
+    static const uint8_t padding[sizeof(TraceRecord)] = { 0 };
+    uint32_t added = LoadAcquire(&stringsAdded);
+    uint32_t i;
+
+    if (added == stringsSeen) {
+        return;
+    }
+
+    stringsSeen = added;
+
+    for (i = 0; i < TRACE_MAX_STRINGS; i++) {
+        const char *str = (const char *)LoadAcquirePtr((void *volatile *)&strings[i].str);
+        TraceRecord record;
+        uint32_t length;
+
+        if (str == NULL || stringWritten[i]) {
+            continue;
+        }
+
+        length = (uint32_t)strlen(str);
+
+        memset(&record, 0, sizeof(record));
+        record.eventId = TRACE_EVT_STRING;
+        record.args[0] = i + 1;
+        record.args[1] = length;
+
+        fwrite(&record, sizeof(record), 1, traceFile);
+        fwrite(str, 1, length, traceFile);
+        fwrite(padding, 1, (sizeof(TraceRecord) - length % sizeof(TraceRecord)) % sizeof(TraceRecord), traceFile);
+
+        stringWritten[i] = 1;
+    }
+}
@@ -16,6 +16,12 @@
 ************************************************************************************/
 #include "utils.h"
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
 /************************************************************************************
 *************************************************************************************
 * Private macros
@@ -278,6 +284,26 @@ ConfigParams *ParseConfig(void)
             params->timeoutAckMs = atoi(value);
         } else if (strcmp(name, "FsciRxAck") == 0) {
             params->fsciRxAck = atoi(value);
+        } else if (strcmp(name, "RxRingSize") == 0) {
+            params->rxRingSize = atoi(value);
+        } else if (strcmp(name, "FsciCursorFramer") == 0) {
+            params->fsciCursorFramer = atoi(value);
+        } else if (strcmp(name, "FramerBatchDispatch") == 0) {
+            params->framerBatchDispatch = atoi(value);
+        } else if (strcmp(name, "TxAckWindow") == 0) {
+            /* Clamped before the narrowing, the device caps the window further. */
+            int window = atoi(value);
+            params->txAckWindow = (window < 0) ? 0 : (window > UINT8_MAX) ? UINT8_MAX : (uint8_t)window;
+        } else if (strcmp(name, "TxCoalesceBytes") == 0) {
+            params->txCoalesceBytes = atoi(value);
+        } else if (strcmp(name, "TxCoalesceLatencyMs") == 0) {
+            params->txCoalesceLatencyMs = atoi(value);
+        } else if (strcmp(name, "SpiBulkReadBytes") == 0) {
+            params->spiBulkReadBytes = atoi(value);
+        } else if (strcmp(name, "ReactorThreads") == 0) {
+            params->reactorThreads = atoi(value);
+        } else if (strcmp(name, "ReactorPinCpus") == 0) {
+            params->reactorPinCpus = atoi(value);
         } else {
             printf("WARNING: %s/%s: Unknown name/value pair!\n", name, value);
         }
@@ -313,3 +339,30 @@ char *UARTSystemPath(char *uartPath)
 #endif
     return uartPath;
 }
+
+/*! *********************************************************************************
+* \brief  Reads a monotonic clock which is not slewed by NTP, used to timestamp the
+*         frames received from and sent to the devices.
+*
+* \return the current time in nanoseconds, from an arbitrary origin
+********************************************************************************** */
+uint64_t MonotonicTimeNs(void)
+{
+#ifdef _WIN32
+    LARGE_INTEGER counter, frequency;
+
+    QueryPerformanceCounter(&counter);
+    QueryPerformanceFrequency(&frequency);
+    return (uint64_t)(counter.QuadPart / frequency.QuadPart) * 1000000000 +
+           (uint64_t)(counter.QuadPart % frequency.QuadPart) * 1000000000 / frequency.QuadPart;
+#else
+    struct timespec now;
+
+#ifdef CLOCK_MONOTONIC_RAW
+    clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+#else
+    clock_gettime(CLOCK_MONOTONIC, &now);
+#endif
+    return (uint64_t)now.tv_sec * 1000000000 + (uint64_t)now.tv_nsec;
+#endif
+}
@@ -11,12 +11,15 @@ target_sources(${MCUX_SDK_PROJECT_NAME} PRIVATE
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/sys/EventManager.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/sys/MessageQueue.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/sys/RawFrame.c
+  ${CMAKE_CURRENT_LIST_DIR}/hsdk/sys/RingQueue.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/sys/hsdkEvent.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/sys/hsdkFile.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/sys/hsdkLock.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/sys/hsdkLogger.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/sys/hsdkSemaphore.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/sys/hsdkThread.c
+  ${CMAKE_CURRENT_LIST_DIR}/hsdk/sys/hsdkTrace.c
+  ${CMAKE_CURRENT_LIST_DIR}/hsdk/sys/hsdkReactor.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/sys/utils.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/physical/PCAP/PCAPDevice.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/physical/SPI/SPIConfiguration.c
@@ -24,8 +27,13 @@ target_sources(${MCUX_SDK_PROJECT_NAME} PRIVATE
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/physical/UART/UARTConfiguration.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/physical/UART/UARTDevice.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/physical/UART/UARTDiscovery.c
+  ${CMAKE_CURRENT_LIST_DIR}/hsdk/physical/Virtual/VirtualBoard.c
+  ${CMAKE_CURRENT_LIST_DIR}/hsdk/physical/Virtual/VirtualDevice.c
+  ${CMAKE_CURRENT_LIST_DIR}/hsdk/protocol/FSCI/FSCICursorFramer.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/protocol/FSCI/FSCIFrame.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk/protocol/FSCI/FSCIFramer.c
+  ${CMAKE_CURRENT_LIST_DIR}/hsdk/protocol/HCI/HCIFrame.c
+  ${CMAKE_CURRENT_LIST_DIR}/hsdk/protocol/HCI/HCIFramer.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk-c/demo/HeartRateSensor.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk-c/src/cmd_ble.c
   ${CMAKE_CURRENT_LIST_DIR}/hsdk-c/src/evt_ble.c